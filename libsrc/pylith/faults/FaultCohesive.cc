@@ -34,6 +34,7 @@
 
 #include <utility> // USES std::pair
 #include <map> // USES std::map
+#include <vector> // USES std::vector
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
@@ -222,65 +223,92 @@ void
 pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh) {
     PYLITH_METHOD_BEGIN;
 
-    assert(mesh);
-    assert(_surfaceLabelName.length() > 0);
+    FaultCohesive* faults[1] = { this };
+    adjustTopologyMultiple(mesh, faults, 1);
 
-    try {
-        pylith::topology::Mesh faultMesh;
-
-        // Get group of vertices associated with fault
-        PetscDM dmMesh = mesh->getDM();assert(dmMesh);
-
-        PetscDMLabel surfaceLabel = NULL;
-        PetscBool hasLabel = PETSC_FALSE;
-        PetscInt depth, gdepth, dim;
-        PetscMPIInt rank;
-        PetscErrorCode err;
-        // We do not have labels on all ranks until after distribution
-        err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
-        err = DMHasLabel(dmMesh, _surfaceLabelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
-        if (!hasLabel && !rank) {
-            std::ostringstream msg;
-            msg << "Mesh missing group of vertices '" << _surfaceLabelName
-                << "' for fault interface condition.";
-            throw std::runtime_error(msg.str());
-        } // if
-        err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
-        err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh->getComm());PYLITH_CHECK_ERROR(err);
-        err = DMGetLabel(dmMesh, _surfaceLabelName.c_str(), &surfaceLabel);PYLITH_CHECK_ERROR(err);
-        TopologyOps::createFault(&faultMesh, *mesh, surfaceLabel, _surfaceLabelValue);
-        PetscDMLabel buriedEdgesLabel = NULL;
-
-        // We do not have labels on all ranks until after distribution
-        if ((_buriedEdgesLabelName.length() > 0) && !rank) {
-            err = DMGetLabel(dmMesh, _buriedEdgesLabelName.c_str(), &buriedEdgesLabel);PYLITH_CHECK_ERROR(err);
-            if (!buriedEdgesLabel) {
+    PYLITH_METHOD_END;
+} // adjustTopology
+
+
+// ------------------------------------------------------------------------------------------------
+// Adjust mesh topology for several faults.
+void
+pylith::faults::FaultCohesive::adjustTopologyMultiple(topology::Mesh* const mesh,
+                                                      FaultCohesive* faults[],
+                                                      const int numFaults) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(!numFaults || faults);
+
+    std::vector<FaultCohesive*> faultsRemaining(faults, faults+numFaults);
+    while (!faultsRemaining.empty()) {
+        const size_t numRemaining = faultsRemaining.size();
+        std::vector<pylith::topology::Mesh*> faultMeshes(numRemaining, NULL);
+        try {
+            // Fault meshes must be created from the current mesh, which changes with each pass.
+            std::vector<TopologyOps::CohesiveFault> cohesiveFaults(numRemaining);
+            for (size_t i = 0; i < numRemaining; ++i) {
+                assert(faultsRemaining[i]);
+                faultMeshes[i] = new pylith::topology::Mesh();
+                PetscDMLabel buriedEdgesLabel = NULL;
+                try {
+                    faultsRemaining[i]->_createFaultMesh(faultMeshes[i], mesh, &buriedEdgesLabel);
+                } catch (const std::exception& err) {
+                    std::ostringstream msg;
+                    msg << "Error occurred while adjusting topology to create cohesive cells for fault '"
+                        << faultsRemaining[i]->_surfaceLabelName << "'.\n"
+                        << err.what();
+                    throw std::runtime_error(msg.str());
+                } // try/catch
+                cohesiveFaults[i].faultMesh = faultMeshes[i];
+                cohesiveFaults[i].faultBdLabel = buriedEdgesLabel;
+                cohesiveFaults[i].faultBdLabelValue = faultsRemaining[i]->_buriedEdgesLabelValue;
+                cohesiveFaults[i].cohesiveLabelValue = faultsRemaining[i]->getCohesiveLabelValue();
+            } // for
+
+            std::vector<bool> inserted;
+            try {
+                TopologyOps::createMultiple(mesh, cohesiveFaults, &inserted);
+
+                // Check consistency of mesh.
+                pylith::topology::MeshOps::checkTopology(*mesh);
+            } catch (const std::exception& err) {
                 std::ostringstream msg;
-                msg << "Could not find label '" << _buriedEdgesLabelName << "' marking buried edges for fault '" << _surfaceLabelName << "'.";
+                msg << "Error occurred while adjusting topology to create cohesive cells for faults";
+                for (size_t i = 0; i < numRemaining; ++i) {
+                    msg << (i ? ", '" : " '") << faultsRemaining[i]->_surfaceLabelName << "'";
+                } // for
+                msg << ".\n" << err.what();
                 throw std::runtime_error(msg.str());
-            } // if
-        } // if
-        TopologyOps::create(mesh, faultMesh, buriedEdgesLabel, _buriedEdgesLabelValue, getCohesiveLabelValue());
+            } // try/catch
 
-        // Check consistency of mesh.
-        pylith::topology::MeshOps::checkTopology(*mesh);
-        pylith::topology::MeshOps::checkTopology(faultMesh);
+            std::vector<FaultCohesive*> faultsNext;
+            for (size_t i = 0; i < numRemaining; ++i) {
+                if (inserted[i]) {
+                    pylith::topology::MeshOps::checkTopology(*faultMeshes[i]);
 
-        pythia::journal::debug_t debug(PyreComponent::getName());
-        if (debug.state()) {
-            mesh->view("::ascii_info_detail");
-        } // if
-
-    } catch (const std::exception& err) {
-        std::ostringstream msg;
-        msg << "Error occurred while adjusting topology to create cohesive cells for fault '" << _surfaceLabelName << "'.\n"
-            << err.what();
-        throw std::runtime_error(msg.str());
-    } // try/catch
+                    pythia::journal::debug_t debug(faultsRemaining[i]->PyreComponent::getName());
+                    if (debug.state()) {
+                        mesh->view("::ascii_info_detail");
+                    } // if
+                } else {
+                    faultsNext.push_back(faultsRemaining[i]);
+                } // if/else
+                delete faultMeshes[i];faultMeshes[i] = NULL;
+            } // for
+            assert(faultsNext.size() < numRemaining);
+            faultsRemaining = faultsNext;
+        } catch (...) {
+            for (size_t i = 0; i < numRemaining; ++i) {
+                delete faultMeshes[i];faultMeshes[i] = NULL;
+            } // for
+            throw;
+        } // try/catch
+    } // while
 
     PYLITH_METHOD_END;
-} // adjustTopology
+} // adjustTopologyMultiple
 
 
 // ------------------------------------------------------------------------------------------------
@@ -426,4 +454,56 @@ pylith::faults::FaultCohesive::createIntegrator(const pylith::topology::Field& s
 } // Empty method
 
 
+// ------------------------------------------------------------------------------------------------
+// Create fault mesh from label marking fault surface.
+void
+pylith::faults::FaultCohesive::_createFaultMesh(pylith::topology::Mesh* faultMesh,
+                                                pylith::topology::Mesh* const mesh,
+                                                PetscDMLabel* buriedEdgesLabel) const {
+    PYLITH_METHOD_BEGIN;
+
+    assert(faultMesh);
+    assert(mesh);
+    assert(buriedEdgesLabel);
+    assert(_surfaceLabelName.length() > 0);
+
+    PetscDM dmMesh = mesh->getDM();assert(dmMesh);
+    PetscDMLabel surfaceLabel = NULL;
+    PetscBool hasLabel = PETSC_FALSE, hasLabelAny = PETSC_FALSE;
+    PetscErrorCode err;
+
+    // A distributed mesh only has the label on processes with points on the fault.
+    err = DMHasLabel(dmMesh, _surfaceLabelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&hasLabel, &hasLabelAny, 1, MPIU_BOOL, MPI_LOR, mesh->getComm());PYLITH_CHECK_ERROR(err);
+    if (!hasLabelAny) {
+        std::ostringstream msg;
+        msg << "Mesh missing group of vertices '" << _surfaceLabelName
+            << "' for fault interface condition.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!hasLabel) {
+        err = DMCreateLabel(dmMesh, _surfaceLabelName.c_str());PYLITH_CHECK_ERROR(err);
+    } // if
+    err = DMGetLabel(dmMesh, _surfaceLabelName.c_str(), &surfaceLabel);PYLITH_CHECK_ERROR(err);
+    TopologyOps::createFault(faultMesh, *mesh, surfaceLabel, _surfaceLabelValue);
+
+    *buriedEdgesLabel = NULL;
+    if (_buriedEdgesLabelName.length() > 0) {
+        err = DMHasLabel(dmMesh, _buriedEdgesLabelName.c_str(), &hasLabel);PYLITH_CHECK_ERROR(err);
+        err = MPI_Allreduce(&hasLabel, &hasLabelAny, 1, MPIU_BOOL, MPI_LOR, mesh->getComm());PYLITH_CHECK_ERROR(err);
+        if (!hasLabelAny) {
+            std::ostringstream msg;
+            msg << "Could not find label '" << _buriedEdgesLabelName << "' marking buried edges for fault '" << _surfaceLabelName << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        if (!hasLabel) {
+            err = DMCreateLabel(dmMesh, _buriedEdgesLabelName.c_str());PYLITH_CHECK_ERROR(err);
+        } // if
+        err = DMGetLabel(dmMesh, _buriedEdgesLabelName.c_str(), buriedEdgesLabel);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _createFaultMesh
+
+
 // End of file
@@ -138,6 +138,21 @@ public:
      */
     void adjustTopology(pylith::topology::Mesh* const mesh);
 
+    /** Adjust mesh topology for several faults.
+     *
+     * Faults that do not touch each other are inserted in a single pass over the mesh; faults that
+     * touch a fault inserted in the same pass (for example, a fault ending on another fault) are
+     * inserted in a subsequent pass. The mesh may be distributed.
+     *
+     * @param mesh[in] PETSc mesh.
+     * @param[in] faults Array of faults.
+     * @param[in] numFaults Number of faults.
+     */
+    static
+    void adjustTopologyMultiple(pylith::topology::Mesh* const mesh,
+                                FaultCohesive* faults[],
+                                const int numFaults);
+
     /** Create integrator and set kernels.
      *
      * @param[in] solution Solution field.
@@ -220,6 +235,19 @@ protected:
     // PRIVATE METHODS ////////////////////////////////////////////////////////////////////////////
 private:
 
+    /** Create fault mesh from label marking fault surface.
+     *
+     * Ranks without any points on the fault get an empty label so that this works on both serial
+     * and distributed meshes.
+     *
+     * @param[out] faultMesh Finite-element mesh of fault.
+     * @param[inout] mesh Finite-element mesh of domain.
+     * @param[out] buriedEdgesLabel Label marking buried edges of fault (NULL if none).
+     */
+    void _createFaultMesh(pylith::topology::Mesh* faultMesh,
+                          pylith::topology::Mesh* const mesh,
+                          PetscDMLabel* buriedEdgesLabel) const;
+
     inline
     static
     PetscErrorCode _zero(PetscInt dim,
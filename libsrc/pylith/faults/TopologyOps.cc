@@ -25,8 +25,72 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
 #include <iostream> // USES std::cout
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error, std::logic_error
 #include <cassert> // USES assert()
 
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        class _TopologyOps {
+public:
+
+            /// Name of temporary label marking fault faces with index of fault.
+            static const char* faultIndexLabelName;
+
+            /** Create label with the points to split for a fault.
+             *
+             * The label includes the fault points and the cells (and their faces, edges, and vertices)
+             * adjacent to the fault on each side. In parallel, the label values of points shared among
+             * processes are made consistent with the owner.
+             *
+             * @param[in] mesh Finite-element mesh.
+             * @param[in] fault Fault information.
+             * @returns Label with points to split (caller is responsible for destroying it).
+             */
+            static
+            PetscDMLabel completeCohesiveLabel(const pylith::topology::Mesh* mesh,
+                                               const TopologyOps::CohesiveFault& fault);
+
+            /** Make label values of points shared among processes consistent.
+             *
+             * If the owner (root) of a shared point marks it, the owner's value is used on every process.
+             * Otherwise the value from the lowest rank that marks the point is used. The resulting values
+             * are broadcast to the leaves, so a point marked on any process sharing it is marked with the
+             * same value on all of them, independent of the order of communication.
+             *
+             * @param[in] dm PETSc DM with point SF.
+             * @param[inout] label Label to synchronize.
+             */
+            static
+            void synchronizeLabel(PetscDM dm,
+                                  PetscDMLabel label);
+
+            /** Check whether any point is marked in both labels.
+             *
+             * @param[in] labelA First label.
+             * @param[in] labelB Second label.
+             * @returns True if labels share a point, false otherwise.
+             */
+            static
+            bool labelsOverlap(PetscDMLabel labelA,
+                               PetscDMLabel labelB);
+
+            /** Add points and values in label to another label.
+             *
+             * @param[inout] labelDest Label to add points to.
+             * @param[in] labelSrc Label with points to add.
+             */
+            static
+            void mergeLabels(PetscDMLabel labelDest,
+                             PetscDMLabel labelSrc);
+
+        }; // _TopologyOps
+        const char* _TopologyOps::faultIndexLabelName = "pylith_fault_index";
+    } // faults
+} // pylith
+
+
 // ------------------------------------------------------------------------------------------------
 void
 pylith::faults::TopologyOps::createFault(pylith::topology::Mesh* faultMesh,
@@ -115,13 +179,43 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
                                     PetscDMLabel faultBdLabel,
                                     const int faultBdLabelValue,
                                     const int cohesiveLabelValue) {
+    PYLITH_METHOD_BEGIN;
+
+    std::vector<CohesiveFault> faults(1);
+    faults[0].faultMesh = &faultMesh;
+    faults[0].faultBdLabel = faultBdLabel;
+    faults[0].faultBdLabelValue = faultBdLabelValue;
+    faults[0].cohesiveLabelValue = cohesiveLabelValue;
+
+    std::vector<bool> inserted;
+    createMultiple(mesh, faults, &inserted);
+    assert(1 == inserted.size() && inserted[0]);
+
+    PYLITH_METHOD_END;
+} // create
+
+
+// ------------------------------------------------------------------------------------------------
+void
+pylith::faults::TopologyOps::createMultiple(pylith::topology::Mesh* mesh,
+                                            const std::vector<CohesiveFault>& faults,
+                                            std::vector<bool>* inserted) {
+    PYLITH_METHOD_BEGIN;
+
     assert(mesh);
+    assert(inserted);
     PetscDM sdm = NULL;
     PetscDM dm = mesh->getDM();assert(dm);
-    PetscDMLabel subpointMap = NULL, label = NULL, mlabel = NULL;
-    PetscInt dim, cMax, cStart, cEnd, numCohesiveCellsOld;
+    PetscDMLabel label = NULL, faultLabel = NULL, mlabel = NULL;
+    PetscInt cMax, cStart, cEnd, numCohesiveCellsOld;
     PetscErrorCode err;
 
+    const size_t numFaults = faults.size();
+    inserted->assign(numFaults, false);
+    if (!numFaults) {
+        PYLITH_METHOD_END;
+    } // if
+
     // Have to remember the old number of cohesive cells
     err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
     cMax = cStart;
@@ -129,108 +223,92 @@ pylith::faults::TopologyOps::create(pylith::topology::Mesh* mesh,
         if (pylith::topology::MeshOps::isCohesiveCell(dm, cell)) { break; }
     } // for
     numCohesiveCellsOld = cEnd - cMax;
-    // Create cohesive cells
-    err = DMPlexGetSubpointMap(faultMesh.getDM(), &subpointMap);PYLITH_CHECK_ERROR(err);
-    err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
-    err = DMLabelClearStratum(label, mesh->getDimension());PYLITH_CHECK_ERROR(err);
-    // Fix over-aggressive completion of boundary label
-    err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
-    if (faultBdLabel && (dim > 2)) {
-        PetscIS bdIS;
-        const PetscInt *bd;
-        PetscInt fStart, fEnd, n, i;
 
-        err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
-        err = DMLabelGetStratumIS(faultBdLabel, faultBdLabelValue, &bdIS);PYLITH_CHECK_ERROR(err);
-        err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
-        err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
-        for (i = 0; i < n; ++i) {
-            const PetscInt p = bd[i];
+    // Label for the combined set of points to split and label marking fault faces with the index of
+    // the fault so we can assign material label values to the new cohesive cells.
+    const char* faultLabelName = _TopologyOps::faultIndexLabelName;
+    err = DMCreateLabel(dm, faultLabelName);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, faultLabelName, &faultLabel);PYLITH_CHECK_ERROR(err);
+    const PetscInt faceDepth = mesh->getDimension() - 1;
+    for (size_t iFault = 0; iFault < numFaults; ++iFault) {
+        PetscDMLabel faultSplitLabel = _TopologyOps::completeCohesiveLabel(mesh, faults[iFault]);
+
+        // Skip faults whose split region touches the split region of a fault already in this pass.
+        PetscBool overlapLocal = PETSC_FALSE, overlap = PETSC_FALSE;
+        if (label) {
+            overlapLocal = _TopologyOps::labelsOverlap(faultSplitLabel, label) ? PETSC_TRUE : PETSC_FALSE;
+        } // if
+        err = MPI_Allreduce(&overlapLocal, &overlap, 1, MPIU_BOOL, MPI_LOR, mesh->getComm());PYLITH_CHECK_ERROR(err);
+        if (overlap) {
+            err = DMLabelDestroy(&faultSplitLabel);PYLITH_CHECK_ERROR(err);
+            continue;
+        } // if
 
-            // Remove faces
-            if ((p >= fStart) && (p < fEnd)) {
-                const PetscInt *edges,   *verts, *supportA, *supportB;
-                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, val, bval, e, s;
-                PetscBool found = PETSC_FALSE;
+        // Mark fault faces with fault index.
+        PetscIS facesIS = NULL;
+        err = DMLabelGetStratumIS(faultSplitLabel, faceDepth, &facesIS);PYLITH_CHECK_ERROR(err);
+        if (facesIS) {
+            PetscInt numFaces = 0;
+            const PetscInt* faces = NULL;
+            err = ISGetLocalSize(facesIS, &numFaces);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(facesIS, &faces);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iFace = 0; iFace < numFaces; ++iFace) {
+                err = DMLabelSetValue(faultLabel, faces[iFace], PetscInt(iFault));PYLITH_CHECK_ERROR(err);
+            } // for
+            err = ISRestoreIndices(facesIS, &faces);PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&facesIS);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        if (!label) {
+            label = faultSplitLabel;
+        } else {
+            _TopologyOps::mergeLabels(label, faultSplitLabel);
+            err = DMLabelDestroy(&faultSplitLabel);PYLITH_CHECK_ERROR(err);
+        } // if/else
+        (*inserted)[iFault] = true;
+    } // for
+    assert((*inserted)[0]);
 
-                err = DMLabelClearValue(faultBdLabel, p, faultBdLabelValue);PYLITH_CHECK_ERROR(err);
-                // Remove the cross edge
-                err = DMPlexGetCone(dm, p, &edges);PYLITH_CHECK_ERROR(err);
-                err = DMPlexGetConeSize(dm, p, &numEdges);PYLITH_CHECK_ERROR(err);
-                if (numEdges != 3) {
-                    std::ostringstream msg;
-                    msg << "Internal error while creating fault mesh. Face "<<p<<" has "<<numEdges<<" edges != 3.";
-                    throw std::logic_error(msg.str());
-                }
-                for (e = 0; e < numEdges; ++e) {
-                    err = DMPlexGetCone(dm, edges[e], &verts);PYLITH_CHECK_ERROR(err);
-                    err = DMPlexGetConeSize(dm, edges[e], &numVerts);PYLITH_CHECK_ERROR(err);
-                    if (numVerts != 2) {
-                        std::ostringstream msg;
-                        msg << "Internal error while creating fault mesh. Edge "<<edges[e]<<" has "<<numVerts<<" vertices != 2.";
-                        throw std::logic_error(msg.str());
-                    }
-                    err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
-                    err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
-                    for (s = 0, sA = 0; s < supportSizeA; ++s) {
-                        err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
-                        err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sA;}
-                    }
-                    err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
-                    err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
-                    for (s = 0, sB = 0; s < supportSizeB; ++s) {
-                        err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
-                        err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
-                        if (( val >= 0) && ( bval >= 0) ) { ++sB;}
-                    }
-                    if ((sA > 2) && (sB > 2)) {
-                        err = DMLabelClearValue(faultBdLabel, edges[e], faultBdLabelValue);PYLITH_CHECK_ERROR(err);
-                        found = PETSC_TRUE;
-                        break;
-                    }
-                }
-                if (!found) {
-                    std::ostringstream msg;
-                    msg << "Internal error while creating fault mesh. Face "<<p<<" has no cross edge.";
-                    throw std::logic_error(msg.str());
-                }
-            }
-        }
-        err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
-        err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
-    }
-    // Completes the set of cells scheduled to be replaced
-    err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, faultBdLabelValue, PETSC_FALSE, faultMesh.getDM());PYLITH_CHECK_ERROR(err);
     err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+    err = DMRemoveLabel(dm, faultLabelName, NULL);PYLITH_CHECK_ERROR(err);
 
     const char* interfaceLabelName = pylith::topology::Mesh::cells_label_name;
     err = DMGetLabel(sdm, interfaceLabelName, &mlabel);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(sdm, faultLabelName, &faultLabel);PYLITH_CHECK_ERROR(err);
     if (mlabel) {
         err = DMPlexGetHeightStratum(sdm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
         cMax = cStart;
         for (PetscInt cell = cStart; cell < cEnd; ++cell, ++cMax) {
             if (pylith::topology::MeshOps::isCohesiveCell(sdm, cell)) { break; }
         }
-        assert(cStart == cEnd || cEnd > cMax + numCohesiveCellsOld);
+        assert(cStart == cEnd || cEnd >= cMax + numCohesiveCellsOld);
         for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
-            PetscInt onBd;
-
-            /* Eliminate hybrid cells on the boundary of the split from cohesive label,
-             * they are marked with -(cell number) since the hybrid cell number aliases vertices in the old mesh */
-            err = DMLabelGetValue(label, -cell, &onBd);PYLITH_CHECK_ERROR(err);
-            // if (onBd == dim) continue;
-            err = DMLabelSetValue(mlabel, cell, cohesiveLabelValue);PYLITH_CHECK_ERROR(err);
-        }
-    }
-    err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+            // Faces in the cone of the cohesive cell are fault faces; get index of fault from either one.
+            const PetscInt* cone = NULL;
+            PetscInt faultIndex = -1;
+            err = DMPlexGetCone(sdm, cell, &cone);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iSide = 0; iSide < 2 && faultIndex < 0; ++iSide) {
+                err = DMLabelGetValue(faultLabel, cone[iSide], &faultIndex);PYLITH_CHECK_ERROR(err);
+            } // for
+            if ((faultIndex < 0) || (size_t(faultIndex) >= numFaults)) {
+                std::ostringstream msg;
+                msg << "Internal error while creating cohesive cells. Could not find fault for cohesive cell " << cell << ".";
+                throw std::logic_error(msg.str());
+            } // if
+            err = DMLabelSetValue(mlabel, cell, faults[faultIndex].cohesiveLabelValue);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // if
+    err = DMRemoveLabel(sdm, faultLabelName, NULL);PYLITH_CHECK_ERROR(err);
 
     PetscReal lengthScale = 1.0;
     err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
     err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
     err = DMViewFromOptions(sdm, NULL, "-pylith_cohesive_dm_view");PYLITH_CHECK_ERROR(err);
     mesh->setDM(sdm);
-} // create
+
+    PYLITH_METHOD_END;
+} // createMultiple
 
 
 // ------------------------------------------------------------------------------------------------
@@ -464,4 +542,261 @@ pylith::faults::TopologyOps::getAdjacentCells(PylithInt* adjacentCellNegative,
 } // getAdjacentCells
 
 
+// ------------------------------------------------------------------------------------------------
+// Create label with points to split for a fault.
+PetscDMLabel
+pylith::faults::_TopologyOps::completeCohesiveLabel(const pylith::topology::Mesh* mesh,
+                                                    const TopologyOps::CohesiveFault& fault) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(fault.faultMesh);
+    PetscDM dm = mesh->getDM();assert(dm);
+    PetscDMLabel subpointMap = NULL, label = NULL;
+    PetscDMLabel faultBdLabel = fault.faultBdLabel;
+    const PetscInt faultBdLabelValue = fault.faultBdLabelValue;
+    PetscInt dim;
+    PetscErrorCode err;
+
+    err = DMPlexGetSubpointMap(fault.faultMesh->getDM(), &subpointMap);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
+    err = DMLabelClearStratum(label, mesh->getDimension());PYLITH_CHECK_ERROR(err);
+    err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
+    // Fix over-aggressive completion of boundary label
+    if (faultBdLabel && (dim > 2)) {
+        PetscIS bdIS;
+        const PetscInt *bd;
+        PetscInt fStart, fEnd, n, i;
+
+        err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
+        err = DMLabelGetStratumIS(faultBdLabel, faultBdLabelValue, &bdIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+        for (i = 0; i < n; ++i) {
+            const PetscInt p = bd[i];
+
+            // Remove faces
+            if ((p >= fStart) && (p < fEnd)) {
+                const PetscInt *edges,   *verts, *supportA, *supportB;
+                PetscInt numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, val, bval, e, s;
+                PetscBool found = PETSC_FALSE;
+
+                err = DMLabelClearValue(faultBdLabel, p, faultBdLabelValue);PYLITH_CHECK_ERROR(err);
+                // Remove the cross edge
+                err = DMPlexGetCone(dm, p, &edges);PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetConeSize(dm, p, &numEdges);PYLITH_CHECK_ERROR(err);
+                if (numEdges != 3) {
+                    std::ostringstream msg;
+                    msg << "Internal error while creating fault mesh. Face "<<p<<" has "<<numEdges<<" edges != 3.";
+                    throw std::logic_error(msg.str());
+                }
+                for (e = 0; e < numEdges; ++e) {
+                    err = DMPlexGetCone(dm, edges[e], &verts);PYLITH_CHECK_ERROR(err);
+                    err = DMPlexGetConeSize(dm, edges[e], &numVerts);PYLITH_CHECK_ERROR(err);
+                    if (numVerts != 2) {
+                        std::ostringstream msg;
+                        msg << "Internal error while creating fault mesh. Edge "<<edges[e]<<" has "<<numVerts<<" vertices != 2.";
+                        throw std::logic_error(msg.str());
+                    }
+                    err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
+                    err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
+                    for (s = 0, sA = 0; s < supportSizeA; ++s) {
+                        err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
+                        err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
+                        if (( val >= 0) && ( bval >= 0) ) { ++sA;}
+                    }
+                    err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
+                    err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
+                    for (s = 0, sB = 0; s < supportSizeB; ++s) {
+                        err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
+                        err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
+                        if (( val >= 0) && ( bval >= 0) ) { ++sB;}
+                    }
+                    if ((sA > 2) && (sB > 2)) {
+                        err = DMLabelClearValue(faultBdLabel, edges[e], faultBdLabelValue);PYLITH_CHECK_ERROR(err);
+                        found = PETSC_TRUE;
+                        break;
+                    }
+                }
+                if (!found) {
+                    std::ostringstream msg;
+                    msg << "Internal error while creating fault mesh. Face "<<p<<" has no cross edge.";
+                    throw std::logic_error(msg.str());
+                }
+            }
+        }
+        err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+    }
+    // Completes the set of cells scheduled to be replaced
+    err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, faultBdLabelValue, PETSC_FALSE, fault.faultMesh->getDM());PYLITH_CHECK_ERROR(err);
+    synchronizeLabel(dm, label);
+
+    PYLITH_METHOD_RETURN(label);
+} // completeCohesiveLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Make label values of points shared among processes consistent.
+void
+pylith::faults::_TopologyOps::synchronizeLabel(PetscDM dm,
+                                               PetscDMLabel label) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(dm);
+    assert(label);
+    PetscErrorCode err;
+
+    PetscSF sf = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sf, &numRoots, &numLeaves, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    PetscMPIInt commSize = 1;
+    err = MPI_Comm_size(PetscObjectComm((PetscObject)dm), &commSize);PYLITH_CHECK_ERROR(err);
+    if ((1 == commSize) || (numRoots < 0)) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Pair each value with a priority and reduce with MPI_MINLOC, which picks the pair with the
+    // smallest priority: the owner's own value (priority -1) wins over values from leaves, and among
+    // leaves the lowest rank wins. Unmarked points have the largest priority.
+    PetscMPIInt commRank = 0;
+    err = MPI_Comm_rank(PetscObjectComm((PetscObject)dm), &commRank);PYLITH_CHECK_ERROR(err);
+    const PetscInt unmarked = PETSC_MAX_INT;
+    PetscInt defaultValue = -1;
+    err = DMLabelGetDefaultValue(label, &defaultValue);PYLITH_CHECK_ERROR(err);
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt chartSize = pEnd - pStart;
+    std::vector<PetscInt> rootValues(2*chartSize);
+    std::vector<PetscInt> leafValues(2*chartSize);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        PetscInt value = defaultValue;
+        err = DMLabelGetValue(label, p, &value);PYLITH_CHECK_ERROR(err);
+        const bool isMarked = value != defaultValue;
+        rootValues[2*(p-pStart)+0] = isMarked ? -1 : unmarked;
+        rootValues[2*(p-pStart)+1] = value;
+        leafValues[2*(p-pStart)+0] = isMarked ? commRank : unmarked;
+        leafValues[2*(p-pStart)+1] = value;
+    } // for
+
+    PetscInt* rootArray = (chartSize > 0) ? &rootValues[0] : NULL;
+    PetscInt* leafArray = (chartSize > 0) ? &leafValues[0] : NULL;
+    err = PetscSFReduceBegin(sf, MPIU_2INT, leafArray, rootArray, MPI_MINLOC);PYLITH_CHECK_ERROR(err);
+    err = PetscSFReduceEnd(sf, MPIU_2INT, leafArray, rootArray, MPI_MINLOC);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastBegin(sf, MPIU_2INT, rootArray, leafArray, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sf, MPIU_2INT, rootArray, leafArray, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+
+    // Leaves take the broadcast values; all other points keep the reduced root values.
+    const PetscInt* leafPoints = NULL;
+    err = PetscSFGetGraph(sf, NULL, NULL, &leafPoints, NULL);PYLITH_CHECK_ERROR(err);
+    std::vector<bool> isLeaf(chartSize, false);
+    for (PetscInt i = 0; i < numLeaves; ++i) {
+        const PetscInt p = leafPoints ? leafPoints[i] : i;
+        isLeaf[p-pStart] = true;
+    } // for
+
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        const PetscInt* pair = isLeaf[p-pStart] ? &leafValues[2*(p-pStart)] : &rootValues[2*(p-pStart)];
+        if (pair[0] == unmarked) { continue; }
+        const PetscInt valueNew = pair[1];
+        PetscInt value = defaultValue;
+        err = DMLabelGetValue(label, p, &value);PYLITH_CHECK_ERROR(err);
+        if (value == valueNew) { continue; }
+        if (value != defaultValue) {
+            err = DMLabelClearValue(label, p, value);PYLITH_CHECK_ERROR(err);
+        } // if
+        err = DMLabelSetValue(label, p, valueNew);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // synchronizeLabel
+
+
+// ------------------------------------------------------------------------------------------------
+// Check whether any point is marked in both labels.
+bool
+pylith::faults::_TopologyOps::labelsOverlap(PetscDMLabel labelA,
+                                            PetscDMLabel labelB) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(labelA);
+    assert(labelB);
+    PetscErrorCode err;
+
+    PetscInt defaultValueB = -1;
+    err = DMLabelGetDefaultValue(labelB, &defaultValueB);PYLITH_CHECK_ERROR(err);
+
+    bool overlap = false;
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMLabelGetValueIS(labelA, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < numValues && !overlap; ++iValue) {
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(labelA, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+        if (!pointsIS) { continue; }
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            PetscInt valueB = defaultValueB;
+            err = DMLabelGetValue(labelB, points[iPoint], &valueB);PYLITH_CHECK_ERROR(err);
+            if (valueB != defaultValueB) {
+                overlap = true;
+                break;
+            } // if
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(overlap);
+} // labelsOverlap
+
+
+// ------------------------------------------------------------------------------------------------
+// Add points and values in label to another label.
+void
+pylith::faults::_TopologyOps::mergeLabels(PetscDMLabel labelDest,
+                                          PetscDMLabel labelSrc) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(labelDest);
+    assert(labelSrc);
+    PetscErrorCode err;
+
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMLabelGetValueIS(labelSrc, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(labelSrc, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+        if (!pointsIS) { continue; }
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+            err = DMLabelSetValue(labelDest, points[iPoint], values[iValue]);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // mergeLabels
+
+
 // End of file
@@ -29,6 +29,7 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include <set> // USES std::set
+#include <vector> // USES std::vector
 
 // TopologyOps ----------------------------------------------------------
 /// Helper object for creation of cohesive cells.
@@ -38,6 +39,14 @@ public:
 
     typedef std::set < PetscInt > PointSet;
 
+    /// Information needed to insert cohesive cells for a fault.
+    struct CohesiveFault {
+        const topology::Mesh* faultMesh; ///< Fault mesh created by createFault().
+        PetscDMLabel faultBdLabel; ///< Label marking buried edges of fault (may be NULL).
+        int faultBdLabelValue; ///< Value of label marking buried edges of fault.
+        int cohesiveLabelValue; ///< Material label value for cohesive cells.
+    }; // CohesiveFault
+
     // PUBLIC METHODS /////////////////////////////////////////////////////
 public:
 
@@ -67,6 +76,21 @@ public:
                 const int faultBdLabelValue,
                 const int cohesiveLabelValue);
 
+    /** Create cohesive cells for several faults in a single pass over the mesh.
+     *
+     * The mesh may be distributed. Faults whose split regions (fault points and adjacent cells on
+     * either side) touch the split region of a fault earlier in the list are skipped, because they
+     * must be inserted after the earlier fault has been split. The first fault is always inserted.
+     *
+     * @param[inout] mesh Finite-element mesh.
+     * @param[in] faults Faults to insert.
+     * @param[out] inserted Flags indicating which faults were inserted.
+     */
+    static
+    void createMultiple(topology::Mesh* mesh,
+                        const std::vector<CohesiveFault>& faults,
+                        std::vector<bool>* inserted);
+
     /** Create (distributed) fault mesh from cohesive cells.
      *
      * @param faultMesh Finite-element mesh of fault (output).
@@ -133,6 +133,14 @@ pylith::feassemble::Integrator::setLHSJacobianTriggers(const int value) {
 } // setLHSJacobianTriggers
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get LHS Jacobian triggers.
+int
+pylith::feassemble::Integrator::getLHSJacobianTriggers(void) const {
+    return _lhsJacobianTriggers;
+} // getLHSJacobianTriggers
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set LHS lumped Jacobian trigger.
 void
@@ -174,6 +182,39 @@ pylith::feassemble::Integrator::setState(const PylithReal t) {
 } // setState
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set subsets of cells for computing the RHS residual.
+void
+pylith::feassemble::Integrator::setRHSResidualCellSubsets(const std::vector<PetscIS>& subsets) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setRHSResidualCellSubsets(subsets="<<subsets.size()<<") empty method");
+
+    PYLITH_METHOD_END;
+} // setRHSResidualCellSubsets
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Select subset of cells for computing the RHS residual.
+void
+pylith::feassemble::Integrator::selectRHSResidualCellSubset(const int index) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("selectRHSResidualCellSubset(index="<<index<<") empty method");
+
+    PYLITH_METHOD_END;
+} // selectRHSResidualCellSubset
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Precompute cell geometry used in computing the residual.
+void
+pylith::feassemble::Integrator::precomputeResidualGeometry(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("precomputeResidualGeometry(void) empty method");
+
+    PYLITH_METHOD_END;
+} // precomputeResidualGeometry
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Update auxiliary fields at end of time step.
 void
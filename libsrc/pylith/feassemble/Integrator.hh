@@ -109,6 +109,12 @@ public:
      */
     void setLHSJacobianTriggers(const int value);
 
+    /** Get LHS Jacobian triggers.
+     *
+     * @returns Triggers for needing new LHS Jacobian.
+     */
+    int getLHSJacobianTriggers(void) const;
+
     /** Set LHS lumped Jacobian trigger.
      *
      * @param[in] value Triggers for needing new LHS lumped Jacobian.
@@ -180,6 +186,29 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData) = 0;
 
+    /** Set subsets of cells for computing the RHS residual, G(t,s), in multirate time stepping.
+     *
+     * Integrators that do not support subsets always use all of their cells.
+     *
+     * @param[in] subsets PETSc IS with cells for each subset.
+     */
+    virtual
+    void setRHSResidualCellSubsets(const std::vector<PetscIS>& subsets);
+
+    /** Select subset of cells for computing the RHS residual, G(t,s).
+     *
+     * @param[in] index Index of subset (-1 for all cells).
+     */
+    virtual
+    void selectRHSResidualCellSubset(const int index);
+
+    /** Precompute cell geometry used in computing the residual.
+     *
+     * Integrators that do not support precomputed geometry compute it on every residual evaluation.
+     */
+    virtual
+    void precomputeResidualGeometry(void);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -22,6 +22,7 @@
 
 #include "pylith/feassemble/UpdateStateVars.hh" // HOLDSA UpdateStateVars
 #include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
+#include "pylith/feassemble/TensorResidual.hh" // HOLDSA TensorResidual
 #include "pylith/problems/Physics.hh" // USES Physics
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
 #include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface::FaceEnum
@@ -97,7 +98,9 @@ pylith::feassemble::IntegratorDomain::IntegratorDomain(pylith::problems::Physics
     _materialMesh(NULL),
     _updateState(NULL),
     _jacobianValues(NULL),
-    _dsLabel(NULL) {
+    _dsLabel(NULL),
+    _tensorResidual(NULL),
+    _rhsResidualCellSubset(-1) {
     GenericComponent::setName("integratordomain");
 } // constructor
 
@@ -121,6 +124,13 @@ pylith::feassemble::IntegratorDomain::deallocate(void) {
     delete _updateState;_updateState = NULL;
     delete _jacobianValues;_jacobianValues = NULL;
     delete _dsLabel;_dsLabel = NULL;
+    delete _tensorResidual;_tensorResidual = NULL;
+
+    for (size_t i = 0; i < _rhsResidualCellSubsets.size(); ++i) {
+        PetscErrorCode err = ISDestroy(&_rhsResidualCellSubsets[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _rhsResidualCellSubsets.clear();
+    _rhsResidualCellSubset = -1;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -212,6 +222,37 @@ pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<Jacob
 } // setKernelsJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+// Set kernels for Jacobian and a separate preconditioner.
+void
+pylith::feassemble::IntegratorDomain::setKernelsJacobian(const std::vector<JacobianKernels>& kernels,
+                                                         const std::vector<JacobianKernels>& kernelsPrecond,
+                                                         const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setKernelsJacobian(# kernels="<<kernels.size()<<", # kernelsPrecond="<<kernelsPrecond.size()<<")");
+
+    setKernelsJacobian(kernels, solution);
+
+    PetscErrorCode err;
+    DSLabelAccess dsLabel(solution.getDM(), _labelName.c_str(), _labelValue);
+    for (size_t i = 0; i < kernelsPrecond.size(); ++i) {
+        if (kernelsPrecond[i].part != LHS) {
+            PYLITH_JOURNAL_LOGICERROR("Preconditioner kernels only supported for LHS Jacobian, not part " << kernelsPrecond[i].part <<".");
+        } // if
+        const PetscInt i_fieldTrial = solution.getSubfieldInfo(kernelsPrecond[i].subfieldTrial.c_str()).index;
+        const PetscInt i_fieldBasis = solution.getSubfieldInfo(kernelsPrecond[i].subfieldBasis.c_str()).index;
+        const PetscInt i_part = kernelsPrecond[i].part;
+        if (dsLabel.weakForm()) {
+            err = PetscWeakFormAddJacobianPreconditioner(dsLabel.weakForm(), dsLabel.label(), dsLabel.value(), i_fieldTrial,
+                                                         i_fieldBasis, i_part, kernelsPrecond[i].j0, kernelsPrecond[i].j1,
+                                                         kernelsPrecond[i].j2, kernelsPrecond[i].j3);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // setKernelsJacobian
+
+
 // ------------------------------------------------------------------------------------------------
 // Set kernels for Jacobian without finite-element integration.
 void
@@ -277,6 +318,11 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
     delete _dsLabel;_dsLabel = new DSLabelAccess(solution.getDM(), _labelName.c_str(), _labelValue);assert(_dsLabel);
     _dsLabel->removeOverlap();
 
+    delete _tensorResidual;_tensorResidual = new TensorResidual;assert(_tensorResidual);
+    if (!_tensorResidual->initialize(*_dsLabel)) {
+        delete _tensorResidual;_tensorResidual = NULL;
+    } // if
+
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing auxiliary field.");
@@ -418,13 +464,67 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
     assert(solution->getLocalVector());
     assert(residual->getLocalVector());
     PetscVec solutionDotVec = NULL;
-    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
-                                         solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    PetscIS cellsIS = (_rhsResidualCellSubset >= 0) ? _rhsResidualCellSubsets[_rhsResidualCellSubset] : _dsLabel->cellsIS();
+    if (!_tensorResidual || !_tensorResidual->computeResidual(key.part, cellsIS, t, solution->getLocalVector(), solutionDotVec,
+                                                               residual->getLocalVector())) {
+        err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, cellsIS, PETSC_MIN_REAL, solution->getLocalVector(),
+                                             solutionDotVec, t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    } // if
 
     PYLITH_METHOD_END;
 } // computeRHSResidual
 
 
+// ------------------------------------------------------------------------------------------------
+// Set subsets of cells for computing the RHS residual.
+void
+pylith::feassemble::IntegratorDomain::setRHSResidualCellSubsets(const std::vector<PetscIS>& subsets) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" setRHSResidualCellSubsets(subsets="<<subsets.size()<<")");
+
+    PetscErrorCode err;
+    for (size_t i = 0; i < _rhsResidualCellSubsets.size(); ++i) {
+        err = ISDestroy(&_rhsResidualCellSubsets[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _rhsResidualCellSubsets.resize(subsets.size());
+    _rhsResidualCellSubset = -1;
+
+    // Restrict each subset to the cells of this integrator.
+    assert(_dsLabel);
+    for (size_t i = 0; i < subsets.size(); ++i) {
+        _rhsResidualCellSubsets[i] = NULL;
+        err = ISIntersect(_dsLabel->cellsIS(), subsets[i], &_rhsResidualCellSubsets[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setRHSResidualCellSubsets
+
+
+// ------------------------------------------------------------------------------------------------
+// Select subset of cells for computing the RHS residual.
+void
+pylith::feassemble::IntegratorDomain::selectRHSResidualCellSubset(const int index) {
+    assert(index < int(_rhsResidualCellSubsets.size()));
+    _rhsResidualCellSubset = index;
+} // selectRHSResidualCellSubset
+
+
+// ------------------------------------------------------------------------------------------------
+// Precompute cell geometry used in computing the residual.
+void
+pylith::feassemble::IntegratorDomain::precomputeResidualGeometry(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" precomputeResidualGeometry(void)");
+
+    if (_tensorResidual) {
+        assert(_dsLabel);
+        _tensorResidual->precomputeGeometry(_dsLabel->cellsIS());
+    } // if
+
+    PYLITH_METHOD_END;
+} // precomputeResidualGeometry
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute LHS residual for F(t,s,\dot{s}).
 void
@@ -453,8 +553,11 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
     assert(solution->getLocalVector());
     assert(solutionDot->getLocalVector());
     assert(residual->getLocalVector());
-    err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
-                                         solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    if (!_tensorResidual || !_tensorResidual->computeResidual(key.part, _dsLabel->cellsIS(), t, solution->getLocalVector(),
+                                                               solutionDot->getLocalVector(), residual->getLocalVector())) {
+        err = DMPlexComputeResidual_Internal(_dsLabel->dm(), key, _dsLabel->cellsIS(), PETSC_MIN_REAL, solution->getLocalVector(),
+                                             solutionDot->getLocalVector(), t, residual->getLocalVector(), NULL);PYLITH_CHECK_ERROR(err);
+    } // if
 
     PYLITH_METHOD_END;
 } // computeLHSResidual
@@ -154,6 +154,19 @@ public:
     void setKernelsJacobian(const std::vector<JacobianKernels>& kernels,
                             const pylith::topology::Field& solution);
 
+    /** Set kernels for Jacobian and a separate preconditioner.
+     *
+     * The preconditioner kernels replace the Jacobian kernels when assembling the preconditioning
+     * matrix, so they must include all blocks needed by the preconditioner.
+     *
+     * @param[in] kernels Array of kernels for computing the Jacobian.
+     * @param[in] kernelsPrecond Array of kernels for computing the preconditioner.
+     * @param[in] solution Solution field.
+     */
+    void setKernelsJacobian(const std::vector<JacobianKernels>& kernels,
+                            const std::vector<JacobianKernels>& kernelsPrecond,
+                            const pylith::topology::Field& solution);
+
     /** Set kernels for Jacobian without finite-element integration.
      *
      * @param[in] kernelsJacobian Array of kernels for computing the Jacobian values without integration.
@@ -229,6 +242,24 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Set subsets of cells for computing the RHS residual, G(t,s), in multirate time stepping.
+     *
+     * @param[in] subsets PETSc IS with cells for each subset.
+     */
+    void setRHSResidualCellSubsets(const std::vector<PetscIS>& subsets);
+
+    /** Select subset of cells for computing the RHS residual, G(t,s).
+     *
+     * @param[in] index Index of subset (-1 for all cells).
+     */
+    void selectRHSResidualCellSubset(const int index);
+
+    /** Precompute cell geometry used in computing the residual.
+     *
+     * Only used with sum factorization on tensor-product cells.
+     */
+    void precomputeResidualGeometry(void);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -263,6 +294,10 @@ private:
     pylith::feassemble::UpdateStateVars* _updateState; ///< Data structure for layout needed to update state vars.
     pylith::feassemble::JacobianValues* _jacobianValues; ///< Jacobian values without finite-element integration.
     pylith::feassemble::DSLabelAccess* _dsLabel; ///< Information about integration (PETSc DS, Label, label value, etc).
+    pylith::feassemble::TensorResidual* _tensorResidual; ///< Sum factorization residual for tensor-product cells.
+
+    std::vector<PetscIS> _rhsResidualCellSubsets; ///< Subsets of cells for RHS residual (multirate time stepping).
+    int _rhsResidualCellSubset; ///< Index of current subset of cells for RHS residual (-1 for all cells).
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -141,6 +141,19 @@ public:
                                                      const char* labelName,
                                                      const int labelValue);
 
+            /** Get global indices of degrees of freedom in closure of point.
+             *
+             * @param[out] indices Global indices of degrees of freedom (grouped by field).
+             * @param[out] offsets Offset of first index for each field (size is number of fields + 1).
+             * @param[in] dm PETSc DM for solution.
+             * @param[in] point Point in mesh.
+             */
+            static
+            void getClosureIndices(std::vector<PetscInt>* indices,
+                                   std::vector<PetscInt>* offsets,
+                                   PetscDM dm,
+                                   const PetscInt point);
+
             static const PetscInt max_face_enums; ///< Maximum number of fault faces (negative, positive, fault).
             static const PetscInt num_face_enums; ///< Number of fault faces (negative, positive, fault).
             static const PetscInt max_parts; ///< Maximum number of equation parts.
@@ -596,6 +609,135 @@ pylith::feassemble::IntegratorInterface::computeLHSJacobianLumpedInv(pylith::top
 } // computeLHSJacobianLumpedInv
 
 
+// ------------------------------------------------------------------------------------------------
+// Add nonzero pattern of LHS Jacobian for cohesive cells to matrix preallocator.
+void
+pylith::feassemble::IntegratorInterface::addJacobianNonzeros(PetscMat matPreallocator,
+                                                             const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG(_labelName<<"="<<_labelValue<<" addJacobianNonzeros(matPreallocator="<<matPreallocator<<", solution="<<solution.getLabel()<<")");
+    typedef InterfacePatches::keysmap_t keysmap_t;
+
+    assert(matPreallocator);
+    assert(_integrationPatches);
+
+    const size_t numParts = 2;
+    const EquationPart equationParts[numParts] = {
+        pylith::feassemble::Integrator::LHS,
+        pylith::feassemble::Integrator::LHS_WEIGHTED,
+    };
+    const size_t numFaces = 3;
+    const FaceEnum faces[numFaces] = {
+        IntegratorInterface::NEGATIVE_FACE,
+        IntegratorInterface::POSITIVE_FACE,
+        IntegratorInterface::FAULT_FACE,
+    };
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();
+    PetscInt numFields = 0;
+    err = DMGetNumFields(dmSoln, &numFields);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> indicesFace[numFaces];
+    std::vector<PetscInt> offsetsFace[numFaces];
+    std::vector<PetscScalar> values;
+    const keysmap_t& keysmap = _integrationPatches->getKeys();
+    for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter) {
+        const PetscWeakForm weakForm = iter->second.cohesive.getWeakForm();
+        const PetscInt patchValue = iter->second.cohesive.getValue();
+        if (!weakForm) {
+            continue;
+        } // if
+
+        // Find blocks (face, trial subfield, basis subfield) with Jacobian or preconditioner kernels.
+        std::vector<bool> hasBlock(numFaces*numFields*numFields, false);
+        for (size_t iFace = 0; iFace < numFaces; ++iFace) {
+            const FEKernelKey& kernelKey = (IntegratorInterface::NEGATIVE_FACE == faces[iFace]) ? iter->second.negative :
+                                           (IntegratorInterface::POSITIVE_FACE == faces[iFace]) ? iter->second.positive :
+                                           iter->second.cohesive;
+            for (size_t iPart = 0; iPart < numParts; ++iPart) {
+                const PetscFormKey key = kernelKey.getPetscKey(solution, equationParts[iPart]);
+                const PetscInt part = getWeakFormPart(equationParts[iPart], faces[iFace], patchValue);
+                for (PetscInt i_trial = 0; i_trial < numFields; ++i_trial) {
+                    for (PetscInt i_basis = 0; i_basis < numFields; ++i_basis) {
+                        PetscInt n0 = 0, n1 = 0, n2 = 0, n3 = 0;
+                        PetscBdPointJac *j0 = NULL, *j1 = NULL, *j2 = NULL, *j3 = NULL;
+                        err = PetscWeakFormGetBdJacobian(weakForm, key.label, key.value, i_trial, i_basis, part,
+                                                         &n0, &j0, &n1, &j1, &n2, &j2, &n3, &j3);PYLITH_CHECK_ERROR(err);
+                        if (n0 + n1 + n2 + n3 > 0) {
+                            hasBlock[(iFace*numFields+i_trial)*numFields+i_basis] = true;
+                        } // if
+                        err = PetscWeakFormGetBdJacobianPreconditioner(weakForm, key.label, key.value, i_trial, i_basis, part,
+                                                                       &n0, &j0, &n1, &j1, &n2, &j2, &n3,
+                                                                       &j3);PYLITH_CHECK_ERROR(err);
+                        if (n0 + n1 + n2 + n3 > 0) {
+                            hasBlock[(iFace*numFields+i_trial)*numFields+i_basis] = true;
+                        } // if
+                    } // for
+                } // for
+            } // for
+        } // for
+
+        PetscIS patchCellsIS = NULL;
+        PetscInt numPatchCells = 0;
+        const PetscInt* patchCells = NULL;
+        err = DMGetStratumIS(dmSoln, _integrationPatches->getLabelName(), patchValue, &patchCellsIS);PYLITH_CHECK_ERROR(err);
+        if (!patchCellsIS) {
+            continue;
+        } // if
+        err = ISGetLocalSize(patchCellsIS, &numPatchCells);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
+
+        // Fields defined only on the cohesive cells (for example, Lagrange multipliers) use the degrees of
+        // freedom in the closure of the cohesive cell. Other fields on the negative and positive faces use
+        // only the degrees of freedom on that side of the interface.
+        std::vector<PetscBool> isCohesive(numFields, PETSC_FALSE);
+        if (numPatchCells > 0) {
+            PetscDS ds = NULL;
+            err = DMGetCellDS(dmSoln, patchCells[0], &ds, NULL);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iField = 0; iField < numFields; ++iField) {
+                err = PetscDSGetCohesive(ds, iField, &isCohesive[iField]);PYLITH_CHECK_ERROR(err);
+            } // for
+        } // if
+
+        for (PetscInt iCell = 0; iCell < numPatchCells; ++iCell) {
+            const PetscInt cell = patchCells[iCell];
+            assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, cell));
+            const PetscInt* cone = NULL;
+            err = DMPlexGetCone(dmSoln, cell, &cone);PYLITH_CHECK_ERROR(err);
+            _IntegratorInterface::getClosureIndices(&indicesFace[0], &offsetsFace[0], dmSoln, cone[0]);
+            _IntegratorInterface::getClosureIndices(&indicesFace[1], &offsetsFace[1], dmSoln, cone[1]);
+            _IntegratorInterface::getClosureIndices(&indicesFace[2], &offsetsFace[2], dmSoln, cell);
+
+            for (size_t iFace = 0; iFace < numFaces; ++iFace) {
+                for (PetscInt i_trial = 0; i_trial < numFields; ++i_trial) {
+                    const size_t iRows = isCohesive[i_trial] ? 2 : iFace;
+                    const PetscInt numRows = offsetsFace[iRows][i_trial+1] - offsetsFace[iRows][i_trial];
+                    for (PetscInt i_basis = 0; i_basis < numFields; ++i_basis) {
+                        if (!hasBlock[(iFace*numFields+i_trial)*numFields+i_basis]) {
+                            continue;
+                        } // if
+                        const size_t iCols = isCohesive[i_basis] ? 2 : iFace;
+                        const PetscInt numCols = offsetsFace[iCols][i_basis+1] - offsetsFace[iCols][i_basis];
+                        if (!numRows || !numCols) {
+                            continue;
+                        } // if
+                        values.resize(numRows*numCols, 0.0);
+                        err = MatSetValues(matPreallocator, numRows, &indicesFace[iRows][offsetsFace[iRows][i_trial]],
+                                           numCols, &indicesFace[iCols][offsetsFace[iCols][i_basis]],
+                                           &values[0], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+                    } // for
+                } // for
+            } // for
+        } // for
+        err = ISRestoreIndices(patchCellsIS, &patchCells);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&patchCellsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // addJacobianNonzeros
+
+
 // ------------------------------------------------------------------------------------------------
 // Compute residual.
 void
@@ -790,4 +932,40 @@ pylith::feassemble::_IntegratorInterface::getMaterial(const std::vector<pylith::
 } // getMaterial
 
 
+// ------------------------------------------------------------------------------------------------
+// Get global indices of degrees of freedom in closure of point.
+void
+pylith::feassemble::_IntegratorInterface::getClosureIndices(std::vector<PetscInt>* indices,
+                                                            std::vector<PetscInt>* offsets,
+                                                            PetscDM dm,
+                                                            const PetscInt point) {
+    PYLITH_METHOD_BEGIN;
+    assert(indices);
+    assert(offsets);
+
+    PetscErrorCode err = 0;
+    PetscSection localSection = NULL;
+    PetscSection globalSection = NULL;
+    PetscInt numFields = 0;
+    err = DMGetLocalSection(dm, &localSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(dm, &globalSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetNumFields(localSection, &numFields);PYLITH_CHECK_ERROR(err);
+
+    // Constrained degrees of freedom have negative indices, which MatSetValues() ignores.
+    PetscInt numIndices = 0;
+    PetscInt* closureIndices = NULL;
+    offsets->resize(numFields+1);
+    err = DMPlexGetClosureIndices(dm, localSection, globalSection, point, PETSC_FALSE, &numIndices, &closureIndices,
+                                  &(*offsets)[0], NULL);PYLITH_CHECK_ERROR(err);
+    indices->resize(numIndices);
+    for (PetscInt i = 0; i < numIndices; ++i) {
+        (*indices)[i] = closureIndices[i];
+    } // for
+    err = DMPlexRestoreClosureIndices(dm, localSection, globalSection, point, PETSC_FALSE, &numIndices, &closureIndices,
+                                      &(*offsets)[0], NULL);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // getClosureIndices
+
+
 // End of file
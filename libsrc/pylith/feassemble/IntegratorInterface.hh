@@ -241,6 +241,18 @@ public:
     void computeLHSJacobianLumpedInv(pylith::topology::Field* jacobianInv,
                                      const pylith::feassemble::IntegrationData& integrationData);
 
+    /** Add nonzero pattern of LHS Jacobian for cohesive cells to matrix preallocator.
+     *
+     * Only the blocks (trial subfield, basis subfield, face) with registered Jacobian or
+     * preconditioner kernels are added. The rows for the negative and positive faces are restricted to the degrees of freedom
+     * on that side of the interface.
+     *
+     * @param[inout] matPreallocator PETSc Mat (MATPREALLOCATOR) for nonzero pattern.
+     * @param[in] solution Field with current trial solution.
+     */
+    void addJacobianNonzeros(PetscMat matPreallocator,
+                             const pylith::topology::Field& solution) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
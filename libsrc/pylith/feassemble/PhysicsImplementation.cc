@@ -26,6 +26,8 @@
 #include "pylith/problems/Physics.hh" // USES Physics
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/TimerTree.hh" // USES TimerTree
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
@@ -64,6 +66,15 @@ pylith::feassemble::PhysicsImplementation::deallocate(void) {
 } // deallocate
 
 
+// ------------------------------------------------------------------------------------------------
+// Get identifier of physics.
+const char*
+pylith::feassemble::PhysicsImplementation::getPhysicsIdentifier(void) const {
+    assert(_physics);
+    return _physics->getIdentifier();
+} // getPhysicsIdentifier
+
+
 // ------------------------------------------------------------------------------------------------
 // Get name of label marking material.
 const char*
@@ -98,6 +109,41 @@ pylith::feassemble::PhysicsImplementation::getDerivedField(void) const {
 } // getDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping on this process.
+PylithReal
+pylith::feassemble::PhysicsImplementation::computeStableTimeStep(void) const {
+    assert(_physics);
+    return (_auxiliaryField) ? _physics->computeStableTimeStep(*_auxiliaryField) : PYLITH_MAXSCALAR;
+} // computeStableTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for explicit time stepping on this process.
+PylithReal
+pylith::feassemble::PhysicsImplementation::computeStableTimeStepExplicit(PylithReal* location) const {
+    assert(_physics);
+    return (_auxiliaryField) ? _physics->computeStableTimeStepExplicit(*_auxiliaryField, location) : PYLITH_MAXSCALAR;
+} // computeStableTimeStepExplicit
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for explicit time stepping for each cell on this process.
+void
+pylith::feassemble::PhysicsImplementation::computeStableTimeStepsExplicit(std::vector<PylithInt>* cells,
+                                                                          std::vector<PylithReal>* dtCells) const {
+    assert(_physics);
+    assert(cells);
+    assert(dtCells);
+    if (_auxiliaryField) {
+        _physics->computeStableTimeStepsExplicit(cells, dtCells, *_auxiliaryField);
+    } else {
+        cells->clear();
+        dtCells->clear();
+    } // if/else
+} // computeStableTimeStepsExplicit
+
+
 // ------------------------------------------------------------------------------------------------
 // Notify observers of current solution.
 void
@@ -110,7 +156,9 @@ pylith::feassemble::PhysicsImplementation::notifyObservers(const PylithReal t,
 
     assert(_observers);
     const bool infoOnly = false;
+    pylith::utils::TimerTree::begin(std::string("observers ") + getPhysicsIdentifier());
     _observers->notifyObservers(t, tindex, solution, infoOnly);
+    pylith::utils::TimerTree::end();
 } // _notifyObservers
 
 
@@ -60,6 +60,12 @@ public:
     virtual
     const pylith::topology::Mesh& getPhysicsDomainMesh(void) const = 0;
 
+    /** Get identifier of physics.
+     *
+     * @returns Identifier of physics (from Pyre component).
+     */
+    const char* getPhysicsIdentifier(void) const;
+
     /** Get name of label marking material.
      *
      * @returns Name of label for material (from mesh generator).
@@ -84,6 +90,27 @@ public:
      */
     const pylith::topology::Field* getDerivedField(void) const;
 
+    /** Compute stable time step for implicit time stepping on this process.
+     *
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal computeStableTimeStep(void) const;
+
+    /** Compute stable time step for explicit time stepping on this process.
+     *
+     * @param[out] location Coordinates of centroid of cell limiting the time step (nondimensional, size 3).
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal computeStableTimeStepExplicit(PylithReal* location) const;
+
+    /** Compute stable time step for explicit time stepping for each cell on this process.
+     *
+     * @param[out] cells Cells with a stable time step.
+     * @param[out] dtCells Stable time step (nondimensional) for each cell.
+     */
+    void computeStableTimeStepsExplicit(std::vector<PylithInt>* cells,
+                                        std::vector<PylithReal>* dtCells) const;
+
     /** Notify observers of current solution.
      *
      * @param[in] t Current time.
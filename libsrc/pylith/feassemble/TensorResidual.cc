@@ -0,0 +1,896 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TensorResidual.hh" // implementation of object methods
+
+#include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
+
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include "petscds.h" // USES PetscDS
+
+#include <algorithm> // USES std::sort(), std::max(), std::min(), std::copy()
+#include <cmath> // USES fabs()
+#include <cassert> // USES assert()
+
+namespace pylith {
+    namespace feassemble {
+        class _TensorResidual {
+public:
+
+            /** Get sorted unique values of coordinate of points.
+             *
+             * @param[in] points Coordinates of points.
+             * @param[in] numPoints Number of points.
+             * @param[in] dim Dimension of points.
+             * @param[in] iDim Coordinate direction.
+             * @returns Sorted unique values.
+             */
+            static
+            std::vector<PylithReal> uniqueCoordinates(const PylithReal* points,
+                                                      const PetscInt numPoints,
+                                                      const int dim,
+                                                      const int iDim);
+
+            /** Get index of value in sorted unique values.
+             *
+             * @param[in] values Sorted unique values.
+             * @param[in] value Value to find.
+             * @returns Index of value; -1 if not found.
+             */
+            static
+            int findCoordinate(const std::vector<PylithReal>& values,
+                               const PylithReal value);
+
+            /** Apply 1D operators one direction at a time (sum factorization).
+             *
+             * The operators are applied to a batch of cells at once. Arrays are ordered with the
+             * cell in the batch varying fastest and then the first direction, so the innermost loop
+             * is unit stride over the cells and vectorizes for any basis order. Operators are stored
+             * as numQuadPts x numNodes matrices; with transpose=false they map values at the nodes to
+             * values at the quadrature points, and with transpose=true they map values at the
+             * quadrature points to the nodes.
+             *
+             * @param[in] dim Dimension.
+             * @param[in] numNodes Number of nodes in each direction.
+             * @param[in] numQuadPts Number of quadrature points in each direction.
+             * @param[in] numBatch Number of cells in batch.
+             * @param[in] ops 1D operator for each direction.
+             * @param[in] transpose Apply transpose of operators.
+             * @param[in] valuesIn Input values.
+             * @param[out] valuesOut Output values.
+             * @param[inout] work Work array (size 2*numBatch*max(numNodes,numQuadPts)^dim).
+             */
+            static
+            void contract(const int dim,
+                          const int numNodes,
+                          const int numQuadPts,
+                          const int numBatch,
+                          const PylithReal* const ops[],
+                          const bool transpose,
+                          const PylithReal* valuesIn,
+                          PylithReal* valuesOut,
+                          PylithReal* work);
+
+            static const PylithReal tolerance; ///< Tolerance for matching coordinates of points.
+            static const int batchSize; ///< Default number of cells in a batch.
+
+        }; // _TensorResidual
+
+        const PylithReal _TensorResidual::tolerance = 1.0e-10;
+        const int _TensorResidual::batchSize = 8;
+
+    } // feassemble
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::feassemble::TensorResidual::TensorResidual(void) :
+    _dm(NULL),
+    _ds(NULL),
+    _label(NULL),
+    _value(0),
+    _dim(0),
+    _numQuadPts1D(0),
+    _geometryCellStart(0),
+    _batchSize(_TensorResidual::batchSize),
+    _isApplicable(false) {
+    GenericComponent::setName("tensorresidual");
+} // constructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::feassemble::TensorResidual::~TensorResidual(void) {
+    deallocate();
+} // destructor
+
+
+// ------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::feassemble::TensorResidual::deallocate(void) {
+    _dm = NULL; // Handle only.
+    _ds = NULL; // Handle only.
+    _label = NULL; // Handle only.
+    _quadPermutation.clear();
+    _numNodes1D.clear();
+    _basis1D.clear();
+    _basisDeriv1D.clear();
+    _closurePermutation.clear();
+    _geometryCellIndex.clear();
+    _geometryCoordinates.clear();
+    _geometryJacobianInv.clear();
+    _geometryWeightDet.clear();
+    _isApplicable = false;
+} // deallocate
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup 1D basis functions and permutations for cells in integration domain.
+bool
+pylith::feassemble::TensorResidual::initialize(const pylith::feassemble::DSLabelAccess& dsLabel) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("initialize(dsLabel="<<typeid(dsLabel).name()<<")");
+
+    deallocate();
+
+    PetscErrorCode err;
+    PetscDM dm = dsLabel.dm();
+    PetscDS ds = dsLabel.ds();
+    if (!dsLabel.numCells()) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    // All cells must be quadrilaterals or hexahedra.
+    PetscInt dim = 0;
+    err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
+    if ((2 != dim) && (3 != dim)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    const DMPolytopeType cellTypeTensor = (2 == dim) ? DM_POLYTOPE_QUADRILATERAL : DM_POLYTOPE_HEXAHEDRON;
+    const PetscInt numCells = dsLabel.numCells();
+    const PetscInt* cellIndices = NULL;
+    bool isTensorMesh = true;
+    err = ISGetIndices(dsLabel.cellsIS(), &cellIndices);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        DMPolytopeType cellType = DM_POLYTOPE_UNKNOWN;
+        err = DMPlexGetCellType(dm, cellIndices[iCell], &cellType);PYLITH_CHECK_ERROR(err);
+        if (cellType != cellTypeTensor) {
+            isTensorMesh = false;
+            break;
+        } // if
+    } // for
+    err = ISRestoreIndices(dsLabel.cellsIS(), &cellIndices);PYLITH_CHECK_ERROR(err);
+    if (!isTensorMesh) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    PetscBool isCohesive = PETSC_FALSE;
+    err = PetscDSIsCohesive(ds, &isCohesive);PYLITH_CHECK_ERROR(err);
+    if (isCohesive) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscInt numFields = 0;
+    err = PetscDSGetNumFields(ds, &numFields);PYLITH_CHECK_ERROR(err);
+    std::vector<PylithReal> quadPoints1D;
+    PetscInt numQuadPts = 0;
+    const PetscReal* quadPoints = NULL;
+    int maxOrder = 0;
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        PetscObject obj = NULL;
+        PetscClassId id;
+        err = PetscDSGetDiscretization(ds, iField, &obj);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectGetClassId(obj, &id);PYLITH_CHECK_ERROR(err);
+        if (id != PETSCFE_CLASSID) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+        PetscFE fe = (PetscFE) obj;
+
+        // All subfields must use the same tensor-product quadrature.
+        PetscQuadrature quadrature = NULL;
+        PetscInt quadDim = 0, quadNc = 0, fieldNumQuadPts = 0;
+        const PetscReal* fieldQuadPoints = NULL;
+        err = PetscFEGetQuadrature(fe, &quadrature);PYLITH_CHECK_ERROR(err);
+        err = PetscQuadratureGetData(quadrature, &quadDim, &quadNc, &fieldNumQuadPts, &fieldQuadPoints, NULL);PYLITH_CHECK_ERROR(err);
+        if (0 == iField) {
+            numQuadPts = fieldNumQuadPts;
+            quadPoints = fieldQuadPoints;
+            quadPoints1D = _TensorResidual::uniqueCoordinates(quadPoints, numQuadPts, dim, 0);
+        } else {
+            if (fieldNumQuadPts != numQuadPts) {
+                PYLITH_METHOD_RETURN(false);
+            } // if
+            for (PetscInt i = 0; i < numQuadPts*dim; ++i) {
+                if (fabs(fieldQuadPoints[i] - quadPoints[i]) > _TensorResidual::tolerance) {
+                    PYLITH_METHOD_RETURN(false);
+                } // if
+            } // for
+        } // if/else
+
+        // Basis must be Lagrange with nodes on a tensor-product grid.
+        PetscDualSpace dualSpace = NULL;
+        PetscInt order = 0, numComponents = 0, numBasis = 0;
+        err = PetscFEGetDualSpace(fe, &dualSpace);PYLITH_CHECK_ERROR(err);
+        err = PetscDualSpaceGetOrder(dualSpace, &order);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetNumComponents(fe, &numComponents);PYLITH_CHECK_ERROR(err);
+        err = PetscFEGetDimension(fe, &numBasis);PYLITH_CHECK_ERROR(err);
+        maxOrder = std::max(maxOrder, int(order));
+
+        std::vector<PylithReal> nodes(numBasis*dim);
+        std::vector<PetscInt> components(numBasis);
+        for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+            PetscQuadrature functional = NULL;
+            PetscInt fDim = 0, fNc = 0, fNumPoints = 0;
+            const PetscReal* fPoints = NULL;
+            const PetscReal* fWeights = NULL;
+            err = PetscDualSpaceGetFunctional(dualSpace, iBasis, &functional);PYLITH_CHECK_ERROR(err);
+            err = PetscQuadratureGetData(functional, &fDim, &fNc, &fNumPoints, &fPoints, &fWeights);PYLITH_CHECK_ERROR(err);
+            if ((fNumPoints != 1) || (fDim != dim)) {
+                PYLITH_METHOD_RETURN(false);
+            } // if
+            PetscInt iComponent = 0;
+            for (PetscInt iC = 1; iC < fNc; ++iC) {
+                if (fabs(fWeights[iC]) > fabs(fWeights[iComponent])) { iComponent = iC; }
+            } // for
+            components[iBasis] = iComponent;
+            for (int iDim = 0; iDim < dim; ++iDim) {
+                nodes[iBasis*dim+iDim] = fPoints[iDim];
+            } // for
+        } // for
+        const std::vector<PylithReal> nodes1D = _TensorResidual::uniqueCoordinates(&nodes[0], numBasis, dim, 0);
+        const int numNodes1D = nodes1D.size();
+        int numNodes = 1;
+        for (int iDim = 0; iDim < dim; ++iDim) {
+            numNodes *= numNodes1D;
+        } // for
+        if ((numNodes1D != order+1) || (numNodes*numComponents != numBasis)) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+
+        // Closure dof -> (component, tensor-product node) with first direction varying fastest.
+        std::vector<PetscInt> permutation(numBasis);
+        std::vector<bool> isUsed(numBasis, false);
+        for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+            int index = 0;
+            for (int iDim = dim-1; iDim >= 0; --iDim) {
+                const int i1D = _TensorResidual::findCoordinate(nodes1D, nodes[iBasis*dim+iDim]);
+                if (i1D < 0) {
+                    PYLITH_METHOD_RETURN(false);
+                } // if
+                index = index*numNodes1D + i1D;
+            } // for
+            index += components[iBasis]*numNodes;
+            if (isUsed[index]) {
+                PYLITH_METHOD_RETURN(false);
+            } // if
+            isUsed[index] = true;
+            permutation[iBasis] = index;
+        } // for
+
+        // 1D Lagrange basis functions and derivatives at the 1D quadrature points.
+        const int numQuadPts1D = quadPoints1D.size();
+        std::vector<PylithReal> basis(numQuadPts1D*numNodes1D);
+        std::vector<PylithReal> basisDeriv(numQuadPts1D*numNodes1D);
+        for (int iQuad = 0; iQuad < numQuadPts1D; ++iQuad) {
+            const PylithReal xi = quadPoints1D[iQuad];
+            for (int a = 0; a < numNodes1D; ++a) {
+                PylithReal value = 1.0;
+                PylithReal deriv = 0.0;
+                for (int b = 0; b < numNodes1D; ++b) {
+                    if (b == a) { continue; }
+                    const PylithReal scale = 1.0 / (nodes1D[a] - nodes1D[b]);
+                    deriv = deriv*(xi - nodes1D[b])*scale + value*scale;
+                    value *= (xi - nodes1D[b])*scale;
+                } // for
+                basis[iQuad*numNodes1D+a] = value;
+                basisDeriv[iQuad*numNodes1D+a] = deriv;
+            } // for
+        } // for
+
+        _numNodes1D.push_back(numNodes1D);
+        _basis1D.push_back(basis);
+        _basisDeriv1D.push_back(basisDeriv);
+        _closurePermutation.push_back(permutation);
+    } // for
+    // Tensor-product quadrature point -> PETSc quadrature point.
+    const int numQuadPts1D = quadPoints1D.size();
+    int numQuadPtsTensor = 1;
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        numQuadPtsTensor *= numQuadPts1D;
+    } // for
+    if (numQuadPtsTensor != numQuadPts) {
+        deallocate();
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    _quadPermutation.resize(numQuadPts, -1);
+    for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+        int index = 0;
+        for (int iDim = dim-1; iDim >= 0; --iDim) {
+            const int i1D = _TensorResidual::findCoordinate(quadPoints1D, quadPoints[iQuad*dim+iDim]);
+            if (i1D < 0) {
+                deallocate();
+                PYLITH_METHOD_RETURN(false);
+            } // if
+            index = index*numQuadPts1D + i1D;
+        } // for
+        if (_quadPermutation[index] >= 0) {
+            deallocate();
+            PYLITH_METHOD_RETURN(false);
+        } // if
+        _quadPermutation[index] = iQuad;
+    } // for
+
+    _dm = dm;
+    _ds = ds;
+    _label = dsLabel.label();
+    _value = dsLabel.value();
+    _dim = dim;
+    _numQuadPts1D = numQuadPts1D;
+
+    // Tabulated basis is just as fast for linear basis functions unless the geometry is precomputed.
+    _isApplicable = maxOrder >= 2;
+
+    PYLITH_METHOD_RETURN(true);
+} // initialize
+
+
+// ------------------------------------------------------------------------------------------------
+// Can sum factorization be used for the integration domain?
+bool
+pylith::feassemble::TensorResidual::isApplicable(void) const {
+    return _isApplicable;
+} // isApplicable
+
+
+// ------------------------------------------------------------------------------------------------
+// Precompute cell geometry at quadrature points.
+void
+pylith::feassemble::TensorResidual::precomputeGeometry(PetscIS cellsIS) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("precomputeGeometry(cellsIS="<<cellsIS<<")");
+
+    assert(_dm);
+    assert(_ds);
+
+    PetscErrorCode err;
+    const int dim = _dim;
+    const int numQuadPts = _quadPermutation.size();
+
+    PetscFE fe0 = NULL;
+    PetscQuadrature quadrature = NULL;
+    const PetscReal* quadWeights = NULL;
+    err = PetscDSGetDiscretization(_ds, 0, (PetscObject*)&fe0);PYLITH_CHECK_ERROR(err);
+    err = PetscFEGetQuadrature(fe0, &quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, NULL, NULL, &quadWeights);PYLITH_CHECK_ERROR(err);
+
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(_dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    _geometryCellStart = cStart;
+    _geometryCellIndex.assign(cEnd-cStart, -1);
+
+    PetscInt numCells = 0;
+    const PetscInt* cells = NULL;
+    err = ISGetLocalSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+    _geometryCoordinates.resize(numCells*numQuadPts*dim);
+    _geometryJacobianInv.resize(numCells*numQuadPts*dim*dim);
+    _geometryWeightDet.resize(numCells*numQuadPts);
+    std::vector<PylithReal> jacobian(numQuadPts*dim*dim);
+
+    err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cells[iCell];
+        assert(cell >= cStart && cell < cEnd);
+        _geometryCellIndex[cell-cStart] = iCell;
+
+        PylithReal* weightDet = &_geometryWeightDet[iCell*numQuadPts];
+        err = DMPlexComputeCellGeometryFEM(_dm, cell, quadrature, &_geometryCoordinates[iCell*numQuadPts*dim], &jacobian[0],
+                                           &_geometryJacobianInv[iCell*numQuadPts*dim*dim], weightDet);PYLITH_CHECK_ERROR(err);
+        for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+            weightDet[iQuad] *= quadWeights[iQuad];
+        } // for
+    } // for
+    err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+
+    // With the geometry precomputed, sum factorization is faster for all basis orders.
+    _isApplicable = true;
+
+    PYLITH_METHOD_END;
+} // precomputeGeometry
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute residual and add it to the local residual vector.
+bool
+pylith::feassemble::TensorResidual::computeResidual(const PetscInt part,
+                                                    PetscIS cellsIS,
+                                                    const PylithReal t,
+                                                    PetscVec solutionVec,
+                                                    PetscVec solutionDotVec,
+                                                    PetscVec residualVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeResidual(part="<<part<<", cellsIS="<<cellsIS<<", t="<<t<<", solutionVec="<<solutionVec
+                                                  <<", solutionDotVec="<<solutionDotVec<<", residualVec="<<residualVec<<")");
+
+    if (!_isApplicable) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscErrorCode err;
+    const int dim = _dim;
+    const int numQuadPts1D = _numQuadPts1D;
+    const int numQuadPts = _quadPermutation.size();
+
+    PetscDS ds = _ds;
+    PetscWeakForm weakForm = NULL;
+    PetscInt numFields = 0, totalDim = 0, numConstants = 0;
+    const PetscInt* uOff = NULL;
+    const PetscInt* uOff_x = NULL;
+    const PetscScalar* constants = NULL;
+    err = PetscDSGetWeakForm(ds, &weakForm);PYLITH_CHECK_ERROR(err);
+    err = PetscDSGetNumFields(ds, &numFields);PYLITH_CHECK_ERROR(err);
+    err = PetscDSGetTotalDimension(ds, &totalDim);PYLITH_CHECK_ERROR(err);
+    err = PetscDSGetComponentOffsets(ds, &uOff);PYLITH_CHECK_ERROR(err);
+    err = PetscDSGetComponentDerivativeOffsets(ds, &uOff_x);PYLITH_CHECK_ERROR(err);
+    err = PetscDSGetConstants(ds, &numConstants, &constants);PYLITH_CHECK_ERROR(err);
+    assert(size_t(numFields) == _numNodes1D.size());
+
+    PetscFE fe0 = NULL;
+    PetscQuadrature quadrature = NULL;
+    const PetscReal* quadPoints = NULL;
+    const PetscReal* quadWeights = NULL;
+    err = PetscDSGetDiscretization(ds, 0, (PetscObject*)&fe0);PYLITH_CHECK_ERROR(err);
+    err = PetscFEGetQuadrature(fe0, &quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, NULL, &quadPoints, &quadWeights);PYLITH_CHECK_ERROR(err);
+
+    // Auxiliary field (evaluated with the tabulated basis since it is usually low order).
+    PetscVec auxiliaryVec = NULL;
+    PetscDM dmAux = NULL;
+    PetscDS dsAux = NULL;
+    PetscInt numFieldsAux = 0;
+    const PetscInt* aOff = NULL;
+    const PetscInt* aOff_x = NULL;
+    PetscTabulation* tabAux = NULL;
+    DMEnclosureType encAux = DM_ENC_UNKNOWN;
+    err = DMGetAuxiliaryVec(_dm, _label, _value, part, &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+    if (auxiliaryVec) {
+        err = VecGetDM(auxiliaryVec, &dmAux);PYLITH_CHECK_ERROR(err);
+        err = DMGetEnclosureRelation(dmAux, _dm, &encAux);PYLITH_CHECK_ERROR(err);
+        err = DMGetDS(dmAux, &dsAux);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetNumFields(dsAux, &numFieldsAux);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetComponentOffsets(dsAux, &aOff);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetComponentDerivativeOffsets(dsAux, &aOff_x);PYLITH_CHECK_ERROR(err);
+        err = PetscDSGetTabulation(dsAux, &tabAux);PYLITH_CHECK_ERROR(err);
+
+        // The auxiliary basis is tabulated at the quadrature points of the auxiliary subfields, so
+        // they must coincide with the quadrature points of the solution subfields.
+        for (PetscInt iField = 0; iField < numFieldsAux; ++iField) {
+            PetscObject obj = NULL;
+            PetscClassId id;
+            err = PetscDSGetDiscretization(dsAux, iField, &obj);PYLITH_CHECK_ERROR(err);
+            err = PetscObjectGetClassId(obj, &id);PYLITH_CHECK_ERROR(err);
+            if (id != PETSCFE_CLASSID) {
+                PYLITH_METHOD_RETURN(false);
+            } // if
+            PetscQuadrature quadratureAux = NULL;
+            PetscInt quadDimAux = 0, numQuadPtsAux = 0;
+            const PetscReal* quadPointsAux = NULL;
+            err = PetscFEGetQuadrature((PetscFE)obj, &quadratureAux);PYLITH_CHECK_ERROR(err);
+            err = PetscQuadratureGetData(quadratureAux, &quadDimAux, NULL, &numQuadPtsAux, &quadPointsAux, NULL);PYLITH_CHECK_ERROR(err);
+            if ((quadDimAux != dim) || (numQuadPtsAux != numQuadPts) || (tabAux[iField]->Np != numQuadPts)) {
+                PYLITH_METHOD_RETURN(false);
+            } // if
+            for (PetscInt i = 0; i < numQuadPts*dim; ++i) {
+                if (fabs(quadPointsAux[i] - quadPoints[i]) > _TensorResidual::tolerance) {
+                    PYLITH_METHOD_RETURN(false);
+                } // if
+            } // for
+        } // for
+    } // if
+
+    // Pointwise functions for each subfield.
+    std::vector<PetscInt> numF0(numFields, 0), numF1(numFields, 0);
+    std::vector<PetscPointFunc*> f0Fns(numFields, NULL), f1Fns(numFields, NULL);
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        err = PetscWeakFormGetResidual(weakForm, _label, _value, iField, part, &numF0[iField], &f0Fns[iField],
+                                       &numF1[iField], &f1Fns[iField]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Work arrays. Values for the cells in a batch are interleaved with the cell index varying
+    // fastest, so the innermost loops of the contractions are unit stride over the cells.
+    const int batchSize = _batchSize;
+    PetscInt totalComponents = 0, totalComponentsAux = 0;
+    err = PetscDSGetTotalComponents(ds, &totalComponents);PYLITH_CHECK_ERROR(err);
+    if (dsAux) {
+        err = PetscDSGetTotalComponents(dsAux, &totalComponentsAux);PYLITH_CHECK_ERROR(err);
+    } // if
+    int maxSize = 1;
+    int maxNodes1D = numQuadPts1D;
+    for (PetscInt iField = 0; iField < numFields; ++iField) {
+        maxNodes1D = std::max(maxNodes1D, _numNodes1D[iField]);
+    } // for
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        maxSize *= maxNodes1D;
+    } // for
+    std::vector<PylithReal> work(2*maxSize*batchSize);
+    std::vector<PylithReal> nodeValues(maxSize*batchSize), nodeResidual(maxSize*batchSize), tmpValues(maxSize*batchSize);
+    std::vector<PylithReal> u(batchSize*numQuadPts*totalComponents), u_t(batchSize*numQuadPts*totalComponents);
+    std::vector<PylithReal> u_x(batchSize*numQuadPts*totalComponents*dim);
+    std::vector<PylithReal> uRef_x(batchSize*numQuadPts*dim); // Gradient in reference coordinates for one component.
+    std::vector<PylithReal> a(totalComponentsAux), a_x(totalComponentsAux*dim);
+    std::vector<PylithReal> f0(totalComponents), f1(totalComponents*dim);
+    std::vector<PylithReal> f0Values(totalComponents*numQuadPts*batchSize), f1RefValues(totalComponents*dim*numQuadPts*batchSize);
+    std::vector<PylithReal> coordsQuad(batchSize*numQuadPts*dim), jacobian(numQuadPts*dim*dim);
+    std::vector<PylithReal> jacobianInv(batchSize*numQuadPts*dim*dim), weightDet(batchSize*numQuadPts);
+    std::vector<const PylithReal*> cellCoords(batchSize), cellJacobianInv(batchSize), cellWeightDet(batchSize);
+    std::vector<PetscScalar> solnBatch(batchSize*totalDim), solnDotBatch(batchSize*totalDim), elemResidual(batchSize*totalDim);
+
+    PetscInt numCells = 0;
+    const PetscInt* cells = NULL;
+    err = ISGetLocalSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iCellStart = 0; iCellStart < numCells; iCellStart += batchSize) {
+        const int numBatch = std::min(PetscInt(batchSize), numCells-iCellStart);
+
+        // Geometry and closures of solution for cells in batch.
+        for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+            const PetscInt cell = cells[iCellStart+iBatch];
+
+            const PetscInt geometryIndex = (_geometryCellIndex.size() > 0) ? _geometryCellIndex[cell-_geometryCellStart] : -1;
+            if (geometryIndex >= 0) {
+                cellCoords[iBatch] = &_geometryCoordinates[geometryIndex*numQuadPts*dim];
+                cellJacobianInv[iBatch] = &_geometryJacobianInv[geometryIndex*numQuadPts*dim*dim];
+                cellWeightDet[iBatch] = &_geometryWeightDet[geometryIndex*numQuadPts];
+            } else {
+                PylithReal* cellWeightDetBatch = &weightDet[iBatch*numQuadPts];
+                err = DMPlexComputeCellGeometryFEM(_dm, cell, quadrature, &coordsQuad[iBatch*numQuadPts*dim], &jacobian[0],
+                                                   &jacobianInv[iBatch*numQuadPts*dim*dim], cellWeightDetBatch);PYLITH_CHECK_ERROR(err);
+                for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                    cellWeightDetBatch[iQuad] *= quadWeights[iQuad];
+                } // for
+                cellCoords[iBatch] = &coordsQuad[iBatch*numQuadPts*dim];
+                cellJacobianInv[iBatch] = &jacobianInv[iBatch*numQuadPts*dim*dim];
+                cellWeightDet[iBatch] = cellWeightDetBatch;
+            } // if/else
+
+            PetscScalar* solnCell = NULL;
+            err = DMPlexVecGetClosure(_dm, NULL, solutionVec, cell, NULL, &solnCell);PYLITH_CHECK_ERROR(err);
+            std::copy(solnCell, solnCell+totalDim, &solnBatch[iBatch*totalDim]);
+            err = DMPlexVecRestoreClosure(_dm, NULL, solutionVec, cell, NULL, &solnCell);PYLITH_CHECK_ERROR(err);
+            if (solutionDotVec) {
+                PetscScalar* solnDotCell = NULL;
+                err = DMPlexVecGetClosure(_dm, NULL, solutionDotVec, cell, NULL, &solnDotCell);PYLITH_CHECK_ERROR(err);
+                std::copy(solnDotCell, solnDotCell+totalDim, &solnDotBatch[iBatch*totalDim]);
+                err = DMPlexVecRestoreClosure(_dm, NULL, solutionDotVec, cell, NULL, &solnDotCell);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // for
+
+        // Solution and gradient at quadrature points (tensor-product order) via sum factorization.
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            const int numNodes1D = _numNodes1D[iField];
+            int numNodes = 1;
+            for (int iDim = 0; iDim < dim; ++iDim) {
+                numNodes *= numNodes1D;
+            } // for
+            const std::vector<PetscInt>& permutation = _closurePermutation[iField];
+            const PetscInt numBasis = permutation.size();
+            const PetscInt numComponents = numBasis / numNodes;
+            PetscInt fieldOffset = 0;
+            err = PetscDSGetFieldOffset(ds, iField, &fieldOffset);PYLITH_CHECK_ERROR(err);
+            const PylithReal* basis = &_basis1D[iField][0];
+            const PylithReal* basisDeriv = &_basisDeriv1D[iField][0];
+
+            for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+                    for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                        const PetscInt index = permutation[iBasis] - iComponent*numNodes;
+                        if ((index >= 0) && (index < numNodes)) {
+                            nodeValues[index*numBatch+iBatch] = PetscRealPart(solnBatch[iBatch*totalDim+fieldOffset+iBasis]);
+                        } // if
+                    } // for
+                } // for
+                const PylithReal* opsValue[3] = { basis, basis, basis };
+                _TensorResidual::contract(dim, numNodes1D, numQuadPts1D, numBatch, opsValue, false, &nodeValues[0], &tmpValues[0], &work[0]);
+                for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+                    for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                        u[(iBatch*numQuadPts+iQuad)*totalComponents+uOff[iField]+iComponent] = tmpValues[iQuad*numBatch+iBatch];
+                    } // for
+                } // for
+                for (int iDeriv = 0; iDeriv < dim; ++iDeriv) {
+                    const PylithReal* opsDeriv[3] = { basis, basis, basis };
+                    opsDeriv[iDeriv] = basisDeriv;
+                    _TensorResidual::contract(dim, numNodes1D, numQuadPts1D, numBatch, opsDeriv, false, &nodeValues[0], &tmpValues[0], &work[0]);
+                    for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+                        for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                            uRef_x[(iBatch*numQuadPts+iQuad)*dim+iDeriv] = tmpValues[iQuad*numBatch+iBatch];
+                        } // for
+                    } // for
+                } // for
+                for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+                    for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                        const PylithReal* invJ = &cellJacobianInv[iBatch][_quadPermutation[iQuad]*dim*dim];
+                        const PylithReal* uRef_xQuad = &uRef_x[(iBatch*numQuadPts+iQuad)*dim];
+                        for (int iDim = 0; iDim < dim; ++iDim) {
+                            PylithReal value = 0.0;
+                            for (int iDeriv = 0; iDeriv < dim; ++iDeriv) {
+                                value += uRef_xQuad[iDeriv] * invJ[iDeriv*dim+iDim];
+                            } // for
+                            u_x[(iBatch*numQuadPts+iQuad)*totalComponents*dim+uOff_x[iField]+iComponent*dim+iDim] = value;
+                        } // for
+                    } // for
+                } // for
+
+                if (solutionDotVec) {
+                    for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+                        for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                            const PetscInt index = permutation[iBasis] - iComponent*numNodes;
+                            if ((index >= 0) && (index < numNodes)) {
+                                nodeValues[index*numBatch+iBatch] = PetscRealPart(solnDotBatch[iBatch*totalDim+fieldOffset+iBasis]);
+                            } // if
+                        } // for
+                    } // for
+                    _TensorResidual::contract(dim, numNodes1D, numQuadPts1D, numBatch, opsValue, false, &nodeValues[0], &tmpValues[0], &work[0]);
+                    for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+                        for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                            u_t[(iBatch*numQuadPts+iQuad)*totalComponents+uOff[iField]+iComponent] = tmpValues[iQuad*numBatch+iBatch];
+                        } // for
+                    } // for
+                } // if
+            } // for
+        } // for
+
+        // Pointwise functions at quadrature points.
+        std::fill(f0Values.begin(), f0Values.end(), 0.0);
+        std::fill(f1RefValues.begin(), f1RefValues.end(), 0.0);
+        for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+            const PetscInt cell = cells[iCellStart+iBatch];
+
+            PetscScalar* auxCell = NULL;
+            PetscInt cellAux = cell;
+            if (auxiliaryVec) {
+                err = DMGetEnclosurePoint(dmAux, _dm, encAux, cell, &cellAux);PYLITH_CHECK_ERROR(err);
+                err = DMPlexVecGetClosure(dmAux, NULL, auxiliaryVec, cellAux, NULL, &auxCell);PYLITH_CHECK_ERROR(err);
+            } // if
+
+            for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                const PetscInt iQuadPetsc = _quadPermutation[iQuad];
+                const PylithReal* invJ = &cellJacobianInv[iBatch][iQuadPetsc*dim*dim];
+                const PylithReal weight = cellWeightDet[iBatch][iQuadPetsc];
+
+                if (auxCell) {
+                    std::fill(a.begin(), a.end(), 0.0);
+                    std::fill(a_x.begin(), a_x.end(), 0.0);
+                    for (PetscInt iField = 0; iField < numFieldsAux; ++iField) {
+                        PetscInt fieldOffset = 0;
+                        err = PetscDSGetFieldOffset(dsAux, iField, &fieldOffset);PYLITH_CHECK_ERROR(err);
+                        const PetscTabulation tab = tabAux[iField];
+                        const PetscInt numBasis = tab->Nb;
+                        const PetscInt numComponents = tab->Nc;
+                        const PetscReal* basis = &tab->T[0][iQuadPetsc*numBasis*numComponents];
+                        const PetscReal* basisDeriv = &tab->T[1][iQuadPetsc*numBasis*numComponents*dim];
+                        for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                            const PylithReal value = PetscRealPart(auxCell[fieldOffset+iBasis]);
+                            for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                                a[aOff[iField]+iComponent] += basis[iBasis*numComponents+iComponent] * value;
+                                for (int iDim = 0; iDim < dim; ++iDim) {
+                                    for (int iDeriv = 0; iDeriv < dim; ++iDeriv) {
+                                        a_x[aOff_x[iField]+iComponent*dim+iDim] +=
+                                            basisDeriv[(iBasis*numComponents+iComponent)*dim+iDeriv] * invJ[iDeriv*dim+iDim] * value;
+                                    } // for
+                                } // for
+                            } // for
+                        } // for
+                    } // for
+                } // if
+
+                const PylithReal* uQuad = &u[(iBatch*numQuadPts+iQuad)*totalComponents];
+                const PylithReal* u_tQuad = &u_t[(iBatch*numQuadPts+iQuad)*totalComponents];
+                const PylithReal* u_xQuad = &u_x[(iBatch*numQuadPts+iQuad)*totalComponents*dim];
+                const PylithReal* x = &cellCoords[iBatch][iQuadPetsc*dim];
+                for (PetscInt iField = 0; iField < numFields; ++iField) {
+                    const PetscInt numComponents = (iField+1 < numFields) ? uOff[iField+1]-uOff[iField] : totalComponents-uOff[iField];
+                    for (PetscInt iFn = 0; iFn < numF0[iField]; ++iFn) {
+                        std::fill(f0.begin(), f0.begin()+numComponents, 0.0);
+                        f0Fns[iField][iFn](dim, numFields, numFieldsAux, uOff, uOff_x, uQuad, u_tQuad, u_xQuad,
+                                           aOff, aOff_x, (auxCell) ? &a[0] : NULL, NULL, (auxCell) ? &a_x[0] : NULL,
+                                           t, x, numConstants, constants, &f0[0]);
+                        for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                            f0Values[((uOff[iField]+iComponent)*numQuadPts+iQuad)*numBatch+iBatch] += f0[iComponent] * weight;
+                        } // for
+                    } // for
+                    for (PetscInt iFn = 0; iFn < numF1[iField]; ++iFn) {
+                        std::fill(f1.begin(), f1.begin()+numComponents*dim, 0.0);
+                        f1Fns[iField][iFn](dim, numFields, numFieldsAux, uOff, uOff_x, uQuad, u_tQuad, u_xQuad,
+                                           aOff, aOff_x, (auxCell) ? &a[0] : NULL, NULL, (auxCell) ? &a_x[0] : NULL,
+                                           t, x, numConstants, constants, &f1[0]);
+                        // Map to reference coordinates: sum_d f1[c][d] dxi_e/dx_d.
+                        for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                            for (int iDeriv = 0; iDeriv < dim; ++iDeriv) {
+                                PylithReal value = 0.0;
+                                for (int iDim = 0; iDim < dim; ++iDim) {
+                                    value += f1[iComponent*dim+iDim] * invJ[iDeriv*dim+iDim];
+                                } // for
+                                f1RefValues[(((uOff[iField]+iComponent)*dim+iDeriv)*numQuadPts+iQuad)*numBatch+iBatch] += value * weight;
+                            } // for
+                        } // for
+                    } // for
+                } // for
+            } // for
+            if (auxiliaryVec) {
+                err = DMPlexVecRestoreClosure(dmAux, NULL, auxiliaryVec, cellAux, NULL, &auxCell);PYLITH_CHECK_ERROR(err);
+            } // if
+        } // for
+
+        // Integrate back to basis functions via sum factorization with transposed operators.
+        std::fill(elemResidual.begin(), elemResidual.end(), 0.0);
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            if (!numF0[iField] && !numF1[iField]) { continue; }
+            const int numNodes1D = _numNodes1D[iField];
+            int numNodes = 1;
+            for (int iDim = 0; iDim < dim; ++iDim) {
+                numNodes *= numNodes1D;
+            } // for
+            const std::vector<PetscInt>& permutation = _closurePermutation[iField];
+            const PetscInt numBasis = permutation.size();
+            const PetscInt numComponents = numBasis / numNodes;
+            PetscInt fieldOffset = 0;
+            err = PetscDSGetFieldOffset(ds, iField, &fieldOffset);PYLITH_CHECK_ERROR(err);
+            const PylithReal* basis = &_basis1D[iField][0];
+            const PylithReal* basisDeriv = &_basisDeriv1D[iField][0];
+
+            for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                std::fill(nodeResidual.begin(), nodeResidual.begin()+numNodes*numBatch, 0.0);
+                if (numF0[iField]) {
+                    const PylithReal* opsValue[3] = { basis, basis, basis };
+                    _TensorResidual::contract(dim, numNodes1D, numQuadPts1D, numBatch, opsValue, true,
+                                              &f0Values[(uOff[iField]+iComponent)*numQuadPts*numBatch], &tmpValues[0], &work[0]);
+                    for (int i = 0; i < numNodes*numBatch; ++i) {
+                        nodeResidual[i] += tmpValues[i];
+                    } // for
+                } // if
+                if (numF1[iField]) {
+                    for (int iDeriv = 0; iDeriv < dim; ++iDeriv) {
+                        const PylithReal* opsDeriv[3] = { basis, basis, basis };
+                        opsDeriv[iDeriv] = basisDeriv;
+                        _TensorResidual::contract(dim, numNodes1D, numQuadPts1D, numBatch, opsDeriv, true,
+                                                  &f1RefValues[((uOff[iField]+iComponent)*dim+iDeriv)*numQuadPts*numBatch], &tmpValues[0],
+                                                  &work[0]);
+                        for (int i = 0; i < numNodes*numBatch; ++i) {
+                            nodeResidual[i] += tmpValues[i];
+                        } // for
+                    } // for
+                } // if
+                for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+                    for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+                        const PetscInt index = permutation[iBasis] - iComponent*numNodes;
+                        if ((index >= 0) && (index < numNodes)) {
+                            elemResidual[iBatch*totalDim+fieldOffset+iBasis] = nodeResidual[index*numBatch+iBatch];
+                        } // if
+                    } // for
+                } // for
+            } // for
+        } // for
+
+        for (int iBatch = 0; iBatch < numBatch; ++iBatch) {
+            err = DMPlexVecSetClosure(_dm, NULL, residualVec, cells[iCellStart+iBatch], &elemResidual[iBatch*totalDim],
+                                      ADD_ALL_VALUES);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+    err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(true);
+} // computeResidual
+
+
+// ------------------------------------------------------------------------------------------------
+// Get sorted unique values of coordinate of points.
+std::vector<PylithReal>
+pylith::feassemble::_TensorResidual::uniqueCoordinates(const PylithReal* points,
+                                                       const PetscInt numPoints,
+                                                       const int dim,
+                                                       const int iDim) {
+    std::vector<PylithReal> values(numPoints);
+    for (PetscInt i = 0; i < numPoints; ++i) {
+        values[i] = points[i*dim+iDim];
+    } // for
+    std::sort(values.begin(), values.end());
+    std::vector<PylithReal> unique;
+    for (PetscInt i = 0; i < numPoints; ++i) {
+        if (unique.empty() || (fabs(values[i] - unique.back()) > tolerance)) {
+            unique.push_back(values[i]);
+        } // if
+    } // for
+    return unique;
+} // uniqueCoordinates
+
+
+// ------------------------------------------------------------------------------------------------
+// Get index of value in sorted unique values.
+int
+pylith::feassemble::_TensorResidual::findCoordinate(const std::vector<PylithReal>& values,
+                                                    const PylithReal value) {
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (fabs(values[i] - value) <= tolerance) {
+            return i;
+        } // if
+    } // for
+    return -1;
+} // findCoordinate
+
+
+// ------------------------------------------------------------------------------------------------
+// Apply 1D operators one direction at a time (sum factorization).
+void
+pylith::feassemble::_TensorResidual::contract(const int dim,
+                                              const int numNodes,
+                                              const int numQuadPts,
+                                              const int numBatch,
+                                              const PylithReal* const ops[],
+                                              const bool transpose,
+                                              const PylithReal* valuesIn,
+                                              PylithReal* valuesOut,
+                                              PylithReal* work) {
+    int maxSize = numBatch;
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        maxSize *= std::max(numNodes, numQuadPts);
+    } // for
+    PylithReal* buffers[2] = { work, work + maxSize };
+
+    int shape[3];
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        shape[iDim] = (transpose) ? numQuadPts : numNodes;
+    } // for
+    const int numDst = (transpose) ? numNodes : numQuadPts;
+
+    const PylithReal* src = valuesIn;
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        const int numSrc = shape[iDim];
+        PylithReal* dst = (iDim == dim-1) ? valuesOut : buffers[iDim % 2];
+        int numInner = numBatch, numOuter = 1;
+        for (int i = 0; i < iDim; ++i) {
+            numInner *= shape[i];
+        } // for
+        for (int i = iDim+1; i < dim; ++i) {
+            numOuter *= shape[i];
+        } // for
+        const PylithReal* op = ops[iDim];
+        for (int iOuter = 0; iOuter < numOuter; ++iOuter) {
+            for (int j = 0; j < numDst; ++j) {
+                PylithReal* dstJ = &dst[numInner*(j + numDst*iOuter)];
+                for (int iInner = 0; iInner < numInner; ++iInner) {
+                    dstJ[iInner] = 0.0;
+                } // for
+                for (int k = 0; k < numSrc; ++k) {
+                    const PylithReal coef = (transpose) ? op[k*numNodes+j] : op[j*numNodes+k];
+                    const PylithReal* srcK = &src[numInner*(k + numSrc*iOuter)];
+                    for (int iInner = 0; iInner < numInner; ++iInner) {
+                        dstJ[iInner] += coef * srcK[iInner];
+                    } // for
+                } // for
+            } // for
+        } // for
+        shape[iDim] = numDst;
+        src = dst;
+    } // for
+} // contract
+
+
+// End of file
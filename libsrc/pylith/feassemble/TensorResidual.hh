@@ -0,0 +1,139 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/feassemble/TensorResidual.hh
+ *
+ * @brief Residual integration using sum factorization for tensor-product cells.
+ *
+ * For quadrilateral and hexahedral cells with a tensor-product Lagrange basis and a
+ * tensor-product quadrature, we evaluate the solution and its gradient at the quadrature points
+ * and integrate the pointwise functions back to the basis functions by applying the 1D basis
+ * (and its derivative) one direction at a time. This reduces the cost per cell from O(p^{2d}) to
+ * O(p^{d+1}) for basis order p in d dimensions. The pointwise functions are the same f0 and f1
+ * functions registered in the PETSc weak form, so results match DMPlexComputeResidual_Internal()
+ * to roundoff. Cells are processed in batches with the values for the cells in a batch
+ * interleaved, so the contractions vectorize across cells even for low basis orders.
+ */
+
+#if !defined(pylith_feassemble_tensorresidual_hh)
+#define pylith_feassemble_tensorresidual_hh
+
+#include "feassemblefwd.hh" // forward declarations
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM, PetscDS, PetscVec, PetscIS
+#include "pylith/utils/arrayfwd.hh" // HASA std::vector
+
+class pylith::feassemble::TensorResidual : public pylith::utils::GenericComponent {
+    friend class TestTensorResidual; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TensorResidual(void);
+
+    /// Destructor
+    ~TensorResidual(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Setup 1D basis functions and permutations for cells in integration domain.
+     *
+     * Sum factorization requires that every cell is a quadrilateral or hexahedron with a tensor-product Lagrange
+     * basis for every solution subfield and the same tensor-product quadrature. It is used by
+     * default only for basis order 2 or higher; with precomputed geometry it is used for all orders.
+     *
+     * @param[in] dsLabel PETSc DS, label, and cells for integration domain.
+     * @returns True if cells and discretization have tensor-product structure, false otherwise.
+     */
+    bool initialize(const pylith::feassemble::DSLabelAccess& dsLabel);
+
+    /** Precompute cell geometry at quadrature points.
+     *
+     * Store the quadrature point coordinates, inverse of the Jacobian, and the quadrature weights
+     * times the determinant of the Jacobian for each cell, so that they are not recomputed from
+     * the vertex coordinates for every residual evaluation. This is intended for explicit time
+     * stepping with a fixed mesh.
+     *
+     * @param[in] cellsIS Cells in integration domain.
+     */
+    void precomputeGeometry(PetscIS cellsIS);
+
+    /** Can sum factorization be used for the integration domain?
+     *
+     * @returns True if sum factorization can be used, false otherwise.
+     */
+    bool isApplicable(void) const;
+
+    /** Compute residual and add it to the local residual vector.
+     *
+     * @param[in] part Part of weak form (LHS or RHS).
+     * @param[in] cellsIS Cells to integrate over.
+     * @param[in] t Current time.
+     * @param[in] solutionVec Local PETSc Vec with solution.
+     * @param[in] solutionDotVec Local PETSc Vec with time derivative of solution (NULL if not used).
+     * @param[out] residualVec Local PETSc Vec for residual.
+     * @returns True if residual was computed, false if the auxiliary subfields do not use the same
+     *   quadrature points as the solution subfields and the caller should use the generic integration.
+     */
+    bool computeResidual(const PetscInt part,
+                         PetscIS cellsIS,
+                         const PylithReal t,
+                         PetscVec solutionVec,
+                         PetscVec solutionDotVec,
+                         PetscVec residualVec);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    PetscDM _dm; ///< PETSc DM for solution.
+    PetscDS _ds; ///< PETSc DS for integration domain.
+    PetscDMLabel _label; ///< PETSc DMLabel for integration domain.
+    PetscInt _value; ///< Label value for integration domain.
+    int _dim; ///< Dimension of cells.
+    int _numQuadPts1D; ///< Number of quadrature points in each direction.
+
+    std::vector<PetscInt> _quadPermutation; ///< PETSc quadrature point for each tensor-product quadrature point.
+    std::vector<int> _numNodes1D; ///< Number of basis nodes in each direction for each subfield.
+    std::vector<std::vector<PylithReal> > _basis1D; ///< 1D basis at quadrature points for each subfield.
+    std::vector<std::vector<PylithReal> > _basisDeriv1D; ///< Derivative of 1D basis at quadrature points for each subfield.
+    std::vector<std::vector<PetscInt> > _closurePermutation; ///< Tensor-product index for each closure dof for each subfield.
+
+    PetscInt _geometryCellStart; ///< First cell in mesh for precomputed geometry.
+    std::vector<PetscInt> _geometryCellIndex; ///< Index of cell in precomputed geometry (-1 if not precomputed).
+    std::vector<PylithReal> _geometryCoordinates; ///< Coordinates of quadrature points for each cell.
+    std::vector<PylithReal> _geometryJacobianInv; ///< Inverse of Jacobian at quadrature points for each cell.
+    std::vector<PylithReal> _geometryWeightDet; ///< Quadrature weight times det(Jacobian) for each cell.
+
+    int _batchSize; ///< Number of cells integrated together in the sum factorization contractions.
+    bool _isApplicable; ///< True if sum factorization can be used.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    TensorResidual(const TensorResidual&); ///< Not implemented.
+    const TensorResidual& operator=(const TensorResidual&); ///< Not implemented.
+
+}; // TensorResidual
+
+#endif // pylith_feassemble_tensorresidual_hh
+
+// End of file
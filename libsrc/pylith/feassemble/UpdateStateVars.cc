@@ -30,6 +30,7 @@
 // Default constructor.
 pylith::feassemble::UpdateStateVars::UpdateStateVars(void) :
     _stateVarsIS(NULL),
+    _stateVarsISLocal(NULL),
     _stateVarsDM(NULL),
     _stateVarsVecLocal(NULL),
     _stateVarsVecGlobal(NULL),
@@ -51,6 +52,7 @@ pylith::feassemble::UpdateStateVars::deallocate(void) {
 
     PetscErrorCode err = 0;
     err = ISDestroy(&_stateVarsIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_stateVarsISLocal);PYLITH_CHECK_ERROR(err);
     err = DMDestroy(&_stateVarsDM);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
@@ -90,10 +92,12 @@ pylith::feassemble::UpdateStateVars::initialize(const pylith::topology::Field& a
     pylith::int_array stateSubfieldIndices(numAuxiliarySubfields);
 
     size_t numStateSubfields = 0;
+    bool isQuadratureStorage = true;
     for (size_t iSubfield = 0; iSubfield < numAuxiliarySubfields; ++iSubfield) {
         const pylith::topology::Field::SubfieldInfo& info = auxiliaryField.getSubfieldInfo(subfieldNames[iSubfield].c_str());
         if (info.description.hasHistory) {
             stateSubfieldIndices[numStateSubfields++] = info.index;
+            isQuadratureStorage = isQuadratureStorage && pylith::topology::FieldBase::POINT_SPACE == info.fe.feSpace;
         } // if
     } // for
     std::sort(&stateSubfieldIndices[0], &stateSubfieldIndices[numStateSubfields]);
@@ -101,10 +105,38 @@ pylith::feassemble::UpdateStateVars::initialize(const pylith::topology::Field& a
     // Create subDM holding only the state vars, which we want to update.
     err = DMCreateSubDM(auxiliaryDM, numStateSubfields, &stateSubfieldIndices[0], &_stateVarsIS,
                         &_stateVarsDM);PYLITH_CHECK_ERROR(err);
-    err = DMCreateGlobalVector(_stateVarsDM, &_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
     err = DMCreateLocalVector(_stateVarsDM, &_stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
 
-    err = DMCreateGlobalVector(auxiliaryDM, &_auxiliaryFieldVecGlobal);
+    if (isQuadratureStorage) {
+        // Map local state vars vector into local auxiliary field vector.
+        PetscSection auxiliarySection = auxiliaryField.getLocalSection();
+        PetscSection stateVarsSection = NULL;
+        err = DMGetLocalSection(_stateVarsDM, &stateVarsSection);PYLITH_CHECK_ERROR(err);
+        PetscInt storageSize = 0;
+        err = PetscSectionGetStorageSize(stateVarsSection, &storageSize);PYLITH_CHECK_ERROR(err);
+        PetscInt* indices = (storageSize > 0) ? new PetscInt[storageSize] : NULL;
+
+        PetscInt pStart = 0, pEnd = 0;
+        err = PetscSectionGetChart(stateVarsSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pEnd; ++point) {
+            for (size_t iState = 0; iState < numStateSubfields; ++iState) {
+                PetscInt numDof = 0, stateOffset = 0, auxiliaryOffset = 0;
+                err = PetscSectionGetFieldDof(stateVarsSection, point, iState, &numDof);PYLITH_CHECK_ERROR(err);
+                if (!numDof) { continue; }
+                err = PetscSectionGetFieldOffset(stateVarsSection, point, iState, &stateOffset);PYLITH_CHECK_ERROR(err);
+                err = PetscSectionGetFieldOffset(auxiliarySection, point, stateSubfieldIndices[iState], &auxiliaryOffset);PYLITH_CHECK_ERROR(err);
+                for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+                    assert(stateOffset+iDof < storageSize);
+                    indices[stateOffset+iDof] = auxiliaryOffset + iDof;
+                } // for
+            } // for
+        } // for
+        err = ISCreateGeneral(PETSC_COMM_SELF, storageSize, indices, PETSC_COPY_VALUES, &_stateVarsISLocal);PYLITH_CHECK_ERROR(err);
+        delete[] indices;indices = NULL;
+    } else {
+        err = DMCreateGlobalVector(_stateVarsDM, &_stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
+        err = DMCreateGlobalVector(auxiliaryDM, &_auxiliaryFieldVecGlobal);PYLITH_CHECK_ERROR(err);
+    } // if/else
 
     PYLITH_METHOD_END;
 } // initialize
@@ -121,6 +153,11 @@ pylith::feassemble::UpdateStateVars::prepare(pylith::topology::Field* auxiliaryF
     PetscErrorCode err = 0;
     err = VecSet(_stateVarsVecLocal, 0.0);PYLITH_CHECK_ERROR(err);
 
+    // State vars at quadrature points are local to each cell, so we do not need the global auxiliary vector.
+    if (_stateVarsISLocal) {
+        PYLITH_METHOD_END;
+    } // if
+
     // Move auxiliaryDM data to global vector.
     assert(auxiliaryField);
     PetscDM auxiliaryDM = auxiliaryField->getDM();
@@ -141,6 +178,11 @@ pylith::feassemble::UpdateStateVars::restore(pylith::topology::Field* auxiliaryF
     assert(auxiliaryField);
     PetscDM auxiliaryDM = auxiliaryField->getDM();
 
+    if (_stateVarsISLocal) {
+        err = VecISCopy(auxiliaryField->getLocalVector(), _stateVarsISLocal, SCATTER_FORWARD, _stateVarsVecLocal);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
     // Move statevarDM data to global vector.
     err = DMLocalToGlobalBegin(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
     err = DMLocalToGlobalEnd(_stateVarsDM, _stateVarsVecLocal, INSERT_VALUES, _stateVarsVecGlobal);PYLITH_CHECK_ERROR(err);
@@ -61,6 +61,10 @@ public:
     PetscVec stateVarsLocalVector(void);
 
     /** Initialize layout for updating state variables.
+     *
+     * If all of the state variables are stored at the quadrature points, then the degrees of freedom
+     * are local to each cell and we copy the updated values directly into the local auxiliary
+     * vector without going through global vectors.
      *
      * @param[in] auxiliaryField Auxiliary field containing state variables.
      */
@@ -82,6 +86,7 @@ public:
 private:
 
     PetscIS _stateVarsIS; ///< Petsc IS for state vars in auxiliary field.
+    PetscIS _stateVarsISLocal; ///< Petsc IS for state vars in local auxiliary field (state vars at quadrature points).
     PetscDM _stateVarsDM; ///< Petsc DM for state vars subfield.
     PetscVec _stateVarsVecLocal; ///< Petsc Vec with global vector for state vars.
     PetscVec _stateVarsVecGlobal; ///< Petsc Vec with global vector for state vars.
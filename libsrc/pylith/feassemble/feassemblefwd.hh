@@ -43,6 +43,7 @@ namespace pylith {
         class InterfacePatches; ///< Interface integration patches.
         class UpdateStateVars; ///< Manager for updating state variables.
         class JacobianValues; ///< Manager for setting Jacobian values without finite-element integration.
+        class TensorResidual; ///< Residual integration using sum factorization for tensor-product cells.
 
         class Constraint; ///< Abstract base class for finite-element constraints.
         class ConstraintSpatialDB; ///< Finite-element constraints via auxiliary field from spatial database.
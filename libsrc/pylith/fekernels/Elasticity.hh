@@ -84,7 +84,6 @@ public:
     // Interface for functions computing stress.
     typedef void (*stressfn_type) (void*,
                                    const pylith::fekernels::Tensor&,
-                                   const pylith::fekernels::TensorOps&,
                                    pylith::fekernels::Tensor*);
 
     // Interface for computing traction from stress.
@@ -176,27 +175,41 @@ public:
     } // f0v
 
     // --------------------------------------------------------------------------------------------
-    // f1 function for elasticity for velocity field (dynamic) and displacement field (quasi-static).
+    /** f1 function for elasticity for velocity field (dynamic) and displacement field (quasi-static)
+     * with the spatial dimension and the strain and stress functions fixed at compile time.
+     *
+     * The strain and stress functions are template arguments rather than runtime function pointers,
+     * and the stress components are copied to f1 with a layout fixed by DIM.
+     */
+    template<PylithInt DIM, strainfn_type strainFn, stressfn_type stressFn>
     static inline
     void f1v(const StrainContext& strainContext,
              void* rheologyContext,
-             strainfn_type strainFn,
-             stressfn_type stressFn,
-             const TensorOps& tensorOps,
              PylithScalar f1[]) {
+        assert(DIM == strainContext.dim);
+
         Tensor strain;
         strainFn(strainContext, &strain);
 
         Tensor stress;
-        stressFn(rheologyContext, strain, tensorOps, &stress);
-
-        PylithScalar stressTensor[9] = {0.0, 0.0, 0.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0 };
-        tensorOps.toTensor(stress, stressTensor);
-
-        const PylithInt dim = strainContext.dim;
-        for (PylithInt i = 0; i < dim*dim; ++i) {
-            f1[i] -= stressTensor[i];
-        } // for
+        stressFn(rheologyContext, strain, &stress);
+
+        if (2 == DIM) {
+            f1[0] -= stress.xx;
+            f1[1] -= stress.xy;
+            f1[2] -= stress.xy;
+            f1[3] -= stress.yy;
+        } else {
+            f1[0] -= stress.xx;
+            f1[1] -= stress.xy;
+            f1[2] -= stress.xz;
+            f1[3] -= stress.xy;
+            f1[4] -= stress.yy;
+            f1[5] -= stress.yz;
+            f1[6] -= stress.xz;
+            f1[7] -= stress.yz;
+            f1[8] -= stress.zz;
+        } // if/else
     } // f1v
 
     // --------------------------------------------------------------------------------------------
@@ -425,16 +438,16 @@ public:
      *
      * Solution fields: [disp(dim)]
      */
+    template<PylithInt DIM>
     static inline
     void strain_asVector(const StrainContext& context,
                          strainfn_type strainFn,
-                         const TensorOps& tensorOps,
                          PylithScalar strainVector[]) {
         assert(strainVector);
 
         Tensor strain;
         strainFn(context, &strain);
-        tensorOps.toVector(strain, strainVector);
+        TensorOps::toVector<DIM>(strain, strainVector);
     } // infinitesimalStrain_asVector
 
     // --------------------------------------------------------------------------------------------
@@ -446,12 +459,12 @@ public:
      *
      * Solution fields: [disp(dim)]
      */
+    template<PylithInt DIM>
     static inline
     void stress_asVector(const StrainContext& strainContext,
                          void* rheologyContext,
                          strainfn_type strainFn,
                          stressfn_type stressFn,
-                         const TensorOps& tensorOps,
                          PylithScalar stressVector[]) {
         assert(stressVector);
 
@@ -459,9 +472,9 @@ public:
         strainFn(strainContext, &strain);
 
         Tensor stress;
-        stressFn(rheologyContext, strain, tensorOps, &stress);
+        stressFn(rheologyContext, strain, &stress);
 
-        tensorOps.toVector(stress, stressVector);
+        TensorOps::toVector<DIM>(stress, stressVector);
     } // cauchyStress_asVector
 
 }; // Elasticity
@@ -532,7 +545,7 @@ public:
         pylith::fekernels::Elasticity::StrainContext context;
         pylith::fekernels::Elasticity::setStrainContext(&context, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
-        Elasticity::strain_asVector(context, infinitesimalStrain, Tensor::ops2D, strainVector);
+        Elasticity::strain_asVector<2>(context, infinitesimalStrain, strainVector);
     } // infinitesimalStrain_asVector3D
 
     // --------------------------------------------------------------------------------------------
@@ -617,7 +630,7 @@ public:
         pylith::fekernels::Elasticity::StrainContext context;
         pylith::fekernels::Elasticity::setStrainContext(&context, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
-        Elasticity::strain_asVector(context, infinitesimalStrain, Tensor::ops3D, strainVector);
+        Elasticity::strain_asVector<3>(context, infinitesimalStrain, strainVector);
     } // infinitesimalStrain_asVector
 
     // --------------------------------------------------------------------------------------------
@@ -439,7 +439,6 @@ public:
                  pylith::fekernels::Elasticity::strainfn_type strainFn,
                  pylith::fekernels::Elasticity::stressfn_type stressFn,
                  pylith::fekernels::Elasticity::tractionfn_type tractionFn,
-                 const pylith::fekernels::TensorOps& tensorOps,
                  PylithScalar f0[]) {
         // Incoming solution fields.
         const PylithInt i_lagrange = 2;
@@ -453,7 +452,7 @@ public:
         strainFn(strainContext, &strain);
 
         pylith::fekernels::Tensor stress;
-        stressFn(rheologyContext, strain, tensorOps, &stress);
+        stressFn(rheologyContext, strain, &stress);
 
         PylithReal traction[3] = { 0.0, 0.0, 0.0 };
         tractionFn(stress, n, traction);
@@ -480,7 +479,6 @@ public:
                  pylith::fekernels::Elasticity::strainfn_type strainFn,
                  pylith::fekernels::Elasticity::stressfn_type stressFn,
                  pylith::fekernels::Elasticity::tractionfn_type tractionFn,
-                 const pylith::fekernels::TensorOps& tensorOps,
                  PylithScalar f0[]) {
         // Incoming solution fields.
         const PylithInt i_lagrange = 2;
@@ -494,7 +492,7 @@ public:
         strainFn(strainContext, &strain);
 
         pylith::fekernels::Tensor stress;
-        stressFn(rheologyContext, strain, tensorOps, &stress);
+        stressFn(rheologyContext, strain, &stress);
 
         PylithReal traction[3] = { 0.0, 0.0, 0.0 };
         tractionFn(stress, n, traction);
@@ -62,7 +62,6 @@ public:
     // Function interface for computing incompressible term.
     typedef void (*incompressiblefn_type) (void*,
                                            const pylith::fekernels::Tensor&,
-                                           const pylith::fekernels::TensorOps&,
                                            PylithScalar*);
 
     // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,7 +78,6 @@ public:
              void* rheologyContext,
              pylith::fekernels::Elasticity::strainfn_type strainFn,
              pylith::fekernels::IncompressibleElasticity::incompressiblefn_type incompressibleFn,
-             const pylith::fekernels::TensorOps& tensorOps,
              PylithScalar f0[]) {
         assert(f0);
 
@@ -87,7 +85,7 @@ public:
         strainFn(strainContext, &strain);
 
         PylithScalar value = 0.0;
-        incompressibleFn(rheologyContext, strain, tensorOps, &value);
+        incompressibleFn(rheologyContext, strain, &value);
 
         f0[0] += value;
     } // f0p
@@ -100,6 +100,7 @@ public:
 public:
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext(Context* context,
                     const PylithInt dim,
@@ -118,8 +119,7 @@ public:
                     const PylithReal t,
                     const PylithScalar x[],
                     const PylithInt numConstants,
-                    const PylithScalar constants[],
-                    const pylith::fekernels::TensorOps& tensorOps) {
+                    const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_shearModulus = numA-2;
@@ -136,6 +136,7 @@ public:
     } // setContext
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext_refState(Context* context,
                              const PylithInt dim,
@@ -154,8 +155,7 @@ public:
                              const PylithReal t,
                              const PylithScalar x[],
                              const PylithInt numConstants,
-                             const PylithScalar constants[],
-                             const pylith::fekernels::TensorOps& tensorOps) {
+                             const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_refStress = numA-4;
@@ -174,8 +174,8 @@ public:
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
         context->bulkModulus = a[aOff[i_bulkModulus]];assert(context->bulkModulus > 0.0);
 
-        tensorOps.fromVector(&a[aOff[i_refStress]], &context->refStress);
-        tensorOps.fromVector(&a[aOff[i_refStrain]], &context->refStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStress]], &context->refStress);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStrain]], &context->refStrain);
     } // createContext
 
     // --------------------------------------------------------------------------------------------
@@ -185,13 +185,11 @@ public:
      *
      * @param[in] rheologyContext IsotropicLinearElasticity context.
      * @param[in] strain Strain tensor.
-     * @param[in] tensorOps Tensor operations.
      * @param[out] stress Stress tensor.
      */
     static inline
     void cauchyStress(void* rheologyContext,
                       const pylith::fekernels::Tensor& strain,
-                      const pylith::fekernels::TensorOps& tensorOps,
                       pylith::fekernels::Tensor* stress) {
         Context* context = (Context*)(rheologyContext);
         assert(context);
@@ -206,13 +204,11 @@ public:
      *
      * @param[in] rheologyContext IsotropicLinearElastcity context.
      * @param[in] strain Strain tensor.
-     * @param[in] tensorOps Tensor operations.
      * @param[out] stress Stress tensor.
      */
     static inline
     void cauchyStress_refState(void* rheologyContext,
                                const pylith::fekernels::Tensor& strain,
-                               const pylith::fekernels::TensorOps& tensorOps,
                                pylith::fekernels::Tensor* stress) {
         Context* context = (Context*)(rheologyContext);
         assert(context);
@@ -356,16 +352,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -400,16 +394,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -452,9 +444,9 @@ public:
                                    PylithScalar Jf3[]) {
         const PylithInt _dim = 2;assert(_dim == dim);
         pylith::fekernels::IsotropicLinearElasticity::Context context;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<2>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         assert(Jf3);
 
@@ -539,9 +531,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -549,7 +541,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -586,9 +577,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -596,7 +587,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -633,9 +623,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -643,7 +633,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -680,9 +669,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -690,7 +679,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -732,15 +720,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -778,15 +765,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     } // cauchyStress_infinitesimalStrain_refState_asVector
 
@@ -834,16 +820,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -878,16 +862,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -918,9 +900,9 @@ public:
                                    PylithScalar Jf3[]) {
         const PylithInt _dim = 3;assert(_dim == dim);
         pylith::fekernels::IsotropicLinearElasticity::Context context;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<3>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         assert(Jf3);
 
@@ -1080,9 +1062,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1090,7 +1072,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1127,9 +1108,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1137,7 +1118,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1174,9 +1154,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1184,7 +1164,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1221,9 +1200,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1231,7 +1210,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1273,15 +1251,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext(
+        pylith::fekernels::IsotropicLinearElasticity::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     }
 
@@ -1319,15 +1296,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearElasticity::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D, stressVector);
+            pylith::fekernels::IsotropicLinearElasticity::cauchyStress_refState, stressVector);
     }
 
 }; // IsotropicLinearElasticity3D
@@ -120,6 +120,7 @@ public:
 public:
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext(Context* context,
                     const PylithInt dim,
@@ -138,8 +139,7 @@ public:
                     const PylithReal t,
                     const PylithScalar x[],
                     const PylithInt numConstants,
-                    const PylithScalar constants[],
-                    const pylith::fekernels::TensorOps& tensorOps) {
+                    const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_shearModulus = numA-6;
@@ -168,13 +168,14 @@ public:
         context->dt = constants[0];
 
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithInt offset = i*tensorOps.vectorSize;
-            tensorOps.fromVector(&a[aOff[i_viscousStrain]+offset], &context->viscousStrain[i]);
+            const PylithInt offset = i*pylith::fekernels::TensorOps::vectorSize<DIM>();
+            pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_viscousStrain]+offset], &context->viscousStrain[i]);
         } // for
-        tensorOps.fromVector(&a[aOff[i_totalStrain]], &context->totalStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_totalStrain]], &context->totalStrain);
     } // setContext
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext_refState(Context* context,
                              const PylithInt dim,
@@ -193,8 +194,7 @@ public:
                              const PylithReal t,
                              const PylithScalar x[],
                              const PylithInt numConstants,
-                             const PylithScalar constants[],
-                             const pylith::fekernels::TensorOps& tensorOps) {
+                             const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_refStress = numA-8;
@@ -227,12 +227,12 @@ public:
         context->dt = constants[0];
 
         for (PylithInt i = 0; i < numParallel; ++i) {
-            const PylithInt offset = i*tensorOps.vectorSize;
-            tensorOps.fromVector(&a[aOff[i_viscousStrain]+offset], &context->viscousStrain[i]);
+            const PylithInt offset = i*pylith::fekernels::TensorOps::vectorSize<DIM>();
+            pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_viscousStrain]+offset], &context->viscousStrain[i]);
         } // for
-        tensorOps.fromVector(&a[aOff[i_totalStrain]], &context->totalStrain);
-        tensorOps.fromVector(&a[aOff[i_refStress]], &context->refStress);
-        tensorOps.fromVector(&a[aOff[i_refStrain]], &context->refStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_totalStrain]], &context->totalStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStress]], &context->refStress);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStrain]], &context->refStrain);
     } // createContext
 
     // --------------------------------------------------------------------------------------------
@@ -241,11 +241,11 @@ public:
      * Use in output of viscous strain.
      *
      */
+    template<PylithInt DIM>
     static inline
     void viscousStrain_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
                                 const Context& rheologyContext,
                                 pylith::fekernels::Elasticity::strainfn_type strainFn,
-                                const pylith::fekernels::TensorOps& tensorOps,
                                 PylithScalar viscousStrainVector[]) {
         assert(viscousStrainVector);
 
@@ -261,8 +261,8 @@ public:
 
             pylith::fekernels::IsotropicLinearMaxwell::viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrainTensor);
 
-            const PylithInt offset = i*tensorOps.vectorSize;
-            tensorOps.toVector(viscousStrainTensor, &viscousStrainVector[offset]);
+            const PylithInt offset = i*pylith::fekernels::TensorOps::vectorSize<DIM>();
+            pylith::fekernels::TensorOps::toVector<DIM>(viscousStrainTensor, &viscousStrainVector[offset]);
         } // for
     }
 
@@ -275,7 +275,6 @@ public:
     static inline
     void cauchyStress(void* rheologyContext,
                       const pylith::fekernels::Tensor& strain,
-                      const pylith::fekernels::TensorOps& tensorOps,
                       pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -311,7 +310,6 @@ public:
     static inline
     void cauchyStress_refState(void* rheologyContext,
                                const pylith::fekernels::Tensor& strain,
-                               const pylith::fekernels::TensorOps& tensorOps,
                                pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -348,7 +346,6 @@ public:
     static inline
     void cauchyStress_stateVars(void* rheologyContext,
                                 const pylith::fekernels::Tensor& strain,
-                                const pylith::fekernels::TensorOps& tensorOps,
                                 pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -374,7 +371,6 @@ public:
     static inline
     void cauchyStress_refState_stateVars(void* rheologyContext,
                                          const pylith::fekernels::Tensor& strain,
-                                         const pylith::fekernels::TensorOps& tensorOps,
                                          pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -557,16 +553,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // ------------------------------------------------------------------------------------------------
@@ -602,16 +596,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -645,9 +637,9 @@ public:
         const PylithInt numParallel = pylith::fekernels::IsotropicLinearGenMaxwell::numParallel;
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context context;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<2>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         const PylithScalar shearModulus = context.shearModulus;
         const PylithScalar bulkModulus = context.bulkModulus;
@@ -734,9 +726,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -744,7 +736,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -782,9 +773,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -792,7 +783,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -830,9 +820,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -840,7 +830,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -878,9 +867,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -888,7 +877,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -932,14 +920,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicLinearGenMaxwell::viscousStrain_asVector(
+        pylith::fekernels::IsotropicLinearGenMaxwell::viscousStrain_asVector<2>(
             strainContext, rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops2D,
             viscousStrain);
     }
 
@@ -981,15 +968,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_stateVars,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -1028,15 +1014,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState_stateVars,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -1084,16 +1069,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -1129,16 +1112,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -1174,9 +1155,9 @@ public:
         const PylithInt numParallel = pylith::fekernels::IsotropicLinearGenMaxwell::numParallel;
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context context;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<3>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         const PylithReal shearModulus = context.shearModulus;
         const PylithReal bulkModulus = context.bulkModulus;
@@ -1342,9 +1323,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1352,7 +1333,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1390,9 +1370,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1400,7 +1380,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1438,9 +1417,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1448,7 +1427,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1486,9 +1464,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1496,7 +1474,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1537,14 +1514,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicLinearGenMaxwell::viscousStrain_asVector(
+        pylith::fekernels::IsotropicLinearGenMaxwell::viscousStrain_asVector<3>(
             strainContext, rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops3D,
             viscousStrain);
     }
 
@@ -1586,15 +1562,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_stateVars,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     }
 
@@ -1632,15 +1607,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearGenMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearGenMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearGenMaxwell::cauchyStress_refState_stateVars,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     }
 
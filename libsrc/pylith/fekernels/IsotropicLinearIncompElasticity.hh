@@ -99,6 +99,7 @@ public:
 public:
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext(Context* context,
                     const PylithInt dim,
@@ -117,8 +118,7 @@ public:
                     const PylithReal t,
                     const PylithScalar x[],
                     const PylithInt numConstants,
-                    const PylithScalar constants[],
-                    const pylith::fekernels::TensorOps& tensorOps) {
+                    const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_pressure = numS-1;
@@ -140,6 +140,7 @@ public:
     } // setContext
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext_refState(Context* context,
                              const PylithInt dim,
@@ -158,8 +159,7 @@ public:
                              const PylithReal t,
                              const PylithScalar x[],
                              const PylithInt numConstants,
-                             const PylithScalar constants[],
-                             const pylith::fekernels::TensorOps& tensorOps) {
+                             const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_pressure = numS-1;
@@ -183,8 +183,8 @@ public:
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
         context->bulkModulus = a[aOff[i_bulkModulus]];assert(context->bulkModulus > 0.0);
 
-        tensorOps.fromVector(&a[aOff[i_refStress]], &context->refStress);
-        tensorOps.fromVector(&a[aOff[i_refStrain]], &context->refStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStress]], &context->refStress);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStrain]], &context->refStrain);
     } // createContext
 
     // ===========================================================================================
@@ -231,6 +231,53 @@ public:
         Jf0[0] += 1.0 / bulkModulus;
     } // Jf0pp
 
+    // --------------------------------------------------------------------------------------------
+    /** Jf0_pp entry function for preconditioner of the Schur complement for isotropic linear
+     * incompressible elasticity.
+     *
+     * The Schur complement, S = J_pp - J_pu J_uu^{-1} J_up, is spectrally equivalent to the
+     * pressure mass matrix scaled by 1/shear_modulus + 1/bulk_modulus.
+     *
+     * Solution fields: [disp(dim), pressure(1)]
+     * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)]
+     */
+    static inline
+    void Jf0pp_schurPrecond(const PylithInt dim,
+                            const PylithInt numS,
+                            const PylithInt numA,
+                            const PylithInt sOff[],
+                            const PylithInt sOff_x[],
+                            const PylithScalar s[],
+                            const PylithScalar s_t[],
+                            const PylithScalar s_x[],
+                            const PylithInt aOff[],
+                            const PylithInt aOff_x[],
+                            const PylithScalar a[],
+                            const PylithScalar a_t[],
+                            const PylithScalar a_x[],
+                            const PylithReal t,
+                            const PylithReal s_tshift,
+                            const PylithScalar x[],
+                            const PylithInt numConstants,
+                            const PylithScalar constants[],
+                            PylithScalar Jf0[]) {
+        // Incoming auxiliary subfields
+        const PylithInt i_shearModulus = numA-2;
+        const PylithInt i_bulkModulus = numA-1;
+
+        assert(numA >= 2);
+        assert(aOff);
+        assert(aOff[i_shearModulus] >= 0);
+        assert(aOff[i_bulkModulus] >= 0);
+        assert(a);
+        assert(Jf0);
+
+        const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+        const PylithScalar bulkModulus = a[aOff[i_bulkModulus]];
+
+        Jf0[0] += 1.0 / shearModulus + 1.0 / bulkModulus;
+    } // Jf0pp_schurPrecond
+
     // ===========================================================================================
     // Helper functions
     // ===========================================================================================
@@ -244,7 +291,6 @@ public:
     static inline
     void incompressibleTerm(void* rheologyContext,
                             const pylith::fekernels::Tensor& strain,
-                            const pylith::fekernels::TensorOps& tensorOps,
                             PylithScalar* value) {
         assert(value);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -265,7 +311,6 @@ public:
     static inline
     void incompressibleTerm_refState(void* rheologyContext,
                                      const pylith::fekernels::Tensor& strain,
-                                     const pylith::fekernels::TensorOps& tensorOps,
                                      PylithScalar* value) {
         assert(value);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -289,13 +334,11 @@ public:
      *
      * @param[in] rheologyContext IsotropicLinearElasticity context.
      * @param[in] strain Strain tensor.
-     * @param[in] tensorOps Tensor operations.
      * @param[out] stress Stress tensor.
      */
     static inline
     void cauchyStress(void* rheologyContext,
                       const pylith::fekernels::Tensor& strain,
-                      const pylith::fekernels::TensorOps& tensorOps,
                       Tensor* stress) {
         Context* context = (Context*)(rheologyContext);
         assert(context);
@@ -316,13 +359,11 @@ public:
      *
      * @param[in] rheologyContext IsotropicLinearElasticity context.
      * @param[in] strain Strain tensor.
-     * @param[in] tensorOps Tensor operations.
      * @param[out] stress Stress tensor.
      */
     static inline
     void cauchyStress_refState(void* rheologyContext,
                                const pylith::fekernels::Tensor& strain,
-                               const pylith::fekernels::TensorOps& tensorOps,
                                Tensor* stress) {
         Context* context = (Context*)(rheologyContext);
         assert(context);
@@ -381,15 +422,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::IncompressibleElasticity::f0p(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearIncompElasticity::incompressibleTerm,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -425,15 +465,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::IncompressibleElasticity::f0p(
             strainContext, &rheologyContext,
             ElasticityPlaneStrain::infinitesimalStrain,
             IsotropicLinearIncompElasticity::incompressibleTerm_refState,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -469,16 +508,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     } // f1u_infinitesimalStrain
 
     // --------------------------------------------------------------------------------------------
@@ -513,16 +550,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -554,9 +589,9 @@ public:
         const PylithInt _dim = 2;assert(_dim == dim);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context context;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<2>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         const PylithScalar shearModulus = context.shearModulus;
 
@@ -636,15 +671,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -682,15 +716,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -737,15 +770,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::IncompressibleElasticity::f0p(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearIncompElasticity::incompressibleTerm,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     } // f0p_infinitesimalStrain
 
@@ -781,15 +813,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::IncompressibleElasticity::f0p(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearIncompElasticity::incompressibleTerm_refState,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     } // f0p_infinitesimalStrain_refState
 
@@ -825,16 +856,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     } // f1u_infinitesimalStrain
 
     // --------------------------------------------------------------------------------------------
@@ -869,16 +898,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     } // f1u_infinitesimalStrain_refState
 
     // --------------------------------------------------------------------------------------------
@@ -910,9 +937,9 @@ public:
         const PylithInt _dim = 3;assert(_dim == dim);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context context;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<3>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         const PylithScalar shearModulus = context.shearModulus;
 
@@ -1074,15 +1101,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     } // cauchyStress_infinitesimalStrain_asVector
 
@@ -1120,15 +1146,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearIncompElasticity::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState(
+        pylith::fekernels::IsotropicLinearIncompElasticity::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearIncompElasticity::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     } // cauchyStress_infinitesimalStrain_refState_asVector
 
@@ -114,6 +114,7 @@ public:
 public:
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext(Context* context,
                     const PylithInt dim,
@@ -132,8 +133,7 @@ public:
                     const PylithReal t,
                     const PylithScalar x[],
                     const PylithInt numConstants,
-                    const PylithScalar constants[],
-                    const pylith::fekernels::TensorOps& tensorOps) {
+                    const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_shearModulus = numA-5;
@@ -158,11 +158,12 @@ public:
         context->maxwellTime = a[aOff[i_maxwellTime]];assert(context->maxwellTime > 0.0);
         context->dt = constants[0];
 
-        tensorOps.fromVector(&a[aOff[i_viscousStrain]], &context->viscousStrain);
-        tensorOps.fromVector(&a[aOff[i_totalStrain]], &context->totalStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_viscousStrain]], &context->viscousStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_totalStrain]], &context->totalStrain);
     } // setContext
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext_refState(Context* context,
                              const PylithInt dim,
@@ -181,8 +182,7 @@ public:
                              const PylithReal t,
                              const PylithScalar x[],
                              const PylithInt numConstants,
-                             const PylithScalar constants[],
-                             const pylith::fekernels::TensorOps& tensorOps) {
+                             const PylithScalar constants[]) {
         assert(context);
 
         const PylithInt i_refStress = numA-7;
@@ -203,15 +203,18 @@ public:
         assert(aOff[i_maxwellTime] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_totalStrain] >= 0);
+        assert(1 == numConstants);
+        assert(constants);
 
         context->shearModulus = a[aOff[i_shearModulus]];assert(context->shearModulus > 0.0);
         context->bulkModulus = a[aOff[i_bulkModulus]];assert(context->bulkModulus > 0.0);
         context->maxwellTime = a[aOff[i_maxwellTime]];assert(context->maxwellTime > 0.0);
+        context->dt = constants[0];
 
-        tensorOps.fromVector(&a[aOff[i_viscousStrain]], &context->viscousStrain);
-        tensorOps.fromVector(&a[aOff[i_totalStrain]], &context->totalStrain);
-        tensorOps.fromVector(&a[aOff[i_refStress]], &context->refStress);
-        tensorOps.fromVector(&a[aOff[i_refStrain]], &context->refStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_viscousStrain]], &context->viscousStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_totalStrain]], &context->totalStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStress]], &context->refStress);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStrain]], &context->refStrain);
     } // createContext
 
     // --------------------------------------------------------------------------------------------
@@ -234,11 +237,11 @@ public:
      * Used to output of viscous strain.
      *
      */
+    template<PylithInt DIM>
     static inline
     void viscousStrain_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
                                 const Context& rheologyContext,
                                 pylith::fekernels::Elasticity::strainfn_type strainFn,
-                                const pylith::fekernels::TensorOps& tensorOps,
                                 PylithScalar viscousStrainVector[]) {
         assert(viscousStrainVector);
 
@@ -252,7 +255,7 @@ public:
         pylith::fekernels::Tensor viscousStrainTensor;
         viscousStrain(maxwellTime, viscousStrainPrev, totalStrain, strain, dt, &viscousStrainTensor);
 
-        tensorOps.toVector(viscousStrainTensor, viscousStrainVector);
+        pylith::fekernels::TensorOps::toVector<DIM>(viscousStrainTensor, viscousStrainVector);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -292,7 +295,6 @@ public:
     static inline
     void cauchyStress(void* rheologyContext,
                       const pylith::fekernels::Tensor& strain,
-                      const pylith::fekernels::TensorOps& tensorOps,
                       pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -321,7 +323,6 @@ public:
     static inline
     void cauchyStress_refState(void* rheologyContext,
                                const pylith::fekernels::Tensor& strain,
-                               const pylith::fekernels::TensorOps& tensorOps,
                                pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -351,7 +352,6 @@ public:
     static inline
     void cauchyStress_stateVars(void* rheologyContext,
                                 const pylith::fekernels::Tensor& strain,
-                                const pylith::fekernels::TensorOps& tensorOps,
                                 pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -373,7 +373,6 @@ public:
     static inline
     void cauchyStress_refState_stateVars(void* rheologyContext,
                                          const pylith::fekernels::Tensor& strain,
-                                         const pylith::fekernels::TensorOps& tensorOps,
                                          pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -479,16 +478,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -524,16 +521,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -565,9 +560,9 @@ public:
         const PylithInt _dim = 2;assert(_dim == dim);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context context;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<2>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         const PylithScalar shearModulus = context.shearModulus;
         const PylithScalar bulkModulus = context.bulkModulus;
@@ -649,9 +644,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -659,7 +654,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -696,9 +690,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -706,7 +700,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -743,9 +736,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -753,7 +746,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -790,9 +782,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -800,7 +792,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -844,14 +835,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain_asVector(
+        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain_asVector<2>(
             strainContext, rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops2D,
             viscousStrain);
     }
 
@@ -893,15 +883,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_stateVars,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -940,15 +929,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState_stateVars,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -996,16 +984,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -1041,16 +1027,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -1083,9 +1067,9 @@ public:
         const PylithInt _dim = 3;assert(_dim == dim);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context context;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<3>(
             &context, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         const PylithScalar shearModulus = context.shearModulus;
         const PylithScalar bulkModulus = context.bulkModulus;
@@ -1245,9 +1229,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1255,7 +1239,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1292,9 +1275,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1302,7 +1285,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1339,9 +1321,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1349,7 +1331,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1386,9 +1367,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1396,7 +1377,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -1438,14 +1418,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain_asVector(
+        pylith::fekernels::IsotropicLinearMaxwell::viscousStrain_asVector<3>(
             strainContext, rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops3D,
             viscousStrain);
     }
 
@@ -1487,15 +1466,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_stateVars,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     }
 
@@ -1533,15 +1511,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicLinearMaxwell::Context rheologyContext;
-        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState(
+        pylith::fekernels::IsotropicLinearMaxwell::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicLinearMaxwell::cauchyStress_refState_stateVars,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     }
 
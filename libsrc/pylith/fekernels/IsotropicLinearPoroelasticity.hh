@@ -2404,8 +2404,8 @@ public:
                         const PylithScalar constants[],
                         PylithScalar porosity[]);
 
-#endif // pylith_fekernels_isotropiclinearporoelasticity_hh
-
 }; // IsotropicLinearPoroelasticity3D
 
+#endif // pylith_fekernels_isotropiclinearporoelasticity_hh
+
 // End of file
@@ -44,6 +44,7 @@
  * -11: deviatoric_stress
  *     2D: 4 components (devstress_xx, devstress_yy, devstress_zz, devstress_xy)
  *     3D: 6 components (devstress_xx, devstress_yy, devstress_zz, devstress_xy, devstress_yz, devstress_xz)
+ * -12: effective_stress(1)
  *
  * The elasticity subfields come first (with required ones before optional ones) followed by the rheology subfields
  * (optional ones before required ones). The rheology fields have required fields last because we index from the back.
@@ -82,12 +83,17 @@
 #include "fekernelsfwd.hh" // forward declarations
 #include "pylith/fekernels/Elasticity.hh" // USES Elasticity kernels
 #include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity* kernels
+#include "pylith/fekernels/KernelStatus.hh" // USES KernelStatus
 
 #include "pylith/utils/types.hh"
 
+#include <cmath> // USES pow(), sqrt(), std::isfinite()
+
 // ------------------------------------------------------------------------------------------------
 /// Kernels for isotropic power-law viscoelasticity (dimension independent).
 class pylith::fekernels::IsotropicPowerLaw {
+    friend class TestIsotropicPowerLawKernels; // unit testing
+
     // PUBLIC MEMBERS /////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -103,6 +109,7 @@ public:
         pylith::fekernels::Tensor refStrain;
         pylith::fekernels::Tensor viscousStrain;
         pylith::fekernels::Tensor devStress;
+        PylithReal effectiveStress; ///< Converged effective stress from last update (0 if not available).
 
         Context(void) :
             bulkModulus(0.0),
@@ -110,7 +117,8 @@ public:
             powerLawRefStress(0.0),
             powerLawRefStrainRate(0.0),
             powerLawExponent(0.0),
-            dt(0.0) {}
+            dt(0.0),
+            effectiveStress(0.0) {}
 
 
     };
@@ -119,6 +127,7 @@ public:
 public:
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext(Context* context,
                     const PylithInt dim,
@@ -137,19 +146,19 @@ public:
                     const PylithReal t,
                     const PylithScalar x[],
                     const PylithInt numConstants,
-                    const PylithScalar constants[],
-                    const pylith::fekernels::TensorOps& tensorOps) {
+                    const PylithScalar constants[]) {
         assert(context);
 
-        const PylithInt i_shearModulus = numA-7;
-        const PylithInt i_bulkModulus = numA-6;
-        const PylithInt i_powerLawRefStrainRate = numA-5;
-        const PylithInt i_powerLawRefStress = numA-4;
-        const PylithInt i_powerLawExponent = numA-3;
-        const PylithInt i_viscousStrain = numA-2;
-        const PylithInt i_devStress = numA-1;
+        const PylithInt i_shearModulus = numA-8;
+        const PylithInt i_bulkModulus = numA-7;
+        const PylithInt i_powerLawRefStrainRate = numA-6;
+        const PylithInt i_powerLawRefStress = numA-5;
+        const PylithInt i_powerLawExponent = numA-4;
+        const PylithInt i_viscousStrain = numA-3;
+        const PylithInt i_devStress = numA-2;
+        const PylithInt i_effectiveStress = numA-1;
 
-        assert(numA >= 8); // also have density
+        assert(numA >= 9); // also have density
         assert(a);
         assert(aOff);
         assert(aOff[i_shearModulus] >= 0);
@@ -159,6 +168,7 @@ public:
         assert(aOff[i_powerLawExponent] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_devStress] >= 0);
+        assert(aOff[i_effectiveStress] >= 0);
         assert(1 == numConstants);
         assert(constants);
 
@@ -168,12 +178,14 @@ public:
         context->powerLawRefStress = a[aOff[i_powerLawRefStress]];assert(context->powerLawRefStress > 0.0);
         context->powerLawExponent = a[aOff[i_powerLawExponent]];assert(context->powerLawExponent > 0.0);
         context->dt = constants[0];assert(context->dt > 0.0);
+        context->effectiveStress = a[aOff[i_effectiveStress]];
 
-        tensorOps.fromVector(&a[aOff[i_viscousStrain]], &context->viscousStrain);
-        tensorOps.fromVector(&a[aOff[i_devStress]], &context->devStress);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_viscousStrain]], &context->viscousStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_devStress]], &context->devStress);
     } // setContext
 
     // --------------------------------------------------------------------------------------------
+    template<PylithInt DIM>
     static inline
     void setContext_refState(Context* context,
                              const PylithInt dim,
@@ -192,21 +204,21 @@ public:
                              const PylithReal t,
                              const PylithScalar x[],
                              const PylithInt numConstants,
-                             const PylithScalar constants[],
-                             const pylith::fekernels::TensorOps& tensorOps) {
+                             const PylithScalar constants[]) {
         assert(context);
 
-        const PylithInt i_refStress = numA-9;
-        const PylithInt i_refStrain = numA-8;
-        const PylithInt i_shearModulus = numA-7;
-        const PylithInt i_bulkModulus = numA-6;
-        const PylithInt i_powerLawRefStrainRate = numA-5;
-        const PylithInt i_powerLawRefStress = numA-4;
-        const PylithInt i_powerLawExponent = numA-3;
-        const PylithInt i_viscousStrain = numA-2;
-        const PylithInt i_devStress = numA-1;
-
-        assert(numA >= 10); // also have density
+        const PylithInt i_refStress = numA-10;
+        const PylithInt i_refStrain = numA-9;
+        const PylithInt i_shearModulus = numA-8;
+        const PylithInt i_bulkModulus = numA-7;
+        const PylithInt i_powerLawRefStrainRate = numA-6;
+        const PylithInt i_powerLawRefStress = numA-5;
+        const PylithInt i_powerLawExponent = numA-4;
+        const PylithInt i_viscousStrain = numA-3;
+        const PylithInt i_devStress = numA-2;
+        const PylithInt i_effectiveStress = numA-1;
+
+        assert(numA >= 11); // also have density
         assert(a);
         assert(aOff);
         assert(aOff[i_refStress] >= 0);
@@ -218,6 +230,7 @@ public:
         assert(aOff[i_powerLawExponent] >= 0);
         assert(aOff[i_viscousStrain] >= 0);
         assert(aOff[i_devStress] >= 0);
+        assert(aOff[i_effectiveStress] >= 0);
         assert(1 == numConstants);
         assert(constants);
 
@@ -227,11 +240,12 @@ public:
         context->powerLawRefStress = a[aOff[i_powerLawRefStress]];assert(context->powerLawRefStress > 0.0);
         context->powerLawExponent = a[aOff[i_powerLawExponent]];assert(context->powerLawExponent > 0.0);
         context->dt = constants[0];assert(context->dt > 0.0);
+        context->effectiveStress = a[aOff[i_effectiveStress]];
 
-        tensorOps.fromVector(&a[aOff[i_refStress]], &context->refStress);
-        tensorOps.fromVector(&a[aOff[i_refStrain]], &context->refStrain);
-        tensorOps.fromVector(&a[aOff[i_viscousStrain]], &context->viscousStrain);
-        tensorOps.fromVector(&a[aOff[i_devStress]], &context->devStress);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStress]], &context->refStress);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_refStrain]], &context->refStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_viscousStrain]], &context->viscousStrain);
+        pylith::fekernels::TensorOps::fromVector<DIM>(&a[aOff[i_devStress]], &context->devStress);
     } // createContext
 
     // --------------------------------------------------------------------------------------------
@@ -243,7 +257,6 @@ public:
     static inline
     void cauchyStress(void* rheologyContext,
                       const pylith::fekernels::Tensor& strain,
-                      const pylith::fekernels::TensorOps& tensorOps,
                       pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -263,7 +276,6 @@ public:
     static inline
     void cauchyStress_refState(void* rheologyContext,
                                const pylith::fekernels::Tensor& strain,
-                               const pylith::fekernels::TensorOps& tensorOps,
                                pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -278,11 +290,17 @@ public:
 
     // --------------------------------------------------------------------------------------------
     /** Calculate deviatoric stress WITHOUT reference stress and strain.
+     *
+     * @param[in] context Rheology context.
+     * @param[in] strain Strain tensor.
+     * @param[inout] stress Stress tensor (deviatoric stress is added).
+     * @param[out] effectiveStress Effective stress at t+dt (optional).
      */
     static inline
     void deviatoricStress(const Context& context,
                           const pylith::fekernels::Tensor& strain,
-                          pylith::fekernels::Tensor* stress) {
+                          pylith::fekernels::Tensor* stress,
+                          PylithReal* effectiveStress=NULL) {
         assert(stress);
 
         const PylithReal shearModulus = context.shearModulus;
@@ -319,12 +337,16 @@ public:
         const PylithReal d = timeFac * j2T;
         PylithReal j2Tpdt = 0.0;
         if ((b != 0.0) || (c != 0.0) || (d != 0.0)) {
-            const PylithReal j2InitialGuess = j2T;
+            // Use converged effective stress from the last update if available.
+            const PylithReal j2InitialGuess = (context.effectiveStress > 0.0) ? context.effectiveStress : j2T;
             const PylithReal stressScale = shearModulus;
             j2Tpdt = _effectiveStress(j2InitialGuess, stressScale, ae, b, c, d, dt, j2T,
                                       powerLawExponent, powerLawRefStrainRate,
                                       powerLawRefStress);
         } // if
+        if (effectiveStress) {
+            *effectiveStress = j2Tpdt;
+        } // if
         // Compute deviatoric stresses from effective stress.
         const PylithReal j2Tau = (1.0 - powerLawAlpha) * j2T + powerLawAlpha * j2Tpdt;
         const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) / powerLawRefStress;
@@ -341,11 +363,17 @@ public:
 
     // --------------------------------------------------------------------------------------------
     /** Calculate deviatoric stress WITH reference stress and strain.
+     *
+     * @param[in] context Rheology context.
+     * @param[in] strain Strain tensor.
+     * @param[inout] stress Stress tensor (deviatoric stress is added).
+     * @param[out] effectiveStress Effective stress at t+dt (optional).
      */
     static inline
     void deviatoricStress_refState(const Context& context,
                                    const pylith::fekernels::Tensor& strain,
-                                   pylith::fekernels::Tensor* stress) {
+                                   pylith::fekernels::Tensor* stress,
+                                   PylithReal* effectiveStress=NULL) {
         assert(stress);
 
         const PylithReal shearModulus = context.shearModulus;
@@ -390,12 +418,16 @@ public:
         const PylithReal d = timeFac * j2T;
         PylithReal j2Tpdt = 0.0;
         if ((b != 0.0) || (c != 0.0) || (d != 0.0)) {
-            const PylithReal j2InitialGuess = j2T;
+            // Use converged effective stress from the last update if available.
+            const PylithReal j2InitialGuess = (context.effectiveStress > 0.0) ? context.effectiveStress : j2T;
             const PylithReal stressScale = shearModulus;
             j2Tpdt = _effectiveStress(j2InitialGuess, stressScale, ae, b, c, d, dt, j2T,
                                       powerLawExponent, powerLawRefStrainRate,
                                       powerLawRefStress);
         } // if
+        if (effectiveStress) {
+            *effectiveStress = j2Tpdt;
+        } // if
         // Compute deviatoric stresses from effective stress.
         const PylithReal j2Tau = (1.0 - powerLawAlpha) * j2T + powerLawAlpha * j2Tpdt;
         const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) / powerLawRefStress;
@@ -419,7 +451,6 @@ public:
     static inline
     void cauchyStress_stateVars(void* rheologyContext,
                                 const pylith::fekernels::Tensor& strain,
-                                const pylith::fekernels::TensorOps& tensorOps,
                                 pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -447,7 +478,6 @@ public:
     static inline
     void cauchyStress_refState_stateVars(void* rheologyContext,
                                          const pylith::fekernels::Tensor& strain,
-                                         const pylith::fekernels::TensorOps& tensorOps,
                                          pylith::fekernels::Tensor* stress) {
         assert(stress);
         Context* context = (Context*)(rheologyContext);assert(context);
@@ -477,11 +507,11 @@ public:
      * Used to update viscous strain state variable.
      *
      */
+    template<PylithInt DIM>
     static inline
     void viscousStrain_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
                                 const Context& rheologyContext,
                                 pylith::fekernels::Elasticity::strainfn_type strainFn,
-                                const pylith::fekernels::TensorOps& tensorOps,
                                 PylithScalar viscousStrainVector[]) {
         assert(viscousStrainVector);
 
@@ -494,7 +524,7 @@ public:
         pylith::fekernels::Tensor viscousStrainTensor;
         _viscousStrain(rheologyContext, devStressTpdt, &viscousStrainTensor);
 
-        tensorOps.toVector(viscousStrainTensor, viscousStrainVector);
+        pylith::fekernels::TensorOps::toVector<DIM>(viscousStrainTensor, viscousStrainVector);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -505,11 +535,11 @@ public:
      * Solution fields: [disp(dim)]
      * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), viscous_strain(4), total_strain(4)]
      */
+    template<PylithInt DIM>
     static inline
     void viscousStrain_refState_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
                                          const Context& rheologyContext,
                                          pylith::fekernels::Elasticity::strainfn_type strainFn,
-                                         const pylith::fekernels::TensorOps& tensorOps,
                                          PylithScalar viscousStrainVector[]) {
         assert(viscousStrainVector);
 
@@ -522,7 +552,7 @@ public:
         pylith::fekernels::Tensor viscousStrainTensor;
         _viscousStrain(rheologyContext, devStressTpdt, &viscousStrainTensor);
 
-        tensorOps.toVector(viscousStrainTensor, viscousStrainVector);
+        pylith::fekernels::TensorOps::toVector<DIM>(viscousStrainTensor, viscousStrainVector);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -531,11 +561,11 @@ public:
      * Used to update deviatoric stress state variable.
      *
      */
+    template<PylithInt DIM>
     static inline
     void deviatoricStress_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
                                    const Context& rheologyContext,
                                    pylith::fekernels::Elasticity::strainfn_type strainFn,
-                                   const pylith::fekernels::TensorOps& tensorOps,
                                    PylithScalar devStressVector[]) {
         assert(devStressVector);
 
@@ -545,7 +575,7 @@ public:
         pylith::fekernels::Tensor devStressTensor;
         deviatoricStress(rheologyContext, strain, &devStressTensor);
 
-        tensorOps.toVector(devStressTensor, devStressVector);
+        pylith::fekernels::TensorOps::toVector<DIM>(devStressTensor, devStressVector);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -556,11 +586,11 @@ public:
      * Solution fields: [disp(dim)]
      * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1), maxwell_time(1), viscous_strain(4), total_strain(4)]
      */
+    template<PylithInt DIM>
     static inline
     void deviatoricStress_refState_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
                                             const Context& rheologyContext,
                                             pylith::fekernels::Elasticity::strainfn_type strainFn,
-                                            const pylith::fekernels::TensorOps& tensorOps,
                                             PylithScalar devStressVector[]) {
         assert(devStressVector);
 
@@ -570,7 +600,53 @@ public:
         pylith::fekernels::Tensor devStressTensor;
         deviatoricStress_refState(rheologyContext, strain, &devStressTensor);
 
-        tensorOps.toVector(devStressTensor, devStressVector);
+        pylith::fekernels::TensorOps::toVector<DIM>(devStressTensor, devStressVector);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Calculate effective stress.
+     *
+     * Used to update the effective stress state variable, which provides the initial guess for the
+     * effective stress root solve in the next time step.
+     */
+    static inline
+    void effectiveStress_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
+                                  const Context& rheologyContext,
+                                  pylith::fekernels::Elasticity::strainfn_type strainFn,
+                                  PylithScalar effectiveStress[]) {
+        assert(effectiveStress);
+
+        Tensor strain;
+        strainFn(strainContext, &strain);
+
+        pylith::fekernels::Tensor devStressTensor;
+        PylithReal j2Tpdt = 0.0;
+        deviatoricStress(rheologyContext, strain, &devStressTensor, &j2Tpdt);
+
+        effectiveStress[0] = j2Tpdt;
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Calculate effective stress WITH reference stress and strain.
+     *
+     * Used to update the effective stress state variable, which provides the initial guess for the
+     * effective stress root solve in the next time step.
+     */
+    static inline
+    void effectiveStress_refState_asVector(const pylith::fekernels::Elasticity::StrainContext& strainContext,
+                                           const Context& rheologyContext,
+                                           pylith::fekernels::Elasticity::strainfn_type strainFn,
+                                           PylithScalar effectiveStress[]) {
+        assert(effectiveStress);
+
+        Tensor strain;
+        strainFn(strainContext, &strain);
+
+        pylith::fekernels::Tensor devStressTensor;
+        PylithReal j2Tpdt = 0.0;
+        deviatoricStress_refState(rheologyContext, strain, &devStressTensor, &j2Tpdt);
+
+        effectiveStress[0] = j2Tpdt;
     }
 
 private:
@@ -637,28 +713,131 @@ private:
         assert(j2InitialGuess >= 0.0);
         // If initial guess is too low, use stress scale instead.
         const PylithReal xMin = 1.0e-10;
+        const PylithReal xGuess = (j2InitialGuess > xMin) ? j2InitialGuess : stressScale;
 
-        // Bracket the root.
-        PylithReal xL = 0.0;
-        PylithReal xR = 0.0;
-        if (j2InitialGuess > xMin) {
-            xL = 0.5 * j2InitialGuess;
-            xR = 1.5 * j2InitialGuess;
-        } else {
-            xL = 0.5 * stressScale;
-            xR = 1.5 * stressScale;
-        } // else
-
-        _bracket(&xL, &xR, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate,
-                 powerLawRefStress);
+        // Warm start Newton's method from the root with the viscosity frozen at the initial guess.
+        PylithReal effStress = _effectiveStressPredictor(xGuess, ae, b, c, d, dt, j2T, powerLawExponent,
+                                                         powerLawRefStrainRate, powerLawRefStress);
+        if (_newton(&effStress, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress)) {
+            return effStress;
+        } // if
 
-        // Find effective stress using Newton's method with bisection.
-        PylithReal effStress = _search(xL, xR, ae, b, c, d, dt, j2T, powerLawExponent,
-                                       powerLawRefStrainRate, powerLawRefStress);
+        // Fall back to bracketing the root followed by Newton's method with bisection.
+        PylithReal xL = 0.5 * xGuess;
+        PylithReal xR = 1.5 * xGuess;
+        if (!_bracket(&xL, &xR, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate,
+                      powerLawRefStress)) {
+            // Flag failure and return the initial guess so the residual remains finite.
+            KernelStatus::setFailed();
+            return xGuess;
+        } // if
+        effStress = _search(xL, xR, ae, b, c, d, dt, j2T, powerLawExponent,
+                            powerLawRefStrainRate, powerLawRefStress);
 
         return effStress;
     }
 
+    // --------------------------------------------------------------------------------------------
+    /** Estimate effective stress by holding the viscosity fixed at the value for a trial effective stress.
+     *
+     * With the viscosity fixed, the effective stress function is quadratic in the effective stress, so
+     * the estimate is much closer to the root than the trial value when the viscosity changes slowly.
+     *
+     */
+    static inline
+    PylithReal _effectiveStressPredictor(const PylithReal j2Trial,
+                                         const PylithReal ae,
+                                         const PylithReal b,
+                                         const PylithReal c,
+                                         const PylithReal d,
+                                         const PylithReal dt,
+                                         const PylithReal j2T,
+                                         const PylithReal powerLawExponent,
+                                         const PylithReal powerLawRefStrainRate,
+                                         const PylithReal powerLawRefStress) {
+        const PylithReal j2Tau = (1.0 - powerLawAlpha) * j2T + powerLawAlpha * j2Trial;
+        const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) /
+                                    powerLawRefStress;
+        const PylithReal a = ae + powerLawAlpha * dt * gammaTau;
+        const PylithReal aj2Squared = b - c * gammaTau + d * d * gammaTau * gammaTau;
+
+        return (aj2Squared > 0.0) ? sqrt(aj2Squared) / a : j2Trial;
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Find zero of effective stress function using safeguarded Newton's method.
+     *
+     * The effective stress function is nonpositive at zero effective stress, so zero is a lower
+     * bound on the root. We update the bracket around the root with each iterate and take a
+     * bisection step (or expand the upper bound if we do not have one yet) whenever the Newton
+     * step would leave the bracket.
+     *
+     * @param[inout] effStress Initial guess on input, effective stress on output.
+     * @returns True if Newton's method converged, false otherwise.
+     */
+    static inline
+    bool _newton(PylithReal* effStress,
+                 const PylithReal ae,
+                 const PylithReal b,
+                 const PylithReal c,
+                 const PylithReal d,
+                 const PylithReal dt,
+                 const PylithReal j2T,
+                 const PylithReal powerLawExponent,
+                 const PylithReal powerLawRefStrainRate,
+                 const PylithReal powerLawRefStress) {
+        assert(effStress);
+        const size_t maxIterations = 100;
+
+        // Desired accuracy for root (same as _search()) and relative size of step for convergence.
+        const PylithReal accuracy = 1.0e-16;
+        const PylithReal stepTolerance = 1.0e-14;
+
+        // Factor by which to increase the upper bound when we do not have one.
+        const PylithReal expandFactor = 2.0;
+
+        PylithReal xLow = 0.0;
+        PylithReal xHigh = HUGE_VAL;
+        if (_effectiveStressFn(xLow, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress) > 0.0) {
+            return false;
+        } // if
+
+        PylithReal x = *effStress;
+        if (!(x > xLow) || !std::isfinite(x)) {
+            return false;
+        } // if
+        PylithReal funcValue = 0.0;
+        PylithReal funcDeriv = 0.0;
+        for (size_t i = 0; i < maxIterations; ++i) {
+            _effectiveStressFnDerivative(&funcValue, &funcDeriv, x, ae, b, c, d, dt, j2T, powerLawExponent, powerLawRefStrainRate, powerLawRefStress);
+            if (!std::isfinite(funcValue)) {
+                return false;
+            } // if
+            if (fabs(funcValue) < accuracy) {
+                *effStress = x;
+                return true;
+            } // if
+            if (funcValue < 0.0) {
+                xLow = x;
+            } else {
+                xHigh = x;
+            } // if/else
+
+            PylithReal xNew = (funcDeriv > 0.0) ? x - funcValue / funcDeriv : xLow;
+            if (!std::isfinite(xNew) || !(xNew > xLow) || !(xNew < xHigh)) {
+                xNew = (xHigh < HUGE_VAL) ? 0.5 * (xLow + xHigh) : expandFactor * xLow;
+            } // if
+            const PylithReal dx = xNew - x;
+            x = xNew;
+            if (fabs(dx) <= stepTolerance * x) {
+                *effStress = x;
+                return true;
+            } // if
+        } // for
+
+        return false;
+    }
+
     // --------------------------------------------------------------------------------------------
     /** Calculate effective stress function for a power-law viscoelastic material.
      *
@@ -710,8 +889,12 @@ private:
 
         const PylithReal factor1 = 1.0 - powerLawAlpha;
         const PylithReal j2Tau = factor1 * j2T + powerLawAlpha * j2Tpdt;
-        const PylithReal gammaTau = powerLawRefStrainRate * pow((j2Tau / powerLawRefStress), (powerLawExponent - 1.0)) / powerLawRefStress;
-        const PylithReal dGammaTau = powerLawRefStrainRate * powerLawAlpha * (powerLawExponent - 1.0) * pow((j2Tau / powerLawRefStress), (powerLawExponent - 2.0)) / (powerLawRefStress * powerLawRefStress);
+        // Use a single pow() for both the viscosity and its derivative.
+        const PylithReal stressRatio = j2Tau / powerLawRefStress;
+        const PylithReal powerNm1 = pow(stressRatio, powerLawExponent - 1.0);
+        const PylithReal powerNm2 = (stressRatio > 0.0) ? powerNm1 / stressRatio : pow(stressRatio, powerLawExponent - 2.0);
+        const PylithReal gammaTau = powerLawRefStrainRate * powerNm1 / powerLawRefStress;
+        const PylithReal dGammaTau = powerLawRefStrainRate * powerLawAlpha * (powerLawExponent - 1.0) * powerNm2 / (powerLawRefStress * powerLawRefStress);
         const PylithReal a = ae + powerLawAlpha * dt * gammaTau;
         y = a * a * j2Tpdt * j2Tpdt - b + c * gammaTau - d * d * gammaTau * gammaTau;
         dy = 2.0 * a * a * j2Tpdt + dGammaTau * (2.0 * a * powerLawAlpha * dt * j2Tpdt * j2Tpdt + c - 2.0 * d * d * gammaTau);
@@ -725,9 +908,10 @@ private:
      *
      * Used to place bounds on effective stress.
      *
+     * @returns True if the root was bracketed, false otherwise.
      */
     static inline
-    void _bracket(PylithReal *px1,
+    bool _bracket(PylithReal *px1,
                   PylithReal *px2,
                   const PylithReal ae,
                   const PylithReal b,
@@ -771,15 +955,13 @@ private:
         *px1 = x1;
         *px2 = x2;
 
-        if (!bracketed) {
-            throw std::runtime_error("Unable to bracket effective stress.");
-        } // if
+        return bracketed;
     }
 
     // --------------------------------------------------------------------------------------------
     /** Find zero of effective stress function using Newton's method with bisection.
      *
-     * Used to find the effective stress.
+     * Used to find the effective stress. Failure to converge is flagged via KernelStatus.
      *
      */
     static inline
@@ -851,7 +1033,7 @@ private:
         } // for
 
         if (!converged) {
-            throw std::runtime_error("Cannot find root of effective stress function.");
+            KernelStatus::setFailed();
         } // if
 
         return effStress;
@@ -913,16 +1095,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicPowerLaw::cauchyStress,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicPowerLaw::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -959,16 +1139,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<2,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops2D,
-            f1);
+            pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -1012,9 +1190,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::Tensor strain;
         pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain(strainContext, &strain);
@@ -1078,9 +1256,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::Tensor strain;
         pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain(strainContext, &strain);
@@ -1146,9 +1324,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1156,7 +1334,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -1193,9 +1370,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1203,7 +1380,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -1240,9 +1416,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -1250,7 +1426,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -1287,9 +1462,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -1297,7 +1472,6 @@ public:
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState,
             pylith::fekernels::ElasticityPlaneStrain::traction,
-            pylith::fekernels::Tensor::ops2D,
             f0);
     }
 
@@ -1339,14 +1513,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::viscousStrain_asVector(
+        pylith::fekernels::IsotropicPowerLaw::viscousStrain_asVector<2>(
             strainContext, rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops2D,
             viscousStrain);
     }
 
@@ -1384,14 +1557,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::viscousStrain_refState_asVector(
+        pylith::fekernels::IsotropicPowerLaw::viscousStrain_refState_asVector<2>(
             strainContext, rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops2D,
             viscousStrain);
     }
 
@@ -1429,14 +1601,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_asVector(
+        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_asVector<2>(
             strainContext, rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops2D,
             devStress);
     }
 
@@ -1474,17 +1645,104 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_refState_asVector(
+        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_refState_asVector<2>(
             strainContext, rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops2D,
             devStress);
     }
 
+    // --------------------------------------------------------------------------------------------
+    /** Entry function for calculating effective stress for plane strain isotropic power-law
+     * viscoelasticity.
+     *
+     * Used to update the effective stress state variable.
+     *
+     * Solution fields: [disp(dim)]
+     * Auxiliary fields: [..., viscous_strain(4), deviatoric_stress(4), effective_stress(1)]
+     */
+    static inline
+    void effectiveStress_infinitesimalStrain_asVector(const PylithInt dim,
+                                                      const PylithInt numS,
+                                                      const PylithInt numA,
+                                                      const PylithInt sOff[],
+                                                      const PylithInt sOff_x[],
+                                                      const PylithScalar s[],
+                                                      const PylithScalar s_t[],
+                                                      const PylithScalar s_x[],
+                                                      const PylithInt aOff[],
+                                                      const PylithInt aOff_x[],
+                                                      const PylithScalar a[],
+                                                      const PylithScalar a_t[],
+                                                      const PylithScalar a_x[],
+                                                      const PylithReal t,
+                                                      const PylithScalar x[],
+                                                      const PylithInt numConstants,
+                                                      const PylithScalar constants[],
+                                                      PylithScalar effectiveStress[]) {
+        const PylithInt _dim = 2;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
+            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
+            t, x, numConstants, constants);
+
+        pylith::fekernels::IsotropicPowerLaw::effectiveStress_asVector(
+            strainContext, rheologyContext,
+            pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
+            effectiveStress);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Entry function for calculating effective stress for plane strain isotropic power-law
+     * viscoelasticity WITH reference stress and strain.
+     *
+     * Used to update the effective stress state variable.
+     *
+     * Solution fields: [disp(dim)]
+     * Auxiliary fields: [..., viscous_strain(4), deviatoric_stress(4), effective_stress(1)]
+     */
+    static inline
+    void effectiveStress_infinitesimalStrain_refState_asVector(const PylithInt dim,
+                                                               const PylithInt numS,
+                                                               const PylithInt numA,
+                                                               const PylithInt sOff[],
+                                                               const PylithInt sOff_x[],
+                                                               const PylithScalar s[],
+                                                               const PylithScalar s_t[],
+                                                               const PylithScalar s_x[],
+                                                               const PylithInt aOff[],
+                                                               const PylithInt aOff_x[],
+                                                               const PylithScalar a[],
+                                                               const PylithScalar a_t[],
+                                                               const PylithScalar a_x[],
+                                                               const PylithReal t,
+                                                               const PylithScalar x[],
+                                                               const PylithInt numConstants,
+                                                               const PylithScalar constants[],
+                                                               PylithScalar effectiveStress[]) {
+        const PylithInt _dim = 2;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<2>(
+            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
+            t, x, numConstants, constants);
+
+        pylith::fekernels::IsotropicPowerLaw::effectiveStress_refState_asVector(
+            strainContext, rheologyContext,
+            pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
+            effectiveStress);
+    }
+
     // ===========================================================================================
     // Kernels for output
     // ===========================================================================================
@@ -1523,15 +1781,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_stateVars,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -1570,15 +1827,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<2>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops2D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<2>(
             strainContext, &rheologyContext,
             pylith::fekernels::ElasticityPlaneStrain::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState_stateVars,
-            pylith::fekernels::Tensor::ops2D,
             stressVector);
     }
 
@@ -1742,16 +1998,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicPowerLaw::cauchyStress,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicPowerLaw::cauchyStress>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -1788,16 +2042,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::f1v(
-            strainContext, &rheologyContext,
+        pylith::fekernels::Elasticity::f1v<3,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState,
-            pylith::fekernels::Tensor::ops3D,
-            f1);
+            pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState>(
+            strainContext, &rheologyContext, f1);
     }
 
     // --------------------------------------------------------------------------------------------
@@ -1834,9 +2086,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::Tensor strain;
         pylith::fekernels::Elasticity3D::infinitesimalStrain(strainContext, &strain);
@@ -1913,9 +2165,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::Tensor strain;
         pylith::fekernels::Elasticity3D::infinitesimalStrain(strainContext, &strain);
@@ -1994,9 +2246,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -2004,7 +2256,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -2041,9 +2292,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -2051,7 +2302,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -2088,9 +2338,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_neg(
             dim, numS, sOff, s, n,
@@ -2098,7 +2348,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -2135,9 +2384,9 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
         pylith::fekernels::FaultCohesiveKin::f0l_pos(
             dim, numS, sOff, s, n,
@@ -2145,7 +2394,6 @@ public:
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState,
             pylith::fekernels::Elasticity3D::traction,
-            pylith::fekernels::Tensor::ops3D,
             f0);
     }
 
@@ -2187,14 +2435,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::viscousStrain_asVector(
+        pylith::fekernels::IsotropicPowerLaw::viscousStrain_asVector<3>(
             strainContext, rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops3D,
             viscousStrain);
     }
 
@@ -2232,14 +2479,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::viscousStrain_refState_asVector(
+        pylith::fekernels::IsotropicPowerLaw::viscousStrain_refState_asVector<3>(
             strainContext, rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops3D,
             viscousStrain);
     }
 
@@ -2277,14 +2523,13 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_asVector(
+        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_asVector<3>(
             strainContext, rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops3D,
             devStress);
     }
 
@@ -2322,17 +2567,104 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_refState_asVector(
+        pylith::fekernels::IsotropicPowerLaw::deviatoricStress_refState_asVector<3>(
             strainContext, rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
-            pylith::fekernels::Tensor::ops3D,
             devStress);
     }
 
+    // --------------------------------------------------------------------------------------------
+    /** Entry function for calculating effective stress for 3D isotropic power-law
+     * viscoelasticity.
+     *
+     * Used to update the effective stress state variable.
+     *
+     * Solution fields: [disp(dim)]
+     * Auxiliary fields: [..., viscous_strain(6), deviatoric_stress(6), effective_stress(1)]
+     */
+    static inline
+    void effectiveStress_infinitesimalStrain_asVector(const PylithInt dim,
+                                                      const PylithInt numS,
+                                                      const PylithInt numA,
+                                                      const PylithInt sOff[],
+                                                      const PylithInt sOff_x[],
+                                                      const PylithScalar s[],
+                                                      const PylithScalar s_t[],
+                                                      const PylithScalar s_x[],
+                                                      const PylithInt aOff[],
+                                                      const PylithInt aOff_x[],
+                                                      const PylithScalar a[],
+                                                      const PylithScalar a_t[],
+                                                      const PylithScalar a_x[],
+                                                      const PylithReal t,
+                                                      const PylithScalar x[],
+                                                      const PylithInt numConstants,
+                                                      const PylithScalar constants[],
+                                                      PylithScalar effectiveStress[]) {
+        const PylithInt _dim = 3;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
+            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
+            t, x, numConstants, constants);
+
+        pylith::fekernels::IsotropicPowerLaw::effectiveStress_asVector(
+            strainContext, rheologyContext,
+            pylith::fekernels::Elasticity3D::infinitesimalStrain,
+            effectiveStress);
+    }
+
+    // --------------------------------------------------------------------------------------------
+    /** Entry function for calculating effective stress for 3D isotropic power-law
+     * viscoelasticity WITH reference stress and strain.
+     *
+     * Used to update the effective stress state variable.
+     *
+     * Solution fields: [disp(dim)]
+     * Auxiliary fields: [..., viscous_strain(6), deviatoric_stress(6), effective_stress(1)]
+     */
+    static inline
+    void effectiveStress_infinitesimalStrain_refState_asVector(const PylithInt dim,
+                                                               const PylithInt numS,
+                                                               const PylithInt numA,
+                                                               const PylithInt sOff[],
+                                                               const PylithInt sOff_x[],
+                                                               const PylithScalar s[],
+                                                               const PylithScalar s_t[],
+                                                               const PylithScalar s_x[],
+                                                               const PylithInt aOff[],
+                                                               const PylithInt aOff_x[],
+                                                               const PylithScalar a[],
+                                                               const PylithScalar a_t[],
+                                                               const PylithScalar a_x[],
+                                                               const PylithReal t,
+                                                               const PylithScalar x[],
+                                                               const PylithInt numConstants,
+                                                               const PylithScalar constants[],
+                                                               PylithScalar effectiveStress[]) {
+        const PylithInt _dim = 3;assert(_dim == dim);
+
+        pylith::fekernels::Elasticity::StrainContext strainContext;
+        pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+        pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<3>(
+            &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
+            t, x, numConstants, constants);
+
+        pylith::fekernels::IsotropicPowerLaw::effectiveStress_refState_asVector(
+            strainContext, rheologyContext,
+            pylith::fekernels::Elasticity3D::infinitesimalStrain,
+            effectiveStress);
+    }
+
     // ===========================================================================================
     // Kernels for output
     // ===========================================================================================
@@ -2371,15 +2703,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext(
+        pylith::fekernels::IsotropicPowerLaw::setContext<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_stateVars,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     }
 
@@ -2418,15 +2749,14 @@ public:
         pylith::fekernels::Elasticity::setStrainContext(&strainContext, _dim, numS, sOff, sOff_x, s, s_t, s_x, x);
 
         pylith::fekernels::IsotropicPowerLaw::Context rheologyContext;
-        pylith::fekernels::IsotropicPowerLaw::setContext_refState(
+        pylith::fekernels::IsotropicPowerLaw::setContext_refState<3>(
             &rheologyContext, _dim, numS, numA, sOff, sOff_x, s, s_t, s_x, aOff, aOff_x, a, a_t, a_x,
-            t, x, numConstants, constants, pylith::fekernels::Tensor::ops3D);
+            t, x, numConstants, constants);
 
-        pylith::fekernels::Elasticity::stress_asVector(
+        pylith::fekernels::Elasticity::stress_asVector<3>(
             strainContext, &rheologyContext,
             pylith::fekernels::Elasticity3D::infinitesimalStrain,
             pylith::fekernels::IsotropicPowerLaw::cauchyStress_refState_stateVars,
-            pylith::fekernels::Tensor::ops3D,
             stressVector);
     }
 
@@ -18,12 +18,8 @@
 
 #include <portinfo>
 
-#include "pylith/fekernels/Tensor.hh"
+#include "pylith/fekernels/KernelStatus.hh" // Implementation of object methods.
 
-const pylith::fekernels::TensorOps pylith::fekernels::Tensor::ops2D =
-    pylith::fekernels::TensorOps::_create2D();
-
-const pylith::fekernels::TensorOps pylith::fekernels::Tensor::ops3D =
-    pylith::fekernels::TensorOps::_create3D();
+bool pylith::fekernels::KernelStatus::_failed = false;
 
 // End of file
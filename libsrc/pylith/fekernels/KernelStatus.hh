@@ -0,0 +1,67 @@
+/* -*- C++ -*-
+ *
+ * ----------------------------------------------------------------------
+ *
+ * Brad T. Aagaard, U.S. Geological Survey
+ * Charles A. Williams, GNS Science
+ * Matthew G. Knepley, University at Buffalo
+ *
+ * This code was developed as part of the Computational Infrastructure
+ * for Geodynamics (http:*geodynamics.org).
+ *
+ * Copyright (c) 2010-2022 University of California, Davis
+ *
+ * See LICENSE.md for license information.
+ *
+ * ----------------------------------------------------------------------
+ */
+
+/** @file libsrc/fekernels/KernelStatus.hh
+ *
+ * Pointwise kernels are called by PETSc through C callbacks, so they cannot throw exceptions or
+ * return error codes. Kernels that fail at a point (for example, a nonlinear constitutive model that
+ * cannot find the stress) flag the failure here and return a finite value. The problem checks the
+ * flag after assembling the residual or Jacobian and reports a domain error to the nonlinear solver
+ * so that the time step can be rejected and retried with a smaller time step.
+ */
+
+#if !defined(pylith_fekernels_kernelstatus_hh)
+#define pylith_fekernels_kernelstatus_hh
+
+#include "fekernelsfwd.hh" // forward declarations
+
+class pylith::fekernels::KernelStatus {
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Clear failure flag.
+    static inline
+    void reset(void) {
+        _failed = false;
+    }
+
+    /// Flag failure of a pointwise kernel.
+    static inline
+    void setFailed(void) {
+        _failed = true;
+    }
+
+    /** Check whether a pointwise kernel failed since the flag was last cleared.
+     *
+     * @returns True if a kernel failed, false otherwise.
+     */
+    static inline
+    bool hasFailed(void) {
+        return _failed;
+    }
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////////////////////////////
+private:
+
+    static bool _failed; ///< True if a pointwise kernel failed.
+
+}; // KernelStatus
+
+#endif // pylith_fekernels_kernelstatus_hh
+
+// End of file
@@ -45,7 +45,7 @@ public:
     PylithReal yz;
     PylithReal xz;
 
-    Tensor(void) :
+    constexpr Tensor(void) :
         xx(0.0),
         yy(0.0),
         zz(0.0),
@@ -54,45 +54,68 @@ public:
         xz(0.0) {}
 
 
-    static const TensorOps ops2D;
-    static const TensorOps ops3D;
 };
 
+/** Operations on tensors.
+ *
+ * The conversions are templated on the spatial dimension, so kernels select the layout at compile
+ * time and the compiler can inline the element copies.
+ */
 class pylith::fekernels::TensorOps {
-    friend class Tensor;
 public:
 
-    typedef void (*fromfn_type)(const PylithReal[],
-                                Tensor*);
-    typedef void (*tofn_type)(const Tensor&,
-                              PylithReal[]);
-
-    fromfn_type fromVector;
-    fromfn_type fromTensor;
-    tofn_type toVector;
-    tofn_type toTensor;
-
-    const int vectorSize;
-
-    static inline
-    TensorOps _create2D(void) {
-        return TensorOps(_fromVector2D,
-                         _fromTensor2D,
-                         _toVector2D,
-                         _toTensor2D,
-                         4);
+    /** Number of components in vector form of tensor.
+     *
+     * @returns Number of components.
+     */
+    template<PylithInt DIM>
+    static constexpr
+    PylithInt vectorSize(void) {
+        static_assert(2 == DIM || 3 == DIM, "Tensor operations are only implemented for 2D and 3D.");
+        return (2 == DIM) ? 4 : 6;
     }
 
-    static inline
-    TensorOps _create3D(void) {
-        return TensorOps(_fromVector3D,
-                         _fromTensor3D,
-                         _toVector3D,
-                         _toTensor3D,
-                         6);
-    }
-
-    static inline
+    /** Set tensor from vector form.
+     *
+     * @param[in] vector Tensor in vector form.
+     * @param[out] tensor Tensor.
+     */
+    template<PylithInt DIM>
+    static constexpr
+    void fromVector(const PylithReal vector[],
+                    Tensor* tensor);
+
+    /** Set tensor from full DIMxDIM tensor.
+     *
+     * @param[in] tensorDIM Full DIMxDIM tensor.
+     * @param[out] tensor Tensor.
+     */
+    template<PylithInt DIM>
+    static constexpr
+    void fromTensor(const PylithReal tensorDIM[],
+                    Tensor* tensor);
+
+    /** Get vector form of tensor.
+     *
+     * @param[in] tensor Tensor.
+     * @param[out] vector Tensor in vector form.
+     */
+    template<PylithInt DIM>
+    static constexpr
+    void toVector(const Tensor& tensor,
+                  PylithReal vector[]);
+
+    /** Get full DIMxDIM tensor.
+     *
+     * @param[in] tensor Tensor.
+     * @param[out] tensorDIM Full DIMxDIM tensor.
+     */
+    template<PylithInt DIM>
+    static constexpr
+    void toTensor(const Tensor& tensor,
+                  PylithReal tensorDIM[]);
+
+    static constexpr
     PylithReal scalarProduct(const Tensor& a,
                              const Tensor& b) {
         return a.xx * b.xx + a.yy * b.yy + a.zz * b.zz + 2.0 * (a.xy * b.xy + a.yz * b.yz + a.xz * b.xz);
@@ -110,121 +133,138 @@ public:
                   << "xz=" << tensor.xz << std::endl;
     }
 
-private:
-
-    inline
-    TensorOps(fromfn_type fromV,
-              fromfn_type fromT,
-              tofn_type toV,
-              tofn_type toT,
-              const int vSize) :
-        fromVector(fromV),
-        fromTensor(fromT),
-        toVector(toV),
-        toTensor(toT),
-        vectorSize(vSize) {}
-
-
-    static inline
-    void _fromVector2D(const PylithReal vector2D[],
-                       Tensor* tensor) {
-        assert(vector2D);
-        assert(tensor);
-        tensor->xx = vector2D[0];
-        tensor->yy = vector2D[1];
-        tensor->zz = vector2D[2];
-        tensor->xy = vector2D[3];
-        tensor->yz = 0.0;
-        tensor->xz = 0.0;
-    }
-
-    static inline
-    void _fromTensor2D(const PylithReal tensor2D[],
-                       Tensor* tensor) {
-        assert(tensor);
-        assert(tensor2D);
-        tensor->xx = tensor2D[0];
-        tensor->yy = tensor2D[3];
-        tensor->zz = 0.0;
-        tensor->xy = tensor2D[1];
-        tensor->yz = 0.0;
-        tensor->xz = 0.0;
-    }
-
-    static inline
-    void _toVector2D(const Tensor& tensor,
-                     PylithReal vector2D[]) {
-        assert(vector2D);
-        vector2D[0] = tensor.xx;
-        vector2D[1] = tensor.yy;
-        vector2D[2] = tensor.zz;
-        vector2D[3] = tensor.xy;
-    }
-
-    static inline
-    void _toTensor2D(const Tensor& tensor,
-                     PylithReal tensor2D[]) {
-        assert(tensor2D);
-        tensor2D[0] = tensor.xx;
-        tensor2D[1] = tensor.xy;
-        tensor2D[2] = tensor.xy;
-        tensor2D[3] = tensor.yy;
-    }
-
-    static inline
-    void _fromVector3D(const PylithReal vector3D[],
-                       Tensor* tensor) {
-        assert(vector3D);
-        assert(tensor);
-        tensor->xx = vector3D[0];
-        tensor->yy = vector3D[1];
-        tensor->zz = vector3D[2];
-        tensor->xy = vector3D[3];
-        tensor->yz = vector3D[4];
-        tensor->xz = vector3D[5];
-    }
-
-    static inline
-    void _fromTensor3D(const PylithReal tensor3D[],
-                       Tensor* tensor) {
-        assert(tensor);
-        assert(tensor3D);
-        tensor->xx = tensor3D[0];
-        tensor->yy = tensor3D[4];
-        tensor->zz = tensor3D[8];
-        tensor->xy = tensor3D[1];
-        tensor->yz = tensor3D[5];
-        tensor->xz = tensor3D[2];
-    }
-
-    static inline
-    void _toVector3D(const Tensor& tensor,
-                     PylithReal vector3D[]) {
-        assert(vector3D);
-        vector3D[0] = tensor.xx;
-        vector3D[1] = tensor.yy;
-        vector3D[2] = tensor.zz;
-        vector3D[3] = tensor.xy;
-        vector3D[4] = tensor.yz;
-        vector3D[5] = tensor.xz;
-    }
+}; // TensorOps
 
-    static inline
-    void _toTensor3D(const Tensor& tensor,
-                     PylithReal tensor3D[]) {
-        assert(tensor3D);
-        tensor3D[0] = tensor.xx;
-        tensor3D[1] = tensor.xy;
-        tensor3D[2] = tensor.xz;
-        tensor3D[3] = tensor.xy;
-        tensor3D[4] = tensor.yy;
-        tensor3D[5] = tensor.yz;
-        tensor3D[6] = tensor.xz;
-        tensor3D[7] = tensor.yz;
-        tensor3D[8] = tensor.zz;
-    }
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::fromVector<2>(const PylithReal vector2D[],
+                                            Tensor* tensor) {
+    assert(vector2D);
+    assert(tensor);
+    tensor->xx = vector2D[0];
+    tensor->yy = vector2D[1];
+    tensor->zz = vector2D[2];
+    tensor->xy = vector2D[3];
+    tensor->yz = 0.0;
+    tensor->xz = 0.0;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::fromTensor<2>(const PylithReal tensor2D[],
+                                            Tensor* tensor) {
+    assert(tensor);
+    assert(tensor2D);
+    tensor->xx = tensor2D[0];
+    tensor->yy = tensor2D[3];
+    tensor->zz = 0.0;
+    tensor->xy = tensor2D[1];
+    tensor->yz = 0.0;
+    tensor->xz = 0.0;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::toVector<2>(const Tensor& tensor,
+                                          PylithReal vector2D[]) {
+    assert(vector2D);
+    vector2D[0] = tensor.xx;
+    vector2D[1] = tensor.yy;
+    vector2D[2] = tensor.zz;
+    vector2D[3] = tensor.xy;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::toTensor<2>(const Tensor& tensor,
+                                          PylithReal tensor2D[]) {
+    assert(tensor2D);
+    tensor2D[0] = tensor.xx;
+    tensor2D[1] = tensor.xy;
+    tensor2D[2] = tensor.xy;
+    tensor2D[3] = tensor.yy;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::fromVector<3>(const PylithReal vector3D[],
+                                            Tensor* tensor) {
+    assert(vector3D);
+    assert(tensor);
+    tensor->xx = vector3D[0];
+    tensor->yy = vector3D[1];
+    tensor->zz = vector3D[2];
+    tensor->xy = vector3D[3];
+    tensor->yz = vector3D[4];
+    tensor->xz = vector3D[5];
+}
+
+
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::fromTensor<3>(const PylithReal tensor3D[],
+                                            Tensor* tensor) {
+    assert(tensor);
+    assert(tensor3D);
+    tensor->xx = tensor3D[0];
+    tensor->yy = tensor3D[4];
+    tensor->zz = tensor3D[8];
+    tensor->xy = tensor3D[1];
+    tensor->yz = tensor3D[5];
+    tensor->xz = tensor3D[2];
+}
+
+
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::toVector<3>(const Tensor& tensor,
+                                          PylithReal vector3D[]) {
+    assert(vector3D);
+    vector3D[0] = tensor.xx;
+    vector3D[1] = tensor.yy;
+    vector3D[2] = tensor.zz;
+    vector3D[3] = tensor.xy;
+    vector3D[4] = tensor.yz;
+    vector3D[5] = tensor.xz;
+}
+
+
+// ------------------------------------------------------------------------------------------------
+template<>
+constexpr
+void
+pylith::fekernels::TensorOps::toTensor<3>(const Tensor& tensor,
+                                          PylithReal tensor3D[]) {
+    assert(tensor3D);
+    tensor3D[0] = tensor.xx;
+    tensor3D[1] = tensor.xy;
+    tensor3D[2] = tensor.xz;
+    tensor3D[3] = tensor.xy;
+    tensor3D[4] = tensor.yy;
+    tensor3D[5] = tensor.yz;
+    tensor3D[6] = tensor.xz;
+    tensor3D[7] = tensor.yz;
+    tensor3D[8] = tensor.zz;
+}
 
-}; // TensorOps
 
 #endif // pylith_fekernels_tensor_hh
 
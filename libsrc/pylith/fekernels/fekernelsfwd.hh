@@ -31,6 +31,7 @@ namespace pylith {
     namespace fekernels {
         class Tensor;
         class TensorOps;
+        class KernelStatus;
 
         class Solution;
         class DispVel;
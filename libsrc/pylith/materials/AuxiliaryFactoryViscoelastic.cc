@@ -296,6 +296,40 @@ pylith::materials::AuxiliaryFactoryViscoelastic::addDeviatoricStress(void) {
 } // addDeviatoricStress
 
 
+// ------------------------------------------------------------------------------------------------
+// Add effective stress subfield to auxiliary fields.
+void
+pylith::materials::AuxiliaryFactoryViscoelastic::addEffectiveStress(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addEffectiveStress(void)");
+
+    const char* subfieldName = "effective_stress";
+    const PylithReal pressureScale = _normalizer->getPressureScale();
+
+    pylith::topology::Field::Description description;
+    description.label = subfieldName;
+    description.alias = subfieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = subfieldName;
+    description.hasHistory = true;
+    description.historySize = 1;
+    description.scale = pressureScale;
+    description.validator = NULL;
+
+    // Values are only needed at the quadrature points.
+    pylith::topology::FieldBase::Discretization discretization = getSubfieldDiscretization(subfieldName);
+    discretization.feSpace = pylith::topology::FieldBase::POINT_SPACE;
+
+    // No subfield query, so the initial value is zero, which tells the kernels to use the effective stress
+    // computed from the deviatoric stress as the initial guess.
+    _field->subfieldAdd(description, discretization);
+
+    PYLITH_METHOD_END;
+} // addEffectiveStress
+
+
 // ------------------------------------------------------------------------------------------------
 // Add viscous strain subfield to auxiliary fields.
 void
@@ -64,6 +64,13 @@ public:
     /// Add stress subfield to auxiliary subfields.
     void addDeviatoricStress(void);
 
+    /** Add effective stress subfield to auxiliary subfields.
+     *
+     * The effective stress is always stored at the quadrature points (point space). It holds the converged
+     * effective stress from the last state variable update and is not set from the spatial database.
+     */
+    void addEffectiveStress(void);
+
     /// Add viscous strain subfield to auxiliary subfields.
     void addViscousStrain(void);
 
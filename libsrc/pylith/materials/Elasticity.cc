@@ -28,6 +28,9 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field::SubfieldInfo
 #include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::isCohesiveCell()
+#include "pylith/topology/Stratum.hh" // USES StratumIS
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/utils/PetscOptions.hh" // USES PetscOptions
 
@@ -35,6 +38,7 @@
 #include "pylith/fekernels/DispVel.hh" // USES DispVel kernels
 #include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin kernels
 
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
@@ -43,6 +47,8 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <typeinfo> // USES typeid()
+#include <algorithm> // USES std::min(), std::max()
+#include <cmath> // USES sqrt(), fabs()
 
 // ------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorDomain::ResidualKernels ResidualKernels;
@@ -55,7 +61,8 @@ typedef pylith::feassemble::Integrator::EquationPart EquationPart;
 pylith::materials::Elasticity::Elasticity(void) :
     _useBodyForce(false),
     _rheology(NULL),
-    _derivedFactory(new pylith::materials::DerivedFactoryElasticity) {
+    _derivedFactory(new pylith::materials::DerivedFactoryElasticity),
+    _solutionBasisOrder(1) {
     pylith::utils::PyreComponent::setName("elasticity");
 } // constructor
 
@@ -153,6 +160,9 @@ pylith::materials::Elasticity::createIntegrator(const pylith::topology::Field& s
     integrator->setLabelName(getLabelName());
     integrator->setLabelValue(getLabelValue());
 
+    // Stable time step for explicit time stepping depends on the basis order of the displacement.
+    _solutionBasisOrder = solution.getSubfieldInfo("displacement").fe.basisOrder;
+
     _setKernelsResidual(integrator, solution);
     _setKernelsJacobian(integrator, solution);
     _setKernelsUpdateStateVars(integrator, solution);
@@ -239,6 +249,108 @@ pylith::materials::Elasticity::createDerivedField(const pylith::topology::Field&
 } // createDerivedField
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping on this process.
+PylithReal
+pylith::materials::Elasticity::computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeStableTimeStep(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    assert(_rheology);
+    PYLITH_METHOD_RETURN(_rheology->computeStableTimeStep(auxiliaryField));
+} // computeStableTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for explicit time stepping for each cell on this process.
+void
+pylith::materials::Elasticity::computeStableTimeStepsExplicit(std::vector<PylithInt>* cells,
+                                                              std::vector<PylithReal>* dtCells,
+                                                              const pylith::topology::Field& auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeStableTimeStepsExplicit(cells="<<cells<<", dtCells="<<dtCells<<", auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    assert(cells);
+    assert(dtCells);
+    cells->clear();
+    dtCells->clear();
+    if (!auxiliaryField.hasSubfield("density") || !auxiliaryField.hasSubfield("shear_modulus") ||
+        !auxiliaryField.hasSubfield("bulk_modulus")) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscDM dmMesh = auxiliaryField.getMesh().getDM();
+    const int dim = auxiliaryField.getMesh().getDimension();
+    pylith::topology::StratumIS cellsIS(dmMesh, getLabelName(), getLabelValue(), true);
+    const PetscInt* materialCells = cellsIS.points();
+    const PetscInt numCells = cellsIS.size();
+    cells->reserve(numCells);
+    dtCells->reserve(numCells);
+
+    pylith::topology::VecVisitorMesh densityVisitor(auxiliaryField, "density");
+    pylith::topology::VecVisitorMesh shearModulusVisitor(auxiliaryField, "shear_modulus");
+    pylith::topology::VecVisitorMesh bulkModulusVisitor(auxiliaryField, "bulk_modulus");
+
+    // Spacing of the nodes decreases and the largest eigenvalue increases roughly as p^2 with the
+    // basis order p.
+    const PylithReal basisOrderFactor = std::max(1, _solutionBasisOrder*_solutionBasisOrder);
+
+    PetscErrorCode err = 0;
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = materialCells[iCell];
+        if (pylith::topology::MeshOps::isCohesiveCell(dmMesh, cell)) { continue; }
+
+        // Cell size: d*V/A for simplices (minimum altitude) and V/A for tensor cells, where A is the
+        // area of the largest face.
+        PylithReal volume = 0.0;
+        err = DMPlexComputeCellGeometryFVM(dmMesh, cell, &volume, NULL, NULL);PYLITH_CHECK_ERROR(err);
+        const PetscInt* cone = NULL;
+        PetscInt coneSize = 0;
+        err = DMPlexGetConeSize(dmMesh, cell, &coneSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetCone(dmMesh, cell, &cone);PYLITH_CHECK_ERROR(err);
+        PylithReal areaMax = 0.0;
+        for (PetscInt iFace = 0; iFace < coneSize; ++iFace) {
+            PylithReal area = 0.0;
+            err = DMPlexComputeCellGeometryFVM(dmMesh, cone[iFace], &area, NULL, NULL);PYLITH_CHECK_ERROR(err);
+            areaMax = std::max(areaMax, area);
+        } // for
+        if (areaMax <= 0.0) { continue; }
+        const bool isSimplex = coneSize == dim+1;
+        const PylithReal cellSize = (isSimplex ? dim : 1) * fabs(volume) / areaMax;
+
+        // Use the largest P-wave speed from the values in the cell closure.
+        PylithReal densityMin = PYLITH_MAXSCALAR;
+        PylithReal shearModulusMax = 0.0;
+        PylithReal bulkModulusMax = 0.0;
+        PetscScalar* values = NULL;
+        PetscInt valuesSize = 0;
+        densityVisitor.getClosure(&values, &valuesSize, cell);
+        for (PetscInt i = 0; i < valuesSize; ++i) {
+            densityMin = std::min(densityMin, PylithReal(values[i]));
+        } // for
+        densityVisitor.restoreClosure(&values, &valuesSize, cell);
+        shearModulusVisitor.getClosure(&values, &valuesSize, cell);
+        for (PetscInt i = 0; i < valuesSize; ++i) {
+            shearModulusMax = std::max(shearModulusMax, PylithReal(values[i]));
+        } // for
+        shearModulusVisitor.restoreClosure(&values, &valuesSize, cell);
+        bulkModulusVisitor.getClosure(&values, &valuesSize, cell);
+        for (PetscInt i = 0; i < valuesSize; ++i) {
+            bulkModulusMax = std::max(bulkModulusMax, PylithReal(values[i]));
+        } // for
+        bulkModulusVisitor.restoreClosure(&values, &valuesSize, cell);
+        if (densityMin <= 0.0) { continue; }
+
+        const PylithReal vp = sqrt((bulkModulusMax + 4.0/3.0*shearModulusMax) / densityMin);
+        if (vp <= 0.0) { continue; }
+        cells->push_back(cell);
+        dtCells->push_back(cellSize / (vp * basisOrderFactor));
+    } // for
+
+    PYLITH_METHOD_END;
+} // computeStableTimeStepsExplicit
+
+
 // ------------------------------------------------------------------------------------------------
 // Get default PETSc solver options appropriate for material.
 pylith::utils::PetscOptions*
@@ -265,8 +377,11 @@ pylith::materials::Elasticity::getSolverDefaults(const bool isParallel,
             options->add("-pc_fieldsplit_type", "schur");
 
             options->add("-pc_fieldsplit_schur_factorization_type", "lower");
-            options->add("-pc_fieldsplit_schur_precondition", "selfp");
+            // Approximate Schur complement from the stiffness of the patches of cells adjacent to the fault
+            // (FaultSchurPreconditioner). With selfp, use the inverse of the point blocks of the stiffness.
+            options->add("-pc_fieldsplit_schur_precondition", "user");
             options->add("-pc_fieldsplit_schur_scale", "1.0");
+            options->add("-fieldsplit_lagrange_multiplier_fault_mat_schur_complement_ainv_type", "blockdiag");
 
             options->add("-fieldsplit_displacement_ksp_type", "preonly");
             options->add("-fieldsplit_lagrange_multiplier_fault_ksp_type", "preonly");
@@ -301,6 +416,15 @@ pylith::materials::Elasticity::getSolverDefaults(const bool isParallel,
 } // getSolverDefaults
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the Jacobian for the material symmetric?
+bool
+pylith::materials::Elasticity::isJacobianSymmetric(void) const {
+    assert(_rheology);
+    return _rheology->isJacobianSymmetric();
+} // isJacobianSymmetric
+
+
 // ------------------------------------------------------------------------------------------------
 // Get residual kernels for an interior interface bounding material.
 std::vector<pylith::materials::Material::InterfaceResidualKernels>
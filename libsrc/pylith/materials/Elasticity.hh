@@ -101,6 +101,27 @@ public:
     pylith::topology::Field* createDerivedField(const pylith::topology::Field& solution,
                                                 const pylith::topology::Mesh& domainMesh);
 
+    /** Compute stable time step for implicit time stepping on this process.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const;
+
+    /** Compute stable time step for explicit time stepping for each cell on this process.
+     *
+     * The stable time step is the cell size divided by the P-wave speed and the square of the basis
+     * order of the displacement. For simplices the cell size is the minimum altitude, and for
+     * quadrilaterals and hexahedra it is the cell volume divided by the area of the largest face.
+     *
+     * @param[out] cells Cells with a stable time step.
+     * @param[out] dtCells Stable time step (nondimensional) for each cell.
+     * @param[in] auxiliaryField Auxiliary field.
+     */
+    void computeStableTimeStepsExplicit(std::vector<PylithInt>* cells,
+                                        std::vector<PylithReal>* dtCells,
+                                        const pylith::topology::Field& auxiliaryField) const;
+
     /** Get default PETSc solver options appropriate for material.
      *
      * @param[in] isParallel True if running in parallel, False if running in serial.
@@ -110,6 +131,12 @@ public:
     pylith::utils::PetscOptions* getSolverDefaults(const bool isParallel,
                                                    const bool hasFault) const;
 
+    /** Is the Jacobian for the material symmetric?
+     *
+     * @returns True if the Jacobian is symmetric, false otherwise.
+     */
+    bool isJacobianSymmetric(void) const;
+
     /** Get residual kernels for an interior interface bounding material.
      *
      * @param[in] solution Solution field.
@@ -190,6 +217,7 @@ private:
     bool _useBodyForce; ///< Flag to include body force term.
     pylith::materials::RheologyElasticity* _rheology; ///< Bulk rheology for elasticity.
     pylith::materials::DerivedFactoryElasticity* _derivedFactory; ///< Factory for creating derived fields.
+    int _solutionBasisOrder; ///< Basis order of displacement subfield in solution.
 
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
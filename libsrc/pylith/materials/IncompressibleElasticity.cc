@@ -32,6 +32,7 @@
 #include "pylith/fekernels/Elasticity.hh" // USES Elasticity kernels
 #include "pylith/fekernels/DispVel.hh" // USES DispVel kernels
 
+#include "pylith/utils/PetscOptions.hh" // USES PetscOptions
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
@@ -39,6 +40,7 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <cstring> // USES strcmp()
 #include <typeinfo> // USES typeid()
 
 // ------------------------------------------------------------------------------------------------
@@ -245,11 +247,14 @@ pylith::materials::IncompressibleElasticity::getSolverDefaults(const bool isPara
             options->add("-pc_type", "fieldsplit");
             options->add("-pc_fieldsplit_type", "schur");
             options->add("-pc_fieldsplit_schur_factorization_type", "full");
-            options->add("-pc_fieldsplit_schur_precondition", "full");
             if (!isParallel) {
+                options->add("-pc_fieldsplit_schur_precondition", "full");
                 options->add("-fieldsplit_displacement_pc_type", "lu");
                 options->add("-fieldsplit_pressure_pc_type", "lu");
             } else {
+                // Precondition Schur complement with scaled pressure mass matrix from preconditioner kernels.
+                options->add("-pc_fieldsplit_schur_precondition", "a11");
+                options->add("-fieldsplit_pressure_ksp_type", "preonly");
 #if 1
                 options->add("-fieldsplit_displacement_pc_type", "ml");
 #else
@@ -257,7 +262,7 @@ pylith::materials::IncompressibleElasticity::getSolverDefaults(const bool isPara
                 options->add("-fieldsplit_displacement_mg_levels_pc_type", "sor");
                 options->add("-fieldsplit_displacement_mg_levels_ksp_type", "richardson");
 #endif
-                options->add("-fieldsplit_pressure_pc_type", "bjacobi");
+                options->add("-fieldsplit_pressure_pc_type", "jacobi");
             } // if/else
         } // if/else
         break;
@@ -390,13 +395,55 @@ pylith::materials::IncompressibleElasticity::_setKernelsJacobian(pylith::feassem
     kernels[2] = JacobianKernels("pressure", "displacement", equationPart, Jf0pu, Jf1pu, Jf2pu, Jf3pu);
     kernels[3] = JacobianKernels("pressure", "pressure", equationPart, Jf0pp, Jf1pp, Jf2pp, Jf3pp);
 
+    int numProcs = 1;
+    MPI_Comm_size(solution.getMesh().getComm(), &numProcs);
+    const bool isParallel = numProcs > 1;
+    const bool hasFault = solution.hasSubfield("lagrange_multiplier_fault");
+
     assert(integrator);
-    integrator->setKernelsJacobian(kernels, solution);
+    if (_isSchurPreconditionA11(isParallel, hasFault)) {
+        // Preconditioner: displacement block of Jacobian and pressure mass matrix scaled by 1/shear_modulus +
+        // 1/bulk_modulus for the Schur complement.
+        std::vector<JacobianKernels> kernelsPrecond(2);
+        const PetscPointJac Jf0ppPrecond = _rheology->getKernelJf0ppSchurPrecond(coordsys);
+        kernelsPrecond[0] = JacobianKernels("displacement", "displacement", equationPart, Jf0uu, Jf1uu, Jf2uu, Jf3uu);
+        kernelsPrecond[1] = JacobianKernels("pressure", "pressure", equationPart, Jf0ppPrecond, NULL, NULL, NULL);
+
+        integrator->setKernelsJacobian(kernels, kernelsPrecond, solution);
+    } else {
+        integrator->setKernelsJacobian(kernels, solution);
+    } // if/else
 
     PYLITH_METHOD_END;
 } // setKernelsJacobian
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the Schur complement preconditioned using the pressure block of the preconditioning matrix?
+bool
+pylith::materials::IncompressibleElasticity::_isSchurPreconditionA11(const bool isParallel,
+                                                                     const bool hasFault) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_isSchurPreconditionA11(isParallel="<<isParallel<<", hasFault="<<hasFault<<")");
+
+    const char* optionName = "-pc_fieldsplit_schur_precondition";
+    char value[PETSC_MAX_PATH_LEN];
+    PetscBool hasOption = PETSC_FALSE;
+    PetscErrorCode err = PetscOptionsGetString(NULL, NULL, optionName, value, sizeof(value), &hasOption);PYLITH_CHECK_ERROR(err);
+    if (hasOption) {
+        PYLITH_METHOD_RETURN(0 == strcmp(value, "a11"));
+    } // if
+
+    // The default solver options are set after the integrators are created, so we look them up.
+    pylith::utils::PetscOptions* defaults = getSolverDefaults(isParallel, hasFault);assert(defaults);
+    const char* defaultValue = defaults->get(optionName);
+    const bool isA11 = defaultValue && (0 == strcmp(defaultValue, "a11"));
+    delete defaults;defaults = NULL;
+
+    PYLITH_METHOD_RETURN(isA11);
+} // _isSchurPreconditionA11
+
+
 // ------------------------------------------------------------------------------------------------
 // Set kernels for computing updated state variables in auxiliary field.
 void
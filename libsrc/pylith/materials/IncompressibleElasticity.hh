@@ -150,6 +150,19 @@ private:
     void _setKernelsJacobian(pylith::feassemble::IntegratorDomain* integrator,
                              const pylith::topology::Field& solution) const;
 
+    /** Is the Schur complement preconditioned using the pressure block of the preconditioning matrix?
+     *
+     * The preconditioning matrix assembled from the preconditioner kernels only contains the diagonal
+     * blocks, so we only use it with `-pc_fieldsplit_schur_precondition a11`. A value set by the user
+     * takes precedence over the default solver options.
+     *
+     * @param[in] isParallel True if running in parallel, false otherwise.
+     * @param[in] hasFault True if problem has a fault, false otherwise.
+     * @returns True if the Schur complement preconditioner is a11, false otherwise.
+     */
+    bool _isSchurPreconditionA11(const bool isParallel,
+                                 const bool hasFault) const;
+
     /** Set kernels for computing updated state variables in auxiliary field.
      *
      * @param[out] integrator Integrator for material.
@@ -109,6 +109,12 @@ public:
      */
     PetscPointFunc getKernelCauchyStressVector(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+    /** Is the elastic Jacobian (Jf3) for the rheology symmetric?
+     *
+     * @returns True if the Jacobian is symmetric, false otherwise.
+     */
+    bool isJacobianSymmetric(void) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -26,9 +26,14 @@
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
 #include <typeinfo> // USES typeid()
+#include <algorithm> // USES std::min()
 
 // ------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorDomain::ProjectKernels ProjectKernels;
@@ -206,6 +211,14 @@ pylith::materials::IsotropicLinearGenMaxwell::getKernelCauchyStressVector(const
 } // getKernelCauchyStressVector
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the elastic Jacobian (Jf3) for the rheology symmetric?
+bool
+pylith::materials::IsotropicLinearGenMaxwell::isJacobianSymmetric(void) const {
+    return true;
+} // isJacobianSymmetric
+
+
 // ------------------------------------------------------------------------------------------------
 // Update kernel constants.
 void
@@ -251,4 +264,38 @@ pylith::materials::IsotropicLinearGenMaxwell::addKernelsUpdateStateVars(std::vec
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping on this process.
+PylithReal
+pylith::materials::IsotropicLinearGenMaxwell::computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeStableTimeStep(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    PylithReal dtStable = PYLITH_MAXSCALAR;
+
+    // Maxwell times and shear modulus ratios have one component per Maxwell element with the same
+    // layout, so we can match them dof by dof.
+    pylith::topology::VecVisitorMesh maxwellTimeVisitor(auxiliaryField, "maxwell_time");
+    pylith::topology::VecVisitorMesh shearRatioVisitor(auxiliaryField, "shear_modulus_ratio");
+    const PetscScalar* maxwellTimeArray = maxwellTimeVisitor.localArray();
+    const PetscScalar* shearRatioArray = shearRatioVisitor.localArray();
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(maxwellTimeVisitor.selectedSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt numDof = maxwellTimeVisitor.sectionDof(point);
+        if (!numDof || (shearRatioVisitor.sectionDof(point) != numDof)) { continue; }
+        const PetscInt maxwellTimeOff = maxwellTimeVisitor.sectionOffset(point);
+        const PetscInt shearRatioOff = shearRatioVisitor.sectionOffset(point);
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            const PylithReal maxwellTime = maxwellTimeArray[maxwellTimeOff+iDof];
+            if ((shearRatioArray[shearRatioOff+iDof] > 0.0) && (maxwellTime > 0.0)) {
+                dtStable = std::min(dtStable, maxwellTime);
+            } // if
+        } // for
+    } // for
+
+    PYLITH_METHOD_RETURN(dtStable);
+} // computeStableTimeStep
+
+
 // End of file
@@ -109,6 +109,12 @@ public:
      */
     PetscPointFunc getKernelCauchyStressVector(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+    /** Is the elastic Jacobian (Jf3) for the rheology symmetric?
+     *
+     * @returns True if the Jacobian is symmetric, false otherwise.
+     */
+    bool isJacobianSymmetric(void) const;
+
     /** Add kernels for updating state variables.
      *
      * @param[inout] kernels Array of kernels for updating state variables.
@@ -125,6 +131,16 @@ public:
     void updateKernelConstants(pylith::real_array* kernelConstants,
                                const PylithReal dt) const;
 
+    /** Compute stable time step for implicit time stepping on this process.
+     *
+     * The stable time step is the minimum Maxwell time over the Maxwell elements with a nonzero
+     * shear modulus ratio.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
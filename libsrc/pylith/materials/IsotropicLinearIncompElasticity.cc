@@ -173,6 +173,19 @@ pylith::materials::IsotropicLinearIncompElasticity::getKernelJf0pp(const spatial
 } // getKernelJacobianInverseBulkModulus
 
 
+// ------------------------------------------------------------------------------------------------
+// Get scaled pressure mass matrix kernel for preconditioner of the Schur complement.
+PetscPointJac
+pylith::materials::IsotropicLinearIncompElasticity::getKernelJf0ppSchurPrecond(const spatialdata::geocoords::CoordSys* coordsys) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("getKernelJf0ppSchurPrecond(coordsys="<<typeid(coordsys).name()<<")");
+
+    PetscPointJac Jf0pp = pylith::fekernels::IsotropicLinearIncompElasticity::Jf0pp_schurPrecond;
+
+    PYLITH_METHOD_RETURN(Jf0pp);
+} // getKernelJf0ppSchurPrecond
+
+
 // ------------------------------------------------------------------------------------------------
 // Get stress kernel for derived field.
 PetscPointFunc
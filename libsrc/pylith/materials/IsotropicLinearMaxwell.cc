@@ -26,9 +26,14 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
 #include <typeinfo> // USES typeid()
+#include <algorithm> // USES std::min()
 
 // ------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorDomain::ProjectKernels ProjectKernels;
@@ -205,6 +210,14 @@ pylith::materials::IsotropicLinearMaxwell::getKernelCauchyStressVector(const spa
 } // getKernelCauchyStressVector
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the elastic Jacobian (Jf3) for the rheology symmetric?
+bool
+pylith::materials::IsotropicLinearMaxwell::isJacobianSymmetric(void) const {
+    return true;
+} // isJacobianSymmetric
+
+
 // ------------------------------------------------------------------------------------------------
 // Update kernel constants.
 void
@@ -250,4 +263,32 @@ pylith::materials::IsotropicLinearMaxwell::addKernelsUpdateStateVars(std::vector
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping on this process.
+PylithReal
+pylith::materials::IsotropicLinearMaxwell::computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeStableTimeStep(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    PylithReal dtStable = PYLITH_MAXSCALAR;
+
+    pylith::topology::VecVisitorMesh maxwellTimeVisitor(auxiliaryField, "maxwell_time");
+    const PetscScalar* maxwellTimeArray = maxwellTimeVisitor.localArray();
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(maxwellTimeVisitor.selectedSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        const PetscInt numDof = maxwellTimeVisitor.sectionDof(point);
+        const PetscInt off = maxwellTimeVisitor.sectionOffset(point);
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            const PylithReal maxwellTime = maxwellTimeArray[off+iDof];
+            if (maxwellTime > 0.0) {
+                dtStable = std::min(dtStable, maxwellTime);
+            } // if
+        } // for
+    } // for
+
+    PYLITH_METHOD_RETURN(dtStable);
+} // computeStableTimeStep
+
+
 // End of file
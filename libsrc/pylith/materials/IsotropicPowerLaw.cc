@@ -26,9 +26,15 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
 #include <typeinfo> // USES typeid()
+#include <algorithm> // USES std::min()
+#include <cmath> // USES pow(), sqrt()
 
 // ------------------------------------------------------------------------------------------------
 typedef pylith::feassemble::IntegratorDomain::ProjectKernels ProjectKernels;
@@ -109,6 +115,7 @@ pylith::materials::IsotropicPowerLaw::addAuxiliarySubfields(void) {
     _auxiliaryFactory->addPowerLawExponent();
     _auxiliaryFactory->addViscousStrain();
     _auxiliaryFactory->addDeviatoricStress();
+    _auxiliaryFactory->addEffectiveStress();
 
     PYLITH_METHOD_END;
 } // addAuxiliarySubfields
@@ -247,15 +254,92 @@ pylith::materials::IsotropicPowerLaw::addKernelsUpdateStateVars(std::vector<Proj
         (_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicPowerLaw3D::deviatoricStress_infinitesimalStrain_refState_asVector :
         (_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicPowerLawPlaneStrain::deviatoricStress_infinitesimalStrain_refState_asVector :
         NULL;
+    const PetscPointFunc funcEffectiveStress =
+        (!_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicPowerLaw3D::effectiveStress_infinitesimalStrain_asVector :
+        (!_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicPowerLawPlaneStrain::effectiveStress_infinitesimalStrain_asVector :
+        (_useReferenceState && 3 == spaceDim) ? pylith::fekernels::IsotropicPowerLaw3D::effectiveStress_infinitesimalStrain_refState_asVector :
+        (_useReferenceState && 2 == spaceDim) ? pylith::fekernels::IsotropicPowerLawPlaneStrain::effectiveStress_infinitesimalStrain_refState_asVector :
+        NULL;
 
     assert(kernels);
     size_t prevNumKernels = kernels->size();
-    kernels->resize(prevNumKernels + 2);
+    kernels->resize(prevNumKernels + 3);
     (*kernels)[prevNumKernels+0] = ProjectKernels("viscous_strain", funcViscousStrain);
     (*kernels)[prevNumKernels+1] = ProjectKernels("deviatoric_stress", funcDeviatoricStress);
+    (*kernels)[prevNumKernels+2] = ProjectKernels("effective_stress", funcEffectiveStress);
 
     PYLITH_METHOD_END;
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping on this process.
+PylithReal
+pylith::materials::IsotropicPowerLaw::computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeStableTimeStep(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    PylithReal dtStable = PYLITH_MAXSCALAR;
+
+    pylith::topology::VecVisitorMesh shearModulusVisitor(auxiliaryField, "shear_modulus");
+    pylith::topology::VecVisitorMesh refStrainRateVisitor(auxiliaryField, "power_law_reference_strain_rate");
+    pylith::topology::VecVisitorMesh refStressVisitor(auxiliaryField, "power_law_reference_stress");
+    pylith::topology::VecVisitorMesh exponentVisitor(auxiliaryField, "power_law_exponent");
+    pylith::topology::VecVisitorMesh devStressVisitor(auxiliaryField, "deviatoric_stress");
+    const PetscScalar* shearModulusArray = shearModulusVisitor.localArray();
+    const PetscScalar* refStrainRateArray = refStrainRateVisitor.localArray();
+    const PetscScalar* refStressArray = refStressVisitor.localArray();
+    const PetscScalar* exponentArray = exponentVisitor.localArray();
+    const PetscScalar* devStressArray = devStressVisitor.localArray();
+
+    // Deviatoric stress has 4 components (xx, yy, zz, xy) in 2D and 6 components in 3D.
+    const int spaceDim = auxiliaryField.getSpaceDim();
+    const PetscInt devStressSize = (3 == spaceDim) ? 6 : 4;
+
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(devStressVisitor.selectedSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        // Use values at points where all subfields have the same number of basis functions.
+        const PetscInt numBasis = devStressVisitor.sectionDof(point) / devStressSize;
+        if (!numBasis ||
+            (shearModulusVisitor.sectionDof(point) != numBasis) ||
+            (refStrainRateVisitor.sectionDof(point) != numBasis) ||
+            (refStressVisitor.sectionDof(point) != numBasis) ||
+            (exponentVisitor.sectionDof(point) != numBasis)) {
+            continue;
+        } // if
+        const PetscInt shearModulusOff = shearModulusVisitor.sectionOffset(point);
+        const PetscInt refStrainRateOff = refStrainRateVisitor.sectionOffset(point);
+        const PetscInt refStressOff = refStressVisitor.sectionOffset(point);
+        const PetscInt exponentOff = exponentVisitor.sectionOffset(point);
+        const PetscInt devStressOff = devStressVisitor.sectionOffset(point);
+        for (PetscInt iBasis = 0; iBasis < numBasis; ++iBasis) {
+            const PylithReal shearModulus = shearModulusArray[shearModulusOff+iBasis];
+            const PylithReal refStrainRate = refStrainRateArray[refStrainRateOff+iBasis];
+            const PylithReal refStress = refStressArray[refStressOff+iBasis];
+            const PylithReal exponent = exponentArray[exponentOff+iBasis];
+            const PetscScalar* devStress = &devStressArray[devStressOff+iBasis*devStressSize];
+
+            // Second invariant of deviatoric stress.
+            PylithReal devStressProd = devStress[0]*devStress[0] + devStress[1]*devStress[1] + devStress[2]*devStress[2];
+            for (PetscInt i = 3; i < devStressSize; ++i) {
+                devStressProd += 2.0*devStress[i]*devStress[i];
+            } // for
+            const PylithReal j2 = sqrt(0.5*devStressProd);
+            if ((j2 <= 0.0) || (shearModulus <= 0.0) || (refStrainRate <= 0.0) || (refStress <= 0.0)) {
+                continue;
+            } // if
+
+            // Effective viscosity is 1/(2*gamma), where the viscous strain rate is gamma times the
+            // deviatoric stress, so the Maxwell time is 1/(2*shearModulus*gamma).
+            const PylithReal gamma = refStrainRate * pow(j2 / refStress, exponent - 1.0) / refStress;
+            const PylithReal maxwellTime = 1.0 / (2.0 * shearModulus * gamma);
+            dtStable = std::min(dtStable, maxwellTime);
+        } // for
+    } // for
+
+    PYLITH_METHOD_RETURN(dtStable);
+} // computeStableTimeStep
+
+
 // End of file
@@ -125,6 +125,16 @@ public:
     void updateKernelConstants(pylith::real_array* kernelConstants,
                                const PylithReal dt) const;
 
+    /** Compute stable time step for implicit time stepping on this process.
+     *
+     * The stable time step is the minimum Maxwell time computed from the effective viscosity at
+     * the current deviatoric stress, so it changes as stresses evolve.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const;
+
     // PRIVATE MEMBERS ////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -108,6 +108,14 @@ pylith::materials::Material::getSolverDefaults(const bool isParallel,
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Is the Jacobian for the material symmetric?
+bool
+pylith::materials::Material::isJacobianSymmetric(void) const {
+    return false;
+} // isJacobianSymmetric
+
+
 // ------------------------------------------------------------------------------------------------
 // Get residual kernels for an interior interface bounding material.
 std::vector<pylith::materials::Material::InterfaceResidualKernels>
@@ -117,6 +117,13 @@ public:
     pylith::utils::PetscOptions* getSolverDefaults(const bool isParallel,
                                                    const bool hasFault) const;
 
+    /** Is the Jacobian for the material symmetric?
+     *
+     * @returns True if the Jacobian is symmetric, false otherwise.
+     */
+    virtual
+    bool isJacobianSymmetric(void) const;
+
     /** Get residual kernels for an interior interface bounding material.
      *
      * @param[in] solution Solution field.
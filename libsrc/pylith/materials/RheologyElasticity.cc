@@ -22,6 +22,7 @@
 
 #include "pylith/feassemble/Integrator.hh" // USES NEW_JACOBIAN_NEVER
 
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_DEBUG
 
@@ -84,4 +85,20 @@ pylith::materials::RheologyElasticity::addKernelsUpdateStateVars(std::vector<pyl
 } // addKernelsUpdateStateVars
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping on this process.
+PylithReal
+pylith::materials::RheologyElasticity::computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const {
+    return PYLITH_MAXSCALAR;
+} // computeStableTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Is the elastic Jacobian (Jf3) for the rheology symmetric?
+bool
+pylith::materials::RheologyElasticity::isJacobianSymmetric(void) const {
+    return false;
+} // isJacobianSymmetric
+
+
 // End of file
@@ -130,6 +130,21 @@ public:
     void updateKernelConstants(pylith::real_array* kernelConstants,
                                const PylithReal dt) const;
 
+    /** Compute stable time step for implicit time stepping on this process.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    virtual
+    PylithReal computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const;
+
+    /** Is the elastic Jacobian (Jf3) for the rheology symmetric?
+     *
+     * @returns True if the Jacobian is symmetric, false otherwise.
+     */
+    virtual
+    bool isJacobianSymmetric(void) const;
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 
     int _lhsJacobianTriggers; ///< Triggers for needing to recompute the RHS Jacobian.
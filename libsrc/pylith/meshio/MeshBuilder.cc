@@ -46,6 +46,30 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 
     assert(mesh);
     assert(coordinates);
+
+    PylithInt* cellsPetsc = const_cast<PylithInt*>(&cells[0]);
+    invertCells(cellsPetsc, numCells, numCorners, meshDim);
+    buildMesh(mesh, &(*coordinates)[0], numVertices, spaceDim, cellsPetsc, numCells, numCorners, meshDim, isParallel);
+
+    PYLITH_METHOD_END;
+} // buildMesh
+
+
+// ----------------------------------------------------------------------
+// Set vertices and cells in mesh from raw arrays.
+void
+pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
+                                       const PylithScalar* coordinates,
+                                       const int numVertices,
+                                       int spaceDim,
+                                       const PylithInt* cells,
+                                       const int numCells,
+                                       const int numCorners,
+                                       const int meshDim,
+                                       const bool isParallel) { // buildMesh
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
     MPI_Comm comm = mesh->getComm();
     PetscInt dim = meshDim;
     PetscErrorCode err;
@@ -53,7 +77,7 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
     { // Check to make sure every vertex is in at least one cell.
       // This is required by PETSc
         std::vector<bool> vertexInCell(numVertices, false);
-        const int size = cells.size();
+        const int size = numCells * numCorners;
         for (int i = 0; i < size; ++i) {
             vertexInCell[cells[i]] = true;
         }
@@ -76,24 +100,40 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 
     err = MPI_Bcast(&dim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
     err = MPI_Bcast(&spaceDim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
-    const PetscInt bound = numCells*numCorners;
-    for (PetscInt coff = 0; coff < bound; coff += numCorners) {
-        DMPolytopeType ct;
-
-        if (dim < 3) { continue;}
-        switch (numCorners) {
-        case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
-        case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
-        case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
-        default: continue;
-        }
-        err = DMPlexInvertCell(ct, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
-    }
-    err = DMPlexCreateFromCellListPetsc(comm, dim, numCells, numVertices, numCorners, interpolate, &cells[0], spaceDim, &(*coordinates)[0], &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCreateFromCellListPetsc(comm, dim, numCells, numVertices, numCorners, interpolate, cells, spaceDim, coordinates, &dmMesh);PYLITH_CHECK_ERROR(err);
     mesh->setDM(dmMesh);
 
     PYLITH_METHOD_END;
 } // buildMesh
 
 
+// ----------------------------------------------------------------------
+// Convert between PyLith and PETSc ordering of vertices in cells.
+void
+pylith::meshio::MeshBuilder::invertCells(PylithInt* cells,
+                                         const int numCells,
+                                         const int numCorners,
+                                         const int meshDim) {
+    PYLITH_METHOD_BEGIN;
+
+    if (meshDim < 3) { PYLITH_METHOD_END;}
+
+    DMPolytopeType ct;
+    switch (numCorners) {
+    case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
+    case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
+    case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
+    default: PYLITH_METHOD_END;
+    } // switch
+
+    PetscErrorCode err = 0;
+    const PetscInt bound = numCells*numCorners;
+    for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+        err = DMPlexInvertCell(ct, &cells[coff]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // invertCells
+
+
 // End of file
@@ -72,6 +72,50 @@ void buildMesh(topology::Mesh* mesh,
                const int numCorners,
                const int meshDim,
                const bool isParallel =false);
+
+/** Build mesh topology and set vertex coordinates from raw arrays.
+ *
+ * The arrays are passed to PETSc without copying, so they may be
+ * slices of a memory-mapped file. Cells MUST use the PETSc vertex
+ * ordering (see invertCells()).
+ *
+ * @param mesh PyLith finite-element mesh.
+ * @param coordinates Array of coordinates of vertices [numVertices*spaceDim].
+ * @param numVertices Number of vertices.
+ * @param spaceDim Dimension of vector space for vertex coordinates.
+ * @param cells Array of indices of vertices in cells (first index is 0) [numCells*numCorners].
+ * @param numCells Number of cells.
+ * @param numCorners Number of vertices per cell.
+ * @param meshDim Dimension of cells in mesh.
+ * @param isParallel Create parallel mesh if true, otherwise only build
+ *   mesh on proc 0.
+ */
+static
+void buildMesh(topology::Mesh* mesh,
+               const PylithScalar* coordinates,
+               const int numVertices,
+               int spaceDim,
+               const PylithInt* cells,
+               const int numCells,
+               const int numCorners,
+               const int meshDim,
+               const bool isParallel =false);
+
+/** Convert between PyLith and PETSc ordering of vertices in cells.
+ *
+ * The conversion is its own inverse.
+ *
+ * @param cells Array of indices of vertices in cells [numCells*numCorners].
+ * @param numCells Number of cells.
+ * @param numCorners Number of vertices per cell.
+ * @param meshDim Dimension of cells in mesh.
+ */
+static
+void invertCells(PylithInt* cells,
+                 const int numCells,
+                 const int numCorners,
+                 const int meshDim);
+
 }; // MeshBuilder
 
 #endif // pylith_meshio_meshbuilder_hh
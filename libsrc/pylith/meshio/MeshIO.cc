@@ -244,6 +244,19 @@ pylith::meshio::MeshIO::_getCells(int_array* cells,
 void
 pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds) {
     PYLITH_METHOD_BEGIN;
+
+    _setMaterials(materialIds.size() > 0 ? &materialIds[0] : NULL, materialIds.size());
+
+    PYLITH_METHOD_END;
+} // _setMaterials
+
+
+// ----------------------------------------------------------------------
+// Tag cells in mesh with material identifiers.
+void
+pylith::meshio::MeshIO::_setMaterials(const PylithInt* materialIds,
+                                      const size_t numCells) {
+    PYLITH_METHOD_BEGIN;
     assert(_mesh);
 
     PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
@@ -256,10 +269,10 @@ pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds) {
         const PetscInt cStart = cellsStratum.begin();
         const PetscInt cEnd = cellsStratum.end();
 
-        if (size_t(cellsStratum.size()) != materialIds.size()) {
+        if (size_t(cellsStratum.size()) != numCells) {
             std::ostringstream msg;
             msg << "Mismatch in size of materials identifier array ("
-                << materialIds.size() << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
+                << numCells << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
             throw std::runtime_error(msg.str());
         } // if
         for (PetscInt c = cStart; c < cEnd; ++c) {
@@ -308,17 +321,31 @@ pylith::meshio::MeshIO::_setGroup(const std::string& name,
                                   const int_array& points) { // _setGroup
     PYLITH_METHOD_BEGIN;
 
+    _setGroup(name, type, points.size() > 0 ? &points[0] : NULL, points.size());
+
+    PYLITH_METHOD_END;
+} // _setGroup
+
+
+// ----------------------------------------------------------------------
+// Build a point group as an int section.
+void
+pylith::meshio::MeshIO::_setGroup(const std::string& name,
+                                  const GroupPtType type,
+                                  const PylithInt* points,
+                                  const size_t numPoints) { // _setGroup
+    PYLITH_METHOD_BEGIN;
+
     assert(_mesh);
 
     PetscDM dmMesh = _mesh->getDM();assert(dmMesh);
-    const PetscInt numPoints = points.size();
     DMLabel label;
     PetscErrorCode err;
 
     err = DMCreateLabel(dmMesh, name.c_str());PYLITH_CHECK_ERROR(err);
     err = DMGetLabel(dmMesh, name.c_str(), &label);PYLITH_CHECK_ERROR(err);
     if (CELL == type) {
-        for (PetscInt p = 0; p < numPoints; ++p) {
+        for (size_t p = 0; p < numPoints; ++p) {
             err = DMLabelSetValue(label, points[p], 1);PYLITH_CHECK_ERROR(err);
         } // for
     } else if (VERTEX == type) {
@@ -327,11 +354,11 @@ pylith::meshio::MeshIO::_setGroup(const std::string& name,
         err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
         err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
         numCells = cEnd - cStart;
-        for (PetscInt p = 0; p < numPoints; ++p) {
+        for (size_t p = 0; p < numPoints; ++p) {
             err = DMLabelSetValue(label, numCells+points[p], 1);PYLITH_CHECK_ERROR(err);
         } // for
           // Also add any non-cells which have all vertices marked
-        for (PetscInt p = 0; p < numPoints; ++p) {
+        for (size_t p = 0; p < numPoints; ++p) {
             const PetscInt vertex = numCells+points[p];
             PetscInt      *star = NULL, starSize, s;
 
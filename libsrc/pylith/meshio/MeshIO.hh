@@ -126,6 +126,14 @@ protected:
      */
     void _setMaterials(const int_array& materialIds);
 
+    /** Tag cells in mesh with material identifiers.
+     *
+     * @param materialIds Material identifiers [numCells]
+     * @param numCells Number of cells.
+     */
+    void _setMaterials(const PylithInt* materialIds,
+                       const size_t numCells);
+
     /** Get material identifiers for cells.
      *
      * @param materialIds Material identifiers [numCells]
@@ -145,6 +153,21 @@ protected:
                    const GroupPtType type,
                    const int_array& points);
 
+    /** Build a point group
+     *
+     * The indices in the points array must use zero based indices. In
+     * other words, the lowest index MUST be 0 not 1.
+     *
+     * @param name The group name
+     * @param type The point type, e.g. VERTEX, CELL
+     * @param points An array of the points in the group [numPoints].
+     * @param numPoints Number of points in the group.
+     */
+    void _setGroup(const std::string& name,
+                   const GroupPtType type,
+                   const PylithInt* points,
+                   const size_t numPoints);
+
     /** Get names of all groups in mesh.
      *
      * @returns Array of group names.
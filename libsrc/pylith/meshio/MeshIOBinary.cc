@@ -0,0 +1,413 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOBinary.hh" // implementation of class methods
+
+#include "MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <sys/mman.h> // USES mmap(), munmap()
+#include <sys/stat.h> // USES fstat()
+#include <fcntl.h> // USES open()
+#include <unistd.h> // USES close()
+
+#include <limits> // USES std::numeric_limits
+#include <cstring> // USES memcpy(), memset(), strncmp()
+#include <cstdint> // USES int32_t, int64_t
+#include <cassert> // USES assert()
+#include <fstream> // USES std::ofstream
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _MeshIOBinary {
+public:
+
+            static const char* magic;
+            static const int32_t version;
+            static const int32_t byteOrderCheck;
+            static const size_t alignment;
+
+            /// Header of binary mesh file.
+            struct Header {
+                char magic[8];
+                int32_t version;
+                int32_t byteOrder;
+                int32_t meshDim;
+                int32_t spaceDim;
+                int32_t numCorners;
+                int32_t numGroups;
+                int32_t intSize;
+                int32_t scalarSize;
+                int64_t numVertices;
+                int64_t numCells;
+                int64_t reserved;
+            }; // Header
+
+            /// Header of group block in binary mesh file.
+            struct GroupHeader {
+                int32_t nameLength;
+                int32_t type;
+                int64_t numPoints;
+            }; // GroupHeader
+
+            /// Read-only memory map of a file that is unmapped when it goes out of scope.
+            class MappedFile {
+public:
+
+                MappedFile(const std::string& filename);
+                ~MappedFile(void);
+
+                /** Get pointer to block of data and advance offset.
+                 *
+                 * @param[in] numBytes Number of bytes in block.
+                 * @returns Pointer to start of block.
+                 */
+                const char* block(const size_t numBytes);
+
+                const char* data; ///< Start of mapped memory.
+                size_t size; ///< Size of mapped memory.
+                size_t offset; ///< Current offset into mapped memory.
+                std::string filename; ///< Name of mapped file.
+            }; // MappedFile
+
+            /** Round size up to alignment.
+             *
+             * @param[in] numBytes Number of bytes.
+             * @returns Number of bytes including padding.
+             */
+            static
+            size_t padded(const size_t numBytes) {
+                return ((numBytes + alignment - 1) / alignment) * alignment;
+            } // padded
+
+            /** Get number of bytes in block of values, checking for invalid counts and overflow.
+             *
+             * @param[in] numValues Number of values in block (from file).
+             * @param[in] valueSize Number of bytes per value.
+             * @param[in] description Description of values for error message.
+             * @returns Number of bytes in block.
+             */
+            static
+            size_t blockSize(const int64_t numValues,
+                             const size_t valueSize,
+                             const char* description);
+
+        }; // _MeshIOBinary
+        const char* _MeshIOBinary::magic = "PYLITHMB";
+        const int32_t _MeshIOBinary::version = 1;
+        const int32_t _MeshIOBinary::byteOrderCheck = 0x01020304;
+        const size_t _MeshIOBinary::alignment = 8;
+    } // meshio
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOBinary::MeshIOBinary(void) :
+    _filename("") { // constructor
+    PyreComponent::setName("meshiobinary");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOBinary::~MeshIOBinary(void) { // destructor
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOBinary::deallocate(void) { // deallocate
+    PYLITH_METHOD_BEGIN;
+
+    MeshIO::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh.
+void
+pylith::meshio::MeshIOBinary::_read(void) { // _read
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_read()");
+
+    const int commRank = _mesh->getCommRank();
+    if (0 == commRank) {
+        try {
+            _MeshIOBinary::MappedFile fileMap(_filename);
+
+            _MeshIOBinary::Header header;
+            memcpy(&header, fileMap.block(sizeof(header)), sizeof(header));
+            if (strncmp(header.magic, _MeshIOBinary::magic, sizeof(header.magic))) {
+                throw std::runtime_error("File is not a PyLith binary mesh file.");
+            } // if
+            if (header.version != _MeshIOBinary::version) {
+                std::ostringstream msg;
+                msg << "Unsupported version " << header.version << " of PyLith binary mesh file. Expected version "
+                    << _MeshIOBinary::version << ".";
+                throw std::runtime_error(msg.str());
+            } // if
+            if (header.byteOrder != _MeshIOBinary::byteOrderCheck) {
+                throw std::runtime_error("Byte order of PyLith binary mesh file does not match byte order of machine.");
+            } // if
+            if ((header.intSize != int32_t(sizeof(PylithInt))) || (header.scalarSize != int32_t(sizeof(PylithScalar)))) {
+                std::ostringstream msg;
+                msg << "Size of integers (" << header.intSize << ") and floating point values (" << header.scalarSize
+                    << ") in PyLith binary mesh file do not match PETSc build (" << sizeof(PylithInt) << " and "
+                    << sizeof(PylithScalar) << "). Regenerate the mesh file with this build.";
+                throw std::runtime_error(msg.str());
+            } // if
+
+            if ((header.meshDim < 0) || (header.meshDim > 3) || (header.spaceDim < 1) || (header.spaceDim > 3) ||
+                (header.meshDim > header.spaceDim) || (header.numCorners < 1) || (header.numGroups < 0) ||
+                (header.numVertices < 0) || (header.numCells < 0) ||
+                (header.numVertices > PETSC_MAX_INT) || (header.numCells > PETSC_MAX_INT)) {
+                std::ostringstream msg;
+                msg << "Invalid header in PyLith binary mesh file: meshDim=" << header.meshDim
+                    << ", spaceDim=" << header.spaceDim << ", numCorners=" << header.numCorners
+                    << ", numGroups=" << header.numGroups << ", numVertices=" << header.numVertices
+                    << ", numCells=" << header.numCells << ".";
+                throw std::runtime_error(msg.str());
+            } // if
+
+            const size_t coordinatesSize = _MeshIOBinary::blockSize(header.numVertices, header.spaceDim*sizeof(PylithScalar), "vertex coordinates");
+            const size_t cellsSize = _MeshIOBinary::blockSize(header.numCells, header.numCorners*sizeof(PylithInt), "cells");
+            const size_t materialIdsSize = _MeshIOBinary::blockSize(header.numCells, sizeof(PylithInt), "material ids");
+            const PylithScalar* coordinates = reinterpret_cast<const PylithScalar*>(fileMap.block(coordinatesSize));
+            const PylithInt* cells = reinterpret_cast<const PylithInt*>(fileMap.block(cellsSize));
+            const PylithInt* materialIds = reinterpret_cast<const PylithInt*>(fileMap.block(materialIdsSize));
+
+            MeshBuilder::buildMesh(_mesh, coordinates, header.numVertices, header.spaceDim, cells, header.numCells,
+                                   header.numCorners, header.meshDim);
+            _setMaterials(materialIds, header.numCells);
+
+            for (int32_t iGroup = 0; iGroup < header.numGroups; ++iGroup) {
+                _MeshIOBinary::GroupHeader groupHeader;
+                memcpy(&groupHeader, fileMap.block(sizeof(groupHeader)), sizeof(groupHeader));
+                if ((groupHeader.type != VERTEX) && (groupHeader.type != CELL)) {
+                    std::ostringstream msg;
+                    msg << "Invalid type " << groupHeader.type << " for group " << iGroup << " in PyLith binary mesh file.";
+                    throw std::runtime_error(msg.str());
+                } // if
+                const size_t nameSize = _MeshIOBinary::blockSize(groupHeader.nameLength, sizeof(char), "group name");
+                const std::string name(fileMap.block(nameSize), nameSize);
+                const size_t pointsSize = _MeshIOBinary::blockSize(groupHeader.numPoints, sizeof(PylithInt), "group points");
+                const PylithInt* points = reinterpret_cast<const PylithInt*>(fileMap.block(pointsSize));
+                _setGroup(name, GroupPtType(groupHeader.type), points, groupHeader.numPoints);
+            } // for
+        } catch (const std::exception& err) {
+            std::ostringstream msg;
+            msg << "Error occurred while reading PyLith binary mesh file '" << _filename << "'.\n"
+                << err.what();
+            throw std::runtime_error(msg.str());
+        } // try/catch
+    } else {
+        MeshBuilder::buildMesh(_mesh, (const PylithScalar*)NULL, 0, 0, (const PylithInt*)NULL, 0, 0, 0);
+        _setMaterials(NULL, 0);
+    } // if/else
+    _distributeGroups();
+
+    PYLITH_METHOD_END;
+} // read
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write mesh to file.
+void
+pylith::meshio::MeshIOBinary::_write(void) const { // write
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_write()");
+
+    std::ofstream fileout(_filename.c_str(), std::ios::out | std::ios::binary);
+    if (!fileout.is_open() || !fileout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open mesh file '" << _filename
+            << "' for writing.\n";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    int spaceDim = 0;
+    int numVertices = 0;
+    scalar_array coordinates;
+    _getVertices(&coordinates, &numVertices, &spaceDim);
+
+    int meshDim = 0;
+    int numCells = 0;
+    int numCorners = 0;
+    int_array cells;
+    _getCells(&cells, &numCells, &numCorners, &meshDim);
+    if (cells.size() > 0) {
+        MeshBuilder::invertCells(&cells[0], numCells, numCorners, meshDim);
+    } // if
+
+    int_array materialIds;
+    _getMaterials(&materialIds);
+
+    string_vector groupNames;
+    _getGroupNames(&groupNames);
+
+    _MeshIOBinary::Header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, _MeshIOBinary::magic, sizeof(header.magic));
+    header.version = _MeshIOBinary::version;
+    header.byteOrder = _MeshIOBinary::byteOrderCheck;
+    header.meshDim = meshDim;
+    header.spaceDim = spaceDim;
+    header.numCorners = numCorners;
+    header.numGroups = groupNames.size();
+    header.intSize = sizeof(PylithInt);
+    header.scalarSize = sizeof(PylithScalar);
+    header.numVertices = numVertices;
+    header.numCells = numCells;
+    _writeBlock(fileout, &header, sizeof(header));
+    _writeBlock(fileout, coordinates.size() > 0 ? &coordinates[0] : NULL, coordinates.size()*sizeof(PylithScalar));
+    _writeBlock(fileout, cells.size() > 0 ? &cells[0] : NULL, cells.size()*sizeof(PylithInt));
+    _writeBlock(fileout, materialIds.size() > 0 ? &materialIds[0] : NULL, materialIds.size()*sizeof(PylithInt));
+
+    for (size_t iGroup = 0; iGroup < groupNames.size(); ++iGroup) {
+        int_array points;
+        GroupPtType type;
+        _getGroup(&points, &type, groupNames[iGroup].c_str());
+
+        _MeshIOBinary::GroupHeader groupHeader;
+        groupHeader.nameLength = groupNames[iGroup].length();
+        groupHeader.type = type;
+        groupHeader.numPoints = points.size();
+        _writeBlock(fileout, &groupHeader, sizeof(groupHeader));
+        _writeBlock(fileout, groupNames[iGroup].c_str(), groupNames[iGroup].length());
+        _writeBlock(fileout, points.size() > 0 ? &points[0] : NULL, points.size()*sizeof(PylithInt));
+    } // for
+
+    if (!fileout.good()) {
+        std::ostringstream msg;
+        msg << "Error occurred while writing PyLith binary mesh file '" << _filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    fileout.close();
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write block of data padded to 8-byte boundary.
+void
+pylith::meshio::MeshIOBinary::_writeBlock(std::ostream& fileout,
+                                          const void* data,
+                                          const size_t numBytes) {
+    if (numBytes > 0) {
+        fileout.write(static_cast<const char*>(data), numBytes);
+    } // if
+    const size_t numPadding = _MeshIOBinary::padded(numBytes) - numBytes;
+    const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    fileout.write(padding, numPadding);
+} // _writeBlock
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::meshio::_MeshIOBinary::MappedFile::MappedFile(const std::string& filenameValue) :
+    data(NULL),
+    size(0),
+    offset(0),
+    filename(filenameValue) {
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::ostringstream msg;
+        msg << "Could not open mesh file '" << filename << "' for reading.";
+        throw std::runtime_error(msg.str());
+    } // if
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) < 0) {
+        close(fd);
+        std::ostringstream msg;
+        msg << "Could not get size of mesh file '" << filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    size = fileStat.st_size;
+    if (size > 0) {
+        void* ptr = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED == ptr) {
+            close(fd);
+            std::ostringstream msg;
+            msg << "Could not memory map mesh file '" << filename << "'.";
+            throw std::runtime_error(msg.str());
+        } // if
+        data = static_cast<const char*>(ptr);
+    } // if
+    close(fd); // Mapping remains valid after closing the file descriptor.
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::meshio::_MeshIOBinary::MappedFile::~MappedFile(void) {
+    if (data) {
+        munmap(const_cast<char*>(data), size);
+    } // if
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of bytes in block of values, checking for invalid counts and overflow.
+size_t
+pylith::meshio::_MeshIOBinary::blockSize(const int64_t numValues,
+                                         const size_t valueSize,
+                                         const char* description) {
+    assert(valueSize > 0);
+    if ((numValues < 0) || (uint64_t(numValues) > std::numeric_limits<size_t>::max() / valueSize)) {
+        std::ostringstream msg;
+        msg << "Invalid number of values (" << numValues << ") for " << description << " in PyLith binary mesh file.";
+        throw std::runtime_error(msg.str());
+    } // if
+    return size_t(numValues) * valueSize;
+} // blockSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get pointer to block of data and advance offset.
+const char*
+pylith::meshio::_MeshIOBinary::MappedFile::block(const size_t numBytes) {
+    assert(offset <= size);
+    if (numBytes > size - offset) {
+        std::ostringstream msg;
+        msg << "Unexpected end of file. Expected " << numBytes << " bytes at offset " << offset << " but file size is " << size << " bytes.";
+        throw std::runtime_error(msg.str());
+    } // if
+    const char* ptr = data + offset;
+    // Padding at the end of the file may be missing, so never advance past the end of the file.
+    const size_t numBytesPadded = padded(numBytes);
+    offset = (numBytesPadded > size - offset) ? size : offset + numBytesPadded;
+    return ptr;
+} // block
+
+
+// End of file
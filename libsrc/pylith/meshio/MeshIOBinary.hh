@@ -0,0 +1,120 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOBinary.hh
+ *
+ * @brief C++ input/output manager for PyLith binary mesh files.
+ *
+ * The binary mesh file uses native byte order and consists of a
+ * fixed-size header followed by data blocks. Every block starts on an
+ * 8-byte boundary, so the file can be memory-mapped and the blocks
+ * passed directly to PETSc.
+ *
+ * Header (64 bytes):
+ *   char[8] magic "PYLITHMB"
+ *   int32 version (1)
+ *   int32 byte order check (0x01020304)
+ *   int32 mesh dimension
+ *   int32 space dimension
+ *   int32 number of corners per cell
+ *   int32 number of groups
+ *   int32 size of integers in bytes (sizeof(PylithInt))
+ *   int32 size of floating point values in bytes (sizeof(PylithScalar))
+ *   int64 number of vertices
+ *   int64 number of cells
+ *   int64 reserved (0)
+ *
+ * Vertex block: PylithScalar coordinates [numVertices*spaceDim]
+ * Cell block: PylithInt cells [numCells*numCorners], zero based, PETSc vertex ordering
+ * Material block: PylithInt material identifiers [numCells]
+ * Group blocks (numGroups times):
+ *   int32 length of name, int32 type (0=vertices, 1=cells), int64 number of points,
+ *   char[] name, PylithInt points [numPoints]
+ */
+
+#if !defined(pylith_meshio_meshiobinary_hh)
+#define pylith_meshio_meshiobinary_hh
+
+#include "MeshIO.hh" // ISA MeshIO
+
+#include <iosfwd> // USES std::ostream
+#include <string> // HASA std::string
+
+class pylith::meshio::MeshIOBinary : public MeshIO {
+    friend class TestMeshIOBinary; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    MeshIOBinary(void);
+
+    /// Destructor
+    ~MeshIOBinary(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set filename for binary file.
+     *
+     * @param filename Name of file
+     */
+    void setFilename(const char* name);
+
+    /** Get filename of binary file.
+     *
+     * @returns Name of file
+     */
+    const char* getFilename(void) const;
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Write mesh
+    void _write(void) const;
+
+    /// Read mesh
+    void _read(void);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Write block of data padded to 8-byte boundary.
+     *
+     * @param fileout Output stream
+     * @param data Data to write.
+     * @param numBytes Number of bytes of data.
+     */
+    static
+    void _writeBlock(std::ostream& fileout,
+                     const void* data,
+                     const size_t numBytes);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::string _filename; ///< Name of file
+
+}; // MeshIOBinary
+
+#include "MeshIOBinary.icc" // inline methods
+
+#endif // pylith_meshio_meshiobinary_hh
+
+// End of file
@@ -0,0 +1,449 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOBox.hh" // implementation of class methods
+
+#include "MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include <cmath> // USES floor()
+#include <vector> // USES std::vector
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _MeshIOBox {
+public:
+
+            /// Indexing of vertices in structured grid.
+            class Grid {
+public:
+
+                /** Constructor.
+                 *
+                 * @param[in] numCells Number of cells in each direction.
+                 */
+                Grid(const std::vector<int>& numCells) :
+                    nx(numCells[0]),
+                    ny(numCells[1]),
+                    nz(numCells.size() > 2 ? numCells[2] : 0) {}
+
+
+                /** Get index of vertex.
+                 *
+                 * @param[in] i Index of vertex in x direction.
+                 * @param[in] j Index of vertex in y direction.
+                 * @param[in] k Index of vertex in z direction.
+                 * @returns Index of vertex.
+                 */
+                int vertex(const int i,
+                           const int j,
+                           const int k=0) const {
+                    return i + (nx+1)*(j + (ny+1)*k);
+                } // vertex
+
+                const int nx; ///< Number of cells in x direction.
+                const int ny; ///< Number of cells in y direction.
+                const int nz; ///< Number of cells in z direction (0 for 2D).
+            }; // Grid
+
+            static const char* boundaryNames[6];
+
+            /** Create cells for 2D mesh.
+             *
+             * @param[out] cells Array of vertices in cells.
+             * @param[in] grid Structured grid.
+             * @param[in] cellShape Shape of cells.
+             */
+            static
+            void createCells2D(int_array* cells,
+                               const Grid& grid,
+                               const MeshIOBox::CellShapeEnum cellShape);
+
+            /** Create cells for 3D mesh.
+             *
+             * @param[out] cells Array of vertices in cells.
+             * @param[in] grid Structured grid.
+             * @param[in] cellShape Shape of cells.
+             */
+            static
+            void createCells3D(int_array* cells,
+                               const Grid& grid,
+                               const MeshIOBox::CellShapeEnum cellShape);
+
+        }; // _MeshIOBox
+        const char* _MeshIOBox::boundaryNames[6] = {
+            "boundary_xneg", "boundary_xpos",
+            "boundary_yneg", "boundary_ypos",
+            "boundary_zneg", "boundary_zpos",
+        };
+    } // meshio
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOBox::MeshIOBox(void) :
+    _cellShape(TENSOR) { // constructor
+    PyreComponent::setName("meshiobox");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOBox::~MeshIOBox(void) { // destructor
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOBox::deallocate(void) { // deallocate
+    PYLITH_METHOD_BEGIN;
+
+    MeshIO::deallocate();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set coordinates of corner of box with minimum coordinates.
+void
+pylith::meshio::MeshIOBox::setLower(const PylithReal* values,
+                                    const int size) {
+    PYLITH_COMPONENT_DEBUG("setLower(values="<<values<<", size="<<size<<")");
+
+    assert(0 == size || values);
+    _lower.resize(size);
+    for (int i = 0; i < size; ++i) {
+        _lower[i] = values[i];
+    } // for
+} // setLower
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set coordinates of corner of box with maximum coordinates.
+void
+pylith::meshio::MeshIOBox::setUpper(const PylithReal* values,
+                                    const int size) {
+    PYLITH_COMPONENT_DEBUG("setUpper(values="<<values<<", size="<<size<<")");
+
+    assert(0 == size || values);
+    _upper.resize(size);
+    for (int i = 0; i < size; ++i) {
+        _upper[i] = values[i];
+    } // for
+} // setUpper
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of cells in each direction.
+void
+pylith::meshio::MeshIOBox::setNumCells(const int* values,
+                                       const int size) {
+    PYLITH_COMPONENT_DEBUG("setNumCells(values="<<values<<", size="<<size<<")");
+
+    assert(0 == size || values);
+    _numCells.resize(size);
+    for (int i = 0; i < size; ++i) {
+        if (values[i] <= 0) {
+            std::ostringstream msg;
+            msg << "Number of cells (" << values[i] << ") in direction " << i << " of box mesh must be positive.";
+            throw std::runtime_error(msg.str());
+        } // if
+        _numCells[i] = values[i];
+    } // for
+} // setNumCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set shape of cells.
+void
+pylith::meshio::MeshIOBox::setCellShape(const CellShapeEnum value) {
+    PYLITH_COMPONENT_DEBUG("setCellShape(value="<<value<<")");
+
+    _cellShape = value;
+} // setCellShape
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set x coordinates of faults normal to x axis.
+void
+pylith::meshio::MeshIOBox::setFaults(const PylithReal* xFaults,
+                                     const int numFaults) {
+    PYLITH_COMPONENT_DEBUG("setFaults(xFaults="<<xFaults<<", numFaults="<<numFaults<<")");
+
+    assert(0 == numFaults || xFaults);
+    _xFaults.resize(numFaults);
+    for (int i = 0; i < numFaults; ++i) {
+        _xFaults[i] = xFaults[i];
+    } // for
+} // setFaults
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Generate mesh.
+void
+pylith::meshio::MeshIOBox::_read(void) { // _read
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_read()");
+
+    const int spaceDim = _numCells.size();
+    if ((spaceDim < 2) || (spaceDim > 3) || (_lower.size() != size_t(spaceDim)) || (_upper.size() != size_t(spaceDim))) {
+        std::ostringstream msg;
+        msg << "Dimension of box mesh must be 2 or 3, and the number of cells (" << _numCells.size()
+            << " values), lower corner (" << _lower.size() << " values), and upper corner (" << _upper.size()
+            << " values) must have the same dimension.";
+        throw std::runtime_error(msg.str());
+    } // if
+    for (int iDim = 0; iDim < spaceDim; ++iDim) {
+        if (_upper[iDim] <= _lower[iDim]) {
+            std::ostringstream msg;
+            msg << "Upper coordinate (" << _upper[iDim] << ") of box mesh must be greater than lower coordinate ("
+                << _lower[iDim] << ") in direction " << iDim << ".";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
+    const int commRank = _mesh->getCommRank();
+    int meshDim = 0;
+    int numVertices = 0;
+    int numCells = 0;
+    int numCorners = 0;
+    scalar_array coordinates;
+    int_array cells;
+    int_array materialIds;
+
+    if (0 == commRank) {
+        const _MeshIOBox::Grid grid(_numCells);
+        const int nx = grid.nx;
+        const int ny = grid.ny;
+        const int nz = grid.nz;
+        const int nzVertices = (3 == spaceDim) ? nz+1 : 1;
+
+        // Vertices
+        numVertices = (nx+1)*(ny+1)*nzVertices;
+        coordinates.resize(numVertices*spaceDim);
+        const PylithReal dx = (_upper[0] - _lower[0]) / nx;
+        const PylithReal dy = (_upper[1] - _lower[1]) / ny;
+        const PylithReal dz = (3 == spaceDim) ? (_upper[2] - _lower[2]) / nz : 0.0;
+        for (int k = 0; k < nzVertices; ++k) {
+            for (int j = 0; j <= ny; ++j) {
+                for (int i = 0; i <= nx; ++i) {
+                    const int v = grid.vertex(i, j, k);
+                    coordinates[v*spaceDim+0] = (i < nx) ? _lower[0] + i*dx : _upper[0];
+                    coordinates[v*spaceDim+1] = (j < ny) ? _lower[1] + j*dy : _upper[1];
+                    if (3 == spaceDim) {
+                        coordinates[v*spaceDim+2] = (k < nz) ? _lower[2] + k*dz : _upper[2];
+                    } // if
+                } // for
+            } // for
+        } // for
+
+        // Cells
+        meshDim = spaceDim;
+        if (2 == spaceDim) {
+            _MeshIOBox::createCells2D(&cells, grid, _cellShape);
+            numCorners = (TENSOR == _cellShape) ? 4 : 3;
+        } else {
+            _MeshIOBox::createCells3D(&cells, grid, _cellShape);
+            numCorners = (TENSOR == _cellShape) ? 8 : 4;
+        } // if/else
+        numCells = cells.size() / numCorners;
+        materialIds.resize(numCells);
+        materialIds = 1;
+
+        MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim);
+        _setMaterials(materialIds);
+
+        // Boundary groups
+        const int numVerticesDir[3] = { nx+1, ny+1, nzVertices };
+        for (int iDim = 0; iDim < spaceDim; ++iDim) {
+            const int dir1 = (iDim + 1) % spaceDim;
+            const int dir2 = (iDim + 2) % spaceDim;
+            const int num1 = numVerticesDir[dir1];
+            const int num2 = (3 == spaceDim) ? numVerticesDir[dir2] : 1;
+            for (int iSide = 0; iSide < 2; ++iSide) {
+                const int index = (0 == iSide) ? 0 : numVerticesDir[iDim]-1;
+                int_array points(num1*num2);
+                int count = 0;
+                for (int i2 = 0; i2 < num2; ++i2) {
+                    for (int i1 = 0; i1 < num1; ++i1) {
+                        int ijk[3] = { 0, 0, 0 };
+                        ijk[iDim] = index;
+                        ijk[dir1] = i1;
+                        if (3 == spaceDim) {
+                            ijk[dir2] = i2;
+                        } // if
+                        points[count++] = grid.vertex(ijk[0], ijk[1], ijk[2]);
+                    } // for
+                } // for
+                _setGroup(_MeshIOBox::boundaryNames[2*iDim+iSide], VERTEX, points);
+            } // for
+        } // for
+
+        // Fault groups
+        for (size_t iFault = 0; iFault < _xFaults.size(); ++iFault) {
+            const int iFaultPlane = int(floor((_xFaults[iFault] - _lower[0]) / dx + 0.5));
+            if ((iFaultPlane <= 0) || (iFaultPlane >= nx)) {
+                std::ostringstream msg;
+                msg << "Fault at x=" << _xFaults[iFault] << " must be inside the box mesh (" << _lower[0] << " < x < "
+                    << _upper[0] << ") and at least one cell from the boundaries.";
+                throw std::runtime_error(msg.str());
+            } // if
+            int_array points((ny+1)*nzVertices);
+            int count = 0;
+            for (int k = 0; k < nzVertices; ++k) {
+                for (int j = 0; j <= ny; ++j) {
+                    points[count++] = grid.vertex(iFaultPlane, j, k);
+                } // for
+            } // for
+            std::ostringstream name;
+            name << "fault_" << iFault;
+            _setGroup(name.str(), VERTEX, points);
+        } // for
+
+        PYLITH_COMPONENT_INFO_ROOT("Generated box mesh with " << numVertices << " vertices and " << numCells << " cells.");
+    } else {
+        MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim);
+        _setMaterials(materialIds);
+    } // if/else
+    _distributeGroups();
+
+    PYLITH_METHOD_END;
+} // _read
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write mesh to file.
+void
+pylith::meshio::MeshIOBox::_write(void) const { // _write
+    throw std::logic_error("MeshIOBox generates meshes and does not support writing meshes.");
+} // _write
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create cells for 2D mesh.
+void
+pylith::meshio::_MeshIOBox::createCells2D(int_array* cells,
+                                          const Grid& grid,
+                                          const MeshIOBox::CellShapeEnum cellShape) {
+    assert(cells);
+
+    const int numQuads = grid.nx * grid.ny;
+    const int numCorners = (MeshIOBox::TENSOR == cellShape) ? 4 : 3;
+    const int numCellsPerQuad = (MeshIOBox::TENSOR == cellShape) ? 1 : 2;
+    cells->resize(numQuads*numCellsPerQuad*numCorners);
+
+    int index = 0;
+    for (int j = 0; j < grid.ny; ++j) {
+        for (int i = 0; i < grid.nx; ++i) {
+            // Counterclockwise ordering.
+            const int v0 = grid.vertex(i, j);
+            const int v1 = grid.vertex(i+1, j);
+            const int v2 = grid.vertex(i+1, j+1);
+            const int v3 = grid.vertex(i, j+1);
+            if (MeshIOBox::TENSOR == cellShape) {
+                (*cells)[index++] = v0;
+                (*cells)[index++] = v1;
+                (*cells)[index++] = v2;
+                (*cells)[index++] = v3;
+            } else {
+                (*cells)[index++] = v0;
+                (*cells)[index++] = v1;
+                (*cells)[index++] = v2;
+
+                (*cells)[index++] = v0;
+                (*cells)[index++] = v2;
+                (*cells)[index++] = v3;
+            } // if/else
+        } // for
+    } // for
+    assert(index == int(cells->size()));
+} // createCells2D
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create cells for 3D mesh.
+void
+pylith::meshio::_MeshIOBox::createCells3D(int_array* cells,
+                                          const Grid& grid,
+                                          const MeshIOBox::CellShapeEnum cellShape) {
+    assert(cells);
+
+    // Kuhn subdivision of hexahedron into 6 tetrahedra sharing the diagonal from corner 0 to corner 7. Corners are
+    // numbered using bits for x (1), y (2), and z (4). Vertices are ordered to give tetrahedra positive volume.
+    static const int numTets = 6;
+    static const int tets[numTets*4] = {
+        0, 1, 3, 7,
+        0, 2, 6, 7,
+        0, 4, 5, 7,
+        0, 5, 1, 7,
+        0, 3, 2, 7,
+        0, 6, 4, 7,
+    };
+
+    const int numHexes = grid.nx * grid.ny * grid.nz;
+    const int numCorners = (MeshIOBox::TENSOR == cellShape) ? 8 : 4;
+    const int numCellsPerHex = (MeshIOBox::TENSOR == cellShape) ? 1 : numTets;
+    cells->resize(numHexes*numCellsPerHex*numCorners);
+
+    int index = 0;
+    int corners[8];
+    for (int k = 0; k < grid.nz; ++k) {
+        for (int j = 0; j < grid.ny; ++j) {
+            for (int i = 0; i < grid.nx; ++i) {
+                for (int iCorner = 0; iCorner < 8; ++iCorner) {
+                    corners[iCorner] = grid.vertex(i + (iCorner & 1), j + ((iCorner >> 1) & 1), k + ((iCorner >> 2) & 1));
+                } // for
+                if (MeshIOBox::TENSOR == cellShape) {
+                    // Counterclockwise ordering on -z face followed by +z face.
+                    (*cells)[index++] = corners[0];
+                    (*cells)[index++] = corners[1];
+                    (*cells)[index++] = corners[3];
+                    (*cells)[index++] = corners[2];
+                    (*cells)[index++] = corners[4];
+                    (*cells)[index++] = corners[5];
+                    (*cells)[index++] = corners[7];
+                    (*cells)[index++] = corners[6];
+                } else {
+                    for (int iTet = 0; iTet < numTets; ++iTet) {
+                        for (int iCorner = 0; iCorner < 4; ++iCorner) {
+                            (*cells)[index++] = corners[tets[iTet*4+iCorner]];
+                        } // for
+                    } // for
+                } // if/else
+            } // for
+        } // for
+    } // for
+    assert(index == int(cells->size()));
+} // createCells3D
+
+
+// End of file
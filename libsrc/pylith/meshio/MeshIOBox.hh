@@ -0,0 +1,135 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOBox.hh
+ *
+ * @brief C++ generator for structured meshes of a box.
+ *
+ * Create a structured mesh of a rectangle (2D) or box (3D) with a
+ * given number of cells in each direction. Tensor product cells are
+ * quadrilaterals or hexahedra; simplex cells are created by splitting
+ * each quadrilateral into 2 triangles or each hexahedron into 6
+ * tetrahedra (Kuhn subdivision), so the mesh is conforming.
+ *
+ * All cells have material id 1. Vertex groups are created for the
+ * boundaries (boundary_xneg, boundary_xpos, boundary_yneg, boundary_ypos,
+ * boundary_zneg, boundary_zpos) and for each fault (fault_0, fault_1,
+ * ...). Faults are planes normal to the x axis that cut through the
+ * entire domain; the fault location is moved to the nearest plane of
+ * vertices.
+ *
+ * The mesh is generated on process 0 and then distributed in the same
+ * way as meshes read from files.
+ */
+
+#if !defined(pylith_meshio_meshiobox_hh)
+#define pylith_meshio_meshiobox_hh
+
+#include "MeshIO.hh" // ISA MeshIO
+
+#include <vector> // HASA std::vector
+
+class pylith::meshio::MeshIOBox : public MeshIO {
+    friend class TestMeshIOBox; // unit testing
+
+    // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Shape of cells.
+    enum CellShapeEnum {
+        TENSOR=0, ///< Quadrilaterals (2D) or hexahedra (3D).
+        SIMPLEX=1, ///< Triangles (2D) or tetrahedra (3D).
+    }; // CellShapeEnum
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    MeshIOBox(void);
+
+    /// Destructor
+    ~MeshIOBox(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set coordinates of corner of box with minimum coordinates.
+     *
+     * @param[in] values Array of coordinates.
+     * @param[in] size Size of array (2 or 3).
+     */
+    void setLower(const PylithReal* values,
+                  const int size);
+
+    /** Set coordinates of corner of box with maximum coordinates.
+     *
+     * @param[in] values Array of coordinates.
+     * @param[in] size Size of array (2 or 3).
+     */
+    void setUpper(const PylithReal* values,
+                  const int size);
+
+    /** Set number of cells in each direction.
+     *
+     * For simplex cells, this is the number of quadrilaterals or
+     * hexahedra before they are split into simplices.
+     *
+     * @param[in] values Array of number of cells in each direction.
+     * @param[in] size Size of array (2 or 3).
+     */
+    void setNumCells(const int* values,
+                     const int size);
+
+    /** Set shape of cells.
+     *
+     * @param[in] value Shape of cells.
+     */
+    void setCellShape(const CellShapeEnum value);
+
+    /** Set x coordinates of faults normal to x axis.
+     *
+     * @param[in] xFaults Array of x coordinates of faults.
+     * @param[in] numFaults Number of faults.
+     */
+    void setFaults(const PylithReal* xFaults,
+                   const int numFaults);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Write mesh
+    void _write(void) const;
+
+    /// Read mesh
+    void _read(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    std::vector<PylithReal> _lower; ///< Coordinates of corner with minimum coordinates.
+    std::vector<PylithReal> _upper; ///< Coordinates of corner with maximum coordinates.
+    std::vector<int> _numCells; ///< Number of cells in each direction.
+    std::vector<PylithReal> _xFaults; ///< x coordinates of faults.
+    CellShapeEnum _cellShape; ///< Shape of cells.
+
+}; // MeshIOBox
+
+#endif // pylith_meshio_meshiobox_hh
+
+// End of file
@@ -27,6 +27,7 @@
 #include "pylith/topology/Field.hh" // USES Field
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/TimerTree.hh" // USES TimerTree
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include <iostream> // USES std::cout
@@ -127,7 +128,9 @@ pylith::meshio::OutputSoln::update(const PylithReal t,
                                    const pylith::topology::Field& solution) {
     assert(_trigger);
     if (_trigger->shouldWrite(t, tindex)) {
+        pylith::utils::TimerTree::begin(std::string("output ") + getIdentifier());
         _writeSolnStep(t, tindex, solution);
+        pylith::utils::TimerTree::end();
     } // if
 } // update
 
@@ -37,7 +37,9 @@ pylith::meshio::OutputSubfield::OutputSubfield(void) :
     _vector(NULL),
     _fn(pylith::fekernels::Solution::passThruSubfield),
     _label(NULL),
-    _labelValue(0) {}
+    _labelValue(0),
+    _cellAverageDM(NULL),
+    _cellAverageVector(NULL) {}
 
 
 // ------------------------------------------------------------------------------------------------
@@ -54,6 +56,8 @@ pylith::meshio::OutputSubfield::deallocate(void) {
     PetscErrorCode err;
     err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&_vector);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&_cellAverageDM);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_cellAverageVector);PYLITH_CHECK_ERROR(err);
 
     _label = NULL; // Destroyed by DMDestroy()
 } // deallocate
@@ -77,6 +81,16 @@ pylith::meshio::OutputSubfield::create(const pylith::topology::Field& field,
     subfield->_discretization.dimension = mesh.getDimension();
     // Basis order of output should be less than or equai to the basis order of the computed field.
     subfield->_discretization.basisOrder = std::min(basisOrder, info.fe.basisOrder);
+    if (pylith::topology::FieldBase::POINT_SPACE == info.fe.feSpace) {
+        // Output cell averages of values at quadrature points.
+        subfield->_discretization.basisOrder = 0;
+        subfield->_discretization.feSpace = pylith::topology::FieldBase::POLYNOMIAL_SPACE;
+        subfield->_discretization.isBasisContinuous = false;
+        subfield->_setupCellAverage(field, name);
+    } else if (pylith::topology::FieldBase::SPECTRAL_SPACE == info.fe.feSpace) {
+        // Output uses standard Lagrange basis (identical nodes for basis order 1).
+        subfield->_discretization.feSpace = pylith::topology::FieldBase::POLYNOMIAL_SPACE;
+    } // if/else
 
     PetscErrorCode err;
     err = DMClone(mesh.getDM(), &subfield->_dm);PYLITH_CHECK_ERROR(err);
@@ -197,8 +211,15 @@ pylith::meshio::OutputSubfield::project(const PetscVec& fieldVector) {
     assert(_vector);
 
     PetscErrorCode err;
-    const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
+    if (_cellAverageDM) {
+        _computeCellAverage(fieldVector);
+        const PetscReal t = 0.01; // :KLUDGE: Cell averages are in the only subfield.
+        err = DMProjectField(_dm, t, _cellAverageVector, &_fn, INSERT_VALUES, _vector);PYLITH_CHECK_ERROR(err);
+        err = VecScale(_vector, _description.scale);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
 
+    const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
     err = DMProjectField(_dm, t, fieldVector, &_fn, INSERT_VALUES, _vector);PYLITH_CHECK_ERROR(err);
     err = VecScale(_vector, _description.scale);PYLITH_CHECK_ERROR(err);
 
@@ -216,8 +237,15 @@ pylith::meshio::OutputSubfield::projectWithLabel(const PetscVec& fieldVector) {
     assert(_label);
 
     PetscErrorCode err;
-    const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
+    if (_cellAverageDM) {
+        _computeCellAverage(fieldVector);
+        const PetscReal t = 0.01; // :KLUDGE: Cell averages are in the only subfield.
+        err = DMProjectFieldLabel(_dm, t, _label, 1, &_labelValue, PETSC_DETERMINE, NULL, _cellAverageVector, &_fn, INSERT_VALUES, _vector);PYLITH_CHECK_ERROR(err);
+        err = VecScale(_vector, _description.scale);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
 
+    const PetscReal t = PetscReal(_subfieldIndex) + 0.01; // :KLUDGE: Easiest way to get subfield to extract into fn.
     err = DMProjectFieldLabel(_dm, t, _label, 1, &_labelValue, PETSC_DETERMINE, NULL, fieldVector, &_fn, INSERT_VALUES, _vector);PYLITH_CHECK_ERROR(err);
     err = VecScale(_vector, _description.scale);PYLITH_CHECK_ERROR(err);
 
@@ -267,4 +295,110 @@ pylith::meshio::OutputSubfield::extractSubfield(const pylith::topology::Field& f
 } // extractSubfield
 
 
+// ------------------------------------------------------------------------------------------------
+// Setup cell averages for subfield with values at quadrature points.
+void
+pylith::meshio::OutputSubfield::_setupCellAverage(const pylith::topology::Field& field,
+                                                  const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    const pylith::topology::Field::SubfieldInfo& info = field.getSubfieldInfo(name);
+
+    PetscErrorCode err;
+    PetscDS fieldDS = NULL;
+    PetscObject fieldFE = NULL;
+    PetscQuadrature quadrature = NULL;
+    PetscInt numQuadPts = 0;
+    const PetscReal* quadWeights = NULL;
+    err = DMGetDS(field.getDM(), &fieldDS);PYLITH_CHECK_ERROR(err);
+    err = PetscDSGetDiscretization(fieldDS, info.index, &fieldFE);PYLITH_CHECK_ERROR(err);
+    err = PetscFEGetQuadrature((PetscFE)fieldFE, &quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, &quadWeights);PYLITH_CHECK_ERROR(err);
+    _quadWeights.assign(quadWeights, quadWeights+numQuadPts);
+
+    err = DMClone(field.getDM(), &_cellAverageDM);PYLITH_CHECK_ERROR(err);
+    pylith::topology::FieldBase::Discretization feAverage(info.fe);
+    feAverage.basisOrder = 0;
+    feAverage.feSpace = pylith::topology::FieldBase::POLYNOMIAL_SPACE;
+    feAverage.isBasisContinuous = false;
+    PetscFE fe = pylith::topology::FieldOps::createFE(feAverage, _cellAverageDM, info.description.numComponents);assert(fe);
+    err = PetscFESetName(fe, info.description.label.c_str());PYLITH_CHECK_ERROR(err);
+    err = DMSetField(_cellAverageDM, 0, NULL, (PetscObject)fe);PYLITH_CHECK_ERROR(err);
+    err = PetscFEDestroy(&fe);PYLITH_CHECK_ERROR(err);
+    err = DMCreateDS(_cellAverageDM);PYLITH_CHECK_ERROR(err);
+    err = DMCreateGlobalVector(_cellAverageDM, &_cellAverageVector);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupCellAverage
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute cell averages of subfield with values at quadrature points.
+void
+pylith::meshio::OutputSubfield::_computeCellAverage(const PetscVec& fieldVector) {
+    PYLITH_METHOD_BEGIN;
+    assert(_cellAverageDM);
+    assert(_cellAverageVector);
+
+    PetscErrorCode err;
+    PetscDM fieldDM = NULL;
+    PetscSection fieldSection = NULL, fieldSectionGlobal = NULL;
+    err = VecGetDM(fieldVector, &fieldDM);PYLITH_CHECK_ERROR(err);assert(fieldDM);
+    err = DMGetLocalSection(fieldDM, &fieldSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(fieldDM, &fieldSectionGlobal);PYLITH_CHECK_ERROR(err);
+
+    PetscSection averageSectionGlobal = NULL;
+    err = DMGetGlobalSection(_cellAverageDM, &averageSectionGlobal);PYLITH_CHECK_ERROR(err);
+
+    PetscInt fieldStart = 0, averageStart = 0;
+    err = VecGetOwnershipRange(fieldVector, &fieldStart, NULL);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(_cellAverageVector, &averageStart, NULL);PYLITH_CHECK_ERROR(err);
+
+    const PetscInt numComponents = _description.numComponents;
+    const PetscInt numQuadPts = _quadWeights.size();
+    PylithReal weightSum = 0.0;
+    for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+        weightSum += _quadWeights[iQuad];
+    } // for
+    assert(weightSum > 0.0);
+
+    const PetscScalar* fieldArray = NULL;
+    PetscScalar* averageArray = NULL;
+    err = VecGetArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(_cellAverageVector, &averageArray);PYLITH_CHECK_ERROR(err);
+
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(_cellAverageDM, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt averageOffset = 0, fieldOffset = 0, fieldPointOffset = 0, fieldDof = 0;
+        err = PetscSectionGetOffset(averageSectionGlobal, cell, &averageOffset);PYLITH_CHECK_ERROR(err);
+        if (averageOffset < 0) { continue; } // Not owned.
+        err = PetscSectionGetFieldDof(fieldSection, cell, _subfieldIndex, &fieldDof);PYLITH_CHECK_ERROR(err);
+        if (fieldDof != numQuadPts*numComponents) { continue; }
+
+        // Offset of subfield within point is the same in the local and global sections without constraints.
+        err = PetscSectionGetOffset(fieldSectionGlobal, cell, &fieldOffset);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetFieldOffset(fieldSection, cell, _subfieldIndex, &fieldPointOffset);PYLITH_CHECK_ERROR(err);
+        PetscInt pointOffset = 0;
+        err = PetscSectionGetOffset(fieldSection, cell, &pointOffset);PYLITH_CHECK_ERROR(err);
+        fieldOffset += fieldPointOffset - pointOffset - fieldStart;
+        averageOffset -= averageStart;
+
+        // Degrees of freedom are ordered by quadrature point and then component.
+        for (PetscInt iComp = 0; iComp < numComponents; ++iComp) {
+            PylithScalar value = 0.0;
+            for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                value += _quadWeights[iQuad] * fieldArray[fieldOffset+iQuad*numComponents+iComp];
+            } // for
+            averageArray[averageOffset+iComp] = value / weightSum;
+        } // for
+    } // for
+
+    err = VecRestoreArray(_cellAverageVector, &averageArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(fieldVector, &fieldArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computeCellAverage
+
+
 // End of file
@@ -34,6 +34,8 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/petscfwd.h" // HASA PetscVec
 
+#include <vector> // HASA std::vector
+
 class pylith::meshio::OutputSubfield : public pylith::utils::GenericComponent {
     friend class TestOutputSubfield; // unit testing
 
@@ -132,6 +134,23 @@ private:
     // Constructor.
     OutputSubfield(void);
 
+    /** Setup cell averages for subfield with values at quadrature points.
+     *
+     * Subfields in the point space cannot be evaluated away from the quadrature points, so we
+     * project the quadrature weighted cell average.
+     *
+     * @param[in] field Field with subfields.
+     * @param[in] name Name of subfield that will be extracted.
+     */
+    void _setupCellAverage(const pylith::topology::Field& field,
+                           const char* name);
+
+    /** Compute cell averages of subfield with values at quadrature points.
+     *
+     * @param[in] fieldVector PETSc vector with subfields.
+     */
+    void _computeCellAverage(const PetscVec& fieldVector);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -145,6 +164,10 @@ protected:
     PetscDMLabel _label; ///< PETSc label associated with subfield.
     PetscInt _labelValue; ///< Value of PETSc label associated with subfield.
 
+    PetscDM _cellAverageDM; ///< PETSc DM for cell averages of subfield with values at quadrature points.
+    PetscVec _cellAverageVector; ///< PETSc global vector for cell averages.
+    std::vector<PylithReal> _quadWeights; ///< Quadrature weights for cell averages.
+
     // NOT IMPLEMENTED ////////////////////////////////////////////////////////////////////////////
 private:
 
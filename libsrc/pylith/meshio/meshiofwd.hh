@@ -34,6 +34,8 @@ namespace pylith {
         class MeshIO;
         class MeshBuilder;
         class MeshIOAscii;
+        class MeshIOBinary;
+        class MeshIOBox;
         class MeshIOPetsc;
         class MeshIOCubit;
         class MeshIOLagrit;
@@ -0,0 +1,452 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "FaultSchurPreconditioner.hh" // implementation of object methods
+
+#include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
+#include "pylith/feassemble/InterfacePatches.hh" // USES InterfacePatches
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::isCohesiveCell()
+
+#include "petscksp.h" // USES PetscKSP, PetscPC
+#include "petscdmplex.h" // USES DMPlexGetClosureIndices()
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD*
+#include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/lapack.h" // USES LAPACKgetrf_, LAPACKgetrs_
+
+#include <cassert> // USES assert()
+#include <algorithm> // USES std::sort(), std::unique(), std::lower_bound()
+#include <map> // USES std::map
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _FaultSchurPreconditioner {
+public:
+
+            /** Get indices of unconstrained degrees of freedom of subfield in closure of point.
+             *
+             * @param[out] indices Global indices of degrees of freedom (appended).
+             * @param[in] dm PETSc DM.
+             * @param[in] point Point in DM.
+             * @param[in] field Index of subfield (-1 for all subfields).
+             * @param[in] keepConstrained Keep constrained degrees of freedom (negative indices).
+             */
+            static
+            void getClosureIndices(std::vector<PetscInt>* indices,
+                                   PetscDM dm,
+                                   const PetscInt point,
+                                   const PetscInt field,
+                                   const bool keepConstrained);
+
+            /** Get index of value in sorted array.
+             *
+             * @param[in] values Sorted array.
+             * @param[in] value Value in array.
+             * @returns Index of value in array.
+             */
+            static
+            PetscInt findIndex(const std::vector<PetscInt>& values,
+                               const PetscInt value);
+
+        }; // _FaultSchurPreconditioner
+    } // problems
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get indices of unconstrained degrees of freedom of subfield in closure of point.
+void
+pylith::problems::_FaultSchurPreconditioner::getClosureIndices(std::vector<PetscInt>* indices,
+                                                               PetscDM dm,
+                                                               const PetscInt point,
+                                                               const PetscInt field,
+                                                               const bool keepConstrained) {
+    PYLITH_METHOD_BEGIN;
+    assert(indices);
+
+    PetscErrorCode err = 0;
+    PetscSection localSection = NULL;
+    PetscSection globalSection = NULL;
+    PetscInt numFields = 0;
+    err = DMGetLocalSection(dm, &localSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(dm, &globalSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetNumFields(localSection, &numFields);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numIndices = 0;
+    PetscInt* closureIndices = NULL;
+    std::vector<PetscInt> offsets(numFields+1, 0);
+    err = DMPlexGetClosureIndices(dm, localSection, globalSection, point, PETSC_FALSE, &numIndices, &closureIndices,
+                                  &offsets[0], NULL);PYLITH_CHECK_ERROR(err);
+    const PetscInt iStart = (field >= 0) ? offsets[field] : 0;
+    const PetscInt iEnd = (field >= 0) ? offsets[field+1] : numIndices;
+    for (PetscInt i = iStart; i < iEnd; ++i) {
+        if (keepConstrained || (closureIndices[i] >= 0)) {
+            indices->push_back(closureIndices[i]);
+        } // if
+    } // for
+    err = DMPlexRestoreClosureIndices(dm, localSection, globalSection, point, PETSC_FALSE, &numIndices, &closureIndices,
+                                      &offsets[0], NULL);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // getClosureIndices
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get index of value in sorted array.
+PetscInt
+pylith::problems::_FaultSchurPreconditioner::findIndex(const std::vector<PetscInt>& values,
+                                                       const PetscInt value) {
+    std::vector<PetscInt>::const_iterator iter = std::lower_bound(values.begin(), values.end(), value);
+    assert(iter != values.end() && *iter == value);
+    return iter - values.begin();
+} // findIndex
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::FaultSchurPreconditioner::FaultSchurPreconditioner(void) :
+    _dmLagrange(NULL),
+    _schurMat(NULL),
+    _subsetIS(NULL),
+    _submat(NULL) {
+    GenericComponent::setName("faultschurpreconditioner");
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::FaultSchurPreconditioner::~FaultSchurPreconditioner(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::FaultSchurPreconditioner::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    if (_submat) {
+        err = MatDestroySubMatrices(1, &_submat);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = ISDestroy(&_subsetIS);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_schurMat);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&_dmLagrange);PYLITH_CHECK_ERROR(err);
+    _patches.clear();
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Find patches for the Lagrange multipliers and create the preconditioning matrix.
+void
+pylith::problems::FaultSchurPreconditioner::initialize(const pylith::topology::Field& solution,
+                                                       const std::vector<pylith::feassemble::IntegratorInterface*>& integrators) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("initialize(solution="<<solution.getLabel()<<", # integrators="<<integrators.size()<<")");
+    typedef pylith::feassemble::InterfacePatches::keysmap_t keysmap_t;
+
+    deallocate();
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = solution.getDM();
+    const PetscInt dispField = solution.getSubfieldInfo("displacement").index;
+    const PetscInt lagrangeField = solution.getSubfieldInfo("lagrange_multiplier_fault").index;
+
+    // The DM for the Lagrange multipliers has the same numbering as the field split, and its
+    // adjacency covers the Lagrange multipliers in each patch.
+    err = DMCreateSubDM(dmSoln, 1, &lagrangeField, NULL, &_dmLagrange);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(_dmLagrange, &_schurMat);PYLITH_CHECK_ERROR(err);
+    err = MatSetOption(_schurMat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    PetscInt rowStart = 0, rowEnd = 0;
+    err = MatGetOwnershipRange(_schurMat, &rowStart, &rowEnd);PYLITH_CHECK_ERROR(err);
+
+    // Cohesive cells in interface integration patches.
+    std::vector<PetscInt> cohesiveCells;
+    for (size_t iIntegrator = 0; iIntegrator < integrators.size(); ++iIntegrator) {
+        assert(integrators[iIntegrator]);
+        const pylith::feassemble::InterfacePatches* patches = integrators[iIntegrator]->getIntegrationPatches();
+        if (!patches) {
+            continue;
+        } // if
+        const keysmap_t& keysmap = patches->getKeys();
+        for (keysmap_t::const_iterator iter = keysmap.begin(); iter != keysmap.end(); ++iter) {
+            PetscIS cellsIS = NULL;
+            PetscInt numCells = 0;
+            const PetscInt* cells = NULL;
+            err = DMGetStratumIS(dmSoln, patches->getLabelName(), iter->second.cohesive.getValue(), &cellsIS);PYLITH_CHECK_ERROR(err);
+            if (!cellsIS) {
+                continue;
+            } // if
+            err = ISGetLocalSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+            cohesiveCells.insert(cohesiveCells.end(), cells, cells+numCells);
+            err = ISRestoreIndices(cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&cellsIS);PYLITH_CHECK_ERROR(err);
+        } // for
+    } // for
+    std::sort(cohesiveCells.begin(), cohesiveCells.end());
+    cohesiveCells.erase(std::unique(cohesiveCells.begin(), cohesiveCells.end()), cohesiveCells.end());
+    const size_t numCells = cohesiveCells.size();
+
+    // Degrees of freedom for each cohesive cell: displacement in the closure of the adjacent bulk
+    // cells, and Lagrange multipliers in the closure of the cohesive cell.
+    std::vector<std::vector<PetscInt> > cellDisp(numCells);
+    std::vector<std::vector<PetscInt> > cellLagrange(numCells);
+    std::vector<std::vector<PetscInt> > cellLagrangeCols(numCells);
+    std::vector<PetscInt> subsetIndices;
+    std::vector<PetscInt> lagrangeIndices, lagrangeCols;
+    std::map<PetscInt, std::vector<PetscInt> > rowCells;
+    for (size_t iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cohesiveCells[iCell];
+        assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, cell));
+
+        const PetscInt* cone = NULL;
+        err = DMPlexGetCone(dmSoln, cell, &cone);PYLITH_CHECK_ERROR(err);
+        for (int iSide = 0; iSide < 2; ++iSide) {
+            const PetscInt* support = NULL;
+            PetscInt supportSize = 0;
+            err = DMPlexGetSupportSize(dmSoln, cone[iSide], &supportSize);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetSupport(dmSoln, cone[iSide], &support);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iSupport = 0; iSupport < supportSize; ++iSupport) {
+                if (!pylith::topology::MeshOps::isCohesiveCell(dmSoln, support[iSupport])) {
+                    _FaultSchurPreconditioner::getClosureIndices(&cellDisp[iCell], dmSoln, support[iSupport], dispField, false);
+                } // if
+            } // for
+        } // for
+        std::sort(cellDisp[iCell].begin(), cellDisp[iCell].end());
+        cellDisp[iCell].erase(std::unique(cellDisp[iCell].begin(), cellDisp[iCell].end()), cellDisp[iCell].end());
+
+        // Closure indices in the full system and for the Lagrange multipliers are in the same order.
+        lagrangeIndices.clear();
+        lagrangeCols.clear();
+        _FaultSchurPreconditioner::getClosureIndices(&lagrangeIndices, dmSoln, cell, lagrangeField, true);
+        _FaultSchurPreconditioner::getClosureIndices(&lagrangeCols, _dmLagrange, cell, -1, true);
+        assert(lagrangeIndices.size() == lagrangeCols.size());
+        for (size_t i = 0; i < lagrangeIndices.size(); ++i) {
+            if ((lagrangeIndices[i] < 0) || (lagrangeCols[i] < 0)) {
+                continue;
+            } // if
+            cellLagrange[iCell].push_back(lagrangeIndices[i]);
+            cellLagrangeCols[iCell].push_back(lagrangeCols[i]);
+            if ((lagrangeCols[i] >= rowStart) && (lagrangeCols[i] < rowEnd)) {
+                rowCells[lagrangeCols[i]].push_back(iCell);
+            } // if
+        } // for
+
+        subsetIndices.insert(subsetIndices.end(), cellDisp[iCell].begin(), cellDisp[iCell].end());
+        subsetIndices.insert(subsetIndices.end(), cellLagrange[iCell].begin(), cellLagrange[iCell].end());
+    } // for
+    std::sort(subsetIndices.begin(), subsetIndices.end());
+    subsetIndices.erase(std::unique(subsetIndices.begin(), subsetIndices.end()), subsetIndices.end());
+    err = ISCreateGeneral(PETSC_COMM_SELF, subsetIndices.size(), subsetIndices.size() ? &subsetIndices[0] : NULL,
+                          PETSC_COPY_VALUES, &_subsetIS);PYLITH_CHECK_ERROR(err);
+
+    // The Lagrange multipliers at a point share the same cohesive cells, so group the rows of the
+    // Schur complement by their cohesive cells to form one patch per point.
+    std::map<std::vector<PetscInt>, std::vector<PetscInt> > patchRows;
+    for (std::map<PetscInt, std::vector<PetscInt> >::const_iterator iter = rowCells.begin(); iter != rowCells.end(); ++iter) {
+        patchRows[iter->second].push_back(iter->first);
+    } // for
+
+    _patches.resize(patchRows.size());
+    size_t iPatch = 0;
+    for (std::map<std::vector<PetscInt>, std::vector<PetscInt> >::const_iterator iter = patchRows.begin(); iter != patchRows.end(); ++iter, ++iPatch) {
+        const std::vector<PetscInt>& cells = iter->first;
+        std::vector<PetscInt> displacement;
+        std::map<PetscInt, PetscInt> lagrange; // index in full system -> column in Schur complement
+        for (size_t i = 0; i < cells.size(); ++i) {
+            const PetscInt iCell = cells[i];
+            displacement.insert(displacement.end(), cellDisp[iCell].begin(), cellDisp[iCell].end());
+            for (size_t j = 0; j < cellLagrange[iCell].size(); ++j) {
+                lagrange[cellLagrange[iCell][j]] = cellLagrangeCols[iCell][j];
+            } // for
+        } // for
+        std::sort(displacement.begin(), displacement.end());
+        displacement.erase(std::unique(displacement.begin(), displacement.end()), displacement.end());
+
+        Patch& patch = _patches[iPatch];
+        patch.displacement.resize(displacement.size());
+        for (size_t i = 0; i < displacement.size(); ++i) {
+            patch.displacement[i] = _FaultSchurPreconditioner::findIndex(subsetIndices, displacement[i]);
+        } // for
+        for (std::map<PetscInt, PetscInt>::const_iterator liter = lagrange.begin(); liter != lagrange.end(); ++liter) {
+            patch.lagrange.push_back(_FaultSchurPreconditioner::findIndex(subsetIndices, liter->first));
+            patch.lagrangeCols.push_back(liter->second);
+        } // for
+        patch.schurRows = iter->second;
+        for (size_t i = 0; i < patch.schurRows.size(); ++i) {
+            const std::vector<PetscInt>::const_iterator col =
+                std::find(patch.lagrangeCols.begin(), patch.lagrangeCols.end(), patch.schurRows[i]);
+            assert(col != patch.lagrangeCols.end());
+            patch.rows.push_back(col - patch.lagrangeCols.begin());
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute approximate Schur complement from assembled preconditioning matrix.
+void
+pylith::problems::FaultSchurPreconditioner::update(PetscMat precondMat) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("update(precondMat="<<precondMat<<")");
+    assert(precondMat);
+    assert(_schurMat);
+    assert(_subsetIS);
+
+    PetscErrorCode err = 0;
+    err = MatCreateSubMatrices(precondMat, 1, &_subsetIS, &_subsetIS, _submat ? MAT_REUSE_MATRIX : MAT_INITIAL_MATRIX,
+                               &_submat);PYLITH_CHECK_ERROR(err);
+    PetscMat submat = _submat[0];
+
+    // Dense arrays use column-major storage for LAPACK.
+    std::vector<PetscScalar> stiffness, values, lagrangeToDisp, dispToLagrange, schur;
+    std::vector<PetscBLASInt> pivots;
+    for (size_t iPatch = 0; iPatch < _patches.size(); ++iPatch) {
+        const Patch& patch = _patches[iPatch];
+        const PetscInt numDisp = patch.displacement.size();
+        const PetscInt numLagrange = patch.lagrange.size();
+        const PetscInt numRows = patch.rows.size();
+        if (!numDisp || !numRows) {
+            continue;
+        } // if
+
+        // K_patch
+        values.resize(numDisp*numDisp);
+        stiffness.resize(numDisp*numDisp);
+        err = MatGetValues(submat, numDisp, &patch.displacement[0], numDisp, &patch.displacement[0], &values[0]);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numDisp; ++i) {
+            for (PetscInt j = 0; j < numDisp; ++j) {
+                stiffness[j*numDisp+i] = values[i*numDisp+j];
+            } // for
+        } // for
+
+        // B_patch^T (displacement rows, Lagrange multiplier columns)
+        values.resize(numDisp*numLagrange);
+        lagrangeToDisp.resize(numDisp*numLagrange);
+        err = MatGetValues(submat, numDisp, &patch.displacement[0], numLagrange, &patch.lagrange[0], &values[0]);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numDisp; ++i) {
+            for (PetscInt j = 0; j < numLagrange; ++j) {
+                lagrangeToDisp[j*numDisp+i] = values[i*numLagrange+j];
+            } // for
+        } // for
+
+        // B_patch for the rows at the point (row-major).
+        std::vector<PetscInt> rows(numRows);
+        for (PetscInt i = 0; i < numRows; ++i) {
+            rows[i] = patch.lagrange[patch.rows[i]];
+        } // for
+        dispToLagrange.resize(numRows*numDisp);
+        err = MatGetValues(submat, numRows, &rows[0], numDisp, &patch.displacement[0], &dispToLagrange[0]);PYLITH_CHECK_ERROR(err);
+
+        // K_patch^{-1} B_patch^T
+        PetscBLASInt n = 0, nrhs = 0, info = 0;
+        err = PetscBLASIntCast(numDisp, &n);PYLITH_CHECK_ERROR(err);
+        err = PetscBLASIntCast(numLagrange, &nrhs);PYLITH_CHECK_ERROR(err);
+        pivots.resize(numDisp);
+        lapack_dgetrf(&n, &n, &stiffness[0], &n, &pivots[0], &info);
+        if (info) {
+            std::ostringstream msg;
+            msg << "Could not factor stiffness matrix for patch of fault Schur complement preconditioner (LAPACK info="
+                << info << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+        lapack_dgetrs("N", &n, &nrhs, &stiffness[0], &n, &pivots[0], &lagrangeToDisp[0], &n, &info);
+        if (info) {
+            std::ostringstream msg;
+            msg << "Could not solve for patch of fault Schur complement preconditioner (LAPACK info=" << info << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        // -B_patch K_patch^{-1} B_patch^T for the rows at the point (row-major).
+        schur.resize(numRows*numLagrange);
+        for (PetscInt i = 0; i < numRows; ++i) {
+            for (PetscInt j = 0; j < numLagrange; ++j) {
+                PetscScalar value = 0.0;
+                for (PetscInt k = 0; k < numDisp; ++k) {
+                    value += dispToLagrange[i*numDisp+k] * lagrangeToDisp[j*numDisp+k];
+                } // for
+                schur[i*numLagrange+j] = -value;
+            } // for
+        } // for
+        err = MatSetValues(_schurMat, numRows, &patch.schurRows[0], numLagrange, &patch.lagrangeCols[0], &schur[0],
+                           INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatAssemblyBegin(_schurMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_schurMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // update
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set approximate Schur complement as the user preconditioning matrix for the Schur complement.
+bool
+pylith::problems::FaultSchurPreconditioner::setSchurPreconditioner(PetscKSP ksp) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setSchurPreconditioner(ksp="<<ksp<<")");
+    assert(ksp);
+
+    PetscErrorCode err = 0;
+    PetscPC pc = NULL;
+    PetscBool isFieldSplit = PETSC_FALSE;
+    err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectTypeCompare((PetscObject)pc, PCFIELDSPLIT, &isFieldSplit);PYLITH_CHECK_ERROR(err);
+    if (!isFieldSplit) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PCCompositeType splitType = PC_COMPOSITE_ADDITIVE;
+    err = PCFieldSplitGetType(pc, &splitType);PYLITH_CHECK_ERROR(err);
+    if (PC_COMPOSITE_SCHUR != splitType) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PCFieldSplitSchurPreType preType = PC_FIELDSPLIT_SCHUR_PRE_SELFP;
+    PetscMat preMat = NULL;
+    err = PCFieldSplitGetSchurPre(pc, &preType, &preMat);PYLITH_CHECK_ERROR(err);
+    if (PC_FIELDSPLIT_SCHUR_PRE_USER != preType) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    if (preMat != _schurMat) {
+        err = PCFieldSplitSetSchurPre(pc, PC_FIELDSPLIT_SCHUR_PRE_USER, _schurMat);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(true);
+} // setSchurPreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get approximate Schur complement.
+PetscMat
+pylith::problems::FaultSchurPreconditioner::getMatrix(void) const {
+    return _schurMat;
+} // getMatrix
+
+
+// End of file
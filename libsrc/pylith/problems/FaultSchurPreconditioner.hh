@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/problems/FaultSchurPreconditioner.hh
+ *
+ * @brief Local approximation of the Schur complement for the fault Lagrange multipliers.
+ *
+ * For the saddle point system with displacement block K and fault constraint blocks B and B^T,
+ * the Schur complement for the Lagrange multipliers is S = -B K^{-1} B^T. PETSc's `selfp`
+ * approximation replaces K^{-1} with the inverse of the diagonal of K, which ignores the elastic
+ * coupling between vertices and degrades with fault size and mesh refinement.
+ *
+ * We approximate S row by row. The patch for the Lagrange multipliers at a point on the fault
+ * is the set of cohesive cells containing the point, and the displacement degrees of freedom are
+ * those in the closure of the bulk cells adjacent to these cohesive cells. We extract K_patch,
+ * B_patch, and B_patch^T for the patch from the assembled preconditioning matrix, compute
+ * -B_patch K_patch^{-1} B_patch^T with a dense LU factorization, and keep the rows for the
+ * Lagrange multipliers at the point. K_patch is the stiffness of the patch with the displacement
+ * fixed on the boundary of the patch, so it is nonsingular whenever K is.
+ *
+ * The cohesive cells are found via the interface integration patches of the fault integrators.
+ * The approximate Schur complement is installed as the user preconditioning matrix for the Schur
+ * complement, `-pc_fieldsplit_schur_precondition user`.
+ */
+
+#if !defined(pylith_problems_faultschurpreconditioner_hh)
+#define pylith_problems_faultschurpreconditioner_hh
+
+// Include directives ---------------------------------------------------
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/GenericComponent.hh" // ISA GenericComponent
+
+#include "pylith/feassemble/feassemblefwd.hh" // USES IntegratorInterface
+#include "pylith/topology/topologyfwd.hh" // USES Field
+#include "pylith/utils/petscfwd.h" // HASA PetscMat, PetscIS, PetscDM
+#include "pylith/utils/arrayfwd.hh" // HASA std::vector
+
+// FaultSchurPreconditioner ---------------------------------------------
+/// @brief Local approximation of the Schur complement for the fault Lagrange multipliers.
+class pylith::problems::FaultSchurPreconditioner : public pylith::utils::GenericComponent {
+    friend class TestFaultSchurPreconditioner; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Constructor.
+    FaultSchurPreconditioner(void);
+
+    /// Destructor.
+    ~FaultSchurPreconditioner(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Find patches for the Lagrange multipliers and create the preconditioning matrix.
+     *
+     * @param[in] solution Solution field with displacement and lagrange_multiplier_fault subfields.
+     * @param[in] integrators Integrators for interior interfaces.
+     */
+    void initialize(const pylith::topology::Field& solution,
+                    const std::vector<pylith::feassemble::IntegratorInterface*>& integrators);
+
+    /** Compute approximate Schur complement from assembled preconditioning matrix.
+     *
+     * @param[in] precondMat PETSc Mat with preconditioner for the full system.
+     */
+    void update(PetscMat precondMat);
+
+    /** Set approximate Schur complement as the user preconditioning matrix for the Schur complement.
+     *
+     * The preconditioner is only set when the PETSc preconditioner is a Schur complement field split
+     * with `-pc_fieldsplit_schur_precondition user`, so other choices by the user take precedence.
+     *
+     * @param[in] ksp PETSc linear solver.
+     * @returns True if the approximate Schur complement is the preconditioner, false otherwise.
+     */
+    bool setSchurPreconditioner(PetscKSP ksp);
+
+    /** Get approximate Schur complement.
+     *
+     * @returns PETSc Mat with approximate Schur complement for the Lagrange multipliers.
+     */
+    PetscMat getMatrix(void) const;
+
+    // PRIVATE STRUCTS ////////////////////////////////////////////////////
+private:
+
+    /// Degrees of freedom for the Lagrange multipliers at a point on the fault.
+    struct Patch {
+        std::vector<PetscInt> displacement; ///< Displacement dofs in patch (index in submatrix).
+        std::vector<PetscInt> lagrange; ///< Lagrange multiplier dofs in patch (index in submatrix).
+        std::vector<PetscInt> lagrangeCols; ///< Lagrange multiplier dofs in patch (column in Schur complement).
+        std::vector<PetscInt> rows; ///< Lagrange multiplier dofs at point (index in lagrange).
+        std::vector<PetscInt> schurRows; ///< Lagrange multiplier dofs at point (row in Schur complement).
+    }; // Patch
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private:
+
+    PetscDM _dmLagrange; ///< PETSc DM for Lagrange multipliers.
+    PetscMat _schurMat; ///< Approximate Schur complement.
+    PetscIS _subsetIS; ///< Dofs of full system in all patches.
+    PetscMat* _submat; ///< Submatrix of preconditioning matrix for dofs in all patches.
+    std::vector<Patch> _patches; ///< Patches for points on fault.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////
+private:
+
+    FaultSchurPreconditioner(const FaultSchurPreconditioner&); ///< Not implemented.
+    const FaultSchurPreconditioner& operator=(const FaultSchurPreconditioner&); ///< Not implemented.
+
+}; // FaultSchurPreconditioner
+
+#endif // pylith_problems_faultschurpreconditioner_hh
+
+// End of file
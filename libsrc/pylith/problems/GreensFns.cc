@@ -29,6 +29,7 @@
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/problems/ProgressMonitorStep.hh" // USES ProgressMonitorStep
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
+#include "pylith/utils/TimerTree.hh" // USES TimerTree
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -238,11 +239,14 @@ pylith::problems::GreensFns::initialize(void) {
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, 1.0);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, 0.0);
 
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC:
         PYLITH_COMPONENT_DEBUG("Setting PetscSNES callbacks SNESSetFunction() and SNESSetJacobian().");
+        _createJacobianMatrices(&jacobianMat, &precondMat);
         err = SNESSetFunction(_snes, NULL, computeResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-        err = SNESSetJacobian(_snes, NULL, NULL, computeJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        err = SNESSetJacobian(_snes, jacobianMat, precondMat, computeJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
         err = SNESSetType(_snes, SNESKSPONLY);PYLITH_CHECK_ERROR(err);
         err = SNESSetLagJacobian(_snes, -2);PYLITH_CHECK_ERROR(err);
         break;
@@ -256,6 +260,8 @@ pylith::problems::GreensFns::initialize(void) {
         PYLITH_COMPONENT_LOGICERROR("Unknown Green's functions formulation '" << _formulation << "'.");
     } // default
     } // switch
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&precondMat);PYLITH_CHECK_ERROR(err);
 
     pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
     err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
@@ -431,9 +437,13 @@ pylith::problems::GreensFns::computeResidual(PetscVec residualVec,
     residual->zeroLocal();
     const int numIntegrators = _integrators.size();
     assert(numIntegrators > 0); // must have at least 1 integrator
+    pylith::utils::TimerTree::begin("computeResidual");
     for (int i = 0; i < numIntegrators; ++i) {
+        pylith::utils::TimerTree::begin(_integrators[i]->getPhysicsIdentifier());
         _integrators[i]->computeLHSResidual(residual, *_integrationData);
+        pylith::utils::TimerTree::end();
     } // for
+    pylith::utils::TimerTree::end();
 
     // Assemble residual values across processes.
     PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
@@ -461,15 +471,10 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
 
     // Zero Jacobian
     PetscErrorCode err = 0;
-    PetscDS dsSoln = NULL;
-    err = DMGetDS(solution->getDM(), &dsSoln);PYLITH_CHECK_ERROR(err);
-
-    PetscBool hasJacobian = PETSC_FALSE;
-    err = PetscDSHasJacobian(dsSoln, &hasJacobian);PYLITH_CHECK_ERROR(err);
+    bool hasJacobian = false;
+    bool hasPreconditioner = false;
+    _hasJacobianKernels(solution->getDM(), &hasJacobian, &hasPreconditioner);
     if (hasJacobian) { err = MatZeroEntries(jacobianMat);PYLITH_CHECK_ERROR(err); }
-
-    PetscBool hasPreconditioner = PETSC_FALSE;
-    err = PetscDSHasJacobianPreconditioner(dsSoln, &hasPreconditioner);PYLITH_CHECK_ERROR(err);
     if (hasPreconditioner) { err = MatZeroEntries(precondMat);PYLITH_CHECK_ERROR(err); }
 
     // Update PyLith view of the solution.
@@ -477,9 +482,13 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
 
     // Sum Jacobian contributions across integrators.
     const size_t numIntegrators = _integrators.size();
+    pylith::utils::TimerTree::begin("computeJacobian");
     for (size_t i = 0; i < numIntegrators; ++i) {
+        pylith::utils::TimerTree::begin(_integrators[i]->getPhysicsIdentifier());
         _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, *_integrationData);
+        pylith::utils::TimerTree::end();
     } // for
+    pylith::utils::TimerTree::end();
 
     // Assemble matrices
     if (jacobianMat != precondMat) {
@@ -489,6 +498,8 @@ pylith::problems::GreensFns::computeJacobian(PetscMat jacobianMat,
     err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
     err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
 
+    _updateFaultSchurPreconditioner(_snes, precondMat);
+
     PYLITH_METHOD_END;
 } // computeJacobian
 
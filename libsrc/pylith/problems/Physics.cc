@@ -24,11 +24,15 @@
 #include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
+#include "petscdmplex.h" // USES DMPlexComputeCellGeometryFVM()
 
 #include "pylith/utils/error.hh" // USES PYLITH_JMETHOD_*
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::min_element()
 #include <typeinfo> // USES typeid()
 #include <stdexcept> // USES std::runtime_error
 
@@ -249,6 +253,57 @@ pylith::problems::Physics::updateAuxiliaryField(pylith::topology::Field* auxilia
 } // updateAuxiliaryField
 
 
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping on this process.
+PylithReal
+pylith::problems::Physics::computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const {
+    return PYLITH_MAXSCALAR;
+} // computeStableTimeStep
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for explicit time stepping for each cell on this process.
+void
+pylith::problems::Physics::computeStableTimeStepsExplicit(std::vector<PylithInt>* cells,
+                                                          std::vector<PylithReal>* dtCells,
+                                                          const pylith::topology::Field& auxiliaryField) const {
+    assert(cells);
+    assert(dtCells);
+    cells->clear();
+    dtCells->clear();
+} // computeStableTimeStepsExplicit
+
+
+// ------------------------------------------------------------------------------------------------
+// Compute stable time step for explicit time stepping on this process.
+PylithReal
+pylith::problems::Physics::computeStableTimeStepExplicit(const pylith::topology::Field& auxiliaryField,
+                                                         PylithReal* location) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("computeStableTimeStepExplicit(auxiliaryField="<<auxiliaryField.getLabel()<<", location="<<location<<")");
+
+    std::vector<PylithInt> cells;
+    std::vector<PylithReal> dtCells;
+    computeStableTimeStepsExplicit(&cells, &dtCells, auxiliaryField);
+    assert(cells.size() == dtCells.size());
+    if (cells.empty()) {
+        PYLITH_METHOD_RETURN(PYLITH_MAXSCALAR);
+    } // if
+
+    const size_t iMin = std::min_element(dtCells.begin(), dtCells.end()) - dtCells.begin();
+    if (location) {
+        PylithReal volume = 0.0;
+        PylithReal centroid[3] = { 0.0, 0.0, 0.0 };
+        PetscErrorCode err = DMPlexComputeCellGeometryFVM(auxiliaryField.getMesh().getDM(), cells[iMin], &volume, centroid, NULL);PYLITH_CHECK_ERROR(err);
+        for (int i = 0; i < 3; ++i) {
+            location[i] = centroid[i];
+        } // for
+    } // if
+
+    PYLITH_METHOD_RETURN(dtCells[iMin]);
+} // computeStableTimeStepExplicit
+
+
 // ------------------------------------------------------------------------------------------------
 // Get derived factory associated with physics.
 pylith::topology::FieldFactory*
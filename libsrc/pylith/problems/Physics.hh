@@ -227,6 +227,40 @@ public:
     void updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
                               const double t);
 
+    /** Compute stable time step for implicit time stepping on this process.
+     *
+     * The stable time step is based on characteristic times of the physics (for example, the
+     * Maxwell relaxation time of a viscoelastic material) for the current auxiliary field.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    virtual
+    PylithReal computeStableTimeStep(const pylith::topology::Field& auxiliaryField) const;
+
+    /** Compute stable time step for explicit time stepping for each cell on this process.
+     *
+     * The stable time step is based on the Courant-Friedrichs-Lewy (CFL) condition with the
+     * wave speed and size of each cell. Cells without a limit are omitted.
+     *
+     * @param[out] cells Cells with a stable time step.
+     * @param[out] dtCells Stable time step (nondimensional) for each cell.
+     * @param[in] auxiliaryField Auxiliary field.
+     */
+    virtual
+    void computeStableTimeStepsExplicit(std::vector<PylithInt>* cells,
+                                        std::vector<PylithReal>* dtCells,
+                                        const pylith::topology::Field& auxiliaryField) const;
+
+    /** Compute stable time step for explicit time stepping on this process.
+     *
+     * @param[in] auxiliaryField Auxiliary field.
+     * @param[out] location Coordinates of centroid of cell limiting the time step (nondimensional, size 3).
+     * @returns Stable time step (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal computeStableTimeStepExplicit(const pylith::topology::Field& auxiliaryField,
+                                             PylithReal* location) const;
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 
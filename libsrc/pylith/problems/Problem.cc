@@ -33,16 +33,21 @@
 #include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
 #include "pylith/feassemble/Constraint.hh" // USES Constraint
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/problems/FaultSchurPreconditioner.hh" // USES FaultSchurPreconditioner
 #include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor::optimizeClosure()
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 
+#include "petscsnes.h" // USES SNESGetKSP()
+
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/PetscOptions.hh" // USES PetscOptions
 
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::min(), std::max()
 #include <typeinfo> // USES typeid()
 
 // ------------------------------------------------------------------------------------------------
@@ -87,8 +92,10 @@ pylith::problems::Problem::Problem() :
     _normalizer(NULL),
     _gravityField(NULL),
     _observers(new pylith::problems::ObserversSoln),
+    _faultSchurPrecond(NULL),
     _formulation(pylith::problems::Physics::QUASISTATIC),
     _solverType(LINEAR),
+    _matrixType(MATRIX_AIJ),
     _petscDefaults(pylith::utils::PetscDefaults::SOLVER | pylith::utils::PetscDefaults::TESTING) {}
 
 
@@ -119,6 +126,7 @@ pylith::problems::Problem::deallocate(void) {
     delete _normalizer;_normalizer = NULL;
     _gravityField = NULL; // Held by Python. :KLUDGE: :TODO: Use shared pointer.
     delete _observers;_observers = NULL;
+    delete _faultSchurPrecond;_faultSchurPrecond = NULL;
 
     pylith::topology::FieldOps::deallocate();
 
@@ -165,6 +173,24 @@ pylith::problems::Problem::getSolverType(void) const {
 } // getSolverType
 
 
+// ------------------------------------------------------------------------------------------------
+// Set storage type for Jacobian and preconditioner matrices.
+void
+pylith::problems::Problem::setMatrixType(const MatrixTypeEnum value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setMatrixType(value="<<value<<")");
+
+    _matrixType = value;
+} // setMatrixType
+
+
+// ------------------------------------------------------------------------------------------------
+// Get storage type for Jacobian and preconditioner matrices.
+pylith::problems::Problem::MatrixTypeEnum
+pylith::problems::Problem::getMatrixType(void) const {
+    return _matrixType;
+} // getMatrixType
+
+
 // ------------------------------------------------------------------------------------------------
 // Specify whether to set defaults for PETSc solver appropriate for problem.
 void
@@ -434,8 +460,10 @@ pylith::problems::Problem::initialize(void) {
     } // for
 
     solution->allocate();
+    pylith::topology::FieldOps::createCoarseHierarchy(*solution);
     solution->createGlobalVector();
     solution->createOutputVector();
+    _setupMatrixType();
 
     switch (_formulation) {
     case pylith::problems::Physics::DYNAMIC:
@@ -449,6 +477,12 @@ pylith::problems::Problem::initialize(void) {
     } // switch
     _Problem::setInterfaceData(solution, _integrators);
 
+    if ((pylith::problems::Physics::QUASISTATIC == _formulation) && solution->hasSubfield("lagrange_multiplier_fault")) {
+        delete _faultSchurPrecond;_faultSchurPrecond = new pylith::problems::FaultSchurPreconditioner;
+        assert(_faultSchurPrecond);
+        _faultSchurPrecond->initialize(*solution, _Problem::subset<pylith::feassemble::IntegratorInterface>(_integrators));
+    } // if
+
     pythia::journal::debug_t debug(PyreComponent::getName());
     if (debug.state()) {
         PYLITH_COMPONENT_DEBUG("Displaying solution field layout");
@@ -622,6 +656,256 @@ pylith::problems::Problem::_setupSolution(void) {
 } // _setupSolution
 
 
+// ------------------------------------------------------------------------------------------------
+// Set storage type of matrices created from the solution layout.
+void
+pylith::problems::Problem::_setupMatrixType(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_setupMatrixType()");
+
+    if (MATRIX_AIJ == _matrixType) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Matrix type specified on the command line takes precedence.
+    PetscErrorCode err = 0;
+    PetscBool hasMatType = PETSC_FALSE;
+    err = PetscOptionsHasName(NULL, NULL, "-dm_mat_type", &hasMatType);PYLITH_CHECK_ERROR(err);
+    if (hasMatType) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField("solution");
+    assert(solution);
+    PetscDM dmSoln = solution->getDM();
+
+    // Block size is the number of unconstrained degrees of freedom at each point, which must be the
+    // same for all points on all processes. This matches the block size used by DMCreateMatrix().
+    PetscSection sectionGlobal = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMGetGlobalSection(dmSoln, &sectionGlobal);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(sectionGlobal, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    PetscInt blockSizeMinMax[2] = { PETSC_MAX_INT, -PETSC_MAX_INT }; // min, -max
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, cdof = 0;
+        err = PetscSectionGetDof(sectionGlobal, point, &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetConstraintDof(sectionGlobal, point, &cdof);PYLITH_CHECK_ERROR(err);
+        if (dof - cdof > 0) {
+            blockSizeMinMax[0] = std::min(blockSizeMinMax[0], dof - cdof);
+            blockSizeMinMax[1] = std::max(blockSizeMinMax[1], -(dof - cdof));
+        } // if
+    } // for
+    PetscInt blockSizeMinMaxGlobal[2];
+    err = MPI_Allreduce(blockSizeMinMax, blockSizeMinMaxGlobal, 2, MPIU_INT, MPI_MIN, solution->getMesh().getComm());PYLITH_CHECK_ERROR(err);
+    const PetscInt blockSize = (blockSizeMinMaxGlobal[0] == -blockSizeMinMaxGlobal[1]) ? blockSizeMinMaxGlobal[0] : 1;
+    if (blockSize < 2) {
+        PYLITH_COMPONENT_WARNING("Points have different numbers of unconstrained degrees of freedom, so block matrix storage "
+                                 "will not reduce memory. Using compressed sparse row (AIJ) matrix storage.");
+        PYLITH_METHOD_END;
+    } // if
+
+    MatType matType = MATBAIJ;
+    if (MATRIX_SBAIJ == _matrixType) {
+        const pylith::string_vector& subfieldNames = solution->getSubfieldNames();
+        bool isSymmetric = (pylith::problems::Physics::QUASISTATIC == _formulation) &&
+                           (1 == subfieldNames.size()) && solution->hasSubfield("displacement");
+        const size_t numMaterials = _materials.size();
+        for (size_t i = 0; i < numMaterials; ++i) {
+            assert(_materials[i]);
+            isSymmetric = isSymmetric && _materials[i]->isJacobianSymmetric();
+        } // for
+        if (isSymmetric) {
+            matType = MATSBAIJ;
+
+            // Only the upper triangle is stored, so ignore the lower triangle of the element matrices.
+            pylith::utils::PetscOptions options;
+            options.add("-mat_ignore_lower_triangular");
+            options.set();
+        } else {
+            PYLITH_COMPONENT_WARNING("Symmetric block matrix storage requires a quasistatic problem with only a displacement "
+                                     "subfield and materials with symmetric Jacobians. Using block (BAIJ) matrix storage.");
+        } // if/else
+    } // if
+    err = DMSetMatType(dmSoln, matType);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupMatrixType
+
+
+// ------------------------------------------------------------------------------------------------
+// Create Jacobian and preconditioning matrices with exact nonzero pattern for interior interfaces.
+void
+pylith::problems::Problem::_createJacobianMatrices(PetscMat* jacobianMat,
+                                                   PetscMat* precondMat) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_createJacobianMatrices(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<")");
+
+    assert(jacobianMat);
+    assert(precondMat);
+    *jacobianMat = NULL;
+    *precondMat = NULL;
+
+    const std::vector<pylith::feassemble::IntegratorInterface*>& integratorsInterface =
+        _Problem::subset<pylith::feassemble::IntegratorInterface>(_integrators);
+    if (integratorsInterface.empty()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_integrationData);
+    const pylith::topology::Field* solution = _integrationData->getField("solution");
+    assert(solution);
+    PetscDM dmSoln = solution->getDM();
+
+    // Create matrices with sizes, type, and local-to-global mapping from the DM, but skip the DMPlex preallocation.
+    PetscErrorCode err = 0;
+    bool hasPreconditioner = false;
+    _hasJacobianKernels(dmSoln, NULL, &hasPreconditioner);
+    err = DMSetMatrixPreallocateSkip(dmSoln, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(dmSoln, jacobianMat);PYLITH_CHECK_ERROR(err);
+    if (hasPreconditioner) {
+        err = DMCreateMatrix(dmSoln, precondMat);PYLITH_CHECK_ERROR(err);
+    } else {
+        err = PetscObjectReference((PetscObject)*jacobianMat);PYLITH_CHECK_ERROR(err);
+        *precondMat = *jacobianMat;
+    } // if/else
+    err = DMSetMatrixPreallocateSkip(dmSoln, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numRowsLocal = 0, numColsLocal = 0, numRows = 0, numCols = 0, blockSize = 1;
+    err = MatGetLocalSize(*jacobianMat, &numRowsLocal, &numColsLocal);PYLITH_CHECK_ERROR(err);
+    err = MatGetSize(*jacobianMat, &numRows, &numCols);PYLITH_CHECK_ERROR(err);
+    err = MatGetBlockSize(*jacobianMat, &blockSize);PYLITH_CHECK_ERROR(err);
+
+    // PETSc assembles the element matrix for the entire closure of the cohesive cells, which includes zero
+    // blocks between the negative and positive sides of the interface. Only AIJ storage can ignore these zero
+    // entries, so we let PETSc create and preallocate matrices with block storage from the DM.
+    PetscBool isAIJ = PETSC_FALSE;
+    err = PetscObjectTypeCompareAny((PetscObject)*jacobianMat, &isAIJ, MATSEQAIJ, MATMPIAIJ, "");PYLITH_CHECK_ERROR(err);
+    if (!isAIJ) {
+        err = MatDestroy(jacobianMat);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(precondMat);PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscMat matPreallocator = NULL;
+    err = MatCreate(solution->getMesh().getComm(), &matPreallocator);PYLITH_CHECK_ERROR(err);
+    err = MatSetType(matPreallocator, MATPREALLOCATOR);PYLITH_CHECK_ERROR(err);
+    err = MatSetSizes(matPreallocator, numRowsLocal, numColsLocal, numRows, numCols);PYLITH_CHECK_ERROR(err);
+    err = MatSetBlockSize(matPreallocator, blockSize);PYLITH_CHECK_ERROR(err);
+    err = MatSetUp(matPreallocator);PYLITH_CHECK_ERROR(err);
+
+    // Cells other than cohesive cells couple all degrees of freedom in their closure.
+    PetscSection localSection = NULL;
+    PetscSection globalSection = NULL;
+    err = DMGetLocalSection(dmSoln, &localSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(dmSoln, &globalSection);PYLITH_CHECK_ERROR(err);
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmSoln, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscScalar> values;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        if (pylith::topology::MeshOps::isCohesiveCell(dmSoln, cell)) {
+            continue;
+        } // if
+        PetscInt numIndices = 0;
+        PetscInt* indices = NULL;
+        err = DMPlexGetClosureIndices(dmSoln, localSection, globalSection, cell, PETSC_TRUE, &numIndices, &indices,
+                                      NULL, NULL);PYLITH_CHECK_ERROR(err);
+        values.resize(numIndices*numIndices, 0.0);
+        err = MatSetValues(matPreallocator, numIndices, indices, numIndices, indices, &values[0],
+                           INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+        err = DMPlexRestoreClosureIndices(dmSoln, localSection, globalSection, cell, PETSC_TRUE, &numIndices, &indices,
+                                          NULL, NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Include diagonal for all rows, so degrees of freedom without any kernels (for example, Lagrange multipliers)
+    // still have a diagonal entry.
+    PetscInt rowStart = 0, rowEnd = 0;
+    err = MatGetOwnershipRange(*jacobianMat, &rowStart, &rowEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt row = rowStart; row < rowEnd; ++row) {
+        err = MatSetValue(matPreallocator, row, row, 0.0, INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Cohesive cells couple only the blocks with registered kernels.
+    for (size_t i = 0; i < integratorsInterface.size(); ++i) {
+        integratorsInterface[i]->addJacobianNonzeros(matPreallocator, *solution);
+    } // for
+    err = MatAssemblyBegin(matPreallocator, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(matPreallocator, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    // Once the nonzero pattern is filled in, we skip the zero entries from the cohesive cells that fall
+    // outside of it. A nonzero entry outside the pattern is an error, so a missing block is not silently
+    // dropped from the Jacobian.
+    const size_t numMats = (*precondMat != *jacobianMat) ? 2 : 1;
+    PetscMat mats[2] = { *jacobianMat, *precondMat };
+    for (size_t i = 0; i < numMats; ++i) {
+        err = MatPreallocatorPreallocate(matPreallocator, PETSC_TRUE, mats[i]);PYLITH_CHECK_ERROR(err);
+        err = MatSetOption(mats[i], MAT_IGNORE_ZERO_ENTRIES, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+        err = MatSetOption(mats[i], MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatDestroy(&matPreallocator);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _createJacobianMatrices
+
+
+// ------------------------------------------------------------------------------------------------
+// Update Schur complement preconditioner for fault Lagrange multipliers from the new preconditioning matrix.
+void
+pylith::problems::Problem::_updateFaultSchurPreconditioner(PetscSNES snes,
+                                                           PetscMat precondMat) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_updateFaultSchurPreconditioner(snes="<<snes<<", precondMat="<<precondMat<<")");
+
+    if (!_faultSchurPrecond) {
+        PYLITH_METHOD_END;
+    } // if
+    assert(snes);
+    assert(precondMat);
+
+    PetscKSP ksp = NULL;
+    PetscErrorCode err = SNESGetKSP(snes, &ksp);PYLITH_CHECK_ERROR(err);
+    if (_faultSchurPrecond->setSchurPreconditioner(ksp)) {
+        _faultSchurPrecond->update(precondMat);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _updateFaultSchurPreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether any PETSc DS of the solution has Jacobian or preconditioner pointwise functions.
+void
+pylith::problems::Problem::_hasJacobianKernels(PetscDM dm,
+                                               bool* hasJacobian,
+                                               bool* hasPreconditioner) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
+
+    if (hasJacobian) { *hasJacobian = false; }
+    if (hasPreconditioner) { *hasPreconditioner = false; }
+
+    PetscErrorCode err = 0;
+    PetscInt numDS = 0;
+    err = DMGetNumDS(dm, &numDS);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numDS; ++i) {
+        PetscDS ds = NULL;
+        err = DMGetRegionNumDS(dm, i, NULL, NULL, &ds, NULL);PYLITH_CHECK_ERROR(err);
+        if (hasJacobian) {
+            PetscBool value = PETSC_FALSE;
+            err = PetscDSHasJacobian(ds, &value);PYLITH_CHECK_ERROR(err);
+            *hasJacobian = *hasJacobian || value;
+        } // if
+        if (hasPreconditioner) {
+            PetscBool value = PETSC_FALSE;
+            err = PetscDSHasJacobianPreconditioner(ds, &value);PYLITH_CHECK_ERROR(err);
+            *hasPreconditioner = *hasPreconditioner || value;
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // _hasJacobianKernels
+
+
 // ------------------------------------------------------------------------------------------------
 // Create null space for solution subfield.
 void
@@ -43,7 +43,7 @@
 #include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
 #include "spatialdata/units/unitsfwd.hh" // HASA Nondimensional
 
-#include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat
+#include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat, PetscSNES
 
 #include "pylith/problems/Physics.hh" // USES Problem::Formulation
 
@@ -61,6 +61,12 @@ public:
         NONLINEAR, // Nonlinear solver.
     }; // SolverType
 
+    enum MatrixTypeEnum {
+        MATRIX_AIJ, // Compressed sparse row storage.
+        MATRIX_BAIJ, // Block compressed sparse row storage.
+        MATRIX_SBAIJ, // Symmetric block compressed sparse row storage (upper triangle).
+    }; // MatrixTypeEnum
+
     // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -97,6 +103,28 @@ public:
      */
     SolverTypeEnum getSolverType(void) const;
 
+    /** Set storage type for Jacobian and preconditioner matrices.
+     *
+     * Block storage uses a block size equal to the number of degrees of freedom at each point, so it
+     * requires all points to have the same number of unconstrained degrees of freedom (for example,
+     * displacement with fault Lagrange multipliers, or displacement and velocity without faults, and
+     * no boundary conditions that constrain only some components). With velocity, vertices have
+     * 2*dim degrees of freedom while fault Lagrange multiplier points have dim, so block storage is
+     * not used. Symmetric block storage also requires a symmetric Jacobian, so it is limited to
+     * quasistatic problems with only a displacement subfield in which every material has a
+     * symmetric Jacobian (for example, not power-law viscoelasticity). We fall back to the next
+     * simpler storage type when the requirements are not met.
+     *
+     * @param[in] value Matrix storage type.
+     */
+    void setMatrixType(const MatrixTypeEnum value);
+
+    /** Get storage type for Jacobian and preconditioner matrices.
+     *
+     * @returns Matrix storage type.
+     */
+    MatrixTypeEnum getMatrixType(void) const;
+
     /** Specify which default PETSc options to use.
      *
      * @param[in] flags Flags indicating which default PETSc options to set.
@@ -201,11 +229,54 @@ protected:
     std::vector<pylith::feassemble::Integrator*> _integrators; ///< Array of integrators.
     std::vector<pylith::feassemble::Constraint*> _constraints; ///< Array of constraints.
     pylith::problems::ObserversSoln* _observers; ///< Subscribers of solution updates.
+    pylith::problems::FaultSchurPreconditioner* _faultSchurPrecond; ///< Schur complement preconditioner for faults.
 
     pylith::problems::Physics::FormulationEnum _formulation; ///< Formulation for equations.
     SolverTypeEnum _solverType; ///< Problem (solver) type.
+    MatrixTypeEnum _matrixType; ///< Storage type for Jacobian and preconditioner matrices.
     int _petscDefaults; ///< Flags for PETSc default options for problem.
 
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Create Jacobian and preconditioning matrices with exact nonzero pattern for interior interfaces.
+     *
+     * The generic DMPlex adjacency couples all degrees of freedom in the closure of each cohesive cell,
+     * including the two sides of the interface. For problems with interfaces, we preallocate only the
+     * blocks with registered kernels. Without interfaces or with block storage the matrices are NULL,
+     * and PETSc creates them from the DM.
+     *
+     * @param[out] jacobianMat PETSc Mat for Jacobian (NULL if not created).
+     * @param[out] precondMat PETSc Mat for preconditioner (NULL if not created).
+     */
+    void _createJacobianMatrices(PetscMat* jacobianMat,
+                                 PetscMat* precondMat);
+
+    /** Check whether any PETSc DS of the solution has Jacobian or preconditioner pointwise functions.
+     *
+     * Problems with interfaces have a DS for the bulk cells and one for the cohesive cells, so
+     * checking only the default DS misses kernels registered for the interfaces.
+     *
+     * @param[in] dm PETSc DM for solution.
+     * @param[out] hasJacobian True if any DS has Jacobian pointwise functions.
+     * @param[out] hasPreconditioner True if any DS has preconditioner pointwise functions.
+     */
+    static
+    void _hasJacobianKernels(PetscDM dm,
+                             bool* hasJacobian,
+                             bool* hasPreconditioner);
+
+    /** Update Schur complement preconditioner for fault Lagrange multipliers from the new preconditioning matrix.
+     *
+     * No-op for problems without fault Lagrange multipliers or when the linear solver does not use
+     * `-pc_fieldsplit_schur_precondition user`.
+     *
+     * @param[in] snes PETSc nonlinear solver.
+     * @param[in] precondMat PETSc Mat with assembled preconditioner.
+     */
+    void _updateFaultSchurPreconditioner(PetscSNES snes,
+                                         PetscMat precondMat);
+
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -221,6 +292,9 @@ private:
     /// Setup solution subfields and discretization.
     void _setupSolution(void);
 
+    /// Set storage type of matrices created from the solution layout.
+    void _setupMatrixType(void);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
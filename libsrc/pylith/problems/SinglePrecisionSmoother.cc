@@ -0,0 +1,407 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "SinglePrecisionSmoother.hh" // implementation of object methods
+
+#include "petscksp.h" // USES PetscKSP, PetscPC
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD*
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::logic_error, std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback for PETSc KSPSetPreSolve() to replace smoothers after the preconditioner is setup.
+PetscErrorCode
+pylith::problems::SinglePrecisionSmoother::presolve(PetscKSP ksp,
+                                                    PetscVec rhsVec,
+                                                    PetscVec solutionVec,
+                                                    void* context) {
+    PYLITH_METHOD_BEGIN;
+    assert(ksp);
+
+    // Make sure the preconditioner (multigrid hierarchy, field splits) is setup before we look for
+    // smoothers. KSPSolve() will not set it up again.
+    PetscErrorCode err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+    PetscPC pc = NULL;
+    err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+    replace(pc);
+
+    PYLITH_METHOD_RETURN(0);
+} // presolve
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Replace Jacobi and SOR preconditioners with single precision versions.
+void
+pylith::problems::SinglePrecisionSmoother::replace(PetscPC pc) {
+    PYLITH_METHOD_BEGIN;
+    assert(pc);
+
+    PetscErrorCode err = 0;
+    PetscBool isFieldSplit = PETSC_FALSE;
+    PetscBool isMultigrid = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCFIELDSPLIT, &isFieldSplit);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectTypeCompareAny((PetscObject)pc, &isMultigrid, PCMG, PCGAMG, "");PYLITH_CHECK_ERROR(err);
+    if (isFieldSplit) {
+        PetscKSP* subksp = NULL;
+        PetscInt numSplits = 0;
+        err = PCFieldSplitGetSubKSP(pc, &numSplits, &subksp);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numSplits; ++i) {
+            PetscPC subpc = NULL;
+            err = KSPSetUp(subksp[i]);PYLITH_CHECK_ERROR(err);
+            err = KSPGetPC(subksp[i], &subpc);PYLITH_CHECK_ERROR(err);
+            replace(subpc);
+        } // for
+        err = PetscFree(subksp);PYLITH_CHECK_ERROR(err);
+    } else if (isMultigrid) {
+        // Level 0 is the coarse level solve.
+        PetscInt numLevels = 0;
+        err = PCMGGetLevels(pc, &numLevels);PYLITH_CHECK_ERROR(err);
+        for (PetscInt level = 1; level < numLevels; ++level) {
+            PetscKSP smoother = NULL;
+            PetscPC smootherPC = NULL;
+            err = PCMGGetSmoother(pc, level, &smoother);PYLITH_CHECK_ERROR(err);
+            err = KSPGetPC(smoother, &smootherPC);PYLITH_CHECK_ERROR(err);
+            _replaceSmoother(smootherPC);
+        } // for
+    } else {
+        _replaceSmoother(pc);
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // replace
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor.
+pylith::problems::SinglePrecisionSmoother::SinglePrecisionSmoother(const SmootherEnum smoother,
+                                                                  const PylithReal omega) :
+    _smoother(smoother),
+    _omega(omega) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::problems::SinglePrecisionSmoother::~SinglePrecisionSmoother(void) {}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Replace preconditioner with single precision version if it is Jacobi or SOR.
+void
+pylith::problems::SinglePrecisionSmoother::_replaceSmoother(PetscPC pc) {
+    PYLITH_METHOD_BEGIN;
+    assert(pc);
+
+    PetscErrorCode err = 0;
+    PetscBool isJacobi = PETSC_FALSE;
+    PetscBool isSOR = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCJACOBI, &isJacobi);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectTypeCompare((PetscObject)pc, PCSOR, &isSOR);PYLITH_CHECK_ERROR(err);
+    if (!isJacobi && !isSOR) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const char* prefix = NULL;
+    err = PCGetOptionsPrefix(pc, &prefix);PYLITH_CHECK_ERROR(err);
+    PylithReal omega = 1.0;
+    if (isSOR) {
+        // PETSc SOR on BAIJ matrices uses point blocks, which is stronger than scalar SOR.
+        PetscMat precondMat = NULL;
+        PetscInt blockSize = 1;
+        PetscBool isBlockMat = PETSC_FALSE;
+        err = PCGetOperators(pc, NULL, &precondMat);PYLITH_CHECK_ERROR(err);
+        err = MatGetBlockSize(precondMat, &blockSize);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectTypeCompareAny((PetscObject)precondMat, &isBlockMat, MATSEQBAIJ, MATMPIBAIJ, MATSEQSBAIJ,
+                                        MATMPISBAIJ, "");PYLITH_CHECK_ERROR(err);
+        if (isBlockMat && (blockSize > 1)) {
+            PYLITH_METHOD_END;
+        } // if
+
+        PetscInt numIterations = 0;
+        PetscInt numLocalIterations = 0;
+        MatSORType sorType = SOR_LOCAL_SYMMETRIC_SWEEP;
+        err = PCSORGetOmega(pc, &omega);PYLITH_CHECK_ERROR(err);
+        err = PCSORGetIterations(pc, &numIterations, &numLocalIterations);PYLITH_CHECK_ERROR(err);
+        err = PCSORGetSymmetric(pc, &sorType);PYLITH_CHECK_ERROR(err);
+        const bool isSymmetric = (SOR_LOCAL_SYMMETRIC_SWEEP == sorType) || (SOR_SYMMETRIC_SWEEP == sorType);
+        if ((1 != numIterations) || (1 != numLocalIterations) || !isSymmetric) {
+            std::ostringstream msg;
+            msg << "Single precision SOR smoothers only support one local symmetric sweep. Found "
+                << numIterations << " iterations and " << numLocalIterations
+                << " local iterations with SOR type " << sorType << " for preconditioner with options prefix '"
+                << (prefix ? prefix : "") << "'. Turn off single precision smoothers or use the default SOR settings.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } else {
+        PCJacobiType jacobiType = PC_JACOBI_DIAGONAL;
+        PetscBool useAbs = PETSC_FALSE;
+        err = PCJacobiGetType(pc, &jacobiType);PYLITH_CHECK_ERROR(err);
+        err = PCJacobiGetUseAbs(pc, &useAbs);PYLITH_CHECK_ERROR(err);
+        if ((PC_JACOBI_DIAGONAL != jacobiType) || useAbs) {
+            std::ostringstream msg;
+            msg << "Single precision Jacobi smoothers only support the diagonal Jacobi type without absolute values "
+                << "for preconditioner with options prefix '" << (prefix ? prefix : "") << "'. "
+                << "Turn off single precision smoothers or use the default Jacobi settings.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if/else
+
+    SinglePrecisionSmoother* smoother = new SinglePrecisionSmoother(isSOR ? SOR : JACOBI, omega);assert(smoother);
+    err = PCSetType(pc, PCSHELL);PYLITH_CHECK_ERROR(err);
+    err = PCShellSetContext(pc, (void*)smoother);PYLITH_CHECK_ERROR(err);
+    err = PCShellSetSetUp(pc, _setupCallback);PYLITH_CHECK_ERROR(err);
+    err = PCShellSetApply(pc, _applyCallback);PYLITH_CHECK_ERROR(err);
+    if (isSOR) {
+        // Richardson smoothers call this instead of computing the residual with the double precision matrix.
+        err = PCShellSetApplyRichardson(pc, _applyRichardsonCallback);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PCShellSetDestroy(pc, _destroyCallback);PYLITH_CHECK_ERROR(err);
+    err = PCShellSetName(pc, isSOR ? "single precision SOR" : "single precision Jacobi");PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _replaceSmoother
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy local diagonal block of matrix (inverse of diagonal for Jacobi) to single precision.
+void
+pylith::problems::SinglePrecisionSmoother::_setup(PetscMat mat) {
+    PYLITH_METHOD_BEGIN;
+    assert(mat);
+
+    PetscErrorCode err = 0;
+    if (JACOBI == _smoother) {
+        PetscVec diagonalVec = NULL;
+        PetscInt numRows = 0;
+        const PetscScalar* diagonalArray = NULL;
+        err = MatCreateVecs(mat, &diagonalVec, NULL);PYLITH_CHECK_ERROR(err);
+        err = MatGetDiagonal(mat, diagonalVec);PYLITH_CHECK_ERROR(err);
+        err = VecGetLocalSize(diagonalVec, &numRows);PYLITH_CHECK_ERROR(err);
+        err = VecGetArrayRead(diagonalVec, &diagonalArray);PYLITH_CHECK_ERROR(err);
+        _diagonalInv.resize(numRows);
+        _work.resize(numRows);
+        for (PetscInt iRow = 0; iRow < numRows; ++iRow) {
+            // Use 1 for zero diagonal entries as in PCJACOBI.
+            const PylithReal diagonal = PetscRealPart(diagonalArray[iRow]);
+            _diagonalInv[iRow] = (diagonal != 0.0) ? float(1.0 / diagonal) : 1.0f;
+        } // for
+        err = VecRestoreArrayRead(diagonalVec, &diagonalArray);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&diagonalVec);PYLITH_CHECK_ERROR(err);
+
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscMat matLocal = NULL;
+    PetscInt numRows = 0;
+    err = MatGetDiagonalBlock(mat, &matLocal);PYLITH_CHECK_ERROR(err);
+    err = MatGetLocalSize(matLocal, &numRows, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Symmetric block storage only provides the upper triangle of each row.
+    PetscBool isSymmetricBlock = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)matLocal, MATSEQSBAIJ, &isSymmetricBlock);PYLITH_CHECK_ERROR(err);
+    if (isSymmetricBlock) {
+        err = MatConvert(matLocal, MATSEQAIJ, MAT_INITIAL_MATRIX, &matLocal);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    _rowOffsets.resize(numRows+1);
+    _diagonalInv.resize(numRows);
+    _work.resize(numRows);
+    _columns.clear();
+    _values.clear();
+    _rowOffsets[0] = 0;
+    for (PetscInt iRow = 0; iRow < numRows; ++iRow) {
+        PetscInt numCols = 0;
+        const PetscInt* cols = NULL;
+        const PetscScalar* values = NULL;
+        PetscScalar diagonal = 0.0;
+        err = MatGetRow(matLocal, iRow, &numCols, &cols, &values);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iCol = 0; iCol < numCols; ++iCol) {
+            if (cols[iCol] == iRow) {
+                diagonal = values[iCol];
+            } else {
+                _columns.push_back(cols[iCol]);
+                _values.push_back(float(PetscRealPart(values[iCol])));
+            } // if/else
+        } // for
+        err = MatRestoreRow(matLocal, iRow, &numCols, &cols, &values);PYLITH_CHECK_ERROR(err);
+
+        // Use 1 for zero diagonal entries as in PCJACOBI.
+        _diagonalInv[iRow] = (PetscRealPart(diagonal) != 0.0) ? float(1.0 / PetscRealPart(diagonal)) : 1.0f;
+        _rowOffsets[iRow+1] = _columns.size();
+    } // for
+    if (isSymmetricBlock) {
+        err = MatDestroy(&matLocal);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setup
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Apply smoother.
+void
+pylith::problems::SinglePrecisionSmoother::_apply(PetscVec rhsVec,
+                                                  PetscVec solutionVec,
+                                                  const PetscInt numIterations,
+                                                  const bool zeroGuess) {
+    PYLITH_METHOD_BEGIN;
+    assert(numIterations > 0);
+
+    PetscErrorCode err = 0;
+    const PetscScalar* rhsArray = NULL;
+    PetscScalar* solutionArray = NULL;
+    err = VecGetArrayRead(rhsVec, &rhsArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(solutionVec, &solutionArray);PYLITH_CHECK_ERROR(err);
+
+    const int numRows = _diagonalInv.size();
+    float* x = (numRows > 0) ? &_work[0] : NULL;
+    if (!zeroGuess) {
+        for (int iRow = 0; iRow < numRows; ++iRow) {
+            x[iRow] = float(PetscRealPart(solutionArray[iRow]));
+        } // for
+    } // if
+    switch (_smoother) {
+    case JACOBI:
+        assert(1 == numIterations && zeroGuess);
+        for (int iRow = 0; iRow < numRows; ++iRow) {
+            x[iRow] = float(PetscRealPart(rhsArray[iRow])) * _diagonalInv[iRow];
+        } // for
+        break;
+    case SOR:
+        for (PetscInt iIter = 0; iIter < numIterations; ++iIter) {
+            // Forward sweep. With a zero initial guess, the first sweep only involves the lower triangle.
+            const bool lowerOnly = zeroGuess && (0 == iIter);
+            for (int iRow = 0; iRow < numRows; ++iRow) {
+                float sum = float(PetscRealPart(rhsArray[iRow]));
+                for (int i = _rowOffsets[iRow]; i < _rowOffsets[iRow+1]; ++i) {
+                    if (!lowerOnly || (_columns[i] < iRow)) {
+                        sum -= _values[i] * x[_columns[i]];
+                    } // if
+                } // for
+                x[iRow] = lowerOnly ? _omega * sum * _diagonalInv[iRow] :
+                          (1.0f - _omega) * x[iRow] + _omega * sum * _diagonalInv[iRow];
+            } // for
+            // Backward sweep.
+            for (int iRow = numRows-1; iRow >= 0; --iRow) {
+                float sum = float(PetscRealPart(rhsArray[iRow]));
+                for (int i = _rowOffsets[iRow]; i < _rowOffsets[iRow+1]; ++i) {
+                    sum -= _values[i] * x[_columns[i]];
+                } // for
+                x[iRow] = (1.0f - _omega) * x[iRow] + _omega * sum * _diagonalInv[iRow];
+            } // for
+        } // for
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown smoother type.");
+    } // switch
+    for (int iRow = 0; iRow < numRows; ++iRow) {
+        solutionArray[iRow] = x[iRow];
+    } // for
+
+    err = VecRestoreArray(solutionVec, &solutionArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(rhsVec, &rhsArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _apply
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback for PETSc PCShellSetSetUp().
+PetscErrorCode
+pylith::problems::SinglePrecisionSmoother::_setupCallback(PetscPC pc) {
+    PYLITH_METHOD_BEGIN;
+
+    void* context = NULL;
+    PetscErrorCode err = PCShellGetContext(pc, &context);PYLITH_CHECK_ERROR(err);
+    SinglePrecisionSmoother* smoother = (SinglePrecisionSmoother*)context;assert(smoother);
+    PetscMat precondMat = NULL;
+    err = PCGetOperators(pc, NULL, &precondMat);PYLITH_CHECK_ERROR(err);
+    smoother->_setup(precondMat);
+
+    PYLITH_METHOD_RETURN(0);
+} // _setupCallback
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback for PETSc PCShellSetApply().
+PetscErrorCode
+pylith::problems::SinglePrecisionSmoother::_applyCallback(PetscPC pc,
+                                                          PetscVec rhsVec,
+                                                          PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+
+    void* context = NULL;
+    PetscErrorCode err = PCShellGetContext(pc, &context);PYLITH_CHECK_ERROR(err);
+    SinglePrecisionSmoother* smoother = (SinglePrecisionSmoother*)context;assert(smoother);
+    smoother->_apply(rhsVec, solutionVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // _applyCallback
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback for PETSc PCShellSetApplyRichardson().
+PetscErrorCode
+pylith::problems::SinglePrecisionSmoother::_applyRichardsonCallback(PetscPC pc,
+                                                                    PetscVec rhsVec,
+                                                                    PetscVec solutionVec,
+                                                                    PetscVec workVec,
+                                                                    PetscReal rtol,
+                                                                    PetscReal abstol,
+                                                                    PetscReal dtol,
+                                                                    PetscInt maxIterations,
+                                                                    PetscBool zeroGuess,
+                                                                    PetscInt* numIterations,
+                                                                    PCRichardsonConvergedReason* reason) {
+    PYLITH_METHOD_BEGIN;
+    assert(numIterations);
+    assert(reason);
+
+    // Like PETSc SOR, do a fixed number of sweeps without checking the residual.
+    void* context = NULL;
+    PetscErrorCode err = PCShellGetContext(pc, &context);PYLITH_CHECK_ERROR(err);
+    SinglePrecisionSmoother* smoother = (SinglePrecisionSmoother*)context;assert(smoother);
+    smoother->_apply(rhsVec, solutionVec, maxIterations, zeroGuess);
+    *numIterations = maxIterations;
+    *reason = PCRICHARDSON_CONVERGED_ITS;
+
+    PYLITH_METHOD_RETURN(0);
+} // _applyRichardsonCallback
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback for PETSc PCShellSetDestroy().
+PetscErrorCode
+pylith::problems::SinglePrecisionSmoother::_destroyCallback(PetscPC pc) {
+    PYLITH_METHOD_BEGIN;
+
+    void* context = NULL;
+    PetscErrorCode err = PCShellGetContext(pc, &context);PYLITH_CHECK_ERROR(err);
+    SinglePrecisionSmoother* smoother = (SinglePrecisionSmoother*)context;
+    delete smoother;smoother = NULL;
+
+    PYLITH_METHOD_RETURN(0);
+} // _destroyCallback
+
+
+// End of file
@@ -0,0 +1,180 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/problems/SinglePrecisionSmoother.hh
+ *
+ * @brief Jacobi and SOR preconditioners stored and applied in single precision.
+ *
+ * PETSc stores all matrices with the precision of PetscScalar, so we cannot build an entire
+ * preconditioner in single precision while keeping the operator and Krylov solver in double
+ * precision. Instead, we replace the Jacobi and SOR smoothers on the multigrid levels (and
+ * Jacobi/SOR preconditioners) with shell preconditioners that keep a single precision copy of the
+ * local diagonal block of the preconditioning matrix. Applying the smoothers dominates the memory
+ * traffic in the preconditioner. SOR performs the Richardson iterations of the smoother itself,
+ * so it reads 8 bytes per nonzero instead of 12 bytes for the double precision matrix, and Jacobi
+ * only keeps the inverse of the diagonal.
+ *
+ * The double precision matrices are still needed for the multigrid residuals and coarse
+ * operators, so the single precision copy is additional memory.
+ */
+
+#if !defined(pylith_problems_singleprecisionsmoother_hh)
+#define pylith_problems_singleprecisionsmoother_hh
+
+// Include directives ---------------------------------------------------
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscKSP, PetscPC, PetscMat, PetscVec
+#include "pylith/utils/arrayfwd.hh" // HASA std::vector
+
+#include "petscpc.h" // USES PCRichardsonConvergedReason
+
+// SinglePrecisionSmoother ----------------------------------------------
+/// @brief Jacobi and SOR preconditioners stored and applied in single precision.
+class pylith::problems::SinglePrecisionSmoother {
+    friend class TestSinglePrecisionSmoother; // unit testing
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /** Callback for PETSc KSPSetPreSolve() to replace smoothers after the preconditioner is setup.
+     *
+     * @param[in] ksp PETSc linear solver.
+     * @param[in] rhsVec PETSc Vec with right-hand side.
+     * @param[in] solutionVec PETSc Vec with solution.
+     * @param[in] context User context (not used).
+     */
+    static
+    PetscErrorCode presolve(PetscKSP ksp,
+                            PetscVec rhsVec,
+                            PetscVec solutionVec,
+                            void* context);
+
+    /** Replace Jacobi and SOR preconditioners with single precision versions.
+     *
+     * Descends into field splits and multigrid levels. The coarse level solve of multigrid is not
+     * changed.
+     *
+     * @param[in] pc PETSc preconditioner.
+     */
+    static
+    void replace(PetscPC pc);
+
+    // PRIVATE ENUMS //////////////////////////////////////////////////////
+private:
+
+    enum SmootherEnum {
+        JACOBI=0, ///< Jacobi (diagonal).
+        SOR=1, ///< Local symmetric successive over-relaxation (SSOR).
+    }; // SmootherEnum
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////
+private:
+
+    /** Constructor.
+     *
+     * @param[in] smoother Type of smoother.
+     * @param[in] omega Relaxation factor for SOR.
+     */
+    SinglePrecisionSmoother(const SmootherEnum smoother,
+                            const PylithReal omega=1.0);
+
+    /// Destructor.
+    ~SinglePrecisionSmoother(void);
+
+    /** Replace preconditioner with single precision version if it is Jacobi or SOR.
+     *
+     * SOR uses the relaxation factor of the PETSc preconditioner. SOR with point blocks (BAIJ or
+     * SBAIJ matrix with block size larger than 1) is not replaced. We only support one local
+     * symmetric sweep and diagonal Jacobi, so we reject other SOR and Jacobi settings.
+     *
+     * @param[in] pc PETSc preconditioner with operators.
+     */
+    static
+    void _replaceSmoother(PetscPC pc);
+
+    /** Copy local diagonal block of matrix (inverse of diagonal for Jacobi) to single precision.
+     *
+     * @param[in] mat PETSc preconditioning matrix.
+     */
+    void _setup(PetscMat mat);
+
+    /** Apply smoother.
+     *
+     * Jacobi only supports one iteration with a zero initial guess.
+     *
+     * @param[in] rhsVec PETSc Vec with right-hand side.
+     * @param[inout] solutionVec PETSc Vec with initial guess (if not zero) and result.
+     * @param[in] numIterations Number of iterations (symmetric sweeps for SOR).
+     * @param[in] zeroGuess True if initial guess is zero, false otherwise.
+     */
+    void _apply(PetscVec rhsVec,
+                PetscVec solutionVec,
+                const PetscInt numIterations=1,
+                const bool zeroGuess=true);
+
+    /// Callback for PETSc PCShellSetSetUp().
+    static
+    PetscErrorCode _setupCallback(PetscPC pc);
+
+    /// Callback for PETSc PCShellSetApply().
+    static
+    PetscErrorCode _applyCallback(PetscPC pc,
+                                  PetscVec rhsVec,
+                                  PetscVec solutionVec);
+
+    /// Callback for PETSc PCShellSetApplyRichardson().
+    static
+    PetscErrorCode _applyRichardsonCallback(PetscPC pc,
+                                            PetscVec rhsVec,
+                                            PetscVec solutionVec,
+                                            PetscVec workVec,
+                                            PetscReal rtol,
+                                            PetscReal abstol,
+                                            PetscReal dtol,
+                                            PetscInt maxIterations,
+                                            PetscBool zeroGuess,
+                                            PetscInt* numIterations,
+                                            PCRichardsonConvergedReason* reason);
+
+    /// Callback for PETSc PCShellSetDestroy().
+    static
+    PetscErrorCode _destroyCallback(PetscPC pc);
+
+    // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private:
+
+    SmootherEnum _smoother; ///< Type of smoother.
+    float _omega; ///< Relaxation factor for SOR.
+    std::vector<int> _rowOffsets; ///< Offset of first nonzero in each row (CSR, SOR only).
+    std::vector<int> _columns; ///< Column of each nonzero, excluding diagonal (CSR, SOR only).
+    std::vector<float> _values; ///< Value of each nonzero, excluding diagonal (CSR, SOR only).
+    std::vector<float> _diagonalInv; ///< Inverse of diagonal.
+    std::vector<float> _work; ///< Work array for solution.
+
+    // NOT IMPLEMENTED ////////////////////////////////////////////////////
+private:
+
+    SinglePrecisionSmoother(const SinglePrecisionSmoother&); ///< Not implemented.
+    const SinglePrecisionSmoother& operator=(const SinglePrecisionSmoother&); ///< Not implemented.
+
+}; // SinglePrecisionSmoother
+
+#endif // pylith_problems_singleprecisionsmoother_hh
+
+// End of file
@@ -29,16 +29,24 @@
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/problems/InitialCondition.hh" // USES InitialCondition
 #include "pylith/problems/ProgressMonitorTime.hh" // USES ProgressMonitorTime
+#include "pylith/problems/SinglePrecisionSmoother.hh" // USES SinglePrecisionSmoother
+#include "pylith/fekernels/KernelStatus.hh" // USES KernelStatus
 #include "pylith/utils/PetscOptions.hh" // USES SolverDefaults
+#include "pylith/utils/TimerTree.hh" // USES TimerTree
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "petscts.h" // USES PetscTS
+#include "petscdmplex.h" // USES DMPlexVecGetClosure()
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::min(), std::rotate(), std::fill()
+#include <cmath> // USES fabs(), floor(), log2(), pow()
 #include <iostream> // USES std::cout in debugging
+#include <string> // USES std::string
 
 // ---------------------------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -46,6 +54,44 @@ namespace pylith {
         class _TimeDependent {
 public:
 
+            /** Set values in closure of cell to 1.
+             *
+             * @param[in] dm PETSc DM for solution.
+             * @param[inout] localVec Local PETSc Vec for marking degrees of freedom.
+             * @param[in] cell Cell.
+             */
+            static
+            void markClosure(PetscDM dm,
+                             PetscVec localVec,
+                             const PetscInt cell);
+
+            /** Check whether any value in closure of cell matches mark.
+             *
+             * @param[in] dm PETSc DM for solution.
+             * @param[in] localVec Local PETSc Vec with marked degrees of freedom.
+             * @param[in] cell Cell.
+             * @param[in] mark Value of mark (values of 0 are unmarked).
+             * @returns True if closure contains mark, false otherwise.
+             */
+            static
+            bool hasMarkInClosure(PetscDM dm,
+                                  PetscVec localVec,
+                                  const PetscInt cell,
+                                  const int mark);
+
+            /** Set whether algebraic multigrid reuses interpolation when the matrix values change.
+             *
+             * Handles GAMG and ML preconditioners and descends into field splits, setting up the linear
+             * solver first so that the splits exist.
+             *
+             * @param[in] ksp PETSc linear solver.
+             * @param[in] value True if reusing interpolation, false otherwise.
+             * @returns True if the linear solver contains a GAMG or ML preconditioner, false otherwise.
+             */
+            static
+            bool setReuseInterpolation(PetscKSP ksp,
+                                       const bool value);
+
             static const char* pyreComponent;
         }; // _TimeDependent
 
@@ -53,6 +99,98 @@ public:
     } // problems
 } // pylith
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set values in closure of cell to 1.
+void
+pylith::problems::_TimeDependent::markClosure(PetscDM dm,
+                                              PetscVec localVec,
+                                              const PetscInt cell) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscScalar* closure = NULL;
+    PetscInt closureSize = 0;
+    PetscErrorCode err = DMPlexVecGetClosure(dm, NULL, localVec, cell, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    std::fill(closure, closure+closureSize, 1.0);
+    err = DMPlexVecSetClosure(dm, NULL, localVec, cell, closure, INSERT_ALL_VALUES);PYLITH_CHECK_ERROR(err);
+    err = DMPlexVecRestoreClosure(dm, NULL, localVec, cell, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // markClosure
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether any value in closure of cell matches mark.
+bool
+pylith::problems::_TimeDependent::hasMarkInClosure(PetscDM dm,
+                                                   PetscVec localVec,
+                                                   const PetscInt cell,
+                                                   const int mark) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscScalar* closure = NULL;
+    PetscInt closureSize = 0;
+    PetscErrorCode err = DMPlexVecGetClosure(dm, NULL, localVec, cell, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    bool hasMark = false;
+    for (PetscInt i = 0; i < closureSize && !hasMark; ++i) {
+        hasMark = int(PetscRealPart(closure[i]) + 0.5) == mark;
+    } // for
+    err = DMPlexVecRestoreClosure(dm, NULL, localVec, cell, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(hasMark);
+} // hasMarkInClosure
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set whether algebraic multigrid reuses interpolation when the matrix values change.
+bool
+pylith::problems::_TimeDependent::setReuseInterpolation(PetscKSP ksp,
+                                                        const bool value) {
+    PYLITH_METHOD_BEGIN;
+    assert(ksp);
+
+    bool hasMultigrid = false;
+    PetscPC pc = NULL;
+    PetscErrorCode err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+
+    PetscBool isGAMG = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCGAMG, &isGAMG);PYLITH_CHECK_ERROR(err);
+    if (isGAMG) {
+        err = PCGAMGSetReuseInterpolation(pc, value ? PETSC_TRUE : PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+        hasMultigrid = true;
+    } // if
+
+    // ML only reads the flag from the options database, so set the option for the prefix of the
+    // preconditioner and process the options again.
+    PetscBool isML = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCML, &isML);PYLITH_CHECK_ERROR(err);
+    if (isML) {
+        const char* prefix = NULL;
+        err = PCGetOptionsPrefix(pc, &prefix);PYLITH_CHECK_ERROR(err);
+        const std::string option = std::string("-") + (prefix ? prefix : "") + "pc_ml_reuse_interpolation";
+        err = PetscOptionsSetValue(NULL, option.c_str(), value ? "true" : "false");PYLITH_CHECK_ERROR(err);
+        err = PCSetFromOptions(pc);PYLITH_CHECK_ERROR(err);
+        hasMultigrid = true;
+    } // if
+
+    PetscBool isFieldSplit = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCFIELDSPLIT, &isFieldSplit);PYLITH_CHECK_ERROR(err);
+    if (isFieldSplit) {
+        // The splits are created when the field split preconditioner is setup. The preconditioners
+        // of the splits are setup when the splits are solved, so they still see the flag.
+        err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+        PetscKSP* subksp = NULL;
+        PetscInt numSplits = 0;
+        err = PCFieldSplitGetSubKSP(pc, &numSplits, &subksp);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numSplits; ++i) {
+            hasMultigrid = setReuseInterpolation(subksp[i], value) || hasMultigrid;
+        } // for
+        err = PetscFree(subksp);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(hasMultigrid);
+} // setReuseInterpolation
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Constructor
 pylith::problems::TimeDependent::TimeDependent(void) :
@@ -60,11 +198,28 @@ pylith::problems::TimeDependent::TimeDependent(void) :
     _endTime(0.0),
     _dtInitial(1.0),
     _maxTimeSteps(0),
+    _maxNonlinearFailures(0),
+    _numNonlinearFailures(0),
     _ts(NULL),
     _monitor(NULL),
     _needNewLHSJacobian(true),
     _haveNewLHSJacobian(false),
-    _shouldNotifyIC(false) {
+    _shouldNotifyIC(false),
+    _cacheLHSJacobian(true),
+    _jacobianLHSCached(NULL),
+    _precondLHSCached(NULL),
+    _adaptTimeStep(false),
+    _dtSafetyFactor(0.5),
+    _predictor(PREDICTOR_NONE),
+    _useLocalTimeStepping(false),
+    _dtStableLocalTimeStepping(PYLITH_MAXSCALAR),
+    _splitResidualVec(NULL),
+    _precomputeGeometry(false),
+    _multigridRebuildInterval(0),
+    _numMultigridSetups(0),
+    _reuseMultigridInterpolation(false),
+    _checkedMultigridReuse(false),
+    _mixedPrecisionSmoothers(false) {
     PyreComponent::setName(_TimeDependent::pyreComponent);
 
     _integrationData->setScalar(pylith::feassemble::IntegrationData::t_state, -HUGE_VAL);
@@ -92,6 +247,10 @@ pylith::problems::TimeDependent::deallocate(void) {
     _monitor = NULL; // Memory handle in Python. :TODO: Use shared pointer.
 
     PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_jacobianLHSCached);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_precondLHSCached);PYLITH_CHECK_ERROR(err);
+    clearPredictorHistory();
+    _destroyLocalTimeStepping();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -167,6 +326,24 @@ pylith::problems::TimeDependent::getMaxTimeSteps(void) const {
 } // getMaxTimeSteps
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set maximum number of failed nonlinear solves retried with a smaller time step.
+void
+pylith::problems::TimeDependent::setMaxNonlinearFailures(const int value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setMaxNonlinearFailures(value="<<value<<")");
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Maximum number of failed nonlinear solves for problem (" << value << ") must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _maxNonlinearFailures = value;
+
+    PYLITH_METHOD_END;
+} // setMaxNonlinearFailures
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set initial time step for problem.
 void
@@ -220,6 +397,127 @@ pylith::problems::TimeDependent::setShouldNotifyIC(const bool value) {
 } // setShouldNotifyIC
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for selecting time step from material relaxation times.
+void
+pylith::problems::TimeDependent::setAdaptTimeStep(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setAdaptTimeStep(value="<<value<<")");
+
+    _adaptTimeStep = value;
+} // setAdaptTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set safety factor for time step selected from material relaxation times.
+void
+pylith::problems::TimeDependent::setTimeStepSafetyFactor(const double value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setTimeStepSafetyFactor(value="<<value<<")");
+
+    if (value <= 0.0) {
+        std::ostringstream msg;
+        msg << "Time step safety factor (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _dtSafetyFactor = value;
+
+    PYLITH_METHOD_END;
+} // setTimeStepSafetyFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for multirate local time stepping in explicit dynamic problems.
+void
+pylith::problems::TimeDependent::setLocalTimeStepping(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setLocalTimeStepping(value="<<value<<")");
+
+    _useLocalTimeStepping = value;
+} // setLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for precomputing cell geometry for the RHS residual in explicit dynamic problems.
+void
+pylith::problems::TimeDependent::setPrecomputeGeometry(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setPrecomputeGeometry(value="<<value<<")");
+
+    _precomputeGeometry = value;
+} // setPrecomputeGeometry
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of new LHS Jacobians between full rebuilds of the algebraic multigrid hierarchy.
+void
+pylith::problems::TimeDependent::setMultigridRebuildInterval(const int value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setMultigridRebuildInterval(value="<<value<<")");
+
+    if (value < 0) {
+        std::ostringstream msg;
+        msg << "Number of new LHS Jacobians between rebuilds of multigrid hierarchy (" << value << ") must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _multigridRebuildInterval = value;
+
+    PYLITH_METHOD_END;
+} // setMultigridRebuildInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for applying Jacobi and SOR smoothers with a single precision copy of the matrix.
+void
+pylith::problems::TimeDependent::setMixedPrecisionSmoothers(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setMixedPrecisionSmoothers(value="<<value<<")");
+
+    _mixedPrecisionSmoothers = value;
+} // setMixedPrecisionSmoothers
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for caching constant contributions to the LHS Jacobian.
+void
+pylith::problems::TimeDependent::setCacheLHSJacobian(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setCacheLHSJacobian(value="<<value<<")");
+
+    _cacheLHSJacobian = value;
+} // setCacheLHSJacobian
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set predictor for initial guess of nonlinear solve in implicit time steps.
+void
+pylith::problems::TimeDependent::setPredictor(const PredictorEnum value) {
+    PYLITH_COMPONENT_DEBUG("setPredictor(value="<<value<<")");
+
+    _predictor = value;
+} // setPredictor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get predictor for initial guess of nonlinear solve in implicit time steps.
+pylith::problems::TimeDependent::PredictorEnum
+pylith::problems::TimeDependent::getPredictor(void) const {
+    return _predictor;
+} // getPredictor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Clear history of solutions used by the predictor.
+void
+pylith::problems::TimeDependent::clearPredictorHistory(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("clearPredictorHistory()");
+
+    for (size_t i = 0; i < _predictorSolns.size(); ++i) {
+        PetscErrorCode err = VecDestroy(&_predictorSolns[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _predictorSolns.clear();
+    _predictorTimes.clear();
+
+    PYLITH_METHOD_END;
+} // clearPredictorHistory
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set progress monitor.
 void
@@ -335,6 +633,9 @@ pylith::problems::TimeDependent::initialize(void) {
     err = TSSetTimeStep(_ts, _dtInitial / timeScale);PYLITH_CHECK_ERROR(err);
     err = TSSetMaxSteps(_ts, _maxTimeSteps);PYLITH_CHECK_ERROR(err);
     err = TSSetMaxTime(_ts, _endTime / timeScale);PYLITH_CHECK_ERROR(err);
+    // Reject time steps with failed nonlinear solves and retry with a smaller time step. PETSc
+    // counts the failure that terminates time stepping, so it allows one more failure than retries.
+    err = TSSetMaxSNESFailures(_ts, _maxNonlinearFailures+1);PYLITH_CHECK_ERROR(err);
     err = TSSetDM(_ts, solution->getDM());PYLITH_CHECK_ERROR(err);
 
     // Set initial solution.
@@ -365,16 +666,20 @@ pylith::problems::TimeDependent::initialize(void) {
     PYLITH_COMPONENT_DEBUG("Setting PetscTS callback for poststep().");
     err = TSSetPostStep(_ts, poststep);PYLITH_CHECK_ERROR(err);
 
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
     switch (_formulation) {
     case pylith::problems::Physics::QUASISTATIC:
         PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks computeIFunction() and computeIJacobian().");
+        _createJacobianMatrices(&jacobianMat, &precondMat);
         err = TSSetIFunction(_ts, NULL, computeLHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-        err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        err = TSSetIJacobian(_ts, jacobianMat, precondMat, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
         break;
     case pylith::problems::Physics::DYNAMIC_IMEX:
         PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks computeLHSJacobian() and computeLHSFunction().");
+        _createJacobianMatrices(&jacobianMat, &precondMat);
         err = TSSetIFunction(_ts, NULL, computeLHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-        err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        err = TSSetIJacobian(_ts, jacobianMat, precondMat, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
         err = TSSetEquationType(_ts, TS_EQ_EXPLICIT);PYLITH_CHECK_ERROR(err);
         pylith::faults::FaultOps::createDAEMassWeighting(_integrationData);
     case pylith::problems::Physics::DYNAMIC: {
@@ -392,9 +697,48 @@ pylith::problems::TimeDependent::initialize(void) {
         PYLITH_COMPONENT_LOGICERROR("Unknown time stepping formulation '" << _formulation << "'.");
     } // default
     } // switch
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&precondMat);PYLITH_CHECK_ERROR(err);
+
+    if (_useLocalTimeStepping) {
+        if (pylith::problems::Physics::DYNAMIC != _formulation) {
+            std::ostringstream msg;
+            msg << "Local time stepping is only supported for the dynamic formulation without faults.";
+            throw std::runtime_error(msg.str());
+        } // if
+        _setupLocalTimeStepping();
+    } // if
+
+    if (_precomputeGeometry) {
+        if (pylith::problems::Physics::QUASISTATIC == _formulation) {
+            std::ostringstream msg;
+            msg << "Precomputing cell geometry is only supported for the dynamic formulations.";
+            throw std::runtime_error(msg.str());
+        } // if
+        for (size_t i = 0; i < _integrators.size(); ++i) {
+            _integrators[i]->precomputeResidualGeometry();
+        } // for
+    } // if
 
     pylith::utils::PetscDefaults::set(*solution, _materials[0], _petscDefaults);
     err = TSSetFromOptions(_ts);PYLITH_CHECK_ERROR(err);
+    if (_maxNonlinearFailures > 0) {
+        // Let TS reject the step and retry with a smaller time step instead of erroring out in SNES.
+        err = SNESSetErrorIfNotConverged(getPetscSNES(), PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_mixedPrecisionSmoothers || (_multigridRebuildInterval > 0)) {
+        PYLITH_COMPONENT_DEBUG("Setting PetscKSP callback for presolve().");
+        PetscKSP ksp = NULL;
+        err = SNESGetKSP(getPetscSNES(), &ksp);PYLITH_CHECK_ERROR(err);
+        err = KSPSetPreSolve(ksp, presolve, (void*)this);PYLITH_CHECK_ERROR(err);
+    } // if
+    if ((pylith::problems::Physics::QUASISTATIC == _formulation) && (_predictor != PREDICTOR_NONE)) {
+        PYLITH_COMPONENT_DEBUG("Setting PetscSNES callback for computePredictor().");
+        err = SNESSetComputeInitialGuess(getPetscSNES(), computePredictor, (void*)this);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (_adaptTimeStep) {
+        _updateTimeStep(true);
+    } // if
     err = TSSetUp(_ts);PYLITH_CHECK_ERROR(err);
 
 #if 0
@@ -438,6 +782,16 @@ pylith::problems::TimeDependent::solve(void) {
 
     PetscErrorCode err = TSSolve(_ts, NULL);PYLITH_CHECK_ERROR(err);
 
+    _logLHSJacobianStats();
+
+    TSConvergedReason reason = TS_CONVERGED_ITERATING;
+    err = TSGetConvergedReason(_ts, &reason);PYLITH_CHECK_ERROR(err);
+    if (reason < 0) {
+        std::ostringstream msg;
+        msg << "Time stepping failed (" << TSConvergedReasons[reason] << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
     PYLITH_METHOD_END;
 } // solve
 
@@ -465,12 +819,34 @@ pylith::problems::TimeDependent::poststep(void) {
     solution->scatterVectorToLocal(solutionVec);
     solution->scatterLocalToOutput();
 
+    if ((pylith::problems::Physics::QUASISTATIC == _formulation) && (_predictor != PREDICTOR_NONE)) {
+        _addPredictorHistory(t, solutionVec);
+    } // if
+
     // Update integrators.
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
         _integrators[i]->poststep(t, tindex, dt, *solution);
     } // for
 
+    // Restore the time step after a time step that succeeded only after retrying with a smaller time
+    // step. With adaptive time stepping, _updateTimeStep() grows the time step back instead.
+    PylithInt numNonlinearFailures = 0;
+    err = TSGetSNESFailures(_ts, &numNonlinearFailures);PYLITH_CHECK_ERROR(err);
+    if (numNonlinearFailures > _numNonlinearFailures) {
+        _numNonlinearFailures = numNonlinearFailures;
+        if (!_adaptTimeStep) {
+            assert(_normalizer);
+            err = TSSetTimeStep(_ts, _dtInitial / _normalizer->getTimeScale());PYLITH_CHECK_ERROR(err);
+        } // if
+    } // if
+
+    // Update time step using state variables at end of time step. The stable time step for explicit
+    // time stepping depends only on the elastic properties, so it does not change.
+    if ((pylith::problems::Physics::QUASISTATIC == _formulation) && _adaptTimeStep) {
+        _updateTimeStep(false);
+    } // if
+
     // Update constraints.
     const size_t numConstraints = _constraints.size();
     for (size_t i = 0; i < numConstraints; ++i) {
@@ -552,11 +928,17 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscVec residualVec,
     // Sum residual contributions across integrators.
     pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
     residual->zeroLocal();
+    pylith::fekernels::KernelStatus::reset();
     const size_t numIntegrators = _integrators.size();
     assert(numIntegrators > 0); // must have at least 1 integrator
+    pylith::utils::TimerTree::begin("computeRHSResidual");
     for (size_t i = 0; i < numIntegrators; ++i) {
+        pylith::utils::TimerTree::begin(_integrators[i]->getPhysicsIdentifier());
         _integrators[i]->computeRHSResidual(residual, *_integrationData);
+        pylith::utils::TimerTree::end();
     } // for
+    pylith::utils::TimerTree::end();
+    _checkKernelFailure(RHS_RESIDUAL);
 
     // Assemble residual values across processes.
     PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
@@ -605,11 +987,17 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
     // Sum residual across integrators.
     pylith::topology::Field* residual = _integrationData->getField(pylith::feassemble::IntegrationData::residual);assert(residual);
     residual->zeroLocal();
+    pylith::fekernels::KernelStatus::reset();
     const int numIntegrators = _integrators.size();
     assert(numIntegrators > 0); // must have at least 1 integrator
+    pylith::utils::TimerTree::begin("computeLHSResidual");
     for (int i = 0; i < numIntegrators; ++i) {
+        pylith::utils::TimerTree::begin(_integrators[i]->getPhysicsIdentifier());
         _integrators[i]->computeLHSResidual(residual, *_integrationData);
+        pylith::utils::TimerTree::end();
     } // for
+    pylith::utils::TimerTree::end();
+    _checkKernelFailure(LHS_RESIDUAL);
 
     // Assemble residual values across processes.
     PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
@@ -647,40 +1035,110 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
     assert(solutionDotVec);
     assert(s_tshift > 0);
 
+    const size_t numIntegrators = _integrators.size();
+    if (_numLHSJacobianAssembled.size() != numIntegrators) {
+        _numLHSJacobianAssembled.assign(numIntegrators, 0);
+        _numLHSJacobianReused.assign(numIntegrators, 0);
+    } // if
+
     if (!_needNewJacobian(dt)) {
         PYLITH_COMPONENT_DEBUG("KEEP LHS Jacobian; t=" << t << ", dt=" << dt);
         _haveNewLHSJacobian = false;
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            ++_numLHSJacobianReused[i];
+        } // for
         PYLITH_METHOD_END;
     } // if
     PYLITH_COMPONENT_DEBUG("NEW LHS Jacobian; t=" << t << ", dt=" << dt);
 
     assert(_integrationData);
     const pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);assert(solution);
+    const bool dtChanged = dt != _integrationData->getScalar(pylith::feassemble::IntegrationData::dt_jacobian);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time, t);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::time_step, dt);
     _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, s_tshift);
 
     // Zero LHS Jacobian
     PetscErrorCode err = 0;
-    PetscDS solnDS = NULL;
-    PetscBool hasJacobian = PETSC_FALSE;
-    err = DMGetDS(solution->getDM(), &solnDS);PYLITH_CHECK_ERROR(err);
-    err = PetscDSHasJacobian(solnDS, &hasJacobian);PYLITH_CHECK_ERROR(err);
+    bool hasJacobian = false;
+    _hasJacobianKernels(solution->getDM(), &hasJacobian, NULL);
     if (hasJacobian) { err = MatZeroEntries(jacobianMat);PYLITH_CHECK_ERROR(err); }
     err = MatZeroEntries(precondMat);PYLITH_CHECK_ERROR(err);
 
     // Update PyLith view of the solution.
     setSolutionLocal(t, solutionVec, solutionDotVec);
 
-    // Sum Jacobian contributions across integrators.
-    const size_t numIntegrators = _integrators.size();
+    pylith::fekernels::KernelStatus::reset();
+
+    // Use cache of constant contributions only if we have a mix of constant and changing contributions.
+    const bool separateJacobian = hasJacobian && jacobianMat != precondMat;
+    size_t numCacheable = 0;
+    bool needNewCache = !_precondLHSCached || (separateJacobian && !_jacobianLHSCached);
     for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        if (_isLHSJacobianCacheable(*_integrators[i])) {
+            ++numCacheable;
+            needNewCache = _integrators[i]->needNewLHSJacobian(dtChanged) || needNewCache;
+        } // if
+    } // for
+    const bool useCache = _cacheLHSJacobian && numCacheable > 0 && numCacheable < numIntegrators;
+
+    pylith::utils::TimerTree::begin("computeLHSJacobian");
+
+    if (useCache && needNewCache) {
+        // Assemble constant contributions and save them in the cache.
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            if (_isLHSJacobianCacheable(*_integrators[i])) {
+                pylith::utils::TimerTree::begin(_integrators[i]->getPhysicsIdentifier());
+                _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, *_integrationData);
+                pylith::utils::TimerTree::end();
+                ++_numLHSJacobianAssembled[i];
+            } // if
+        } // for
+        if (separateJacobian) {
+            err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+            err = MatAssemblyEnd(jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+            if (!_jacobianLHSCached) {
+                err = MatDuplicate(jacobianMat, MAT_COPY_VALUES, &_jacobianLHSCached);PYLITH_CHECK_ERROR(err);
+            } else {
+                err = MatCopy(jacobianMat, _jacobianLHSCached, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+            } // if/else
+        } // if
+        err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+        err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+        if (!_precondLHSCached) {
+            err = MatDuplicate(precondMat, MAT_COPY_VALUES, &_precondLHSCached);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = MatCopy(precondMat, _precondLHSCached, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+        } // if/else
+    } // if
+
+    // Sum Jacobian contributions across integrators, skipping contributions already in the cache.
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        if (useCache && _isLHSJacobianCacheable(*_integrators[i])) {
+            if (!needNewCache) {
+                ++_numLHSJacobianReused[i];
+            } // if
+            continue;
+        } // if
+        pylith::utils::TimerTree::begin(_integrators[i]->getPhysicsIdentifier());
         _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, *_integrationData);
+        pylith::utils::TimerTree::end();
+        ++_numLHSJacobianAssembled[i];
     } // for
+    pylith::utils::TimerTree::end();
 
     _needNewLHSJacobian = false;
     _haveNewLHSJacobian = true;
 
+    // The preconditioner is setup with the new LHS Jacobian in the next linear solve, and presolve()
+    // passes the flag to the preconditioner. Keep the multigrid interpolation except every
+    // _multigridRebuildInterval setups, when we rebuild it from scratch.
+    if (_multigridRebuildInterval > 0) {
+        _reuseMultigridInterpolation = 0 != _numMultigridSetups % _multigridRebuildInterval;
+        ++_numMultigridSetups;
+    } // if
+
     _integrationData->setScalar(pylith::feassemble::IntegrationData::dt_jacobian, dt);
 
     // Assemble matrices
@@ -691,6 +1149,20 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
     err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);
     err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);
 
+    // Add cached constant contributions; the cache shares the nonzero pattern of the LHS Jacobian.
+    if (useCache && !needNewCache) {
+        if (separateJacobian) {
+            assert(_jacobianLHSCached);
+            err = MatAXPY(jacobianMat, 1.0, _jacobianLHSCached, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+        } // if
+        assert(_precondLHSCached);
+        err = MatAXPY(precondMat, 1.0, _precondLHSCached, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    _updateFaultSchurPreconditioner(getPetscSNES(), precondMat);
+
+    _checkKernelFailure(LHS_JACOBIAN);
+
     PYLITH_METHOD_END;
 } // computeLHSJacobian
 
@@ -734,9 +1206,13 @@ pylith::problems::TimeDependent::computeLHSJacobianLumpedInv(const PylithReal t,
     _integrationData->setScalar(pylith::feassemble::IntegrationData::s_tshift, s_tshift);
 
     // Sum Jacobian contributions across integrators.
+    pylith::utils::TimerTree::begin("computeLHSJacobianLumpedInv");
     for (size_t i = 0; i < numIntegrators; ++i) {
+        pylith::utils::TimerTree::begin(_integrators[i]->getPhysicsIdentifier());
         _integrators[i]->computeLHSJacobianLumpedInv(jacobianLumpedInv, *_integrationData);
+        pylith::utils::TimerTree::end();
     } // for
+    pylith::utils::TimerTree::end();
 
     // Insert values into global vector.
     jacobianLumpedInv->scatterLocalToVector(jacobianLumpedInv->getGlobalVector());
@@ -842,6 +1318,620 @@ pylith::problems::TimeDependent::poststep(PetscTS ts) {
 } // poststep
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing initial guess for nonlinear solve.
+PetscErrorCode
+pylith::problems::TimeDependent::computePredictor(PetscSNES snes,
+                                                  PetscVec solutionVec,
+                                                  void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computePredictor(snes="<<snes<<", solutionVec="<<solutionVec<<", context="<<context<<")"
+          << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_predict(solutionVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computePredictor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for operations before each linear solve.
+PetscErrorCode
+pylith::problems::TimeDependent::presolve(PetscKSP ksp,
+                                          PetscVec rhsVec,
+                                          PetscVec solutionVec,
+                                          void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "presolve(ksp="<<ksp<<", rhsVec="<<rhsVec<<", solutionVec="<<solutionVec<<", context="<<context<<")"
+          << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    if (problem->_multigridRebuildInterval > 0) {
+        const bool hasMultigrid = _TimeDependent::setReuseInterpolation(ksp, problem->_reuseMultigridInterpolation);
+        if (!hasMultigrid && !problem->_checkedMultigridReuse) {
+            pythia::journal::warning_t warning(_TimeDependent::pyreComponent);
+            warning << pythia::journal::at(__HERE__)
+                    << "Multigrid rebuild interval is " << problem->_multigridRebuildInterval
+                    << ", but the linear solver does not use a GAMG or ML preconditioner. Ignoring the rebuild interval."
+                    << pythia::journal::endl;
+        } // if
+        problem->_checkedMultigridReuse = true;
+    } // if
+    if (problem->_mixedPrecisionSmoothers) {
+        PetscErrorCode err = pylith::problems::SinglePrecisionSmoother::presolve(ksp, rhsVec, solutionVec, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_RETURN(0);
+} // presolve
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for RHS, G(t,s), for slow split.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualSlow(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeRHSResidualSlow(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_computeRHSResidualSplit(SPLIT_SLOW, t, solutionVec, residualVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualSlow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for RHS, G(t,s), for slow buffer split.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualSlowBuffer(PetscTS ts,
+                                                              PetscReal t,
+                                                              PetscVec solutionVec,
+                                                              PetscVec residualVec,
+                                                              void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeRHSResidualSlowBuffer(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_computeRHSResidualSplit(SPLIT_SLOWBUFFER, t, solutionVec, residualVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualSlowBuffer
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for RHS, G(t,s), for fast split.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualFast(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeRHSResidualFast(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_computeRHSResidualSplit(SPLIT_FAST, t, solutionVec, residualVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualFast
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute stable time step for implicit time stepping from the materials.
+PylithReal
+pylith::problems::TimeDependent::_computeStableTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PylithReal dtStableLocal = PYLITH_MAXSCALAR;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        dtStableLocal = std::min(dtStableLocal, _integrators[i]->computeStableTimeStep());
+    } // for
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    err = PetscObjectGetComm((PetscObject)_ts, &comm);PYLITH_CHECK_ERROR(err);
+    PylithReal dtStable = PYLITH_MAXSCALAR;
+    err = MPI_Allreduce(&dtStableLocal, &dtStable, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(dtStable);
+} // _computeStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute stable time step for explicit time stepping from the materials.
+PylithReal
+pylith::problems::TimeDependent::_computeStableTimeStepExplicit(PylithReal location[3]) {
+    PYLITH_METHOD_BEGIN;
+
+    PylithReal dtStableLocal = PYLITH_MAXSCALAR;
+    PylithReal locationLocal[3] = { 0.0, 0.0, 0.0 };
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        PylithReal locationIntegrator[3] = { 0.0, 0.0, 0.0 };
+        const PylithReal dt = _integrators[i]->computeStableTimeStepExplicit(locationIntegrator);
+        if (dt < dtStableLocal) {
+            dtStableLocal = dt;
+            for (int iDim = 0; iDim < 3; ++iDim) {
+                locationLocal[iDim] = locationIntegrator[iDim];
+            } // for
+        } // if
+    } // for
+
+    // Find process with the smallest stable time step and get location of limiting cell from it. We
+    // reduce the time step and the rank separately (lowest rank wins ties), so the reduction works
+    // with any precision of PylithReal.
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    err = PetscObjectGetComm((PetscObject)_ts, &comm);PYLITH_CHECK_ERROR(err);
+    int rank = 0, numProcs = 1;
+    err = MPI_Comm_rank(comm, &rank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &numProcs);PYLITH_CHECK_ERROR(err);
+    PylithReal dtStable = PYLITH_MAXSCALAR;
+    err = MPI_Allreduce(&dtStableLocal, &dtStable, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    const int rankCandidate = (dtStableLocal == dtStable) ? rank : numProcs;
+    int rankStable = 0;
+    err = MPI_Allreduce(&rankCandidate, &rankStable, 1, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    for (int i = 0; i < 3; ++i) {
+        location[i] = locationLocal[i];
+    } // for
+    err = MPI_Bcast(location, 3, MPIU_REAL, rankStable, comm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(dtStable);
+} // _computeStableTimeStepExplicit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Limit time step using stable time step from the materials.
+void
+pylith::problems::TimeDependent::_updateTimeStep(const bool isInitial) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_updateTimeStep(isInitial="<<isInitial<<")");
+
+    const bool isExplicit = pylith::problems::Physics::QUASISTATIC != _formulation;
+    PylithReal location[3] = { 0.0, 0.0, 0.0 };
+    PylithReal dtStable = (isExplicit) ? _computeStableTimeStepExplicit(location) : _computeStableTimeStep();
+    if (_useLocalTimeStepping) {
+        // Fast degrees of freedom take 2 steps for each step of the slow ones.
+        dtStable = _dtStableLocalTimeStepping;
+    } // if
+    if (dtStable >= PYLITH_MAXSCALAR) {
+        PYLITH_METHOD_END;
+    } // if
+    const PylithReal dtMax = _dtSafetyFactor * dtStable;
+
+    // Limit time steps chosen by TSAdapt (if the user selects an adaptive time stepper).
+    PetscErrorCode err = 0;
+    TSAdapt adapt = NULL;
+    err = TSGetAdapt(_ts, &adapt);PYLITH_CHECK_ERROR(err);
+    err = TSAdaptSetStepLimits(adapt, PETSC_DEFAULT, dtMax);PYLITH_CHECK_ERROR(err);
+
+    assert(_normalizer);
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    PylithReal dt = 0.0;
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    const PylithReal dtNew = _computeTimeStep(dt, dtMax, _dtInitial / timeScale, isInitial, isExplicit);
+    if (dtNew != dt) {
+        err = TSSetTimeStep(_ts, dtNew);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_COMPONENT_DEBUG("Stable time step="<<dtStable*timeScale<<", time step="<<dtNew*timeScale<<".");
+    if (isInitial && isExplicit) {
+        const PylithReal lengthScale = _normalizer->getLengthScale();
+        const int spaceDim = _integrationData->getField(pylith::feassemble::IntegrationData::solution)->getSpaceDim();
+        std::ostringstream coords;
+        for (int i = 0; i < spaceDim; ++i) {
+            coords << (i > 0 ? ", " : "") << location[i]*lengthScale;
+        } // for
+        PYLITH_COMPONENT_INFO_ROOT("Stable time step from CFL condition"
+                                   << (_useLocalTimeStepping ? " with local time stepping" : "")
+                                   << " is " << dtStable*timeScale
+                                                                             << ", limited by cell with centroid (" << coords.str() << ")"
+                                                                             << "; setting time step to " << dtNew*timeScale << ".");
+    } else if (isInitial) {
+        PYLITH_COMPONENT_INFO_ROOT("Stable time step from materials is " << dtStable*timeScale
+                                                                         << "; limiting time step to " << dtMax*timeScale << ".");
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // _updateTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute time step limited by stable time step.
+PylithReal
+pylith::problems::TimeDependent::_computeTimeStep(const PylithReal dt,
+                                                  const PylithReal dtMax,
+                                                  const PylithReal dtUser,
+                                                  const bool isInitial,
+                                                  const bool isExplicit) {
+    // For explicit time stepping, we use the stable time step (Courant factor times CFL time step)
+    // since it is the most efficient one. For implicit time stepping, the time step is never larger
+    // than the one specified by the user. After reducing the time step (larger stable time step or
+    // failed nonlinear solve), we let it grow back by at most a factor of 2 per time step.
+    PylithReal dtNew = dtMax;
+    if (!isExplicit) {
+        dtNew = (isInitial) ? std::min(dt, dtMax) : std::min(std::min(2.0*dt, dtUser), dtMax);
+    } // if
+
+    return dtNew;
+} // _computeTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Add solution to history used by predictor.
+void
+pylith::problems::TimeDependent::_addPredictorHistory(const PylithReal t,
+                                                      PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_addPredictorHistory(t="<<t<<", solutionVec="<<solutionVec<<")");
+
+    assert(_predictorSolns.size() == _predictorTimes.size());
+    PetscErrorCode err;
+
+    // Reuse the vector of the oldest solution once the history is full.
+    const size_t historySize = _getPredictorHistorySize(_predictor);
+    if (!historySize) {
+        PYLITH_METHOD_END;
+    } // if
+    if (_predictorSolns.size() < historySize) {
+        PetscVec vec = NULL;
+        err = VecDuplicate(solutionVec, &vec);PYLITH_CHECK_ERROR(err);
+        _predictorSolns.push_back(vec);
+        _predictorTimes.push_back(t);
+    } // if
+    std::rotate(_predictorSolns.rbegin(), _predictorSolns.rbegin()+1, _predictorSolns.rend());
+    std::rotate(_predictorTimes.rbegin(), _predictorTimes.rbegin()+1, _predictorTimes.rend());
+
+    err = VecCopy(solutionVec, _predictorSolns[0]);PYLITH_CHECK_ERROR(err);
+    _predictorTimes[0] = t;
+
+    PYLITH_METHOD_END;
+} // _addPredictorHistory
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Extrapolate solution in time from history.
+void
+pylith::problems::TimeDependent::_predict(PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_predict(solutionVec="<<solutionVec<<")");
+
+    PetscErrorCode err;
+    PylithReal t = 0.0, dt = 0.0;
+    err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+
+    // Only extrapolate from a history that ends at the start of the current time step. Otherwise (no
+    // history yet or history cleared), start from the previous solution.
+    const size_t numSolns = _predictorSolns.size();
+    if ((numSolns < 2) || (fabs(_predictorTimes[0] - t) > 1.0e-10*fabs(dt))) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Lagrange interpolating polynomial through the previous solutions evaluated at t+dt. We use the
+    // target time from the time stepper, so retries with a smaller time step extrapolate correctly.
+    const PylithReal tPredict = t + dt;
+    const size_t numPoints = std::min(numSolns, _getPredictorHistorySize(_predictor));
+    const std::vector<PylithReal> times(_predictorTimes.begin(), _predictorTimes.begin()+numPoints);
+    std::vector<PylithReal> weightsReal;
+    _computePredictorWeights(&weightsReal, times, tPredict);
+    const std::vector<PetscScalar> weights(weightsReal.begin(), weightsReal.end());
+
+    err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecMAXPY(solutionVec, numPoints, &weights[0], &_predictorSolns[0]);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _predict
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of previous solutions used by predictor.
+size_t
+pylith::problems::TimeDependent::_getPredictorHistorySize(const PredictorEnum predictor) {
+    size_t historySize = 0;
+    switch (predictor) {
+    case PREDICTOR_NONE:
+        historySize = 0;
+        break;
+    case PREDICTOR_LINEAR:
+        historySize = 2;
+        break;
+    case PREDICTOR_QUADRATIC:
+        historySize = 3;
+        break;
+    default: {
+        std::ostringstream msg;
+        msg << "Unknown predictor type (" << predictor << ").";
+        throw std::logic_error(msg.str());
+    } // default
+    } // switch
+
+    return historySize;
+} // _getPredictorHistorySize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute weights of Lagrange interpolating polynomial through previous solutions.
+void
+pylith::problems::TimeDependent::_computePredictorWeights(std::vector<PylithReal>* weights,
+                                                          const std::vector<PylithReal>& times,
+                                                          const PylithReal tPredict) {
+    assert(weights);
+
+    const size_t numPoints = times.size();
+    weights->resize(numPoints);
+    for (size_t k = 0; k < numPoints; ++k) {
+        PylithReal w = 1.0;
+        for (size_t j = 0; j < numPoints; ++j) {
+            if (j == k) { continue; }
+            w *= (tPredict - times[j]) / (times[k] - times[j]);
+        } // for
+        (*weights)[k] = w;
+    } // for
+} // _computePredictorWeights
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup splits of degrees of freedom and cells for multirate local time stepping.
+void
+pylith::problems::TimeDependent::_setupLocalTimeStepping(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupLocalTimeStepping()");
+
+    _destroyLocalTimeStepping();
+
+    assert(_integrationData);
+    pylith::topology::Field* solution = _integrationData->getField(pylith::feassemble::IntegrationData::solution);
+    assert(solution);
+    PetscDM dmSoln = solution->getDM();
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    err = PetscObjectGetComm((PetscObject)_ts, &comm);PYLITH_CHECK_ERROR(err);
+
+    // Get stable time step for each cell from the materials.
+    std::vector<PylithInt> cells;
+    std::vector<PylithReal> dtCells;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        std::vector<PylithInt> cellsIntegrator;
+        std::vector<PylithReal> dtCellsIntegrator;
+        _integrators[i]->computeStableTimeStepsExplicit(&cellsIntegrator, &dtCellsIntegrator);
+        cells.insert(cells.end(), cellsIntegrator.begin(), cellsIntegrator.end());
+        dtCells.insert(dtCells.end(), dtCellsIntegrator.begin(), dtCellsIntegrator.end());
+    } // for
+    const size_t numCells = cells.size();
+    assert(dtCells.size() == numCells);
+    PylithReal dtMinLocal = PYLITH_MAXSCALAR;
+    for (size_t i = 0; i < numCells; ++i) {
+        dtMinLocal = std::min(dtMinLocal, dtCells[i]);
+    } // for
+    PylithReal dtMin = PYLITH_MAXSCALAR;
+    err = MPI_Allreduce(&dtMinLocal, &dtMin, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    if (dtMin >= PYLITH_MAXSCALAR) {
+        throw std::runtime_error("Local time stepping requires materials with a stable time step for explicit time stepping.");
+    } // if
+
+    // Group cells into rate classes, k = floor(log2(dt/dtMin)), and report the histogram. PETSc MPRK
+    // supports a time step ratio of 2, so cells in class 0 are fast and all other cells are slow.
+    const int maxClasses = 16;
+    std::vector<PylithInt> classCountsLocal(maxClasses, 0);
+    PylithReal dtSlowLocal = PYLITH_MAXSCALAR;
+    for (size_t i = 0; i < numCells; ++i) {
+        const int k = std::min(int(floor(log2(dtCells[i] / dtMin))), maxClasses-1);
+        classCountsLocal[k] += 1;
+        if (k > 0) {
+            dtSlowLocal = std::min(dtSlowLocal, dtCells[i]);
+        } // if
+    } // for
+    std::vector<PylithInt> classCounts(maxClasses, 0);
+    err = MPI_Allreduce(&classCountsLocal[0], &classCounts[0], maxClasses, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    PylithReal dtSlow = PYLITH_MAXSCALAR;
+    err = MPI_Allreduce(&dtSlowLocal, &dtSlow, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    _dtStableLocalTimeStepping = std::min(2.0*dtMin, dtSlow);
+
+    assert(_normalizer);
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    std::ostringstream histogram;
+    for (int k = 0; k < maxClasses; ++k) {
+        if (classCounts[k] > 0) {
+            histogram << "\n    stable time step in [" << pow(2.0, k)*dtMin*timeScale << ", " << pow(2.0, k+1)*dtMin*timeScale
+                      << "): " << classCounts[k] << " cells";
+        } // if
+    } // for
+    PYLITH_COMPONENT_INFO_ROOT("Rate classes of cells for local time stepping:" << histogram.str());
+
+    // Mark degrees of freedom in the closure of fast cells. Constrained degrees of freedom are
+    // dropped when we add the local values into the global vector.
+    PetscVec markLocalVec = NULL, fastGlobalVec = NULL, bufferGlobalVec = NULL;
+    err = DMGetLocalVector(dmSoln, &markLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalVector(dmSoln, &fastGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalVector(dmSoln, &bufferGlobalVec);PYLITH_CHECK_ERROR(err);
+    std::vector<bool> isFastCell(numCells, false);
+    for (size_t i = 0; i < numCells; ++i) {
+        isFastCell[i] = dtCells[i] < 2.0*dtMin;
+    } // for
+    err = VecSet(markLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < numCells; ++i) {
+        if (isFastCell[i]) {
+            _TimeDependent::markClosure(dmSoln, markLocalVec, cells[i]);
+        } // if
+    } // for
+    err = VecSet(fastGlobalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmSoln, markLocalVec, ADD_VALUES, fastGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmSoln, markLocalVec, ADD_VALUES, fastGlobalVec);PYLITH_CHECK_ERROR(err);
+    PetscInt ownerStart = 0, ownerEnd = 0;
+    err = VecGetOwnershipRange(fastGlobalVec, &ownerStart, &ownerEnd);PYLITH_CHECK_ERROR(err);
+    PetscScalar* fastArray = NULL;
+    err = VecGetArray(fastGlobalVec, &fastArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < ownerEnd-ownerStart; ++i) {
+        fastArray[i] = (PetscRealPart(fastArray[i]) > 0.0) ? 1.0 : 0.0;
+    } // for
+    err = VecRestoreArray(fastGlobalVec, &fastArray);PYLITH_CHECK_ERROR(err);
+
+    // Slow cells that share degrees of freedom with fast cells form the buffer.
+    err = DMGlobalToLocalBegin(dmSoln, fastGlobalVec, INSERT_VALUES, markLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, fastGlobalVec, INSERT_VALUES, markLocalVec);PYLITH_CHECK_ERROR(err);
+    std::vector<PylithInt> bufferCells;
+    for (size_t i = 0; i < numCells; ++i) {
+        if (!isFastCell[i] && _TimeDependent::hasMarkInClosure(dmSoln, markLocalVec, cells[i], 1)) {
+            bufferCells.push_back(cells[i]);
+        } // if
+    } // for
+    err = VecSet(markLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    for (size_t i = 0; i < bufferCells.size(); ++i) {
+        _TimeDependent::markClosure(dmSoln, markLocalVec, bufferCells[i]);
+    } // for
+    err = VecSet(bufferGlobalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalBegin(dmSoln, markLocalVec, ADD_VALUES, bufferGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMLocalToGlobalEnd(dmSoln, markLocalVec, ADD_VALUES, bufferGlobalVec);PYLITH_CHECK_ERROR(err);
+
+    // Assign each degree of freedom to a split. We store the split (plus 1) in the global vector
+    // for fast degrees of freedom, so we can find the cells contributing to each split.
+    std::vector<std::vector<PetscInt> > splitIndices(NUM_SPLITS);
+    const PetscScalar* bufferArray = NULL;
+    err = VecGetArray(fastGlobalVec, &fastArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(bufferGlobalVec, &bufferArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < ownerEnd-ownerStart; ++i) {
+        const RHSSplitEnum split = (PetscRealPart(fastArray[i]) > 0.0) ? SPLIT_FAST :
+                                   (PetscRealPart(bufferArray[i]) > 0.0) ? SPLIT_SLOWBUFFER : SPLIT_SLOW;
+        splitIndices[split].push_back(ownerStart+i);
+        fastArray[i] = split + 1;
+    } // for
+    err = VecRestoreArrayRead(bufferGlobalVec, &bufferArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArray(fastGlobalVec, &fastArray);PYLITH_CHECK_ERROR(err);
+
+    _splitDofs.resize(NUM_SPLITS);
+    PylithInt splitSizesLocal[NUM_SPLITS];
+    for (int iSplit = 0; iSplit < NUM_SPLITS; ++iSplit) {
+        _splitDofs[iSplit] = NULL;
+        const PetscInt* indices = (splitIndices[iSplit].size() > 0) ? &splitIndices[iSplit][0] : NULL;
+        err = ISCreateGeneral(comm, splitIndices[iSplit].size(), indices, PETSC_COPY_VALUES, &_splitDofs[iSplit]);PYLITH_CHECK_ERROR(err);
+        splitSizesLocal[iSplit] = splitIndices[iSplit].size();
+    } // for
+    PylithInt splitSizes[NUM_SPLITS];
+    err = MPI_Allreduce(splitSizesLocal, splitSizes, NUM_SPLITS, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    PYLITH_COMPONENT_INFO_ROOT("Local time stepping with " << splitSizes[SPLIT_FAST] << " fast, "
+                                                           << splitSizes[SPLIT_SLOWBUFFER] << " slow buffer, and "
+                                                           << splitSizes[SPLIT_SLOW] << " slow degrees of freedom.");
+
+    // Residual for each split only needs cells with degrees of freedom in the split.
+    err = DMGlobalToLocalBegin(dmSoln, fastGlobalVec, INSERT_VALUES, markLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, fastGlobalVec, INSERT_VALUES, markLocalVec);PYLITH_CHECK_ERROR(err);
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmSoln, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    std::vector<std::vector<PetscInt> > splitCells(NUM_SPLITS);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        for (int iSplit = 0; iSplit < NUM_SPLITS; ++iSplit) {
+            if (_TimeDependent::hasMarkInClosure(dmSoln, markLocalVec, cell, iSplit+1)) {
+                splitCells[iSplit].push_back(cell);
+            } // if
+        } // for
+    } // for
+    std::vector<PetscIS> cellSubsets(NUM_SPLITS);
+    for (int iSplit = 0; iSplit < NUM_SPLITS; ++iSplit) {
+        cellSubsets[iSplit] = NULL;
+        const PetscInt* indices = (splitCells[iSplit].size() > 0) ? &splitCells[iSplit][0] : NULL;
+        err = ISCreateGeneral(PETSC_COMM_SELF, splitCells[iSplit].size(), indices, PETSC_COPY_VALUES, &cellSubsets[iSplit]);PYLITH_CHECK_ERROR(err);
+    } // for
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->setRHSResidualCellSubsets(cellSubsets);
+    } // for
+    for (int iSplit = 0; iSplit < NUM_SPLITS; ++iSplit) {
+        err = ISDestroy(&cellSubsets[iSplit]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    err = DMRestoreGlobalVector(dmSoln, &bufferGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreGlobalVector(dmSoln, &fastGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &markLocalVec);PYLITH_CHECK_ERROR(err);
+
+    err = VecDuplicate(solution->getGlobalVector(), &_splitResidualVec);PYLITH_CHECK_ERROR(err);
+
+    // Use PETSc multirate partitioned Runge-Kutta time stepper (time step ratio of 2).
+    PYLITH_COMPONENT_DEBUG("Setting PetscTS RHS splits for local time stepping.");
+    err = TSSetType(_ts, TSMPRK);PYLITH_CHECK_ERROR(err);
+    err = TSMPRKSetType(_ts, TSMPRK2A22);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetIS(_ts, "slow", _splitDofs[SPLIT_SLOW]);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetIS(_ts, "slowbuffer", _splitDofs[SPLIT_SLOWBUFFER]);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetIS(_ts, "fast", _splitDofs[SPLIT_FAST]);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetRHSFunction(_ts, "slow", NULL, computeRHSResidualSlow, (void*)this);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetRHSFunction(_ts, "slowbuffer", NULL, computeRHSResidualSlowBuffer, (void*)this);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetRHSFunction(_ts, "fast", NULL, computeRHSResidualFast, (void*)this);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destroy splits for multirate local time stepping.
+void
+pylith::problems::TimeDependent::_destroyLocalTimeStepping(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    for (size_t i = 0; i < _splitDofs.size(); ++i) {
+        err = ISDestroy(&_splitDofs[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _splitDofs.clear();
+    err = VecDestroy(&_splitResidualVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _destroyLocalTimeStepping
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute RHS residual, G(t,s), for split in multirate local time stepping.
+void
+pylith::problems::TimeDependent::_computeRHSResidualSplit(const RHSSplitEnum split,
+                                                          const PylithReal t,
+                                                          PetscVec solutionVec,
+                                                          PetscVec residualVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeRHSResidualSplit(split="<<split<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<")");
+
+    assert(_splitResidualVec);
+    assert(size_t(split) < _splitDofs.size());
+
+    PylithReal dt = 0.0;
+    PetscErrorCode err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+
+    // Integrate only over cells contributing to the split. Integrators without cell subsets (for
+    // example, boundary conditions) integrate over all of their cells.
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->selectRHSResidualCellSubset(split);
+    } // for
+    computeRHSResidual(_splitResidualVec, t, dt, solutionVec);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->selectRHSResidualCellSubset(-1);
+    } // for
+
+    PetscVec splitVec = NULL;
+    err = VecGetSubVector(_splitResidualVec, _splitDofs[split], &splitVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(splitVec, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(_splitResidualVec, _splitDofs[split], &splitVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computeRHSResidualSplit
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Check whether we need to reform the Jacobian.
 bool
@@ -866,6 +1956,81 @@ pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt) {
 } // _needNewJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether integrator's LHS Jacobian can be cached across Jacobian reformations.
+bool
+pylith::problems::TimeDependent::_isLHSJacobianCacheable(const pylith::feassemble::Integrator& integrator) {
+    const int changingTriggers = pylith::feassemble::Integrator::NEW_JACOBIAN_ALWAYS |
+                                 pylith::feassemble::Integrator::NEW_JACOBIAN_UPDATE_STATE_VARS;
+    return !(integrator.getLHSJacobianTriggers() & changingTriggers);
+} // _isLHSJacobianCacheable
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write LHS Jacobian reassembly statistics for each integrator to the log.
+void
+pylith::problems::TimeDependent::_logLHSJacobianStats(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    const size_t numIntegrators = std::min(_integrators.size(), _numLHSJacobianAssembled.size());
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        PYLITH_COMPONENT_INFO_ROOT("LHS Jacobian for integrator " << _integrators[i]->getLabelName() << "="
+                                                                  << _integrators[i]->getLabelValue() << ": "
+                                                                  << _numLHSJacobianAssembled[i] << " assembled, "
+                                                                  << _numLHSJacobianReused[i] << " reused"
+                                                                  << (_isLHSJacobianCacheable(*_integrators[i]) ? " (cacheable)." : "."));
+    } // for
+
+    PYLITH_METHOD_END;
+} // _logLHSJacobianStats
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Report failure of pointwise kernels on any process to the nonlinear solver.
+void
+pylith::problems::TimeDependent::_checkKernelFailure(const KernelOperationEnum operation) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    err = PetscObjectGetComm((PetscObject)_ts, &comm);PYLITH_CHECK_ERROR(err);
+    int failedLocal = pylith::fekernels::KernelStatus::hasFailed() ? 1 : 0;
+    int failed = 0;
+    err = MPI_Allreduce(&failedLocal, &failed, 1, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    if (!failed) {
+        PYLITH_METHOD_END;
+    } // if
+
+    pylith::fekernels::KernelStatus::reset();
+    switch (operation) {
+    case LHS_RESIDUAL: {
+        PYLITH_COMPONENT_WARNING("Pointwise kernels failed while computing LHS residual. Rejecting time step.");
+        err = SNESSetFunctionDomainError(getPetscSNES());PYLITH_CHECK_ERROR(err);
+        break;
+    } // LHS_RESIDUAL
+    case LHS_JACOBIAN: {
+        PYLITH_COMPONENT_WARNING("Pointwise kernels failed while computing LHS Jacobian. Rejecting time step.");
+        err = SNESSetJacobianDomainError(getPetscSNES());PYLITH_CHECK_ERROR(err);
+        break;
+    } // LHS_JACOBIAN
+    case RHS_RESIDUAL: {
+        // Explicit time stepping has no nonlinear solve to reject, so we cannot retry the time step.
+        PetscReal t = 0.0;
+        err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+        assert(_normalizer);
+        std::ostringstream msg;
+        msg << "Pointwise kernels failed while computing RHS residual at t=" << t*_normalizer->getTimeScale() << ".";
+        throw std::runtime_error(msg.str());
+    } // RHS_RESIDUAL
+    default:
+        PYLITH_COMPONENT_LOGICERROR("Unknown kernel operation '" << operation << "'.");
+    } // switch
+
+    PYLITH_METHOD_END;
+} // _checkKernelFailure
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set state (auxiliary field values) of system for time t.
 void
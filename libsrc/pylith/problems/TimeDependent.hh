@@ -32,6 +32,15 @@ class pylith::problems::TimeDependent : public pylith::problems::Problem {
     friend class TestTimeDependent; // unit testing
     friend class pylith::testing::MMSTest; // Testing with Method of Manufactured Solutions
 
+    // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum PredictorEnum {
+        PREDICTOR_NONE=0, // Start nonlinear solve from previous solution.
+        PREDICTOR_LINEAR=1, // Linear extrapolation from last 2 solutions.
+        PREDICTOR_QUADRATIC=2, // Quadratic extrapolation from last 3 solutions.
+    }; // PredictorEnum
+
     // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -80,6 +89,15 @@ public:
      */
     size_t getMaxTimeSteps(void) const;
 
+    /** Set maximum number of failed nonlinear solves retried with a smaller time step.
+     *
+     * A time step with a failed nonlinear solve, including failures of pointwise kernels, is rejected
+     * and retried with a smaller time step. After the retried step succeeds, the time step is restored.
+     *
+     * @param[in] value Maximum number of failed nonlinear solves (default is 0, which terminates on first failure).
+     */
+    void setMaxNonlinearFailures(const int value);
+
     /** Set initial time step for problem.
      *
      * @param[in] value Initial time step (seconds).
@@ -108,6 +126,102 @@ public:
      */
     void setShouldNotifyIC(const bool value);
 
+    /** Set flag for selecting time step from material properties.
+     *
+     * For quasistatic problems, the time step is limited to the safety factor times the stable
+     * time step from the materials (for example, the minimum Maxwell time), which is updated after
+     * each time step as stresses evolve. The time step never exceeds the initial time step and grows
+     * by at most a factor of 2 per time step. For dynamic problems, the time step is the safety factor
+     * (Courant factor) times the stable time step from the CFL condition.
+     *
+     * @param[in] value True if time step should be selected from material properties.
+     */
+    void setAdaptTimeStep(const bool value);
+
+    /** Set safety factor for time step selected from material properties.
+     *
+     * @param[in] value Safety factor (time step is this factor times the stable time step).
+     */
+    void setTimeStepSafetyFactor(const double value);
+
+    /** Set flag for multirate local time stepping in explicit dynamic problems.
+     *
+     * Degrees of freedom in the smallest cells (stable time step less than twice the smallest
+     * stable time step) are advanced with half the time step of the rest of the domain using the
+     * PETSc multirate partitioned Runge-Kutta (MPRK) time stepper. This is only supported for
+     * the dynamic formulation without faults.
+     *
+     * @param[in] value True if using local time stepping, false otherwise.
+     */
+    void setLocalTimeStepping(const bool value);
+
+    /** Set flag for precomputing cell geometry for the RHS residual in explicit dynamic problems.
+     *
+     * The coordinates, inverse Jacobian, and quadrature weights times the Jacobian determinant at
+     * the quadrature points are computed once and reused for every residual evaluation. Only
+     * materials on tensor-product cells use the precomputed geometry.
+     *
+     * @param[in] value True if precomputing cell geometry, false otherwise.
+     */
+    void setPrecomputeGeometry(const bool value);
+
+    /** Set flag for caching constant contributions to the LHS Jacobian.
+     *
+     * When some integrators have LHS Jacobians that change every time step (for example, power-law
+     * viscoelasticity) and others do not, the constant contributions are assembled once into a
+     * cached matrix and added to the freshly assembled contributions.
+     *
+     * @param[in] value True if constant LHS Jacobian contributions should be cached.
+     */
+    void setCacheLHSJacobian(const bool value);
+
+    /** Set number of new LHS Jacobians between full rebuilds of the algebraic multigrid hierarchy.
+     *
+     * When the LHS Jacobian is reformed (for example, the time step changes or a material has a
+     * nonlinear rheology), the sparsity pattern and near null space do not change. With a positive
+     * value, GAMG or ML keeps the aggregates and prolongators and only recomputes the Galerkin
+     * coarse operators from the new matrix values. The hierarchy is rebuilt from scratch every `value`
+     * new LHS Jacobians. A value of 0 rebuilds the hierarchy for every new LHS Jacobian.
+     *
+     * @param[in] value Number of new LHS Jacobians between full rebuilds.
+     */
+    void setMultigridRebuildInterval(const int value);
+
+    /** Set flag for applying Jacobi and SOR smoothers with a single precision copy of the matrix.
+     *
+     * The Jacobi and SOR preconditioners, including the smoothers on the multigrid levels, use a
+     * single precision copy of the preconditioning matrix. The operator, the Krylov solver, and the
+     * multigrid coarse level solve remain in double precision. The double precision matrices on the
+     * multigrid levels are still needed for the residuals and coarse operators, so the single
+     * precision copy adds memory (8 bytes per off-diagonal nonzero for SOR, 4 bytes per row for
+     * Jacobi) in exchange for reading fewer bytes when applying the smoothers.
+     *
+     * @param[in] value True if using mixed precision smoothers, false otherwise.
+     */
+    void setMixedPrecisionSmoothers(const bool value);
+
+    /** Set predictor for initial guess of nonlinear solve in implicit time steps.
+     *
+     * The initial guess is extrapolated in time from the solutions of the last few time steps. This
+     * reduces the number of nonlinear iterations when the solution varies smoothly in time.
+     *
+     * @param[in] value Predictor type.
+     */
+    void setPredictor(const PredictorEnum value);
+
+    /** Get predictor for initial guess of nonlinear solve in implicit time steps.
+     *
+     * @returns Predictor type.
+     */
+    PredictorEnum getPredictor(void) const;
+
+    /** Clear history of solutions used by the predictor.
+     *
+     * Use this when constraints change abruptly, so the next time step starts from the previous
+     * solution rather than an extrapolation across the change.
+     */
+    void clearPredictorHistory(void);
+
     /** Set progress monitor.
      *
      * @param[in] monitor Progress monitor for time-dependent simulation.
@@ -270,6 +384,94 @@ public:
     static
     PetscErrorCode poststep(PetscTS ts);
 
+    /** Callback static method for computing initial guess for nonlinear solve.
+     *
+     * @param[in] snes PETSc nonlinear solver.
+     * @param[out] solutionVec PETSc Vec with initial guess.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computePredictor(PetscSNES snes,
+                                    PetscVec solutionVec,
+                                    void* context);
+
+    /** Callback static method for operations before each linear solve.
+     *
+     * Sets whether algebraic multigrid reuses interpolation and replaces smoothers with single
+     * precision versions before the preconditioner is setup.
+     *
+     * @param[in] ksp PETSc linear solver.
+     * @param[in] rhsVec PETSc Vec with right-hand side.
+     * @param[in] solutionVec PETSc Vec with solution.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode presolve(PetscKSP ksp,
+                            PetscVec rhsVec,
+                            PetscVec solutionVec,
+                            void* context);
+
+    /** Callback static method for computing residual for RHS, G(t,s), for slow split.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PetscVec for solution (all degrees of freedom).
+     * @param[out] residualVec PetscVec for residual (degrees of freedom in split).
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualSlow(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
+    /** Callback static method for computing residual for RHS, G(t,s), for slow buffer split.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PetscVec for solution (all degrees of freedom).
+     * @param[out] residualVec PetscVec for residual (degrees of freedom in split).
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualSlowBuffer(PetscTS ts,
+                                                PetscReal t,
+                                                PetscVec solutionVec,
+                                                PetscVec residualVec,
+                                                void* context);
+
+    /** Callback static method for computing residual for RHS, G(t,s), for fast split.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PetscVec for solution (all degrees of freedom).
+     * @param[out] residualVec PetscVec for residual (degrees of freedom in split).
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualFast(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
+    // PRIVATE ENUMS ///////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    enum RHSSplitEnum {
+        SPLIT_SLOW=0, // Degrees of freedom advanced with full time step.
+        SPLIT_SLOWBUFFER=1, // Degrees of freedom advanced with full time step coupled to fast ones.
+        SPLIT_FAST=2, // Degrees of freedom advanced with half time step.
+        NUM_SPLITS=3,
+    }; // RHSSplitEnum
+
+    enum KernelOperationEnum {
+        LHS_RESIDUAL=0, // Computing LHS residual, F(t,s,\dot{s}).
+        LHS_JACOBIAN=1, // Computing LHS Jacobian.
+        RHS_RESIDUAL=2, // Computing RHS residual, G(t,s).
+    }; // KernelOperationEnum
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -280,6 +482,27 @@ private:
      */
     bool _needNewJacobian(const PylithReal dt);
 
+    /** Check whether integrator's LHS Jacobian can be cached across Jacobian reformations.
+     *
+     * @param[in] integrator Integrator to check.
+     * @returns True if LHS Jacobian for integrator depends only on the time step.
+     */
+    static
+    bool _isLHSJacobianCacheable(const pylith::feassemble::Integrator& integrator);
+
+    /// Write LHS Jacobian reassembly statistics for each integrator to the log.
+    void _logLHSJacobianStats(void) const;
+
+    /** Report failure of pointwise kernels on any process.
+     *
+     * Failures in the LHS residual and Jacobian are reported to the nonlinear solver as domain errors, so
+     * the time step can be rejected and retried. Explicit time stepping cannot reject a time step, so a
+     * failure in the RHS residual is an error.
+     *
+     * @param[in] operation Operation that evaluated the kernels.
+     */
+    void _checkKernelFailure(const KernelOperationEnum operation);
+
     /** Set state (auxiliary field values) of system for time t.
      *
      * @param[in] t Current time.
@@ -289,6 +512,96 @@ private:
     /// Notify observers with solution corresponding to initial conditions.
     void _notifyObserversInitialSoln(void);
 
+    /** Compute stable time step for implicit time stepping from the materials.
+     *
+     * @returns Stable time step over all processes (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal _computeStableTimeStep(void);
+
+    /** Compute stable time step for explicit time stepping from the materials (CFL condition).
+     *
+     * @param[out] location Coordinates of centroid of cell limiting the time step (nondimensional).
+     * @returns Stable time step over all processes (nondimensional); PYLITH_MAXSCALAR if there is no limit.
+     */
+    PylithReal _computeStableTimeStepExplicit(PylithReal location[3]);
+
+    /** Limit time step using stable time step from the materials.
+     *
+     * @param[in] isInitial True if setting the initial time step, false if updating after a time step.
+     */
+    void _updateTimeStep(const bool isInitial);
+
+    /** Compute time step limited by stable time step.
+     *
+     * @param[in] dt Current time step.
+     * @param[in] dtMax Maximum time step (safety factor times stable time step).
+     * @param[in] dtUser Time step specified by user.
+     * @param[in] isInitial True if setting the initial time step, false if updating after a time step.
+     * @param[in] isExplicit True if using explicit time stepping, false otherwise.
+     * @returns Time step for next time step.
+     */
+    static
+    PylithReal _computeTimeStep(const PylithReal dt,
+                                const PylithReal dtMax,
+                                const PylithReal dtUser,
+                                const bool isInitial,
+                                const bool isExplicit);
+
+    /** Add solution to history used by predictor.
+     *
+     * @param[in] t Time of solution.
+     * @param[in] solutionVec PETSc Vec with solution.
+     */
+    void _addPredictorHistory(const PylithReal t,
+                              PetscVec solutionVec);
+
+    /** Extrapolate solution in time from history.
+     *
+     * @param[out] solutionVec PETSc Vec with initial guess (unchanged if history is insufficient).
+     */
+    void _predict(PetscVec solutionVec);
+
+    /** Get number of previous solutions used by predictor.
+     *
+     * @param[in] predictor Type of predictor.
+     * @returns Number of solutions in history (0 if predictor does not use history).
+     */
+    static
+    size_t _getPredictorHistorySize(const PredictorEnum predictor);
+
+    /** Compute weights of Lagrange interpolating polynomial through previous solutions.
+     *
+     * @param[out] weights Weights of previous solutions.
+     * @param[in] times Times of previous solutions.
+     * @param[in] tPredict Time at which to evaluate polynomial.
+     */
+    static
+    void _computePredictorWeights(std::vector<PylithReal>* weights,
+                                  const std::vector<PylithReal>& times,
+                                  const PylithReal tPredict);
+
+    /** Setup splits of degrees of freedom and cells for multirate local time stepping.
+     *
+     * Cells are grouped into rate classes by their CFL time step; degrees of freedom in the
+     * closure of cells with the smallest stable time steps form the fast split.
+     */
+    void _setupLocalTimeStepping(void);
+
+    /// Destroy splits for multirate local time stepping.
+    void _destroyLocalTimeStepping(void);
+
+    /** Compute RHS residual, G(t,s), for split in multirate local time stepping.
+     *
+     * @param[in] split Split of degrees of freedom.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PetscVec for solution (all degrees of freedom).
+     * @param[out] residualVec PetscVec for residual (degrees of freedom in split).
+     */
+    void _computeRHSResidualSplit(const RHSSplitEnum split,
+                                  const PylithReal t,
+                                  PetscVec solutionVec,
+                                  PetscVec residualVec);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -296,6 +609,8 @@ private:
     double _endTime; ///< Ending time of problem (seconds).
     double _dtInitial; ///< Initial time step (seconds).
     size_t _maxTimeSteps; ///< Maximum number of time steps for problem.
+    int _maxNonlinearFailures; ///< Maximum number of failed nonlinear solves retried with a smaller time step.
+    PylithInt _numNonlinearFailures; ///< Number of failed nonlinear solves at the end of the previous time step.
     PetscTS _ts; ///< PETSc time stepper.
     std::vector<pylith::problems::InitialCondition*> _ic; ///< Array of initial conditions.
     pylith::problems::ProgressMonitorTime* _monitor; ///< Monitor for simulation progress.
@@ -304,6 +619,32 @@ private:
     bool _haveNewLHSJacobian; ///< True if LHS Jacobian was reformed.
     bool _shouldNotifyIC;
 
+    bool _cacheLHSJacobian; ///< True if constant LHS Jacobian contributions should be cached.
+    PetscMat _jacobianLHSCached; ///< Constant contributions to LHS Jacobian.
+    PetscMat _precondLHSCached; ///< Constant contributions to LHS preconditioner.
+    std::vector<size_t> _numLHSJacobianAssembled; ///< Number of LHS Jacobian assemblies for each integrator.
+    std::vector<size_t> _numLHSJacobianReused; ///< Number of LHS Jacobian reuses for each integrator.
+
+    bool _adaptTimeStep; ///< True if time step is selected from material properties.
+    double _dtSafetyFactor; ///< Safety factor (Courant factor for dynamic problems) for time step.
+
+    PredictorEnum _predictor; ///< Predictor for initial guess of nonlinear solve.
+    std::vector<PetscVec> _predictorSolns; ///< Solutions of previous time steps (most recent first).
+    std::vector<PylithReal> _predictorTimes; ///< Times of previous solutions (most recent first).
+
+    bool _useLocalTimeStepping; ///< True if using multirate local time stepping.
+    PylithReal _dtStableLocalTimeStepping; ///< Stable time step (nondimensional) with local time stepping.
+    std::vector<PetscIS> _splitDofs; ///< Global indices of degrees of freedom in each split.
+    PetscVec _splitResidualVec; ///< Work vector for RHS residual (all degrees of freedom).
+
+    bool _precomputeGeometry; ///< True if precomputing cell geometry for explicit RHS residual.
+
+    int _multigridRebuildInterval; ///< Number of new LHS Jacobians between full rebuilds of multigrid hierarchy.
+    size_t _numMultigridSetups; ///< Number of preconditioner setups with new LHS Jacobian.
+    bool _reuseMultigridInterpolation; ///< True if next multigrid setup reuses interpolation.
+    bool _checkedMultigridReuse; ///< True if checked linear solver for multigrid preconditioner.
+    bool _mixedPrecisionSmoothers; ///< True if using Jacobi and SOR smoothers with single precision copy of matrix.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -49,6 +49,9 @@ namespace pylith {
         class ProgressMonitorTime;
         class ProgressMonitorStep;
 
+        class SinglePrecisionSmoother;
+        class FaultSchurPreconditioner;
+
     } // problems
 } // pylith
 
@@ -56,6 +56,7 @@ public:
     enum SpaceEnum {
         POLYNOMIAL_SPACE=0, ///< Polynomial finite-element space.
         POINT_SPACE=1, ///< Point finite-element space.
+        SPECTRAL_SPACE=2, ///< Spectral-element space (Gauss-Lobatto-Legendre nodes and quadrature).
     }; // SpaceEnum
 
     enum CellBasis {
@@ -25,12 +25,68 @@
 #include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/VisitorSubmesh.hh" // USES VecVisitorSubmesh
+#include "pylith/faults/TopologyOps.hh" // USES TopologyOps
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 
 #include "petscdm.h" // USES PetscDM
 
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _FieldOps {
+public:
+
+            /** Get reference cell type for discretization.
+             *
+             * @param[in] dim Topological dimension of cell.
+             * @param[in] useTensor True if cell is a tensor-product cell (quadrilateral or hexahedron).
+             * @returns Polytope type of reference cell.
+             */
+            static
+            DMPolytopeType getCellType(const PetscInt dim,
+                                       const PetscBool useTensor);
+
+            /** Create PetscFE with degrees of freedom at the quadrature points.
+             *
+             * The basis functions are delta functions at the quadrature points, so interpolating the
+             * field to the quadrature points is exact and all degrees of freedom are associated with
+             * the cell.
+             *
+             * @param[in] dim Topological dimension of cell.
+             * @param[in] cellType Polytope type of reference cell.
+             * @param[in] quadOrder Order of quadrature scheme.
+             * @param[in] numComponents Number of components in field.
+             * @returns PetscFE for field.
+             */
+            static
+            PetscFE createPointFE(const PetscInt dim,
+                                  const DMPolytopeType cellType,
+                                  const PetscInt quadOrder,
+                                  const PetscInt numComponents);
+
+            /** Create tensor-product Gauss-Lobatto-Legendre (GLL) quadrature on reference cell [-1,1]^dim.
+             *
+             * @param[in] dim Topological dimension of cell.
+             * @param[in] numPoints1D Number of quadrature points in each direction (>= 2).
+             * @returns PetscQuadrature with GLL points.
+             */
+            static
+            PetscQuadrature createGLLQuadrature(const PetscInt dim,
+                                                const PetscInt numPoints1D);
+
+        }; // _FieldOps
+    } // topology
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
 std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE> pylith::topology::FieldOps::feStore = std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE>();
 
 void
@@ -65,61 +121,70 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
         const PetscBool useTensor = pylith::topology::FieldBase::TENSOR_BASIS == feKey.cellBasis ? PETSC_TRUE : PETSC_FALSE;
         const PetscBool basisContinuity = feKey.isBasisContinuous ? PETSC_TRUE : PETSC_FALSE;
 
-        // Create space
-        PetscSpace space = NULL;
-        err = PetscSpaceCreate(PETSC_COMM_SELF, &space);PYLITH_CHECK_ERROR(err);assert(space);
-        err = PetscSpaceSetType(space, feKey.feSpace == FieldBase::POLYNOMIAL_SPACE ?
-                                PETSCSPACEPOLYNOMIAL : PETSCSPACEPOINT);PYLITH_CHECK_ERROR(err);
-        err = PetscSpaceSetNumComponents(space, numComponents);PYLITH_CHECK_ERROR(err);
-        err = PetscSpaceSetDegree(space, basisOrder, PETSC_DETERMINE);
-        if (feKey.feSpace == FieldBase::POLYNOMIAL_SPACE) {
-            err = PetscSpacePolynomialSetTensor(space, useTensor);PYLITH_CHECK_ERROR(err);
+        const bool isSpectral = FieldBase::SPECTRAL_SPACE == feKey.feSpace;
+        if (isSpectral && !useTensor && (dim > 1)) {
+            std::ostringstream msg;
+            msg << "Spectral finite-element space requires tensor-product cells (quadrilaterals or hexahedra).";
+            throw std::runtime_error(msg.str());
         } // if
-        err = PetscSpaceSetNumVariables(space, dim);PYLITH_CHECK_ERROR(err);
-        err = PetscSpaceSetUp(space);PYLITH_CHECK_ERROR(err);
-
-        // Create dual space
-        PetscDualSpace dualspace = NULL;
-        PetscDM dmCell = NULL;
-        err = PetscDualSpaceCreate(PETSC_COMM_SELF, &dualspace);PYLITH_CHECK_ERROR(err);
-        err = DMPlexCreateReferenceCell(PETSC_COMM_SELF, DMPolytopeTypeSimpleShape(dim, simplexBasis), &dmCell);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetDM(dualspace, dmCell);PYLITH_CHECK_ERROR(err);
-        err = DMDestroy(&dmCell);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetNumComponents(dualspace, numComponents);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACELAGRANGE);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceLagrangeSetTensor(dualspace, useTensor);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceSetOrder(dualspace, basisOrder);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceLagrangeSetContinuity(dualspace, basisContinuity);
-        err = PetscDualSpaceSetUp(dualspace);PYLITH_CHECK_ERROR(err);
-
-        // Create element
-        err = PetscFECreate(PETSC_COMM_SELF, &fe);PYLITH_CHECK_ERROR(err);
-        err = PetscFESetType(fe, PETSCFEBASIC);PYLITH_CHECK_ERROR(err);
-        err = PetscFESetBasisSpace(fe, space);PYLITH_CHECK_ERROR(err);
-        err = PetscFESetDualSpace(fe, dualspace);PYLITH_CHECK_ERROR(err);
-        err = PetscFESetNumComponents(fe, numComponents);PYLITH_CHECK_ERROR(err);
-        err = PetscFESetUp(fe);PYLITH_CHECK_ERROR(err);
-        err = PetscSpaceDestroy(&space);PYLITH_CHECK_ERROR(err);
-        err = PetscDualSpaceDestroy(&dualspace);PYLITH_CHECK_ERROR(err);
-
-        // Create quadrature
-        PetscQuadrature quadrature = NULL;
-        PetscQuadrature faceQuadrature = NULL;
-        DMPolytopeType ct;
-        switch (dim) {
-          case 0: ct = DM_POLYTOPE_POINT;break;
-          case 1: ct = DM_POLYTOPE_SEGMENT;break;
-          case 2: ct = useTensor ? DM_POLYTOPE_QUADRILATERAL : DM_POLYTOPE_TRIANGLE;break;
-          case 3: ct = useTensor ? DM_POLYTOPE_HEXAHEDRON : DM_POLYTOPE_TETRAHEDRON;break;
-          default: throw std::logic_error("Cannot handle dimension");
-        }
-        err = PetscDTCreateDefaultQuadrature(ct, quadOrder, &quadrature, &faceQuadrature);PYLITH_CHECK_ERROR(err);
-        err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
-        err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
-        err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
-        err = PetscQuadratureDestroy(&faceQuadrature);PYLITH_CHECK_ERROR(err);
-
-        assert(feKey.feSpace == FieldBase::POLYNOMIAL_SPACE);
+        if (FieldBase::POINT_SPACE == feKey.feSpace) {
+            fe = _FieldOps::createPointFE(dim, _FieldOps::getCellType(dim, useTensor), quadOrder, numComponents);
+        } else {
+            // Create space
+            PetscSpace space = NULL;
+            err = PetscSpaceCreate(PETSC_COMM_SELF, &space);PYLITH_CHECK_ERROR(err);assert(space);
+            err = PetscSpaceSetType(space, PETSCSPACEPOLYNOMIAL);PYLITH_CHECK_ERROR(err);
+            err = PetscSpaceSetNumComponents(space, numComponents);PYLITH_CHECK_ERROR(err);
+            err = PetscSpaceSetDegree(space, basisOrder, PETSC_DETERMINE);
+            err = PetscSpacePolynomialSetTensor(space, useTensor);PYLITH_CHECK_ERROR(err);
+            err = PetscSpaceSetNumVariables(space, dim);PYLITH_CHECK_ERROR(err);
+            err = PetscSpaceSetUp(space);PYLITH_CHECK_ERROR(err);
+
+            // Create dual space
+            PetscDualSpace dualspace = NULL;
+            PetscDM dmCell = NULL;
+            err = PetscDualSpaceCreate(PETSC_COMM_SELF, &dualspace);PYLITH_CHECK_ERROR(err);
+            err = DMPlexCreateReferenceCell(PETSC_COMM_SELF, DMPolytopeTypeSimpleShape(dim, simplexBasis), &dmCell);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSetDM(dualspace, dmCell);PYLITH_CHECK_ERROR(err);
+            err = DMDestroy(&dmCell);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSetNumComponents(dualspace, numComponents);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACELAGRANGE);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceLagrangeSetTensor(dualspace, useTensor);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceSetOrder(dualspace, basisOrder);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceLagrangeSetContinuity(dualspace, basisContinuity);
+            if (isSpectral) {
+                // Nodes at Gauss-Lobatto-Legendre points (Gauss-Jacobi with exponent 0 including endpoints).
+                err = PetscDualSpaceLagrangeSetNodeType(dualspace, PETSCDTNODES_GAUSSJACOBI, PETSC_TRUE, 0.0);PYLITH_CHECK_ERROR(err);
+            } // if
+            err = PetscDualSpaceSetUp(dualspace);PYLITH_CHECK_ERROR(err);
+
+            // Create element
+            err = PetscFECreate(PETSC_COMM_SELF, &fe);PYLITH_CHECK_ERROR(err);
+            err = PetscFESetType(fe, PETSCFEBASIC);PYLITH_CHECK_ERROR(err);
+            err = PetscFESetBasisSpace(fe, space);PYLITH_CHECK_ERROR(err);
+            err = PetscFESetDualSpace(fe, dualspace);PYLITH_CHECK_ERROR(err);
+            err = PetscFESetNumComponents(fe, numComponents);PYLITH_CHECK_ERROR(err);
+            err = PetscFESetUp(fe);PYLITH_CHECK_ERROR(err);
+            err = PetscSpaceDestroy(&space);PYLITH_CHECK_ERROR(err);
+            err = PetscDualSpaceDestroy(&dualspace);PYLITH_CHECK_ERROR(err);
+
+            // Create quadrature
+            PetscQuadrature quadrature = NULL;
+            PetscQuadrature faceQuadrature = NULL;
+            if (isSpectral) {
+                // Quadrature points co-located with the nodes of a basis of order quadOrder, so the mass
+                // matrix is diagonal when quadOrder equals basisOrder.
+                quadrature = _FieldOps::createGLLQuadrature(dim, PetscMax(quadOrder, 1) + 1);
+                faceQuadrature = _FieldOps::createGLLQuadrature(dim-1, PetscMax(quadOrder, 1) + 1);
+            } else {
+                const DMPolytopeType ct = _FieldOps::getCellType(dim, useTensor);
+                err = PetscDTCreateDefaultQuadrature(ct, quadOrder, &quadrature, &faceQuadrature);PYLITH_CHECK_ERROR(err);
+            } // if/else
+            err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
+            err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
+            err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
+            err = PetscQuadratureDestroy(&faceQuadrature);PYLITH_CHECK_ERROR(err);
+        } // if/else
         pylith::topology::FieldOps::feStore.insert(std::pair<FieldBase::Discretization, pylith::topology::FE>(feKey, fe));
     } else {
         throw std::logic_error("FieldOps::createFE() :TODO: Can't reuse PetscFE due to naming of fields, so make a deep copy of fe.");
@@ -131,6 +196,147 @@ pylith::topology::FieldOps::createFE(const FieldBase::Discretization& feinfo,
 } // createFE
 
 
+// ------------------------------------------------------------------------------------------------
+// Create tensor-product Gauss-Lobatto-Legendre quadrature on reference cell.
+PetscQuadrature
+pylith::topology::_FieldOps::createGLLQuadrature(const PetscInt dim,
+                                                 const PetscInt numPoints1D) {
+    PYLITH_METHOD_BEGIN;
+    assert(dim >= 0);
+    assert(numPoints1D >= 2);
+
+    PetscErrorCode err;
+    std::vector<PetscReal> points1D(numPoints1D);
+    std::vector<PetscReal> weights1D(numPoints1D);
+    err = PetscDTGaussLobattoLegendreQuadrature(numPoints1D, PETSCGAUSSLOBATTOLEGENDRE_VIA_GOLUB_WELSCH,
+                                                &points1D[0], &weights1D[0]);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numPoints = 1;
+    for (PetscInt d = 0; d < dim; ++d) {
+        numPoints *= numPoints1D;
+    } // for
+    PetscReal* points = NULL;
+    PetscReal* weights = NULL;
+    err = PetscMalloc1(numPoints*dim, &points);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(numPoints, &weights);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+        // First coordinate varies fastest.
+        PetscInt index = iPoint;
+        weights[iPoint] = 1.0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            const PetscInt i1D = index % numPoints1D;
+            index /= numPoints1D;
+            points[iPoint*dim+d] = points1D[i1D];
+            weights[iPoint] *= weights1D[i1D];
+        } // for
+    } // for
+
+    PetscQuadrature quadrature = NULL;
+    err = PetscQuadratureCreate(PETSC_COMM_SELF, &quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureSetOrder(quadrature, 2*numPoints1D-3);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureSetData(quadrature, dim, 1, numPoints, points, weights);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(quadrature);
+} // createGLLQuadrature
+
+
+// ------------------------------------------------------------------------------------------------
+// Get reference cell type for discretization.
+DMPolytopeType
+pylith::topology::_FieldOps::getCellType(const PetscInt dim,
+                                         const PetscBool useTensor) {
+    DMPolytopeType ct = DM_POLYTOPE_UNKNOWN;
+    switch (dim) {
+      case 0: ct = DM_POLYTOPE_POINT;break;
+      case 1: ct = DM_POLYTOPE_SEGMENT;break;
+      case 2: ct = useTensor ? DM_POLYTOPE_QUADRILATERAL : DM_POLYTOPE_TRIANGLE;break;
+      case 3: ct = useTensor ? DM_POLYTOPE_HEXAHEDRON : DM_POLYTOPE_TETRAHEDRON;break;
+      default: throw std::logic_error("Cannot handle dimension");
+    } // switch
+    return ct;
+} // getCellType
+
+
+// ------------------------------------------------------------------------------------------------
+// Create PetscFE with degrees of freedom at the quadrature points.
+PetscFE
+pylith::topology::_FieldOps::createPointFE(const PetscInt dim,
+                                           const DMPolytopeType cellType,
+                                           const PetscInt quadOrder,
+                                           const PetscInt numComponents) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err;
+    PetscQuadrature quadrature = NULL;
+    PetscQuadrature faceQuadrature = NULL;
+    err = PetscDTCreateDefaultQuadrature(cellType, quadOrder, &quadrature, &faceQuadrature);PYLITH_CHECK_ERROR(err);
+    PetscInt numPoints = 0;
+    const PetscReal* points = NULL;
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, &numPoints, &points, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Scalar space spanned by delta functions at the quadrature points.
+    PetscSpace space = NULL;
+    err = PetscSpaceCreate(PETSC_COMM_SELF, &space);PYLITH_CHECK_ERROR(err);assert(space);
+    err = PetscSpaceSetType(space, PETSCSPACEPOINT);PYLITH_CHECK_ERROR(err);
+    err = PetscSpaceSetNumComponents(space, 1);PYLITH_CHECK_ERROR(err);
+    err = PetscSpaceSetNumVariables(space, dim);PYLITH_CHECK_ERROR(err);
+    err = PetscSpacePointSetPoints(space, quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscSpaceSetUp(space);PYLITH_CHECK_ERROR(err);
+
+    // Dual space of point evaluations at the quadrature points (all dof are interior to the cell).
+    PetscDualSpace dualspace = NULL;
+    PetscDM dmCell = NULL;
+    err = PetscDualSpaceCreate(PETSC_COMM_SELF, &dualspace);PYLITH_CHECK_ERROR(err);
+    err = DMPlexCreateReferenceCell(PETSC_COMM_SELF, cellType, &dmCell);PYLITH_CHECK_ERROR(err);
+    err = PetscDualSpaceSetDM(dualspace, dmCell);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmCell);PYLITH_CHECK_ERROR(err);
+    err = PetscDualSpaceSetNumComponents(dualspace, 1);PYLITH_CHECK_ERROR(err);
+    err = PetscDualSpaceSetType(dualspace, PETSCDUALSPACESIMPLE);PYLITH_CHECK_ERROR(err);
+    err = PetscDualSpaceSimpleSetDimension(dualspace, numPoints);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+        PetscQuadrature functional = NULL;
+        PetscReal* functionalPoint = NULL;
+        PetscReal* functionalWeight = NULL;
+        err = PetscMalloc1(dim, &functionalPoint);PYLITH_CHECK_ERROR(err);
+        err = PetscMalloc1(1, &functionalWeight);PYLITH_CHECK_ERROR(err);
+        for (PetscInt d = 0; d < dim; ++d) {
+            functionalPoint[d] = points[iPoint*dim+d];
+        } // for
+        functionalWeight[0] = 1.0;
+        err = PetscQuadratureCreate(PETSC_COMM_SELF, &functional);PYLITH_CHECK_ERROR(err);
+        err = PetscQuadratureSetData(functional, dim, 1, 1, functionalPoint, functionalWeight);PYLITH_CHECK_ERROR(err);
+        err = PetscDualSpaceSimpleSetFunctional(dualspace, iPoint, functional);PYLITH_CHECK_ERROR(err);
+        err = PetscQuadratureDestroy(&functional);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscDualSpaceSetUp(dualspace);PYLITH_CHECK_ERROR(err);
+
+    PetscFE fe = NULL;
+    err = PetscFECreate(PETSC_COMM_SELF, &fe);PYLITH_CHECK_ERROR(err);
+    err = PetscFESetType(fe, PETSCFEBASIC);PYLITH_CHECK_ERROR(err);
+    err = PetscFESetBasisSpace(fe, space);PYLITH_CHECK_ERROR(err);
+    err = PetscFESetDualSpace(fe, dualspace);PYLITH_CHECK_ERROR(err);
+    err = PetscFESetNumComponents(fe, 1);PYLITH_CHECK_ERROR(err);
+    err = PetscFESetUp(fe);PYLITH_CHECK_ERROR(err);
+    err = PetscSpaceDestroy(&space);PYLITH_CHECK_ERROR(err);
+    err = PetscDualSpaceDestroy(&dualspace);PYLITH_CHECK_ERROR(err);
+    err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
+
+    if (numComponents > 1) {
+        // Components are interleaved, so dof for a cell are ordered by quadrature point and then component.
+        PetscFE feScalar = fe;
+        err = PetscFECreateVector(feScalar, numComponents, PETSC_TRUE, PETSC_TRUE, &fe);PYLITH_CHECK_ERROR(err);
+        err = PetscFEDestroy(&feScalar);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetQuadrature(fe, quadrature);PYLITH_CHECK_ERROR(err);
+        err = PetscFESetFaceQuadrature(fe, faceQuadrature);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureDestroy(&faceQuadrature);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(fe);
+} // createPointFE
+
+
 // ------------------------------------------------------------------------------------------------
 // Check compatibility of discretization of subfields in the auxiliary field and target field.
 void
@@ -187,6 +393,36 @@ pylith::topology::FieldOps::checkDiscretization(const pylith::topology::Field& t
         } // for
     } // auxiliary subfields
 
+    // Spectral subfields use Gauss-Lobatto-Legendre quadrature points, whereas the other subfields use
+    // Gauss quadrature points. DMPlex only checks that the number of quadrature points match, so we
+    // require all subfields to use the spectral space if any of them do.
+    bool hasSpectral = false;
+    bool hasNonspectral = false;
+    std::string nameSpectral, nameNonspectral;
+    const pylith::topology::Field* fields[2] = { &target, &auxiliary };
+    for (int iField = 0; iField < 2; ++iField) {
+        const pylith::string_vector& subfieldNames = fields[iField]->getSubfieldNames();
+        const size_t numSubfields = subfieldNames.size();
+        for (size_t i = 0; i < numSubfields; ++i) {
+            const pylith::topology::Field::SubfieldInfo& sinfo = fields[iField]->getSubfieldInfo(subfieldNames[i].c_str());
+            if (FieldBase::SPECTRAL_SPACE == sinfo.fe.feSpace) {
+                hasSpectral = true;
+                nameSpectral = std::string(fields[iField]->getLabel()) + "." + subfieldNames[i];
+            } else {
+                hasNonspectral = true;
+                nameNonspectral = std::string(fields[iField]->getLabel()) + "." + subfieldNames[i];
+            } // if/else
+        } // for
+    } // for
+    if (hasSpectral && hasNonspectral) {
+        std::ostringstream msg;
+        msg << "Subfield '" << nameSpectral << "' uses the spectral finite-element space, but subfield '" << nameNonspectral
+            << "' does not. If any subfield in the target field '" << target.getLabel() << "' or the auxiliary field '"
+            << auxiliary.getLabel() << "' uses the spectral finite-element space, then all of them must use it, so "
+            << "that they use the same quadrature points.";
+        throw std::runtime_error(msg.str());
+    } // if
+
     PYLITH_METHOD_END;
 } // checkDiscretization
 
@@ -262,4 +498,82 @@ pylith::topology::FieldOps::layoutsMatch(const pylith::topology::Field& fieldA,
 } // layoutsMatch
 
 
+// ------------------------------------------------------------------------------------------------
+// Create layout of field on coarser levels of mesh refinement hierarchy for geometric multigrid.
+void
+pylith::topology::FieldOps::createCoarseHierarchy(const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+
+    // The mesh DMs from uniform refinement only carry the topology, coordinates, and labels. PCMG
+    // coarsens the solution DM using DMGetCoarseDM(), so each coarse level needs its own fields, DS,
+    // and boundary conditions. We cannot use DMCopyDisc() because it keeps the labels of the fine DM
+    // for fields and regions restricted to the fault.
+    PetscErrorCode err = 0;
+    PetscDM dmFine = field.getDM();
+    PetscDM dmCoarseMesh = NULL;
+    err = DMGetCoarseDM(dmFine, &dmCoarseMesh);PYLITH_CHECK_ERROR(err);
+    while (dmCoarseMesh) {
+        PetscDM dmCoarseMeshNext = NULL;
+        err = DMGetCoarseDM(dmCoarseMesh, &dmCoarseMeshNext);PYLITH_CHECK_ERROR(err);
+
+        PetscDM dmCoarse = NULL;
+        err = DMClone(dmCoarseMesh, &dmCoarse);PYLITH_CHECK_ERROR(err);
+
+        PetscInt numFields = 0;
+        err = DMGetNumFields(dmFine, &numFields);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iField = 0; iField < numFields; ++iField) {
+            PetscDMLabel labelFine = NULL;
+            PetscObject disc = NULL;
+            err = DMGetField(dmFine, iField, &labelFine, &disc);PYLITH_CHECK_ERROR(err);
+
+            PetscDMLabel labelCoarse = NULL;
+            if (labelFine) {
+                const char* labelName = NULL;
+                err = PetscObjectGetName((PetscObject)labelFine, &labelName);PYLITH_CHECK_ERROR(err);
+                if (std::string(labelName) == pylith::faults::TopologyOps::getInterfacesLabelName()) {
+                    labelCoarse = pylith::faults::TopologyOps::getInterfacesLabel(dmCoarse);
+                } else {
+                    err = DMGetLabel(dmCoarse, labelName, &labelCoarse);PYLITH_CHECK_ERROR(err);
+                } // if/else
+                if (!labelCoarse) {
+                    std::ostringstream msg;
+                    msg << "Could not find label '" << labelName << "' for subfield " << iField
+                        << " on coarse level of mesh refinement hierarchy for field '" << field.getLabel() << "'.";
+                    throw std::runtime_error(msg.str());
+                } // if
+            } // if
+            PetscBool avoidTensor = PETSC_FALSE;
+            err = DMGetFieldAvoidTensor(dmFine, iField, &avoidTensor);PYLITH_CHECK_ERROR(err);
+            err = DMSetField(dmCoarse, iField, labelCoarse, disc);PYLITH_CHECK_ERROR(err);
+            err = DMSetFieldAvoidTensor(dmCoarse, iField, avoidTensor);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = DMCreateDS(dmCoarse);PYLITH_CHECK_ERROR(err);
+
+        // Regions are created in the same order on both levels, so boundary conditions map one-to-one.
+        PetscInt numDSFine = 0;
+        PetscInt numDSCoarse = 0;
+        err = DMGetNumDS(dmFine, &numDSFine);PYLITH_CHECK_ERROR(err);
+        err = DMGetNumDS(dmCoarse, &numDSCoarse);PYLITH_CHECK_ERROR(err);
+        assert(numDSFine == numDSCoarse);
+        for (PetscInt iDS = 0; iDS < numDSFine; ++iDS) {
+            PetscDS dsFine = NULL;
+            PetscDS dsCoarse = NULL;
+            err = DMGetRegionNumDS(dmFine, iDS, NULL, NULL, &dsFine, NULL);PYLITH_CHECK_ERROR(err);
+            err = DMGetRegionNumDS(dmCoarse, iDS, NULL, NULL, &dsCoarse, NULL);PYLITH_CHECK_ERROR(err);
+            err = PetscDSCopyBoundary(dsFine, PETSC_DEFAULT, NULL, dsCoarse);PYLITH_CHECK_ERROR(err);
+            err = PetscDSUpdateBoundaryLabels(dsCoarse, dmCoarse);PYLITH_CHECK_ERROR(err);
+        } // for
+
+        err = DMSetCoarseDM(dmCoarse, dmCoarseMeshNext);PYLITH_CHECK_ERROR(err);
+        err = DMSetCoarseDM(dmFine, dmCoarse);PYLITH_CHECK_ERROR(err);
+        err = DMDestroy(&dmCoarse);PYLITH_CHECK_ERROR(err);
+
+        err = DMGetCoarseDM(dmFine, &dmFine);PYLITH_CHECK_ERROR(err);
+        dmCoarseMesh = dmCoarseMeshNext;
+    } // while
+
+    PYLITH_METHOD_END;
+} // createCoarseHierarchy
+
+
 // End of file
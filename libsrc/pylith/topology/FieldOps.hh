@@ -89,6 +89,9 @@ public:
                      const int numComponents);
 
     /** Check compatibility of discretization of subfields in the auxiliary field and target field.
+     *
+     * All subfields must use the same quadrature order, and either all or none of the subfields may
+     * use the spectral finite-element space.
      *
      * @param[in] target Field with subfields set from auxiliary field.
      * @param[in] auxliary Auxiliary field.
@@ -117,6 +120,16 @@ public:
     bool layoutsMatch(const pylith::topology::Field& fieldA,
                       const pylith::topology::Field& fieldB);
 
+    /** Create layout of field on coarser levels of mesh refinement hierarchy for geometric multigrid.
+     *
+     * The coarse levels get the subfields and boundary conditions of the field. Subfields restricted to
+     * a label use the label with the same name on the coarse level.
+     *
+     * @param[in] field Field with layout and coarse mesh hierarchy.
+     */
+    static
+    void createCoarseHierarchy(const pylith::topology::Field& field);
+
     /** Free saved PetscFE objects.
      */
     static
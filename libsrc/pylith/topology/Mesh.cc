@@ -96,6 +96,13 @@ pylith::topology::Mesh::clone(void) const {
         const char* name = NULL;
         err = PetscObjectGetName((PetscObject)this->_dm, &name);PYLITH_CHECK_ERROR(err);
         err = PetscObjectSetName((PetscObject)mesh->_dm,  name);PYLITH_CHECK_ERROR(err);
+
+        // Keep the refinement hierarchy (if any) for geometric multigrid.
+        PetscDM dmCoarse = NULL;
+        err = DMGetCoarseDM(this->_dm, &dmCoarse);PYLITH_CHECK_ERROR(err);
+        if (dmCoarse) {
+            err = DMSetCoarseDM(mesh->_dm, dmCoarse);PYLITH_CHECK_ERROR(err);
+        } // if
     } // if
 
     PYLITH_METHOD_RETURN(mesh);
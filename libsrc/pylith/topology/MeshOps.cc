@@ -225,6 +225,16 @@ pylith::topology::MeshOps::nondimensionalize(Mesh* const mesh,
     err = DMPlexSetScale(dmMesh, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
     err = DMViewFromOptions(dmMesh, NULL, "-pylith_nondim_dm_view");PYLITH_CHECK_ERROR(err);
 
+    // Coarser levels from uniform refinement are used in geometric multigrid.
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(dmMesh, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    while (dmCoarse) {
+        err = DMGetCoordinatesLocal(dmCoarse, &coordVec);PYLITH_CHECK_ERROR(err);assert(coordVec);
+        err = VecScale(coordVec, 1.0/lengthScale);PYLITH_CHECK_ERROR(err);
+        err = DMPlexSetScale(dmCoarse, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    } // while
+
     const PetscInt dim = mesh->getDimension();
     if (dim < 1) {
         PYLITH_METHOD_END;
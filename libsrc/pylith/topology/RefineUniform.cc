@@ -28,6 +28,23 @@
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _RefineUniform {
+public:
+
+            /** Remove all points that are not cells from cells label.
+             *
+             * @param[inout] dm PETSc DM for mesh.
+             */
+            static
+            void removeNonCellsFromLabel(PetscDM dm);
+
+        };
+    }
+}
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::topology::RefineUniform::RefineUniform(void) {}
@@ -79,24 +96,47 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     err = DMRefine(dmOrig, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
 
+    // Keep the coarser levels so they can be used as a geometric multigrid hierarchy. Each level
+    // holds a reference to the next coarser level, so the intermediate levels persist after we
+    // release our references.
+    err = DMSetCoarseDM(dmNew, dmOrig);PYLITH_CHECK_ERROR(err);
     for (int i = 1; i < levels; ++i) {
         PetscDM dmCur = dmNew;dmNew = NULL;
+        _RefineUniform::removeNonCellsFromLabel(dmCur);
         err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
         err = DMRefine(dmCur, mesh.getComm(), &dmNew);PYLITH_CHECK_ERROR(err);
+        err = DMSetCoarseDM(dmNew, dmCur);PYLITH_CHECK_ERROR(err);
 
         err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
     } // for
 
     newMesh->setDM(dmNew);
+    _RefineUniform::removeNonCellsFromLabel(dmNew);
+
+    // Check consistency
+    topology::MeshOps::checkTopology(*newMesh);
+
+    // newMesh->view("REFINED_MESH", "::ascii_info_detail");
+
+    PYLITH_METHOD_END;
+} // refine
+
+
+// ------------------------------------------------------------------------------------------------
+// Remove all points that are not cells from cells label.
+void
+pylith::topology::_RefineUniform::removeNonCellsFromLabel(PetscDM dm) {
+    PYLITH_METHOD_BEGIN;
+    assert(dm);
 
-    // Remove all non-cells from cells label
     const char* const labelName = pylith::topology::Mesh::cells_label_name;
     PetscDMLabel matidLabel = NULL;
     PetscIS valuesIS = NULL;
     const PetscInt *values = NULL;
     PetscInt cStart, cEnd, labelNumValues;
-    err = DMPlexGetHeightStratum(dmNew, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
-    err = DMGetLabel(dmNew, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err = 0;
+    err = DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, labelName, &matidLabel);PYLITH_CHECK_ERROR(err);
     err = DMLabelGetNumValues(matidLabel, &labelNumValues);PYLITH_CHECK_ERROR(err);
     err = DMLabelGetValueIS(matidLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
     err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
@@ -120,13 +160,8 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
     err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
 
-    // Check consistency
-    topology::MeshOps::checkTopology(*newMesh);
-
-    // newMesh->view("REFINED_MESH", "::ascii_info_detail");
-
     PYLITH_METHOD_END;
-} // refine
+} // removeNonCellsFromLabel
 
 
 // End of file
@@ -0,0 +1,227 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SpaceFillingCurve.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::isCohesiveCell()
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::sort()
+#include <vector> // USES std::vector
+#include <map> // USES std::map
+#include <utility> // USES std::pair
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _SpaceFillingCurve {
+public:
+
+            /// Sort key for a point within a depth stratum.
+            struct PointKey {
+                bool isCohesive; ///< True if point is a cohesive cell.
+                PetscInt block; ///< First point (original numbering) in material block.
+                uint64_t index; ///< Hilbert index of centroid.
+                PetscInt point; ///< Point in original numbering.
+
+                bool operator<(const PointKey& other) const {
+                    if (isCohesive != other.isCohesive) { return !isCohesive; }
+                    if (block != other.block) { return block < other.block; }
+                    if (index != other.index) { return index < other.index; }
+                    return point < other.point;
+                } // operator<
+
+            }; // PointKey
+
+        }; // _SpaceFillingCurve
+    } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Reorder vertices and cells in mesh.
+void
+pylith::topology::SpaceFillingCurve::reorder(topology::Mesh* mesh) {
+    PYLITH_METHOD_BEGIN;
+    assert(mesh);
+    PetscErrorCode err = 0;
+
+    PetscDM dmOrig = mesh->getDM();assert(dmOrig);
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmOrig, &spaceDim);PYLITH_CHECK_ERROR(err);
+    assert(spaceDim > 0 && spaceDim <= 3);
+
+    // Map bounding box to unit hypercube using same scale in all directions.
+    PetscReal bboxMin[3] = { 0.0, 0.0, 0.0 };
+    PetscReal bboxMax[3] = { 0.0, 0.0, 0.0 };
+    err = DMGetBoundingBox(dmOrig, bboxMin, bboxMax);PYLITH_CHECK_ERROR(err);
+    PylithReal bboxSize = 0.0;
+    for (PetscInt i = 0; i < spaceDim; ++i) {
+        bboxSize = std::max(bboxSize, PylithReal(bboxMax[i] - bboxMin[i]));
+    } // for
+    if (bboxSize <= 0.0) { bboxSize = 1.0; }
+
+    PetscInt pStart = 0, pEnd = 0, cStart = 0, cEnd = 0, vStart = 0, vEnd = 0, depth = 0;
+    err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHeightStratum(dmOrig, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dmOrig, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepth(dmOrig, &depth);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel dmLabel = NULL;
+    const char* const labelName = pylith::topology::Mesh::cells_label_name;
+    err = DMGetLabel(dmOrig, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);
+
+    // Blocks of cells are identified by the first cell (in the original
+    // numbering) with a given material label value. Cohesive cells are
+    // always kept after the other cells.
+    typedef std::pair<bool, PetscInt> block_key;
+    std::map<block_key, PetscInt> blockStart;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt labelValue = -1;
+        if (dmLabel) {
+            err = DMLabelGetValue(dmLabel, cell, &labelValue);PYLITH_CHECK_ERROR(err);
+        } // if
+        const block_key key(pylith::topology::MeshOps::isCohesiveCell(dmOrig, cell), labelValue);
+        if (blockStart.find(key) == blockStart.end()) {
+            blockStart[key] = cell;
+        } // if
+    } // for
+
+    CoordsVisitor coordsVisitor(dmOrig);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();assert(coordsArray);
+
+    std::vector<PetscInt> permutation(pEnd - pStart, -1);
+    std::vector<_SpaceFillingCurve::PointKey> keys;
+    for (PetscInt iDepth = 0; iDepth <= depth; ++iDepth) {
+        PetscInt sStart = 0, sEnd = 0;
+        err = DMPlexGetDepthStratum(dmOrig, iDepth, &sStart, &sEnd);PYLITH_CHECK_ERROR(err);
+        keys.resize(sEnd - sStart);
+        for (PetscInt point = sStart; point < sEnd; ++point) {
+            // Centroid of vertices in closure.
+            PylithReal centroid[3] = { 0.0, 0.0, 0.0 };
+            PetscInt* closure = NULL;
+            PetscInt closureSize = 0;
+            PetscInt numVertices = 0;
+            err = DMPlexGetTransitiveClosure(dmOrig, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iClosure = 0; iClosure < 2*closureSize; iClosure += 2) {
+                const PetscInt vertex = closure[iClosure];
+                if ((vertex < vStart) || (vertex >= vEnd)) { continue; }
+                const PetscInt off = coordsVisitor.sectionOffset(vertex);
+                for (PetscInt i = 0; i < spaceDim; ++i) {
+                    centroid[i] += coordsArray[off+i];
+                } // for
+                ++numVertices;
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmOrig, point, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            assert(numVertices > 0);
+            for (PetscInt i = 0; i < spaceDim; ++i) {
+                centroid[i] = (centroid[i] / numVertices - bboxMin[i]) / bboxSize;
+            } // for
+
+            _SpaceFillingCurve::PointKey& key = keys[point - sStart];
+            key.isCohesive = false;
+            key.block = 0;
+            key.index = _hilbertIndex(centroid, spaceDim);
+            key.point = point;
+            if ((point >= cStart) && (point < cEnd)) {
+                PetscInt labelValue = -1;
+                if (dmLabel) {
+                    err = DMLabelGetValue(dmLabel, point, &labelValue);PYLITH_CHECK_ERROR(err);
+                } // if
+                key.isCohesive = pylith::topology::MeshOps::isCohesiveCell(dmOrig, point);
+                key.block = blockStart[block_key(key.isCohesive, labelValue)];
+            } // if
+        } // for
+
+        std::sort(keys.begin(), keys.end());
+        for (PetscInt iKey = 0; iKey < sEnd - sStart; ++iKey) {
+            permutation[keys[iKey].point - pStart] = sStart + iKey;
+        } // for
+    } // for
+
+    PetscIS permutationIS = NULL;
+    PetscDM dmNew = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, pEnd - pStart, &permutation[0], PETSC_COPY_VALUES, &permutationIS);PYLITH_CHECK_ERROR(err);
+    err = DMPlexPermute(dmOrig, permutationIS, &dmNew);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&permutationIS);PYLITH_CHECK_ERROR(err);
+    mesh->setDM(dmNew);
+
+    PYLITH_METHOD_END;
+} // reorder
+
+
+// ----------------------------------------------------------------------
+// Compute Hilbert index of point in unit hypercube.
+uint64_t
+pylith::topology::SpaceFillingCurve::_hilbertIndex(const PylithReal xyz[],
+                                                   const int dim) {
+    assert(dim > 0 && dim <= 3);
+
+    // Number of bits per dimension so that the index fits in 63 bits.
+    const int numBits = 63 / dim;
+    const uint64_t maxCoord = (uint64_t(1) << numBits) - 1;
+
+    uint64_t x[3] = { 0, 0, 0 };
+    for (int i = 0; i < dim; ++i) {
+        const PylithReal value = std::min(PylithReal(1.0), std::max(PylithReal(0.0), xyz[i]));
+        x[i] = uint64_t(value * maxCoord);
+    } // for
+
+    // Convert axes to transposed Hilbert index (J. Skilling, 2004,
+    // Programming the Hilbert curve, AIP Conf. Proc. 707, 381).
+    const uint64_t highBit = uint64_t(1) << (numBits - 1);
+    for (uint64_t q = highBit; q > 1; q >>= 1) {
+        const uint64_t p = q - 1;
+        for (int i = 0; i < dim; ++i) {
+            if (x[i] & q) {
+                x[0] ^= p;
+            } else {
+                const uint64_t t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            } // if/else
+        } // for
+    } // for
+    for (int i = 1; i < dim; ++i) {
+        x[i] ^= x[i-1];
+    } // for
+    uint64_t t = 0;
+    for (uint64_t q = highBit; q > 1; q >>= 1) {
+        if (x[dim-1] & q) { t ^= q - 1; }
+    } // for
+    for (int i = 0; i < dim; ++i) {
+        x[i] ^= t;
+    } // for
+
+    // Interleave bits of transposed index.
+    uint64_t index = 0;
+    for (int iBit = numBits-1; iBit >= 0; --iBit) {
+        for (int i = 0; i < dim; ++i) {
+            index = (index << 1) | ((x[i] >> iBit) & 1);
+        } // for
+    } // for
+
+    return index;
+} // _hilbertIndex
+
+
+// End of file
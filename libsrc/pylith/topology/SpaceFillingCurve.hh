@@ -0,0 +1,75 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Reordering of mesh points along a Hilbert space-filling curve.
+ */
+
+#if !defined(pylith_topology_spacefillingcurve_hh)
+#define pylith_topology_spacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // USES PylithReal
+
+#include <cstdint> // USES uint64_t
+
+// SpaceFillingCurve ----------------------------------------------------
+/** Reordering of mesh points along a Hilbert space-filling curve.
+ *
+ * Points in each depth stratum are sorted by the Hilbert index of their
+ * centroid. Cells are sorted within each block of the material label,
+ * so cells with the same material remain consecutive, and cohesive cells
+ * remain after all other cells.
+ */
+class pylith::topology::SpaceFillingCurve
+{ // SpaceFillingCurve
+  friend class TestSpaceFillingCurve; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Reorder vertices and cells of mesh using Hilbert space-filling curve.
+   *
+   * @param mesh PyLith finite-element mesh.
+   */
+  static
+  void reorder(topology::Mesh* mesh);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  /** Compute Hilbert index of point in unit hypercube.
+   *
+   * @param xyz Coordinates of point, scaled to [0,1].
+   * @param dim Spatial dimension (1, 2, or 3).
+   * @returns Index of point along Hilbert curve.
+   */
+  static
+  uint64_t _hilbertIndex(const PylithReal xyz[],
+                         const int dim);
+
+}; // SpaceFillingCurve
+
+#endif // pylith_topology_spacefillingcurve_hh
+
+
+// End of file 
@@ -54,6 +54,7 @@ namespace pylith {
         class Distributor;
         class RefineUniform;
         class ReverseCuthillMcKee;
+        class SpaceFillingCurve;
 
     } // topology
 } // pylith
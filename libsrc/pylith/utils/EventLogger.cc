@@ -76,6 +76,8 @@ pylith::utils::EventLogger::registerEvent(const char* name) {
         throw std::runtime_error(msg.str());
     } // if
     _events[name] = id;
+    TimerTree::registerEvent(id, name);
+
     PYLITH_METHOD_RETURN(id);
 } // registerEvent
 
@@ -112,6 +114,7 @@ pylith::utils::EventLogger::registerStage(const char* name) {
         throw std::runtime_error(msg.str());
     } // if
     _stages[name] = id;
+    TimerTree::registerStage(id, name);
 
     PYLITH_METHOD_RETURN(id);
 } // registerStage
@@ -22,6 +22,7 @@
  * @brief C++ object for managing event logging using PETSc.
  *
  * Each logger object manages the events for a single "logging class".
+ * Events and stages are also added to the TimerTree when it is enabled.
  */
 
 #if !defined(pylith_utils_eventlogger_hh)
@@ -29,6 +30,7 @@
 
 // Include directives ---------------------------------------------------
 #include "utilsfwd.hh" // forward declarations
+#include "TimerTree.hh" // USES TimerTree in inline methods
 
 #include <string> // USES std::string
 #include <map> // USES std::map
@@ -29,6 +29,7 @@
 #include "pylith/utils/mpi.hh" // USES isRoot()
 
 #include <cassert>
+#include <sstream> // USES std::ostringstream
 
 namespace pylith {
     namespace utils {
@@ -57,6 +58,23 @@ public:
             static
             bool hasFault(const pylith::topology::Field& solution);
 
+            /** Get number of levels in mesh refinement hierarchy.
+             *
+             * @param[in] solution Solution field for problem.
+             * @returns Number of levels (1 if mesh was not refined).
+             */
+            static
+            int getNumMeshLevels(const pylith::topology::Field& solution);
+
+            /** Replace algebraic multigrid with geometric multigrid using mesh refinement hierarchy.
+             *
+             * @param[in] options PETSc options.
+             * @param[in] numLevels Number of levels in mesh refinement hierarchy.
+             */
+            static
+            void addGeometricMultigrid(PetscOptions* options,
+                                       const int numLevels);
+
             /** Add debugging options.
              *
              * @param[in] options PETSc options.
@@ -120,6 +138,13 @@ pylith::utils::PetscDefaults::set(const pylith::topology::Field& solution,
         options = new PetscOptions();
     } // if
     assert(options);
+    if (flags & SOLVER) {
+        const int numMeshLevels = _PetscOptions::getNumMeshLevels(solution);
+        if (numMeshLevels > 1) {
+            _PetscOptions::addGeometricMultigrid(options, numMeshLevels);
+        } // if
+    } // if
+    assert(options);
 
     _PetscOptions::addSolverTolerances(options);
     if (flags & INITIAL_GUESS) {
@@ -171,6 +196,15 @@ pylith::utils::PetscOptions::remove(const char* name) {
 } // remove
 
 
+// ------------------------------------------------------------------------------------------------
+// Get value of PETSc option.
+const char*
+pylith::utils::PetscOptions::get(const char* name) const {
+    const options_t::const_iterator iter = _options.find(std::string(name));
+    return (_options.end() != iter) ? iter->second.c_str() : NULL;
+} // get
+
+
 // ------------------------------------------------------------------------------------------------
 // Clear PETSc options.
 void
@@ -285,6 +319,56 @@ pylith::utils::_PetscOptions::hasFault(const pylith::topology::Field& solution)
 } // hasFault
 
 
+// ------------------------------------------------------------------------------------------------
+// Get number of levels in mesh refinement hierarchy.
+int
+pylith::utils::_PetscOptions::getNumMeshLevels(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    int numLevels = 1;
+    PetscDM dmCoarse = NULL;
+    PetscErrorCode err = DMGetCoarseDM(solution.getDM(), &dmCoarse);PYLITH_CHECK_ERROR(err);
+    while (dmCoarse) {
+        ++numLevels;
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    } // while
+
+    PYLITH_METHOD_RETURN(numLevels);
+} // getNumMeshLevels
+
+
+// ------------------------------------------------------------------------------------------------
+// Replace algebraic multigrid with geometric multigrid using mesh refinement hierarchy.
+void
+pylith::utils::_PetscOptions::addGeometricMultigrid(PetscOptions* options,
+                                                    const int numLevels) {
+    assert(options);
+
+    // Only the displacement block (or the entire system without a fault) uses algebraic
+    // multigrid. Keep direct solvers in serial.
+    std::string prefix;
+    const PetscOptions::options_t::const_iterator iterPC = options->_options.find("-pc_type");
+    const PetscOptions::options_t::const_iterator iterDisp = options->_options.find("-fieldsplit_displacement_pc_type");
+    if ((options->_options.end() != iterPC) && ("gamg" == iterPC->second)) {
+        prefix = "-";
+    } else if ((options->_options.end() != iterDisp) && (("gamg" == iterDisp->second) || ("ml" == iterDisp->second))) {
+        prefix = "-fieldsplit_displacement_";
+    } else {
+        return;
+    } // if/else
+
+    // Coarse level operators are computed using Galerkin projection, so we do not need to
+    // integrate the Jacobian on the coarser meshes.
+    std::ostringstream levels;
+    levels << numLevels;
+    options->add((prefix + "pc_type").c_str(), "mg");
+    options->add((prefix + "pc_mg_levels").c_str(), levels.str().c_str());
+    options->add((prefix + "pc_mg_galerkin").c_str(), "both");
+    options->add((prefix + "mg_levels_ksp_type").c_str(), "richardson");
+    options->add((prefix + "mg_levels_pc_type").c_str(), "sor");
+} // addGeometricMultigrid
+
+
 // ------------------------------------------------------------------------------------------------
 // Add debugging options.
 void
@@ -94,6 +94,13 @@ public:
      */
     void remove(const char* name);
 
+    /** Get value of PETSc option.
+     *
+     * @param[in] name Option name.
+     * @returns Option value or NULL if the option has not been added.
+     */
+    const char* get(const char* name) const;
+
     /// Clear PETSc options.
     void clear(void);
 
@@ -0,0 +1,706 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimerTree.hh" // Implementation of class methods
+
+#include "error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petsc.h" // USES PetscTime(), PetscMemoryGetCurrentUsage()
+#include "petsctime.h" // USES PetscTime()
+
+#include <vector> // USES std::vector
+#include <map> // USES std::map
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream, std::istringstream
+#include <iomanip> // USES std::setprecision
+#include <algorithm> // USES std::min(), std::max()
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace utils {
+        class _TimerTree {
+public:
+
+            /// Timer in tree on a single process.
+            struct Node {
+                std::string name;
+                Node* parent;
+                std::vector<Node*> children;
+                PetscLogDouble time;
+                PetscLogDouble tStart;
+                long count;
+                bool running;
+
+                Node(const std::string& nameValue,
+                     Node* parentValue) :
+                    name(nameValue),
+                    parent(parentValue),
+                    time(0.0),
+                    tStart(0.0),
+                    count(0),
+                    running(false) {}
+
+
+                ~Node(void) {
+                    for (size_t i = 0; i < children.size(); ++i) {
+                        delete children[i];
+                    } // for
+                } // destructor
+
+
+                Node* getChild(const std::string& childName) {
+                    for (size_t i = 0; i < children.size(); ++i) {
+                        if (children[i]->name == childName) {
+                            return children[i];
+                        } // if
+                    } // for
+                    children.push_back(new Node(childName, this));
+                    return children.back();
+                } // getChild
+
+            }; // Node
+
+            /// Timer in tree merged over processes.
+            struct MergedNode {
+                std::string name;
+                std::vector<MergedNode> children;
+                std::vector<double> time;
+                std::vector<double> count;
+
+                MergedNode(const std::string& nameValue,
+                           const int numProcs) :
+                    name(nameValue),
+                    time(numProcs, 0.0),
+                    count(numProcs, 0.0) {}
+
+
+                MergedNode* getChild(const std::string& childName,
+                                     const int numProcs) {
+                    for (size_t i = 0; i < children.size(); ++i) {
+                        if (children[i].name == childName) {
+                            return &children[i];
+                        } // if
+                    } // for
+                    children.push_back(MergedNode(childName, numProcs));
+                    return &children.back();
+                } // getChild
+
+            }; // MergedNode
+
+            /// Memory snapshot on a single process.
+            struct Snapshot {
+                std::string label;
+                PetscLogDouble current;
+                PetscLogDouble maximum;
+            }; // Snapshot
+
+            static bool enabled;
+            static Node* root;
+            static Node* current;
+            static PetscLogDouble tEnabled;
+            static std::map<int, std::string> events;
+            static std::map<int, std::string> stages;
+            static std::vector<std::string> stageStack;
+            static std::vector<Snapshot> snapshots;
+
+            /** Start timer.
+             *
+             * @param[in] name Name of timer.
+             */
+            static
+            void begin(const std::string& name);
+
+            /** Stop timer with given name and any timers nested within it.
+             *
+             * @param[in] name Name of timer.
+             */
+            static
+            void end(const std::string& name);
+
+            /** Stop timer.
+             *
+             * @param[in] node Timer.
+             * @param[in] t Current time.
+             */
+            static
+            void stop(Node* node,
+                      const PetscLogDouble t);
+
+            /** Append paths and values of timers to buffers for gathering across processes.
+             *
+             * @param[in] node Timer.
+             * @param[in] path Path of parent timer.
+             * @param[in] t Current time.
+             * @param[inout] paths Paths of timers (one per line).
+             * @param[inout] values Count and time for each timer.
+             */
+            static
+            void flatten(const Node& node,
+                         const std::string& path,
+                         const PetscLogDouble t,
+                         std::ostringstream* paths,
+                         std::vector<double>* values);
+
+            /** Gather strings to process 0.
+             *
+             * @param[in] value String on this process.
+             * @param[in] comm MPI communicator.
+             * @returns Strings from all processes (only on process 0).
+             */
+            static
+            std::vector<std::string> gatherStrings(const std::string& value,
+                                                   MPI_Comm comm);
+
+            /** Gather arrays of values to process 0.
+             *
+             * @param[in] values Values on this process.
+             * @param[in] comm MPI communicator.
+             * @returns Values from all processes (only on process 0).
+             */
+            static
+            std::vector<std::vector<double> > gatherValues(const std::vector<double>& values,
+                                                           MPI_Comm comm);
+
+            /** Write statistics (min, max, avg) of values over processes.
+             *
+             * @param[in] sout Output stream.
+             * @param[in] values Values over processes.
+             */
+            static
+            void writeStats(std::ostream& sout,
+                            const std::vector<double>& values);
+
+            /** Write merged timer and its children.
+             *
+             * @param[in] sout Output stream.
+             * @param[in] node Merged timer.
+             * @param[in] indent Indentation.
+             */
+            static
+            void writeNode(std::ostream& sout,
+                           const MergedNode& node,
+                           const std::string& indent);
+
+            /** Quote and escape string for JSON.
+             *
+             * @param[in] value String.
+             * @returns Quoted string.
+             */
+            static
+            std::string quote(const std::string& value);
+
+        }; // _TimerTree
+    } // utils
+} // pylith
+
+bool pylith::utils::_TimerTree::enabled = false;
+pylith::utils::_TimerTree::Node* pylith::utils::_TimerTree::root = NULL;
+pylith::utils::_TimerTree::Node* pylith::utils::_TimerTree::current = NULL;
+PetscLogDouble pylith::utils::_TimerTree::tEnabled = 0.0;
+std::map<int, std::string> pylith::utils::_TimerTree::events;
+std::map<int, std::string> pylith::utils::_TimerTree::stages;
+std::vector<std::string> pylith::utils::_TimerTree::stageStack;
+std::vector<pylith::utils::_TimerTree::Snapshot> pylith::utils::_TimerTree::snapshots;
+
+// ----------------------------------------------------------------------
+// Turn timers on/off.
+void
+pylith::utils::TimerTree::setEnabled(const bool value) {
+    PYLITH_METHOD_BEGIN;
+
+    if (value && !_TimerTree::root) {
+        _TimerTree::root = new _TimerTree::Node("", NULL);
+        _TimerTree::current = _TimerTree::root;
+        PetscErrorCode err = PetscTime(&_TimerTree::tEnabled);PYLITH_CHECK_ERROR(err);
+        err = PetscMemorySetGetMaximumUsage();PYLITH_CHECK_ERROR(err);
+    } // if
+    _TimerTree::enabled = value;
+
+    PYLITH_METHOD_END;
+} // setEnabled
+
+
+// ----------------------------------------------------------------------
+// Are timers on?
+bool
+pylith::utils::TimerTree::isEnabled(void) {
+    return _TimerTree::enabled;
+} // isEnabled
+
+
+// ----------------------------------------------------------------------
+// Remove all timers and memory snapshots.
+void
+pylith::utils::TimerTree::reset(void) {
+    delete _TimerTree::root;_TimerTree::root = NULL;
+    _TimerTree::current = NULL;
+    _TimerTree::stageStack.clear();
+    _TimerTree::snapshots.clear();
+    _TimerTree::enabled = false;
+} // reset
+
+
+// ----------------------------------------------------------------------
+// Start timer nested within current timer.
+void
+pylith::utils::TimerTree::begin(const char* name) {
+    if (_TimerTree::enabled) {
+        _TimerTree::begin(std::string(name));
+    } // if
+} // begin
+
+
+// ----------------------------------------------------------------------
+// Start timer nested within current timer.
+void
+pylith::utils::TimerTree::begin(const std::string& name) {
+    if (_TimerTree::enabled) {
+        _TimerTree::begin(name);
+    } // if
+} // begin
+
+
+// ----------------------------------------------------------------------
+// Stop current timer.
+void
+pylith::utils::TimerTree::end(void) {
+    if (!_TimerTree::enabled || (_TimerTree::current == _TimerTree::root)) {
+        return;
+    } // if
+    assert(_TimerTree::current);
+    PetscLogDouble t = 0.0;
+    PetscTime(&t);
+    _TimerTree::stop(_TimerTree::current, t);
+    _TimerTree::current = _TimerTree::current->parent;
+} // end
+
+
+// ----------------------------------------------------------------------
+// Associate name with PETSc event.
+void
+pylith::utils::TimerTree::registerEvent(const int id,
+                                        const char* name) {
+    _TimerTree::events[id] = name;
+} // registerEvent
+
+
+// ----------------------------------------------------------------------
+// Start timer for PETSc event.
+void
+pylith::utils::TimerTree::eventBegin(const int id) {
+    if (_TimerTree::enabled) {
+        std::map<int, std::string>::const_iterator iter = _TimerTree::events.find(id);
+        if (iter != _TimerTree::events.end()) {
+            _TimerTree::begin(iter->second);
+        } // if
+    } // if
+} // eventBegin
+
+
+// ----------------------------------------------------------------------
+// Stop timer for PETSc event.
+void
+pylith::utils::TimerTree::eventEnd(const int id) {
+    if (_TimerTree::enabled) {
+        std::map<int, std::string>::const_iterator iter = _TimerTree::events.find(id);
+        if (iter != _TimerTree::events.end()) {
+            _TimerTree::end(iter->second);
+        } // if
+    } // if
+} // eventEnd
+
+
+// ----------------------------------------------------------------------
+// Associate name with PETSc stage.
+void
+pylith::utils::TimerTree::registerStage(const int id,
+                                        const char* name) {
+    _TimerTree::stages[id] = name;
+} // registerStage
+
+
+// ----------------------------------------------------------------------
+// Start timer for PETSc stage and record memory usage.
+void
+pylith::utils::TimerTree::stagePush(const int id) {
+    if (_TimerTree::enabled) {
+        std::map<int, std::string>::const_iterator iter = _TimerTree::stages.find(id);
+        const std::string name = (iter != _TimerTree::stages.end()) ? iter->second : std::string("Stage");
+        snapshotMemory((name + " begin").c_str());
+        _TimerTree::stageStack.push_back(name);
+        _TimerTree::begin(name);
+    } // if
+} // stagePush
+
+
+// ----------------------------------------------------------------------
+// Stop timer for current PETSc stage and record memory usage.
+void
+pylith::utils::TimerTree::stagePop(void) {
+    if (_TimerTree::enabled && !_TimerTree::stageStack.empty()) {
+        const std::string name = _TimerTree::stageStack.back();
+        _TimerTree::stageStack.pop_back();
+        _TimerTree::end(name);
+        snapshotMemory((name + " end").c_str());
+    } // if
+} // stagePop
+
+
+// ----------------------------------------------------------------------
+// Record current and maximum memory usage.
+void
+pylith::utils::TimerTree::snapshotMemory(const char* label) {
+    PYLITH_METHOD_BEGIN;
+
+    if (_TimerTree::enabled) {
+        _TimerTree::Snapshot snapshot;
+        snapshot.label = label;
+        // Getting the current usage also updates the maximum usage.
+        PetscErrorCode err = PetscMemoryGetCurrentUsage(&snapshot.current);PYLITH_CHECK_ERROR(err);
+        err = PetscMemoryGetMaximumUsage(&snapshot.maximum);PYLITH_CHECK_ERROR(err);
+        _TimerTree::snapshots.push_back(snapshot);
+    } // if
+
+    PYLITH_METHOD_END;
+} // snapshotMemory
+
+
+// ----------------------------------------------------------------------
+// Write timers and memory snapshots to JSON file.
+void
+pylith::utils::TimerTree::write(const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    if (!_TimerTree::root) {
+        PYLITH_METHOD_END;
+    } // if
+
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    int commRank = 0;
+    int commSize = 0;
+    PetscErrorCode err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+    PetscLogDouble t = 0.0;
+    err = PetscTime(&t);PYLITH_CHECK_ERROR(err);
+
+    // Flatten timers into paths and values.
+    std::ostringstream paths;
+    std::vector<double> values;
+    for (size_t i = 0; i < _TimerTree::root->children.size(); ++i) {
+        _TimerTree::flatten(*_TimerTree::root->children[i], "", t, &paths, &values);
+    } // for
+    const std::vector<std::string>& pathsAll = _TimerTree::gatherStrings(paths.str(), comm);
+    const std::vector<std::vector<double> >& valuesAll = _TimerTree::gatherValues(values, comm);
+
+    // Memory snapshots.
+    std::vector<double> memory;
+    for (size_t i = 0; i < _TimerTree::snapshots.size(); ++i) {
+        memory.push_back(_TimerTree::snapshots[i].current);
+        memory.push_back(_TimerTree::snapshots[i].maximum);
+    } // for
+    const std::vector<std::vector<double> >& memoryAll = _TimerTree::gatherValues(memory, comm);
+
+    std::vector<double> elapsed(1, t - _TimerTree::tEnabled);
+    const std::vector<std::vector<double> >& elapsedAll = _TimerTree::gatherValues(elapsed, comm);
+
+    if (commRank > 0) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Merge timers from all processes into a single tree.
+    _TimerTree::MergedNode merged("", commSize);
+    for (int iProc = 0; iProc < commSize; ++iProc) {
+        std::istringstream sin(pathsAll[iProc]);
+        std::string path;
+        size_t iValue = 0;
+        while (std::getline(sin, path)) {
+            _TimerTree::MergedNode* node = &merged;
+            std::istringstream sinPath(path);
+            std::string name;
+            while (std::getline(sinPath, name, '\x1f')) {
+                node = node->getChild(name, commSize);
+            } // while
+            assert(2*iValue+1 < valuesAll[iProc].size());
+            node->count[iProc] = valuesAll[iProc][2*iValue+0];
+            node->time[iProc] = valuesAll[iProc][2*iValue+1];
+            ++iValue;
+        } // while
+    } // for
+
+    std::ofstream fout(filename);
+    if (!fout.is_open() || !fout.good()) {
+        std::ostringstream msg;
+        msg << "Could not open file '" << filename << "' for writing timers.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    std::vector<double> elapsedProcs(commSize);
+    for (int iProc = 0; iProc < commSize; ++iProc) {
+        elapsedProcs[iProc] = elapsedAll[iProc][0];
+    } // for
+
+    fout << std::setprecision(6);
+    fout << "{\n"
+         << "  \"num_processes\": " << commSize << ",\n"
+         << "  \"elapsed_time\": ";
+    _TimerTree::writeStats(fout, elapsedProcs);
+    fout << ",\n"
+         << "  \"timers\": [";
+    for (size_t i = 0; i < merged.children.size(); ++i) {
+        fout << (i > 0 ? "," : "") << "\n";
+        _TimerTree::writeNode(fout, merged.children[i], "    ");
+    } // for
+    fout << "\n  ],\n"
+         << "  \"memory\": [";
+
+    // Snapshots are taken at collective stage boundaries, so all processes should have the same number.
+    size_t numSnapshots = _TimerTree::snapshots.size();
+    for (int iProc = 0; iProc < commSize; ++iProc) {
+        numSnapshots = std::min(numSnapshots, memoryAll[iProc].size() / 2);
+    } // for
+    std::vector<double> currentProcs(commSize);
+    std::vector<double> maximumProcs(commSize);
+    for (size_t iSnapshot = 0; iSnapshot < numSnapshots; ++iSnapshot) {
+        for (int iProc = 0; iProc < commSize; ++iProc) {
+            currentProcs[iProc] = memoryAll[iProc][2*iSnapshot+0];
+            maximumProcs[iProc] = memoryAll[iProc][2*iSnapshot+1];
+        } // for
+        fout << (iSnapshot > 0 ? "," : "") << "\n"
+             << "    {\"label\": " << _TimerTree::quote(_TimerTree::snapshots[iSnapshot].label)
+             << ", \"current\": ";
+        _TimerTree::writeStats(fout, currentProcs);
+        fout << ", \"maximum\": ";
+        _TimerTree::writeStats(fout, maximumProcs);
+        fout << "}";
+    } // for
+    fout << "\n  ]\n"
+         << "}\n";
+    fout.close();
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// ----------------------------------------------------------------------
+// Start timer.
+void
+pylith::utils::_TimerTree::begin(const std::string& name) {
+    assert(current);
+    Node* node = current->getChild(name);assert(node);
+    PetscTime(&node->tStart);
+    node->running = true;
+    node->count += 1;
+    current = node;
+} // begin
+
+
+// ----------------------------------------------------------------------
+// Stop timer with given name and any timers nested within it.
+void
+pylith::utils::_TimerTree::end(const std::string& name) {
+    assert(current);
+    Node* node = current;
+    while (node != root && node->name != name) {
+        node = node->parent;
+    } // while
+    if (node == root) {
+        return; // Timer was started before timers were turned on.
+    } // if
+
+    PetscLogDouble t = 0.0;
+    PetscTime(&t);
+    while (current != node) {
+        stop(current, t);
+        current = current->parent;
+    } // while
+    stop(node, t);
+    current = node->parent;
+} // end
+
+
+// ----------------------------------------------------------------------
+// Stop timer.
+void
+pylith::utils::_TimerTree::stop(Node* node,
+                                const PetscLogDouble t) {
+    assert(node);
+    if (node->running) {
+        node->time += t - node->tStart;
+        node->running = false;
+    } // if
+} // stop
+
+
+// ----------------------------------------------------------------------
+// Append paths and values of timers to buffers.
+void
+pylith::utils::_TimerTree::flatten(const Node& node,
+                                   const std::string& path,
+                                   const PetscLogDouble t,
+                                   std::ostringstream* paths,
+                                   std::vector<double>* values) {
+    assert(paths);
+    assert(values);
+
+    const std::string nodePath = path.empty() ? node.name : path + '\x1f' + node.name;
+    *paths << nodePath << "\n";
+    values->push_back(node.count);
+    values->push_back(node.running ? node.time + (t - node.tStart) : node.time);
+    for (size_t i = 0; i < node.children.size(); ++i) {
+        flatten(*node.children[i], nodePath, t, paths, values);
+    } // for
+} // flatten
+
+
+// ----------------------------------------------------------------------
+// Gather strings to process 0.
+std::vector<std::string>
+pylith::utils::_TimerTree::gatherStrings(const std::string& value,
+                                         MPI_Comm comm) {
+    int commRank = 0;
+    int commSize = 0;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+
+    int size = value.size();
+    std::vector<int> sizes(commSize, 0);
+    MPI_Gather(&size, 1, MPI_INT, &sizes[0], 1, MPI_INT, 0, comm);
+
+    std::vector<int> offsets(commSize, 0);
+    for (int iProc = 1; iProc < commSize; ++iProc) {
+        offsets[iProc] = offsets[iProc-1] + sizes[iProc-1];
+    } // for
+    std::vector<char> buffer(offsets[commSize-1] + sizes[commSize-1] + 1);
+    MPI_Gatherv(const_cast<char*>(value.c_str()), size, MPI_CHAR, &buffer[0], &sizes[0], &offsets[0], MPI_CHAR, 0, comm);
+
+    std::vector<std::string> strings;
+    if (0 == commRank) {
+        for (int iProc = 0; iProc < commSize; ++iProc) {
+            strings.push_back(std::string(&buffer[offsets[iProc]], sizes[iProc]));
+        } // for
+    } // if
+    return strings;
+} // gatherStrings
+
+
+// ----------------------------------------------------------------------
+// Gather arrays of values to process 0.
+std::vector<std::vector<double> >
+pylith::utils::_TimerTree::gatherValues(const std::vector<double>& values,
+                                        MPI_Comm comm) {
+    int commRank = 0;
+    int commSize = 0;
+    MPI_Comm_rank(comm, &commRank);
+    MPI_Comm_size(comm, &commSize);
+
+    int size = values.size();
+    std::vector<int> sizes(commSize, 0);
+    MPI_Gather(&size, 1, MPI_INT, &sizes[0], 1, MPI_INT, 0, comm);
+
+    std::vector<int> offsets(commSize, 0);
+    for (int iProc = 1; iProc < commSize; ++iProc) {
+        offsets[iProc] = offsets[iProc-1] + sizes[iProc-1];
+    } // for
+    std::vector<double> buffer(offsets[commSize-1] + sizes[commSize-1] + 1);
+    MPI_Gatherv(size > 0 ? const_cast<double*>(&values[0]) : NULL, size, MPI_DOUBLE,
+                &buffer[0], &sizes[0], &offsets[0], MPI_DOUBLE, 0, comm);
+
+    std::vector<std::vector<double> > valuesAll;
+    if (0 == commRank) {
+        for (int iProc = 0; iProc < commSize; ++iProc) {
+            valuesAll.push_back(std::vector<double>(buffer.begin() + offsets[iProc],
+                                                    buffer.begin() + offsets[iProc] + sizes[iProc]));
+        } // for
+    } // if
+    return valuesAll;
+} // gatherValues
+
+
+// ----------------------------------------------------------------------
+// Write statistics of values over processes.
+void
+pylith::utils::_TimerTree::writeStats(std::ostream& sout,
+                                      const std::vector<double>& values) {
+    assert(values.size() > 0);
+    double vmin = values[0];
+    double vmax = values[0];
+    double sum = 0.0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        vmin = std::min(vmin, values[i]);
+        vmax = std::max(vmax, values[i]);
+        sum += values[i];
+    } // for
+    sout << "{\"min\": " << vmin << ", \"max\": " << vmax << ", \"avg\": " << sum / values.size() << "}";
+} // writeStats
+
+
+// ----------------------------------------------------------------------
+// Write merged timer and its children.
+void
+pylith::utils::_TimerTree::writeNode(std::ostream& sout,
+                                     const MergedNode& node,
+                                     const std::string& indent) {
+    double timeMax = 0.0;
+    double timeSum = 0.0;
+    for (size_t i = 0; i < node.time.size(); ++i) {
+        timeMax = std::max(timeMax, node.time[i]);
+        timeSum += node.time[i];
+    } // for
+    const double timeAvg = timeSum / node.time.size();
+    const double imbalance = (timeAvg > 0.0) ? timeMax / timeAvg : 1.0;
+
+    sout << indent << "{\"name\": " << quote(node.name) << ", \"count\": ";
+    writeStats(sout, node.count);
+    sout << ", \"time\": ";
+    writeStats(sout, node.time);
+    sout << ", \"imbalance\": " << imbalance;
+    if (node.children.size() > 0) {
+        sout << ", \"children\": [";
+        for (size_t i = 0; i < node.children.size(); ++i) {
+            sout << (i > 0 ? "," : "") << "\n";
+            writeNode(sout, node.children[i], indent + "  ");
+        } // for
+        sout << "\n" << indent << "]";
+    } // if
+    sout << "}";
+} // writeNode
+
+
+// ----------------------------------------------------------------------
+// Quote and escape string for JSON.
+std::string
+pylith::utils::_TimerTree::quote(const std::string& value) {
+    std::string quoted = "\"";
+    for (size_t i = 0; i < value.size(); ++i) {
+        const char c = value[i];
+        if (('"' == c) || ('\\' == c)) {
+            quoted += '\\';
+        } // if
+        quoted += c;
+    } // for
+    quoted += "\"";
+    return quoted;
+} // quote
+
+
+// End of file
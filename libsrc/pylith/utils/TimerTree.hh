@@ -0,0 +1,159 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/TimerTree.hh
+ *
+ * @brief Nested timers and memory snapshots for a summary of a run.
+ *
+ * PETSc events and stages registered through EventLogger are added to
+ * the tree automatically when timing is enabled; other timers (for
+ * example, one per integrator or observer) are added with begin() and
+ * end(). Timers are nested according to the order in which they are
+ * started, so the same event shows up under each parent in which it
+ * occurs. Memory usage is recorded at stage boundaries.
+ *
+ * The tree is local to each process; write() reduces the timers over
+ * processes (min, max, average) and writes a JSON file on process 0.
+ */
+
+#if !defined(pylith_utils_timertree_hh)
+#define pylith_utils_timertree_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include <string> // USES std::string
+
+// TimerTree ------------------------------------------------------------
+/// @brief Nested timers and memory snapshots for a summary of a run.
+class pylith::utils::TimerTree { // TimerTree
+    friend class TestTimerTree; // unit testing
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /** Turn timers on/off.
+     *
+     * Turning timers on also turns on tracking of the maximum memory usage.
+     *
+     * @param[in] value True if timers are on, false otherwise.
+     */
+    static
+    void setEnabled(const bool value);
+
+    /** Are timers on?
+     *
+     * @returns True if timers are on, false otherwise.
+     */
+    static
+    bool isEnabled(void);
+
+    /// Remove all timers and memory snapshots.
+    static
+    void reset(void);
+
+    /** Start timer nested within current timer.
+     *
+     * @param[in] name Name of timer.
+     */
+    static
+    void begin(const char* name);
+
+    /** Start timer nested within current timer.
+     *
+     * @param[in] name Name of timer.
+     */
+    static
+    void begin(const std::string& name);
+
+    /// Stop current timer.
+    static
+    void end(void);
+
+    /** Associate name with PETSc event.
+     *
+     * @param[in] id PETSc event identifier.
+     * @param[in] name Name of event.
+     */
+    static
+    void registerEvent(const int id,
+                       const char* name);
+
+    /** Start timer for PETSc event.
+     *
+     * @param[in] id PETSc event identifier.
+     */
+    static
+    void eventBegin(const int id);
+
+    /** Stop timer for PETSc event.
+     *
+     * @param[in] id PETSc event identifier.
+     */
+    static
+    void eventEnd(const int id);
+
+    /** Associate name with PETSc stage.
+     *
+     * @param[in] id PETSc stage identifier.
+     * @param[in] name Name of stage.
+     */
+    static
+    void registerStage(const int id,
+                       const char* name);
+
+    /** Start timer for PETSc stage and record memory usage.
+     *
+     * @param[in] id PETSc stage identifier.
+     */
+    static
+    void stagePush(const int id);
+
+    /// Stop timer for current PETSc stage and record memory usage.
+    static
+    void stagePop(void);
+
+    /** Record current and maximum memory usage.
+     *
+     * @param[in] label Label for snapshot.
+     */
+    static
+    void snapshotMemory(const char* label);
+
+    /** Write timers and memory snapshots to JSON file.
+     *
+     * Collective over PETSC_COMM_WORLD; only process 0 writes the file.
+     *
+     * @param[in] filename Name of file.
+     */
+    static
+    void write(const char* filename);
+
+    // NOT IMPLEMENTED //////////////////////////////////////////////////////
+private:
+
+    TimerTree(void); ///< Not implemented
+    TimerTree(const TimerTree&); ///< Not implemented
+    const TimerTree& operator=(const TimerTree&); ///< Not implemented
+
+}; // TimerTree
+
+#endif // pylith_utils_timertree_hh
+
+// End of file
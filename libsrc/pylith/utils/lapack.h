@@ -28,6 +28,8 @@
 
 #include <petscblaslapack.h>
 #define lapack_dgesvd LAPACKgesvd_
+#define lapack_dgetrf LAPACKgetrf_
+#define lapack_dgetrs LAPACKgetrs_
 
 #endif // pylith_utils_lapack_h
 
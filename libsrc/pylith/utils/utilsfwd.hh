@@ -33,6 +33,7 @@ namespace pylith {
         class PetscDefaults;
 
         class EventLogger;
+        class TimerTree;
         class GenericComponent;
         class PyreComponent;
 
@@ -127,6 +127,17 @@ public:
              */
             void adjustTopology(pylith::topology::Mesh* const mesh);
 
+            /** Adjust mesh topology for several faults.
+             *
+             * @param mesh[in] PETSc mesh.
+             * @param[in] faults Array of faults.
+             * @param[in] numFaults Number of faults.
+             */
+            static
+            void adjustTopologyMultiple(pylith::topology::Mesh* const mesh,
+                                        pylith::faults::FaultCohesive* faults[],
+                                        const int numFaults);
+
             /** Create integrator and set kernels.
              *
              * @param[in] solution Solution field.
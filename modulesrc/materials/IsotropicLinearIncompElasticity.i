@@ -85,6 +85,14 @@ public:
              */
             PetscPointJac getKernelJf0pp(const spatialdata::geocoords::CoordSys* coordsys) const;
 
+            /** Get Jf0pp kernel for preconditioner of the Schur complement (scaled pressure mass matrix).
+             *
+             * @param[in] coordsys Coordinate system.
+             *
+             * @return LHS Jf0pp preconditioner kernel.
+             */
+            PetscPointJac getKernelJf0ppSchurPrecond(const spatialdata::geocoords::CoordSys* coordsys) const;
+
             /** Get Jf3uu kernel for LHS Jacobian F(t,s,\dot{s}).
              *
              * @param[in] coordsys Coordinate system.
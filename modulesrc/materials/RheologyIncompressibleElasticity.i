@@ -74,6 +74,15 @@ public:
             virtual
             PetscPointJac getKernelJf0pp(const spatialdata::geocoords::CoordSys* coordsys) const = 0;
 
+            /** Get Jf0pp kernel for preconditioner of the Schur complement (scaled pressure mass matrix).
+             *
+             * @param[in] coordsys Coordinate system.
+             *
+             * @return LHS Jf0pp preconditioner kernel.
+             */
+            virtual
+            PetscPointJac getKernelJf0ppSchurPrecond(const spatialdata::geocoords::CoordSys* coordsys) const = 0;
+
             /** Get Jf3uu kernel for LHS Jacobian F(t,s,\dot{s}).
              *
              * @param[in] coordsys Coordinate system.
@@ -0,0 +1,119 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/MeshIOBox.i
+ *
+ * @brief Python interface to C++ MeshIOBox object.
+ */
+
+namespace pylith {
+    namespace meshio {
+        class MeshIOBox: public MeshIO
+        { // MeshIOBox
+          // PUBLIC ENUMS ///////////////////////////////////////////////////
+public:
+
+            enum CellShapeEnum {
+                TENSOR=0,
+                SIMPLEX=1,
+            }; // CellShapeEnum
+
+            // PUBLIC METHODS /////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            MeshIOBox(void);
+
+            /// Destructor
+            ~MeshIOBox(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set coordinates of corner of box with minimum coordinates.
+             *
+             * @param[in] values Array of coordinates.
+             * @param[in] size Size of array (2 or 3).
+             */
+            %apply(double* IN_ARRAY1, int DIM1) {
+                (const PylithReal* values,
+                 const int size)
+            };
+            void setLower(const PylithReal* values,
+                          const int size);
+
+            /** Set coordinates of corner of box with maximum coordinates.
+             *
+             * @param[in] values Array of coordinates.
+             * @param[in] size Size of array (2 or 3).
+             */
+            void setUpper(const PylithReal* values,
+                          const int size);
+
+            %clear(const PylithReal* values, const int size);
+
+            /** Set number of cells in each direction.
+             *
+             * @param[in] values Array of number of cells in each direction.
+             * @param[in] size Size of array (2 or 3).
+             */
+            %apply(int* IN_ARRAY1, int DIM1) {
+                (const int* values,
+                 const int size)
+            };
+            void setNumCells(const int* values,
+                             const int size);
+
+            %clear(const int* values, const int size);
+
+            /** Set shape of cells.
+             *
+             * @param[in] value Shape of cells.
+             */
+            void setCellShape(const CellShapeEnum value);
+
+            /** Set x coordinates of faults normal to x axis.
+             *
+             * @param[in] xFaults Array of x coordinates of faults.
+             * @param[in] numFaults Number of faults.
+             */
+            %apply(double* IN_ARRAY1, int DIM1) {
+                (const PylithReal* xFaults,
+                 const int numFaults)
+            };
+            void setFaults(const PylithReal* xFaults,
+                           const int numFaults);
+
+            %clear(const PylithReal* xFaults, const int numFaults);
+
+            // PROTECTED METHODS //////////////////////////////////////////////
+protected:
+
+            /// Write mesh
+            void _write(void) const;
+
+            /// Read mesh
+            void _read(void);
+
+        }; // MeshIOBox
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -23,6 +23,8 @@
 %{
 #include "pylith/meshio/MeshIO.hh"
 #include "pylith/meshio/MeshIOAscii.hh"
+#include "pylith/meshio/MeshIOBinary.hh"
+#include "pylith/meshio/MeshIOBox.hh"
 #include "pylith/meshio/MeshIOLagrit.hh"
 #include "pylith/meshio/MeshIOPetsc.hh"
 #if defined(ENABLE_CUBIT)
@@ -77,6 +79,8 @@ import_array();
 %include "../problems/ObserverPhysics.i"
 %include "MeshIOObj.i"
 %include "MeshIOAscii.i"
+%include "MeshIOBinary.i"
+%include "MeshIOBox.i"
 %include "MeshIOLagrit.i"
 %include "MeshIOPetsc.i"
 #if defined(ENABLE_CUBIT)
@@ -33,6 +33,12 @@ public:
                 NONLINEAR, // Nonlinear solver.
             }; // SolverType
 
+            enum MatrixTypeEnum {
+                MATRIX_AIJ, // Compressed sparse row storage.
+                MATRIX_BAIJ, // Block compressed sparse row storage.
+                MATRIX_SBAIJ, // Symmetric block compressed sparse row storage (upper triangle).
+            }; // MatrixTypeEnum
+
             // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -69,6 +75,18 @@ public:
              */
             SolverTypeEnum getSolverType(void) const;
 
+            /** Set storage type for Jacobian and preconditioner matrices.
+             *
+             * @param[in] value Matrix storage type.
+             */
+            void setMatrixType(const MatrixTypeEnum value);
+
+            /** Get storage type for Jacobian and preconditioner matrices.
+             *
+             * @returns Matrix storage type.
+             */
+            MatrixTypeEnum getMatrixType(void) const;
+
             /** Specify which default PETSc options to use.
              *
              * @param[in] flags Flags indicating which default PETSc options to set.
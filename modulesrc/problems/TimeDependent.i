@@ -25,6 +25,15 @@
 namespace pylith {
     namespace problems {
         class TimeDependent : public pylith::problems::Problem {
+            // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            enum PredictorEnum {
+                PREDICTOR_NONE=0, // Start nonlinear solve from previous solution.
+                PREDICTOR_LINEAR=1, // Linear extrapolation from last 2 solutions.
+                PREDICTOR_QUADRATIC=2, // Quadratic extrapolation from last 3 solutions.
+            }; // PredictorEnum
+
             // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -73,6 +82,12 @@ public:
              */
             size_t getMaxTimeSteps(void) const;
 
+            /** Set maximum number of failed nonlinear solves retried with a smaller time step.
+             *
+             * @param[in] value Maximum number of failed nonlinear solves (0 terminates on first failure).
+             */
+            void setMaxNonlinearFailures(const int value);
+
             /** Set initial time step for problem.
              *
              * @param[in] value Initial time step (seconds).
@@ -101,6 +116,63 @@ public:
              */
             void setShouldNotifyIC(const bool value);
 
+            /** Set flag for selecting time step from material properties.
+             *
+             * @param[in] value True if time step should be selected from material properties.
+             */
+            void setAdaptTimeStep(const bool value);
+
+            /** Set safety factor for time step selected from material properties.
+             *
+             * @param[in] value Safety factor (time step is this factor times the stable time step).
+             */
+            void setTimeStepSafetyFactor(const double value);
+
+            /** Set flag for multirate local time stepping in explicit dynamic problems.
+             *
+             * @param[in] value True if using local time stepping, false otherwise.
+             */
+            void setLocalTimeStepping(const bool value);
+
+            /** Set flag for precomputing cell geometry for the RHS residual in explicit dynamic problems.
+             *
+             * @param[in] value True if precomputing cell geometry, false otherwise.
+             */
+            void setPrecomputeGeometry(const bool value);
+
+            /** Set flag for caching constant contributions to the LHS Jacobian.
+             *
+             * @param[in] value True if constant LHS Jacobian contributions should be cached.
+             */
+            void setCacheLHSJacobian(const bool value);
+
+            /** Set number of new LHS Jacobians between full rebuilds of the algebraic multigrid hierarchy.
+             *
+             * @param[in] value Number of new LHS Jacobians between full rebuilds (0 rebuilds every time).
+             */
+            void setMultigridRebuildInterval(const int value);
+
+            /** Set flag for applying Jacobi and SOR smoothers with a single precision copy of the matrix.
+             *
+             * @param[in] value True if using mixed precision smoothers, false otherwise.
+             */
+            void setMixedPrecisionSmoothers(const bool value);
+
+            /** Set predictor for initial guess of nonlinear solve in implicit time steps.
+             *
+             * @param[in] value Predictor type.
+             */
+            void setPredictor(const PredictorEnum value);
+
+            /** Get predictor for initial guess of nonlinear solve in implicit time steps.
+             *
+             * @returns Predictor type.
+             */
+            PredictorEnum getPredictor(void) const;
+
+            /// Clear history of solutions used by the predictor.
+            void clearPredictorHistory(void);
+
             /** Set progress monitor.
              *
              * @param[in] monitor Progress monitor for time-dependent simulation.
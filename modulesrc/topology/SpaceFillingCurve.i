@@ -0,0 +1,48 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Python interface to C++ PyLith SpaceFillingCurve object.
+ */
+
+namespace pylith {
+  namespace topology {
+
+    // SpaceFillingCurve ----------------------------------------------
+    class SpaceFillingCurve
+    { // SpaceFillingCurve
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /** Reorder vertices and cells of mesh using Hilbert space-filling curve.
+       *
+       * @param mesh PyLith finite-element mesh.
+       */
+      static
+      void reorder(topology::Mesh* mesh);
+
+    }; // SpaceFillingCurve
+
+  } // topology
+} // pylith
+
+
+// End of file
@@ -28,6 +28,7 @@
 #include "pylith/topology/Distributor.hh"
 #include "pylith/topology/RefineUniform.hh"
 #include "pylith/topology/ReverseCuthillMcKee.hh"
+#include "pylith/topology/SpaceFillingCurve.hh"
 %}
 
 %include "exception.i"
@@ -61,6 +62,7 @@ import_array();
 %include "Distributor.i"
 %include "RefineUniform.i"
 %include "ReverseCuthillMcKee.i"
+%include "SpaceFillingCurve.i"
 
 // End of file
 
@@ -0,0 +1,77 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/TimerTree.i
+ *
+ * @brief Python interface to C++ TimerTree.
+ */
+
+
+namespace pylith {
+  namespace utils {
+
+    class TimerTree
+    { // TimerTree
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /** Turn timers on/off.
+       *
+       * @param[in] value True if timers are on, false otherwise.
+       */
+      static
+      void setEnabled(const bool value);
+
+      /** Are timers on?
+       *
+       * @returns True if timers are on, false otherwise.
+       */
+      static
+      bool isEnabled(void);
+
+      /// Remove all timers and memory snapshots.
+      static
+      void reset(void);
+
+      /** Record current and maximum memory usage.
+       *
+       * @param[in] label Label for snapshot.
+       */
+      static
+      void snapshotMemory(const char* label);
+
+      /** Write timers and memory snapshots to JSON file.
+       *
+       * @param[in] filename Name of file.
+       */
+      static
+      void write(const char* filename);
+
+    private :
+
+      TimerTree(void); ///< Not implemented
+
+    }; // TimerTree
+
+  } // utils
+} // pylith
+
+
+// End of file 
@@ -22,6 +22,7 @@
 // Header files for module C++ code
 %{
 #include "pylith/utils/EventLogger.hh"
+#include "pylith/utils/TimerTree.hh"
 #include "pylith/utils/PyreComponent.hh"
 #include "pylith/utils/PetscOptions.hh"
 #include "pylith/utils/PylithVersion.hh"
@@ -58,6 +59,7 @@ import_array();
 // Interfaces
 %include "pylith_general.i"
 %include "EventLogger.i"
+%include "TimerTree.i"
 %include "PyreComponent.i"
 %include "PetscOptions.i"
 %include "PylithVersion.i"
@@ -0,0 +1,72 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/apps/ConvertMeshApp.py
+#
+# @brief Python application for converting meshes between PyLith mesh formats.
+
+from .PetscApplication import PetscApplication
+
+
+class ConvertMeshApp(PetscApplication):
+    """Python application for converting a mesh from one PyLith mesh format to another.
+
+    The typical use is converting large ASCII or Cubit meshes to the PyLith binary format once,
+    so that subsequent simulations avoid parsing the mesh at startup.
+
+    Implements `PetscApplication`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylith_convertmesh]
+            reader = pylith.meshio.MeshIOCubit
+            reader.filename = mesh_tet.exo
+            reader.coordsys.space_dim = 3
+
+            writer = pylith.meshio.MeshIOBinary
+            writer.filename = mesh_tet.bin
+            """
+    }
+
+    import pythia.pyre.inventory
+
+    from pylith.meshio.MeshIOAscii import MeshIOAscii
+    reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
+    reader.meta['tip'] = "Reader for input mesh file."
+
+    from pylith.meshio.MeshIOBinary import MeshIOBinary
+    writer = pythia.pyre.inventory.facility("writer", family="mesh_io", factory=MeshIOBinary)
+    writer.meta['tip'] = "Writer for output mesh file."
+
+    checkTopology = pythia.pyre.inventory.bool("check_topology", default=True)
+    checkTopology.meta['tip'] = "Check topology of mesh after reading."
+
+    def __init__(self, name="pylith_convertmesh"):
+        """Constructor.
+        """
+        PetscApplication.__init__(self, name)
+
+    def main(self, *args, **kwds):
+        """Read mesh with reader and write it with writer.
+        """
+        self.reader.preinitialize()
+        self.writer.preinitialize()
+
+        mesh = self.reader.read(self.checkTopology)
+        self.writer.write(mesh)
+        mesh.deallocate()
+
+
+# End of file
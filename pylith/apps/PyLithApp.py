@@ -39,6 +39,9 @@ class PyLithApp(PetscApplication):
     initializeOnly = pythia.pyre.inventory.bool("initialize_only", default=False)
     initializeOnly.meta['tip'] = "Stop simulation after initializing problem."
 
+    writeTimers = pythia.pyre.inventory.bool("write_timers", default=True)
+    writeTimers.meta['tip'] = "Write nested timers and memory usage to JSON file in output directory at end of simulation."
+
     from pylith.utils.SimulationMetadata import SimulationMetadata
     metadata = pythia.pyre.inventory.facility(
         "metadata", family="simulation_metadata", factory=SimulationMetadata)
@@ -114,17 +117,21 @@ class PyLithApp(PetscApplication):
 
         # If initializing only, stop before running problem
         if self.initializeOnly:
+            self._writeTimers()
             return
 
         # Run problem
+        self._eventLogger.stagePush("Run")
         self.problem.run(self)
         self._debug.log(resourceUsageString())
+        self._eventLogger.stagePop()
 
         # Cleanup
         self._eventLogger.stagePush("Finalize")
         self.problem.finalize()
         self._eventLogger.stagePop()
 
+        self._writeTimers()
         return
 
     def version(self):
@@ -240,6 +247,9 @@ class PyLithApp(PetscApplication):
     def _setupLogging(self):
         """Setup event logging.
         """
+        from pylith.utils.utils import TimerTree
+        TimerTree.setEnabled(self.writeTimers)
+
         from pylith.utils.EventLogger import EventLogger
         logger = EventLogger()
         logger.setClassName("PyLith")
@@ -248,6 +258,25 @@ class PyLithApp(PetscApplication):
         self._eventLogger = logger
         return
 
+    def _writeTimers(self):
+        """Write nested timers and memory usage to JSON file.
+        """
+        if not self.writeTimers:
+            return
+
+        import os
+        from pylith.mpi.Communicator import mpi_is_root
+        defaults = self.problem.defaults
+        filename = os.path.join(defaults.outputDir, "%s-timers.json" % defaults.simName)
+        if mpi_is_root():
+            if not os.path.isdir(defaults.outputDir):
+                os.makedirs(defaults.outputDir)
+            self._info.log("Writing timers and memory usage to '%s'." % filename)
+
+        from pylith.utils.utils import TimerTree
+        TimerTree.write(filename)
+        return
+
 
 # ======================================================================
 # Local version of InfoApp that only configures itself. Workaround for
@@ -30,6 +30,7 @@ class AuxSubfieldsIsotropicPowerLaw(PetscComponent):
             power_law_exponent.basis_order = 1
             viscous_strain.basis_order = 1
             deviatoric_stress.basis_order = 1
+            effective_stress.quadrature_order = 1
             reference_stress.basis_order = 0
             reference_strain.basis_order = 0
         """
@@ -60,6 +61,9 @@ class AuxSubfieldsIsotropicPowerLaw(PetscComponent):
     deviatoricStress = pythia.pyre.inventory.facility("deviatoric_stress", family="auxiliary_subfield", factory=Subfield)
     deviatoricStress.meta['tip'] = "Deviatoric stress subfield."
 
+    effectiveStress = pythia.pyre.inventory.facility("effective_stress", family="auxiliary_subfield", factory=Subfield)
+    effectiveStress.meta['tip'] = "Effective stress subfield (always stored at quadrature points)."
+
     referenceStress = pythia.pyre.inventory.facility("reference_stress", family="auxiliary_subfield", factory=Subfield)
     referenceStress.meta['tip'] = "Reference stress subfield."
 
@@ -0,0 +1,148 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .MeshIOObj import MeshIOObj
+from .meshio import MeshIOBox as ModuleMeshIOBox
+
+
+def validateCoordinates(value):
+    """Validate coordinates of corner of box.
+    """
+    msg = "Coordinates of corner of box must be a list of 2 or 3 numbers."
+    if not isinstance(value, list) or not len(value) in [2, 3]:
+        raise ValueError(msg)
+    try:
+        nums = list(map(float, value))
+    except:
+        raise ValueError(msg)
+    return nums
+
+
+def validateNumCells(value):
+    """Validate number of cells in each direction.
+    """
+    msg = "Number of cells must be a list of 2 or 3 positive integers."
+    if not len(value) in [2, 3]:
+        raise ValueError(msg)
+    for v in value:
+        if v <= 0:
+            raise ValueError(msg)
+    return value
+
+
+def validateFaults(value):
+    """Validate x coordinates of faults.
+    """
+    try:
+        nums = list(map(float, value))
+    except:
+        raise ValueError("Fault locations must be a list of numbers.")
+    return nums
+
+
+class MeshIOBox(MeshIOObj, ModuleMeshIOBox):
+    """
+    Generator for structured finite-element meshes of a rectangle (2D) or box (3D).
+
+    The mesh is generated in memory, so no external mesh generator or mesh file is required. This is intended for benchmarks and scaling studies.
+    Simplex cells are created by splitting each quadrilateral into 2 triangles or each hexahedron into 6 tetrahedra.
+    All cells have material id 1.
+    Vertex groups `boundary_xneg`, `boundary_xpos`, `boundary_yneg`, `boundary_ypos`, `boundary_zneg`, and `boundary_zpos` are created for the boundaries.
+    Faults are planes normal to the x axis that cut through the entire domain; the vertex groups are named `fault_0`, `fault_1`, and so on.
+    Each fault is moved to the nearest plane of vertices.
+
+    :::{warning}
+    The coordinate system associated with the mesh must be a Cartesian coordinate system, such as a generic Cartesian coordinate system or a geographic projection.
+    :::
+
+    Implements `MeshIOObj`.
+    """
+    DOC_CONFIG = {
+        "cfg": """
+            [pylithapp.mesh_generator]
+            reader = pylith.meshio.MeshIOBox
+
+            [pylithapp.mesh_generator.reader]
+            lower = [-50.0e+3, -50.0e+3, -50.0e+3]
+            upper = [+50.0e+3, +50.0e+3, 0.0]
+            num_cells = [20, 20, 10]
+            cell_shape = simplex
+            faults_x = [0.0]
+            coordsys.space_dim = 3
+        """
+    }
+
+    import pythia.pyre.inventory
+
+    lower = pythia.pyre.inventory.list("lower", default=[0.0, 0.0, 0.0], validator=validateCoordinates)
+    lower.meta['tip'] = "Coordinates of corner of box with minimum coordinates."
+
+    upper = pythia.pyre.inventory.list("upper", default=[1.0, 1.0, 1.0], validator=validateCoordinates)
+    upper.meta['tip'] = "Coordinates of corner of box with maximum coordinates."
+
+    numCells = pythia.pyre.inventory.array("num_cells", converter=int, default=[1, 1, 1], validator=validateNumCells)
+    numCells.meta['tip'] = "Number of cells in each direction (before splitting into simplices)."
+
+    cellShape = pythia.pyre.inventory.str("cell_shape", default="tensor",
+                                          validator=pythia.pyre.inventory.choice(["tensor", "simplex"]))
+    cellShape.meta['tip'] = "Shape of cells ('tensor'=quadrilaterals/hexahedra, 'simplex'=triangles/tetrahedra)."
+
+    faultsX = pythia.pyre.inventory.list("faults_x", default=[], validator=validateFaults)
+    faultsX.meta['tip'] = "x coordinates of faults normal to the x axis."
+
+    from spatialdata.geocoords.CSCart import CSCart
+    coordsys = pythia.pyre.inventory.facility("coordsys", family="coordsys", factory=CSCart)
+    coordsys.meta['tip'] = "Coordinate system associated with mesh."
+
+    def __init__(self, name="meshiobox"):
+        """Constructor.
+        """
+        MeshIOObj.__init__(self, name)
+
+    def preinitialize(self):
+        """Do minimal initialization."""
+        import numpy
+
+        MeshIOObj.preinitialize(self)
+        ModuleMeshIOBox.setLower(self, numpy.array(self.lower, dtype=numpy.float64))
+        ModuleMeshIOBox.setUpper(self, numpy.array(self.upper, dtype=numpy.float64))
+        ModuleMeshIOBox.setNumCells(self, numpy.array(self.numCells, dtype=numpy.intc))
+        mapShape = {
+            "tensor": ModuleMeshIOBox.TENSOR,
+            "simplex": ModuleMeshIOBox.SIMPLEX,
+        }
+        ModuleMeshIOBox.setCellShape(self, mapShape[self.cellShape])
+        ModuleMeshIOBox.setFaults(self, numpy.array(self.faultsX, dtype=numpy.float64))
+
+    def _configure(self):
+        """Set members based using inventory.
+        """
+        MeshIOObj._configure(self)
+
+    def _createModuleObj(self):
+        """Create C++ MeshIOBox object.
+        """
+        ModuleMeshIOBox.__init__(self)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def mesh_io():
+    """Factory associated with MeshIOBox.
+    """
+    return MeshIOBox()
+
+
+# End of file
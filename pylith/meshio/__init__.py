@@ -21,6 +21,8 @@
 __all__ = [
     "MeshIOObj",
     "MeshIOAscii",
+    "MeshIOBinary",
+    "MeshIOBox",
     "MeshIOCubit",
     "MeshIOLagrit",
     "DataWriter",
@@ -78,6 +78,10 @@ class Problem(PetscComponent, ModuleProblem):
                                       validator=pythia.pyre.inventory.choice(["linear", "nonlinear"]))
     solverChoice.meta['tip'] = "Type of solver to use ['linear', 'nonlinear']."
 
+    matrixType = pythia.pyre.inventory.str("matrix_type", default="aij",
+                                     validator=pythia.pyre.inventory.choice(["aij", "baij", "sbaij"]))
+    matrixType.meta['tip'] = "Storage for Jacobian and preconditioner matrices ['aij', 'baij', 'sbaij'] (block storage uses the number of components as the block size)."
+
     petscDefaults = pythia.pyre.inventory.facility("petsc_defaults", family="petsc_defaults", factory=PetscDefaults)
     petscDefaults.meta['tip'] = "Flags controlling which default PETSc options to use."
 
@@ -140,6 +144,12 @@ class Problem(PetscComponent, ModuleProblem):
             ModuleProblem.setSolverType(self, ModuleProblem.NONLINEAR)
         else:
             raise ValueError("Unknown solver choice '%s'." % self.solverChoice)
+        mapMatrixType = {
+            "aij": ModuleProblem.MATRIX_AIJ,
+            "baij": ModuleProblem.MATRIX_BAIJ,
+            "sbaij": ModuleProblem.MATRIX_SBAIJ,
+        }
+        ModuleProblem.setMatrixType(self, mapMatrixType[self.matrixType])
         ModuleProblem.setPetscDefaults(self, self.petscDefaults.flags());
         ModuleProblem.setNormalizer(self, self.normalizer)
         if not isinstance(self.gravityField, NullComponent):
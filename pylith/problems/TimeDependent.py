@@ -88,12 +88,40 @@ class TimeDependent(Problem, ModuleTimeDependent):
     maxTimeSteps = pythia.pyre.inventory.int("max_timesteps", default=20000, validator=pythia.pyre.inventory.greater(0))
     maxTimeSteps.meta['tip'] = "Maximum number of time steps."
 
+    maxNonlinearFailures = pythia.pyre.inventory.int("max_nonlinear_failures", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    maxNonlinearFailures.meta['tip'] = "Maximum number of failed nonlinear solves retried with a smaller time step (0 terminates on first failure)."
+
+    adaptDt = pythia.pyre.inventory.bool("adapt_dt", default=False)
+    adaptDt.meta['tip'] = "Select time step from material properties (relaxation times for quasistatic problems, CFL condition for dynamic problems)."
+
+    dtSafetyFactor = pythia.pyre.inventory.float("dt_safety_factor", default=0.5, validator=pythia.pyre.inventory.greater(0.0))
+    dtSafetyFactor.meta['tip'] = "Safety factor (Courant factor for dynamic problems) applied to stable time step when adapt_dt is True."
+
+    localTimeStepping = pythia.pyre.inventory.bool("local_time_stepping", default=False)
+    localTimeStepping.meta['tip'] = "Advance degrees of freedom in the smallest cells with half the time step (dynamic formulation only)."
+
+    precomputeGeometry = pythia.pyre.inventory.bool("precompute_geometry", default=False)
+    precomputeGeometry.meta['tip'] = "Precompute cell geometry for explicit residual on tensor-product cells (dynamic formulations only)."
+
     ic = pythia.pyre.inventory.facilityArray("ic", itemFactory=icFactory, factory=EmptyBin)
     ic.meta['tip'] = "Initial conditions."
 
     shouldNotifyIC = pythia.pyre.inventory.bool("notify_observers_ic", default=False)
     shouldNotifyIC.meta["tip"] = "Notify observers of solution with initial conditions."
 
+    cacheLHSJacobian = pythia.pyre.inventory.bool("cache_lhs_jacobian", default=True)
+    cacheLHSJacobian.meta["tip"] = "Cache constant contributions to the LHS Jacobian and reassemble only contributions that change."
+
+    multigridRebuildInterval = pythia.pyre.inventory.int("multigrid_rebuild_interval", default=0, validator=pythia.pyre.inventory.greaterEqual(0))
+    multigridRebuildInterval.meta["tip"] = "Number of new LHS Jacobians between full rebuilds of the algebraic multigrid hierarchy (0 rebuilds for every new Jacobian)."
+
+    mixedPrecisionSmoothers = pythia.pyre.inventory.bool("mixed_precision_smoothers", default=False)
+    mixedPrecisionSmoothers.meta["tip"] = "Apply Jacobi and SOR preconditioners (including multigrid smoothers) using a single precision copy of the preconditioning matrix in addition to the double precision matrix."
+
+    predictor = pythia.pyre.inventory.str("predictor", default="none",
+                                          validator=pythia.pyre.inventory.choice(["none", "linear", "quadratic"]))
+    predictor.meta["tip"] = "Extrapolate initial guess for nonlinear solve from solutions at previous time steps (quasistatic only)."
+
     from .ProgressMonitorTime import ProgressMonitorTime
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorTime)
@@ -119,7 +147,21 @@ class TimeDependent(Problem, ModuleTimeDependent):
         ModuleTimeDependent.setEndTime(self, self.endTime.value)
         ModuleTimeDependent.setInitialTimeStep(self, self.dtInitial.value)
         ModuleTimeDependent.setMaxTimeSteps(self, self.maxTimeSteps)
+        ModuleTimeDependent.setMaxNonlinearFailures(self, self.maxNonlinearFailures)
+        ModuleTimeDependent.setAdaptTimeStep(self, self.adaptDt)
+        ModuleTimeDependent.setTimeStepSafetyFactor(self, self.dtSafetyFactor)
+        ModuleTimeDependent.setLocalTimeStepping(self, self.localTimeStepping)
+        ModuleTimeDependent.setPrecomputeGeometry(self, self.precomputeGeometry)
         ModuleTimeDependent.setShouldNotifyIC(self, self.shouldNotifyIC)
+        ModuleTimeDependent.setCacheLHSJacobian(self, self.cacheLHSJacobian)
+        ModuleTimeDependent.setMultigridRebuildInterval(self, self.multigridRebuildInterval)
+        ModuleTimeDependent.setMixedPrecisionSmoothers(self, self.mixedPrecisionSmoothers)
+        mapPredictor = {
+            "none": ModuleTimeDependent.PREDICTOR_NONE,
+            "linear": ModuleTimeDependent.PREDICTOR_LINEAR,
+            "quadratic": ModuleTimeDependent.PREDICTOR_QUADRATIC,
+        }
+        ModuleTimeDependent.setPredictor(self, mapPredictor[self.predictor])
 
         # Preinitialize initial conditions.
         for ic in self.ic.components():
@@ -46,23 +46,39 @@ class MeshGenerator(PetscComponent):
     def _adjustTopology(self, mesh, interfaces, problem):
         """Adjust topology for interface implementation.
         """
+        self._preinitializeInterfaces(interfaces, problem)
+        self._insertInterfaces(mesh, interfaces)
+
+    def _preinitializeInterfaces(self, interfaces, problem):
+        """Setup interfaces and assign label values for cohesive cells.
+        """
+        if interfaces is None:
+            return
+        cohesiveLabelValue = 100
+        for material in problem.materials.components():
+            labelValue = material.labelValue
+            cohesiveLabelValue = max(cohesiveLabelValue, labelValue+1)
+        for interface in interfaces:
+            interface.preinitialize(problem)
+            interface.setCohesiveLabelValue(cohesiveLabelValue)
+            cohesiveLabelValue += 1
+
+    def _insertInterfaces(self, mesh, interfaces):
+        """Insert cohesive cells for interfaces.
+
+        Interfaces that do not touch each other are inserted in a single pass over the mesh.
+        """
+        if interfaces is None or 0 == len(interfaces):
+            return
+
         logEvent = "%sadjTopo" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
 
         from pylith.mpi.Communicator import mpi_is_root
-
-        if not interfaces is None:
-            cohesiveLabelValue = 100
-            for material in problem.materials.components():
-                labelValue = material.labelValue
-                cohesiveLabelValue = max(cohesiveLabelValue, labelValue+1)
-            for interface in interfaces:
-                if mpi_is_root():
-                    self._info.log("Adjusting topology for fault '%s'." % interface.labelName)
-                interface.preinitialize(problem)
-                interface.setCohesiveLabelValue(cohesiveLabelValue)
-                interface.adjustTopology(mesh)
-                cohesiveLabelValue += 1
+        if mpi_is_root():
+            self._info.log("Adjusting topology for faults %s." % ", ".join(["'%s'" % interface.labelName for interface in interfaces]))
+        from pylith.faults.faults import FaultCohesive as ModuleFaultCohesive
+        ModuleFaultCohesive.adjustTopologyMultiple(mesh, list(interfaces))
 
         self._eventLogger.eventEnd(logEvent)
 
@@ -26,7 +26,9 @@ class MeshImporter(MeshGenerator):
         "cfg": """
             [pylithapp.meshimporter]
             reorder_mesh = True
+            reorder_algorithm = hilbert
             check_topology = True
+            insert_faults_after_distribution = True
             reader = pylith.meshio.MeshIOCubit
             refiner = pylith.topology.RefineUniform
         """
@@ -35,11 +37,18 @@ class MeshImporter(MeshGenerator):
     import pythia.pyre.inventory
 
     reorderMesh = pythia.pyre.inventory.bool("reorder_mesh", default=True)
-    reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
+    reorderMesh.meta['tip'] = "Reorder mesh to improve memory locality."
+
+    reorderAlgorithm = pythia.pyre.inventory.str("reorder_algorithm", default="rcm",
+                                                 validator=pythia.pyre.inventory.choice(["rcm", "hilbert"]))
+    reorderAlgorithm.meta['tip'] = "Algorithm for reordering mesh ('rcm'=reverse Cuthill-McKee, 'hilbert'=Hilbert space-filling curve)."
 
     checkTopology = pythia.pyre.inventory.bool("check_topology", default=True)
     checkTopology.meta['tip'] = "Check topology of imported mesh."
 
+    insertFaultsAfterDistribution = pythia.pyre.inventory.bool("insert_faults_after_distribution", default=False)
+    insertFaultsAfterDistribution.meta['tip'] = "Insert cohesive cells for faults after distributing the mesh (faster setup for large faults)."
+
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
     reader.meta['tip'] = "Reader for mesh files."
@@ -88,16 +97,24 @@ class MeshImporter(MeshGenerator):
             self._debug.log(resourceUsageString())
             if isRoot:
                 self._info.log("Reordering cells and vertices.")
-            from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-            ordering = ReverseCuthillMcKee()
+            if self.reorderAlgorithm == "hilbert":
+                from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+                ordering = SpaceFillingCurve()
+            else:
+                from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+                ordering = ReverseCuthillMcKee()
             ordering.reorder(mesh)
             self._eventLogger.eventEnd(logEvent2)
 
+        # Faults must be setup before distribution, because the overlap includes cells adjacent to faults.
+        self._preinitializeInterfaces(faults, problem)
+
         # Adjust topology
-        self._debug.log(resourceUsageString())
-        if isRoot:
-            self._info.log("Adjusting topology.")
-        self._adjustTopology(mesh, faults, problem)
+        if not self.insertFaultsAfterDistribution:
+            self._debug.log(resourceUsageString())
+            if isRoot:
+                self._info.log("Adjusting topology.")
+            self._insertInterfaces(mesh, faults)
 
         # Distribute mesh
         from pylith.mpi.Communicator import mpi_comm_world
@@ -108,6 +125,13 @@ class MeshImporter(MeshGenerator):
             mesh = self.distributor.distribute(mesh, problem)
             mesh.memLoggingStage = "DistributedMesh"
 
+        # Adjust topology of distributed mesh
+        if self.insertFaultsAfterDistribution:
+            self._debug.log(resourceUsageString())
+            if isRoot:
+                self._info.log("Adjusting topology of distributed mesh.")
+            self._insertInterfaces(mesh, faults)
+
         # Refine mesh (if necessary)
         newMesh = self.refiner.refine(mesh)
         if not newMesh == mesh:
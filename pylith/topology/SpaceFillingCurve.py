@@ -0,0 +1,37 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+
+from .topology import SpaceFillingCurve as ModuleSpaceFillingCurve
+
+
+class SpaceFillingCurve(ModuleSpaceFillingCurve):
+    """
+    Reordering of mesh cells and vertices along a Hilbert space-filling curve.
+
+    Cells are reordered within each material, so cells with the same material remain consecutive.
+    """
+
+    def __init__(self):
+        """Constructor.
+        """
+        return
+
+    def reorder(self, mesh):
+        """Reorder cells and vertices of mesh.
+        """
+        ModuleSpaceFillingCurve.reorder(mesh)
+
+
+# End of file
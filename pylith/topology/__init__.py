@@ -28,6 +28,7 @@ __all__ = [
     "MeshRefiner",
     "RefineUniform",
     "ReverseCuthillMcKee",
+    "SpaceFillingCurve",
     "Subfield",
 ]
 
@@ -0,0 +1,755 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** Micro-benchmark suite for pointwise kernels.
+ *
+ * Call the residual, Jacobian, boundary, and fault (cohesive) pointwise kernels listed in
+ * benchmark_kernels_cases.hh over arrays of synthetic quadrature point inputs with the same
+ * solution and auxiliary field layouts used in simulations and report the time per point and the
+ * achieved floating point rate.
+ *
+ * The number of floating point operations per point is counted by evaluating each kernel
+ * compiled with a scalar type that tallies operations (see benchmark_kernels_flops.cc); for
+ * kernels with data dependent operation counts (for example, power-law viscoelasticity) it is the
+ * average over the points used for verification.
+ *
+ * Before timing, the output of each kernel is verified element by element:
+ *   - the kernel does not write more than outputSize values per point,
+ *   - the compile-time specialized elasticity f1 kernels match a generic implementation that
+ *     calls the strain and stress functions through function pointers, and
+ *   - the kernel compiled with the operation counting scalar type matches the kernel in libpylith.
+ * The benchmark fails if any value differs by more than the relative tolerance.
+ *
+ * Options:
+ *   -bench_num_points N       Number of points per sweep (default 1000000).
+ *   -bench_num_iterations N   Number of sweeps to time (default 10).
+ *   -bench_num_verify_points N  Number of points used to verify output and count operations (default 1000).
+ *   -bench_rtol TOL           Relative tolerance for verifying output (default 1.0e-10).
+ *   -bench_kernel NAME        Only run kernels whose name contains NAME.
+ *   -bench_output FILENAME    Write results in JSON format to FILENAME.
+ */
+
+#include <portinfo>
+
+#include "benchmark_kernels.hh" // implementation of class methods
+
+#include "pylith/fekernels/Elasticity.hh" // USES Elasticity kernels
+#include "pylith/fekernels/DispVel.hh" // USES DispVel kernels
+#include "pylith/fekernels/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity kernels
+#include "pylith/fekernels/IsotropicLinearMaxwell.hh" // USES IsotropicLinearMaxwell kernels
+#include "pylith/fekernels/IsotropicLinearGenMaxwell.hh" // USES IsotropicLinearGenMaxwell kernels
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw kernels
+#include "pylith/fekernels/IncompressibleElasticity.hh" // USES IncompressibleElasticity kernels
+#include "pylith/fekernels/IsotropicLinearIncompElasticity.hh" // USES IsotropicLinearIncompElasticity kernels
+#include "pylith/fekernels/Poroelasticity.hh" // USES Poroelasticity kernels
+#include "pylith/fekernels/IsotropicLinearPoroelasticity.hh" // USES IsotropicLinearPoroelasticity kernels
+#include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin kernels
+#include "pylith/fekernels/AbsorbingDampers.hh" // USES AbsorbingDampers kernels
+#include "pylith/fekernels/NeumannTimeDependent.hh" // USES NeumannTimeDependent kernels
+#include "pylith/fekernels/TimeDependentFn.hh" // USES TimeDependentFn kernels
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <random> // USES std::mt19937
+#include <algorithm> // USES std::min()
+#include <iostream> // USES std::cout
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setw()
+#include <cmath> // USES fabs()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace benchmarks {
+        class _BenchmarkKernels {
+public:
+
+            /** Generic f1 function with the strain and stress functions passed at runtime and the
+             * layout of the stress tensor selected from the dimension at runtime.
+             *
+             * This is the form of Elasticity::f1v() before it was templated on the dimension and the
+             * strain and stress functions.
+             */
+            static inline
+            void f1v_runtime(const pylith::fekernels::Elasticity::StrainContext& strainContext,
+                             void* rheologyContext,
+                             pylith::fekernels::Elasticity::strainfn_type strainFn,
+                             pylith::fekernels::Elasticity::stressfn_type stressFn,
+                             PylithScalar f1[]) {
+                pylith::fekernels::Tensor strain;
+                strainFn(strainContext, &strain);
+
+                pylith::fekernels::Tensor stress;
+                stressFn(rheologyContext, strain, &stress);
+
+                PylithScalar stressTensor[9] = {0.0, 0.0, 0.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0 };
+                const PylithInt dim = strainContext.dim;
+                if (2 == dim) {
+                    pylith::fekernels::TensorOps::toTensor<2>(stress, stressTensor);
+                } else {
+                    pylith::fekernels::TensorOps::toTensor<3>(stress, stressTensor);
+                } // if/else
+                for (PylithInt i = 0; i < dim*dim; ++i) {
+                    f1[i] -= stressTensor[i];
+                } // for
+            } // f1v_runtime
+
+            /// Generic f1 entry function using f1v_runtime().
+            template<typename Rheology, PylithInt DIM, bool REFSTATE,
+                     pylith::fekernels::Elasticity::strainfn_type strainFn,
+                     pylith::fekernels::Elasticity::stressfn_type stressFn>
+            static
+            void f1v_generic(const PylithInt dim,
+                             const PylithInt numS,
+                             const PylithInt numA,
+                             const PylithInt sOff[],
+                             const PylithInt sOff_x[],
+                             const PylithScalar s[],
+                             const PylithScalar s_t[],
+                             const PylithScalar s_x[],
+                             const PylithInt aOff[],
+                             const PylithInt aOff_x[],
+                             const PylithScalar a[],
+                             const PylithScalar a_t[],
+                             const PylithScalar a_x[],
+                             const PylithReal t,
+                             const PylithScalar x[],
+                             const PylithInt numConstants,
+                             const PylithScalar constants[],
+                             PylithScalar f1[]) {
+                pylith::fekernels::Elasticity::StrainContext strainContext;
+                pylith::fekernels::Elasticity::setStrainContext(&strainContext, dim, numS, sOff, sOff_x, s, s_t, s_x, x);
+
+                typename Rheology::Context rheologyContext;
+                if (REFSTATE) {
+                    Rheology::template setContext_refState<DIM>(&rheologyContext, dim, numS, numA, sOff, sOff_x, s, s_t, s_x,
+                                                                aOff, aOff_x, a, a_t, a_x, t, x, numConstants, constants);
+                } else {
+                    Rheology::template setContext<DIM>(&rheologyContext, dim, numS, numA, sOff, sOff_x, s, s_t, s_x,
+                                                       aOff, aOff_x, a, a_t, a_x, t, x, numConstants, constants);
+                } // if/else
+
+                f1v_runtime(strainContext, &rheologyContext, strainFn, stressFn, f1);
+            } // f1v_generic
+
+            /** Add kernel to list of kernels.
+             *
+             * @param[inout] cases Kernels.
+             * @param[in] name Name of kernel.
+             * @param[in] type Type of kernel.
+             * @param[in] dim Dimension passed to kernel.
+             * @param[in] spaceDim Spatial dimension.
+             * @param[in] residual Residual kernel (if type is RESIDUAL).
+             * @param[in] jacobian Jacobian kernel (if type is JACOBIAN).
+             * @param[in] residualBoundary Boundary residual kernel (if type is RESIDUAL_BOUNDARY).
+             * @param[in] jacobianBoundary Boundary Jacobian kernel (if type is JACOBIAN_BOUNDARY).
+             * @param[in] residualGeneric Generic implementation of residual kernel (optional).
+             * @param[in] solnSizes Number of components in each solution subfield.
+             * @param[in] auxSizes Number of components in each auxiliary subfield.
+             * @param[in] constants Kernel constants.
+             * @param[in] outputSize Number of values written by kernel per point.
+             */
+            static
+            void addCase(std::vector<BenchmarkKernels::KernelCase>* cases,
+                         const char* name,
+                         const BenchmarkKernels::KernelTypeEnum type,
+                         const PylithInt dim,
+                         const PylithInt spaceDim,
+                         PetscPointFunc residual,
+                         PetscPointJac jacobian,
+                         PetscBdPointFunc residualBoundary,
+                         PetscBdPointJac jacobianBoundary,
+                         PetscPointFunc residualGeneric,
+                         const std::vector<PylithInt>& solnSizes,
+                         const std::vector<PylithInt>& auxSizes,
+                         const std::vector<PylithScalar>& constants,
+                         const PylithInt outputSize);
+
+            /** Evaluate kernel at points.
+             *
+             * @param[out] f Kernel output with stride values per point.
+             * @param[in] kernelCase Kernel with layout of inputs.
+             * @param[in] inputs Inputs at points.
+             * @param[in] useGeneric Evaluate generic implementation of residual kernel.
+             * @param[in] numPoints Number of points.
+             * @param[in] stride Number of values per point in output.
+             */
+            static
+            void evaluate(PylithScalar* f,
+                          const BenchmarkKernels::KernelCase& kernelCase,
+                          const BenchmarkKernels::KernelInputs& inputs,
+                          const bool useGeneric,
+                          const PylithInt numPoints,
+                          const PylithInt stride);
+
+            /** Time sweeps over points for kernel.
+             *
+             * @param[out] checksum Sum of kernel output.
+             * @param[in] kernelCase Kernel with layout of inputs.
+             * @param[in] inputs Inputs at points.
+             * @param[in] useGeneric Time generic implementation of residual kernel.
+             * @param[in] numIterations Number of sweeps.
+             *
+             * @returns Time per point (seconds).
+             */
+            static
+            PetscLogDouble time(PylithReal* checksum,
+                                const BenchmarkKernels::KernelCase& kernelCase,
+                                const BenchmarkKernels::KernelInputs& inputs,
+                                const bool useGeneric,
+                                const PylithInt numIterations);
+
+            /** Compare kernel output element by element.
+             *
+             * @param[in] label Description of comparison for error messages.
+             * @param[in] kernelCase Kernel with layout of inputs.
+             * @param[in] values Kernel output with stride values per point.
+             * @param[in] valuesE Expected kernel output with strideE values per point.
+             * @param[in] numPoints Number of points.
+             * @param[in] stride Number of values per point in values.
+             * @param[in] strideE Number of values per point in valuesE.
+             * @param[in] rtol Relative tolerance.
+             *
+             * @returns Number of values that differ by more than the tolerance.
+             */
+            static
+            PylithInt compare(const char* label,
+                              const BenchmarkKernels::KernelCase& kernelCase,
+                              const PylithScalar* values,
+                              const PylithScalar* valuesE,
+                              const PylithInt numPoints,
+                              const PylithInt stride,
+                              const PylithInt strideE,
+                              const PylithReal rtol);
+
+            static const PylithScalar guardValue; ///< Value in output beyond outputSize values per point.
+            static const PylithInt maxMismatchMessages; ///< Maximum number of mismatches reported per comparison.
+
+        }; // _BenchmarkKernels
+        const PylithScalar _BenchmarkKernels::guardValue = -1.2345e+30;
+        const PylithInt _BenchmarkKernels::maxMismatchMessages = 5;
+
+    } // benchmarks
+} // pylith
+
+
+// ------------------------------------------------------------------------------------------------
+// Create kernels for benchmark.
+std::vector<pylith::benchmarks::BenchmarkKernels::KernelCase>
+pylith::benchmarks::BenchmarkKernels::createCases(void) {
+    using namespace pylith::fekernels;
+
+    std::vector<KernelCase> cases;
+
+#define BENCHMARK_UNPACK(...) __VA_ARGS__
+#define BENCHMARK_RESIDUAL(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    _BenchmarkKernels::addCase(&cases, #kernel, RESIDUAL, dim, spaceDim, kernel, NULL, NULL, NULL, NULL, \
+                               { BENCHMARK_UNPACK solnSizes }, { BENCHMARK_UNPACK auxSizes }, \
+                               { BENCHMARK_UNPACK constants }, outputSize);
+#define BENCHMARK_JACOBIAN(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    _BenchmarkKernels::addCase(&cases, #kernel, JACOBIAN, dim, spaceDim, NULL, kernel, NULL, NULL, NULL, \
+                               { BENCHMARK_UNPACK solnSizes }, { BENCHMARK_UNPACK auxSizes }, \
+                               { BENCHMARK_UNPACK constants }, outputSize);
+#define BENCHMARK_RESIDUAL_BOUNDARY(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    _BenchmarkKernels::addCase(&cases, #kernel, RESIDUAL_BOUNDARY, dim, spaceDim, NULL, NULL, kernel, NULL, NULL, \
+                               { BENCHMARK_UNPACK solnSizes }, { BENCHMARK_UNPACK auxSizes }, \
+                               { BENCHMARK_UNPACK constants }, outputSize);
+#define BENCHMARK_JACOBIAN_BOUNDARY(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    _BenchmarkKernels::addCase(&cases, #kernel, JACOBIAN_BOUNDARY, dim, spaceDim, NULL, NULL, NULL, kernel, NULL, \
+                               { BENCHMARK_UNPACK solnSizes }, { BENCHMARK_UNPACK auxSizes }, \
+                               { BENCHMARK_UNPACK constants }, outputSize);
+#define BENCHMARK_RESIDUAL_F1V(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize, \
+                               Rheology, refState, strainFn, stressFn) \
+    _BenchmarkKernels::addCase(&cases, #kernel, RESIDUAL, dim, spaceDim, kernel, NULL, NULL, NULL, \
+                               _BenchmarkKernels::f1v_generic<Rheology, dim, refState, strainFn, stressFn>, \
+                               { BENCHMARK_UNPACK solnSizes }, { BENCHMARK_UNPACK auxSizes }, \
+                               { BENCHMARK_UNPACK constants }, outputSize);
+
+#include "benchmark_kernels_cases.hh"
+
+#undef BENCHMARK_UNPACK
+#undef BENCHMARK_RESIDUAL
+#undef BENCHMARK_JACOBIAN
+#undef BENCHMARK_RESIDUAL_BOUNDARY
+#undef BENCHMARK_JACOBIAN_BOUNDARY
+#undef BENCHMARK_RESIDUAL_F1V
+
+    return cases;
+} // createCases
+
+
+// ------------------------------------------------------------------------------------------------
+// Create synthetic inputs for kernel.
+pylith::benchmarks::BenchmarkKernels::KernelInputs
+pylith::benchmarks::BenchmarkKernels::createInputs(const KernelCase& kernelCase,
+                                                   const PylithInt numPoints) {
+    const PylithInt spaceDim = kernelCase.spaceDim;
+    const PylithInt numS = kernelCase.solnSizes.size();
+    const PylithInt numA = kernelCase.auxSizes.size();
+
+    KernelInputs inputs;
+    inputs.numPoints = numPoints;
+    inputs.sOff.resize(numS);
+    inputs.sOff_x.resize(numS);
+    inputs.solnSize = 0;
+    for (PylithInt i = 0; i < numS; ++i) {
+        inputs.sOff[i] = inputs.solnSize;
+        inputs.sOff_x[i] = inputs.solnSize*spaceDim;
+        inputs.solnSize += kernelCase.solnSizes[i];
+    } // for
+    inputs.aOff.resize(numA);
+    inputs.aOff_x.resize(numA);
+    inputs.auxSize = 0;
+    for (PylithInt i = 0; i < numA; ++i) {
+        inputs.aOff[i] = inputs.auxSize;
+        inputs.aOff_x[i] = inputs.auxSize*spaceDim;
+        inputs.auxSize += kernelCase.auxSizes[i];
+    } // for
+
+    // Use same pseudo-random values for all kernels. Keep auxiliary values positive (moduli, etc).
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<PylithReal> distribution(0.5, 1.5);
+    inputs.s.resize(numPoints*inputs.solnSize);
+    inputs.s_t.resize(numPoints*inputs.solnSize);
+    inputs.s_x.resize(numPoints*inputs.solnSize*spaceDim);
+    inputs.a.resize(numPoints*inputs.auxSize);
+    inputs.a_t.resize(numPoints*inputs.auxSize);
+    inputs.a_x.resize(numPoints*inputs.auxSize*spaceDim);
+    inputs.x.resize(numPoints*spaceDim);
+    for (size_t i = 0; i < inputs.s.size(); ++i) {
+        inputs.s[i] = 1.0e-4 * (distribution(generator) - 1.0);
+        inputs.s_t[i] = 1.0e-4 * (distribution(generator) - 1.0);
+    } // for
+    for (size_t i = 0; i < inputs.s_x.size(); ++i) {
+        inputs.s_x[i] = 1.0e-4 * (distribution(generator) - 1.0);
+    } // for
+    for (size_t i = 0; i < inputs.a.size(); ++i) {
+        inputs.a[i] = distribution(generator);
+        inputs.a_t[i] = 1.0e-4 * (distribution(generator) - 1.0);
+    } // for
+    for (size_t i = 0; i < inputs.a_x.size(); ++i) {
+        inputs.a_x[i] = 1.0e-4 * (distribution(generator) - 1.0);
+    } // for
+    for (size_t i = 0; i < inputs.x.size(); ++i) {
+        inputs.x[i] = distribution(generator);
+    } // for
+    const PylithScalar normal2D[3] = { 0.6, 0.8, 0.0 };
+    const PylithScalar normal3D[3] = { 0.6, 0.0, 0.8 };
+    const PylithScalar* n = (2 == spaceDim) ? normal2D : normal3D;
+    for (PylithInt i = 0; i < 3; ++i) {
+        inputs.n[i] = n[i];
+    } // for
+    inputs.t = 1.0;
+    inputs.s_tshift = 1.0;
+
+    return inputs;
+} // createInputs
+
+
+// ------------------------------------------------------------------------------------------------
+// Verify kernel output and count floating point operations.
+void
+pylith::benchmarks::BenchmarkKernels::verify(Result* result,
+                                             const KernelCase& kernelCase,
+                                             const KernelInputs& inputs,
+                                             const PylithReal rtol) {
+    assert(result);
+
+    const PylithInt numPoints = inputs.numPoints;
+    const PylithInt outputSize = kernelCase.outputSize;
+    const PylithInt stride = 2*outputSize;
+
+    // Pad output for each point with guard values to detect writes beyond outputSize values.
+    std::vector<PylithScalar> f(numPoints*stride, _BenchmarkKernels::guardValue);
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        for (PylithInt i = 0; i < outputSize; ++i) {
+            f[p*stride+i] = 0.0;
+        } // for
+    } // for
+    _BenchmarkKernels::evaluate(&f[0], kernelCase, inputs, false, numPoints, stride);
+
+    result->numMismatches = 0;
+    PylithInt numGuardMismatches = 0;
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        for (PylithInt i = outputSize; i < stride; ++i) {
+            if (f[p*stride+i] != _BenchmarkKernels::guardValue) {
+                ++numGuardMismatches;
+            } // if
+        } // for
+    } // for
+    if (numGuardMismatches > 0) {
+        std::cerr << "ERROR: " << kernelCase.name << " (space dim " << kernelCase.spaceDim
+                  << ") writes more than " << outputSize << " values per point." << std::endl;
+        result->numMismatches += numGuardMismatches;
+    } // if
+
+    if (kernelCase.residualGeneric) {
+        std::vector<PylithScalar> fGeneric(numPoints*outputSize, 0.0);
+        _BenchmarkKernels::evaluate(&fGeneric[0], kernelCase, inputs, true, numPoints, outputSize);
+        result->numMismatches += _BenchmarkKernels::compare("generic implementation", kernelCase, &fGeneric[0], &f[0],
+                                                            numPoints, outputSize, stride, rtol);
+    } // if
+
+    std::vector<PylithScalar> fCounted;
+    result->flopsPerPoint = countFlops(&fCounted, kernelCase, inputs, numPoints);
+    result->numMismatches += _BenchmarkKernels::compare("operation counting implementation", kernelCase, &fCounted[0], &f[0],
+                                                        numPoints, outputSize, stride, rtol);
+} // verify
+
+
+// ------------------------------------------------------------------------------------------------
+// Time kernel.
+void
+pylith::benchmarks::BenchmarkKernels::run(Result* result,
+                                          const KernelCase& kernelCase,
+                                          const KernelInputs& inputs,
+                                          const PylithInt numIterations) {
+    assert(result);
+
+    result->timePerPoint = _BenchmarkKernels::time(&result->checksum, kernelCase, inputs, false, numIterations);
+    result->timePerPointGeneric = 0.0;
+    if (kernelCase.residualGeneric) {
+        PylithReal checksumGeneric = 0.0;
+        result->timePerPointGeneric = _BenchmarkKernels::time(&checksumGeneric, kernelCase, inputs, true, numIterations);
+    } // if
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+// Write results in JSON format.
+void
+pylith::benchmarks::BenchmarkKernels::writeJSON(const char* filename,
+                                                const std::vector<KernelCase>& cases,
+                                                const std::vector<Result>& results,
+                                                const PylithInt numPoints,
+                                                const PylithInt numIterations) {
+    assert(cases.size() == results.size());
+    const char* typeNames[4] = { "residual", "jacobian", "residual_boundary", "jacobian_boundary" };
+
+    std::ofstream fout(filename);
+    if (!fout.is_open()) {
+        std::ostringstream msg;
+        msg << "Could not open '" << filename << "' for writing benchmark results.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    fout << "{\n"
+         << "  \"num_points\": " << numPoints << ",\n"
+         << "  \"num_iterations\": " << numIterations << ",\n"
+         << "  \"kernels\": [\n";
+    fout << std::scientific << std::setprecision(6);
+    for (size_t i = 0; i < cases.size(); ++i) {
+        const KernelCase& kernelCase = cases[i];
+        const Result& result = results[i];
+        fout << "    {\n"
+             << "      \"name\": \"" << kernelCase.name << "\",\n"
+             << "      \"type\": \"" << typeNames[kernelCase.type] << "\",\n"
+             << "      \"space_dim\": " << kernelCase.spaceDim << ",\n"
+             << "      \"ns_per_point\": " << 1.0e+9*result.timePerPoint << ",\n"
+             << "      \"flops_per_point\": " << result.flopsPerPoint << ",\n"
+             << "      \"gflops\": " << 1.0e-9*result.flopsPerPoint/result.timePerPoint << ",\n";
+        if (kernelCase.residualGeneric) {
+            fout << "      \"ns_per_point_generic\": " << 1.0e+9*result.timePerPointGeneric << ",\n";
+        } else {
+            fout << "      \"ns_per_point_generic\": null,\n";
+        } // if/else
+        fout << "      \"num_mismatches\": " << result.numMismatches << ",\n"
+             << "      \"checksum\": " << result.checksum << "\n"
+             << "    }" << (i+1 < cases.size() ? "," : "") << "\n";
+    } // for
+    fout << "  ]\n"
+         << "}\n";
+} // writeJSON
+
+
+// ------------------------------------------------------------------------------------------------
+// Add kernel to list of kernels.
+void
+pylith::benchmarks::_BenchmarkKernels::addCase(std::vector<BenchmarkKernels::KernelCase>* cases,
+                                               const char* name,
+                                               const BenchmarkKernels::KernelTypeEnum type,
+                                               const PylithInt dim,
+                                               const PylithInt spaceDim,
+                                               PetscPointFunc residual,
+                                               PetscPointJac jacobian,
+                                               PetscBdPointFunc residualBoundary,
+                                               PetscBdPointJac jacobianBoundary,
+                                               PetscPointFunc residualGeneric,
+                                               const std::vector<PylithInt>& solnSizes,
+                                               const std::vector<PylithInt>& auxSizes,
+                                               const std::vector<PylithScalar>& constants,
+                                               const PylithInt outputSize) {
+    assert(cases);
+
+    BenchmarkKernels::KernelCase kernelCase;
+    kernelCase.name = name;
+    kernelCase.type = type;
+    kernelCase.index = cases->size();
+    kernelCase.dim = dim;
+    kernelCase.spaceDim = spaceDim;
+    kernelCase.residual = residual;
+    kernelCase.jacobian = jacobian;
+    kernelCase.residualBoundary = residualBoundary;
+    kernelCase.jacobianBoundary = jacobianBoundary;
+    kernelCase.residualGeneric = residualGeneric;
+    kernelCase.solnSizes = solnSizes;
+    kernelCase.auxSizes = auxSizes;
+    kernelCase.constants = constants;
+    kernelCase.outputSize = outputSize;
+    cases->push_back(kernelCase);
+} // addCase
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate kernel at points.
+void
+pylith::benchmarks::_BenchmarkKernels::evaluate(PylithScalar* f,
+                                                const BenchmarkKernels::KernelCase& kernelCase,
+                                                const BenchmarkKernels::KernelInputs& inputs,
+                                                const bool useGeneric,
+                                                const PylithInt numPoints,
+                                                const PylithInt stride) {
+    assert(f);
+    assert(numPoints <= inputs.numPoints);
+
+    const PylithInt dim = kernelCase.dim;
+    const PylithInt spaceDim = kernelCase.spaceDim;
+    const PylithInt numS = kernelCase.solnSizes.size();
+    const PylithInt numA = kernelCase.auxSizes.size();
+    const PylithInt solnSize = inputs.solnSize;
+    const PylithInt auxSize = inputs.auxSize;
+    const PylithInt* sOff = &inputs.sOff[0];
+    const PylithInt* sOff_x = &inputs.sOff_x[0];
+    const PylithInt* aOff = &inputs.aOff[0];
+    const PylithInt* aOff_x = &inputs.aOff_x[0];
+    const PylithScalar* s = &inputs.s[0];
+    const PylithScalar* s_t = &inputs.s_t[0];
+    const PylithScalar* s_x = &inputs.s_x[0];
+    const PylithScalar* a = &inputs.a[0];
+    const PylithScalar* a_t = &inputs.a_t[0];
+    const PylithScalar* a_x = &inputs.a_x[0];
+    const PylithScalar* x = &inputs.x[0];
+    const PylithScalar* n = inputs.n;
+    const PylithReal t = inputs.t;
+    const PylithReal s_tshift = inputs.s_tshift;
+    const PylithInt numConstants = kernelCase.constants.size();
+    const PylithScalar* constants = numConstants > 0 ? &kernelCase.constants[0] : NULL;
+
+    switch (kernelCase.type) {
+    case BenchmarkKernels::RESIDUAL: {
+        const PetscPointFunc kernel = useGeneric ? kernelCase.residualGeneric : kernelCase.residual;assert(kernel);
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            kernel(dim, numS, numA, sOff, sOff_x, &s[p*solnSize], &s_t[p*solnSize], &s_x[p*solnSize*spaceDim],
+                   aOff, aOff_x, &a[p*auxSize], &a_t[p*auxSize], &a_x[p*auxSize*spaceDim],
+                   t, &x[p*spaceDim], numConstants, constants, &f[p*stride]);
+        } // for
+        break;
+    } // RESIDUAL
+    case BenchmarkKernels::JACOBIAN: {
+        const PetscPointJac kernel = kernelCase.jacobian;assert(kernel);
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            kernel(dim, numS, numA, sOff, sOff_x, &s[p*solnSize], &s_t[p*solnSize], &s_x[p*solnSize*spaceDim],
+                   aOff, aOff_x, &a[p*auxSize], &a_t[p*auxSize], &a_x[p*auxSize*spaceDim],
+                   t, s_tshift, &x[p*spaceDim], numConstants, constants, &f[p*stride]);
+        } // for
+        break;
+    } // JACOBIAN
+    case BenchmarkKernels::RESIDUAL_BOUNDARY: {
+        const PetscBdPointFunc kernel = kernelCase.residualBoundary;assert(kernel);
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            kernel(dim, numS, numA, sOff, sOff_x, &s[p*solnSize], &s_t[p*solnSize], &s_x[p*solnSize*spaceDim],
+                   aOff, aOff_x, &a[p*auxSize], &a_t[p*auxSize], &a_x[p*auxSize*spaceDim],
+                   t, &x[p*spaceDim], n, numConstants, constants, &f[p*stride]);
+        } // for
+        break;
+    } // RESIDUAL_BOUNDARY
+    case BenchmarkKernels::JACOBIAN_BOUNDARY: {
+        const PetscBdPointJac kernel = kernelCase.jacobianBoundary;assert(kernel);
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            kernel(dim, numS, numA, sOff, sOff_x, &s[p*solnSize], &s_t[p*solnSize], &s_x[p*solnSize*spaceDim],
+                   aOff, aOff_x, &a[p*auxSize], &a_t[p*auxSize], &a_x[p*auxSize*spaceDim],
+                   t, s_tshift, &x[p*spaceDim], n, numConstants, constants, &f[p*stride]);
+        } // for
+        break;
+    } // JACOBIAN_BOUNDARY
+    default:
+        assert(0);
+        throw std::logic_error("Unknown kernel type.");
+    } // switch
+} // evaluate
+
+
+// ------------------------------------------------------------------------------------------------
+// Time sweeps over points for kernel.
+PetscLogDouble
+pylith::benchmarks::_BenchmarkKernels::time(PylithReal* checksum,
+                                            const BenchmarkKernels::KernelCase& kernelCase,
+                                            const BenchmarkKernels::KernelInputs& inputs,
+                                            const bool useGeneric,
+                                            const PylithInt numIterations) {
+    assert(checksum);
+
+    const PylithInt numPoints = inputs.numPoints;
+    const PylithInt outputSize = kernelCase.outputSize;
+    std::vector<PylithScalar> f(numPoints*outputSize, 0.0);
+
+    PetscLogDouble tStart = 0.0, tEnd = 0.0;
+    PetscErrorCode err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+    for (PylithInt iter = 0; iter < numIterations; ++iter) {
+        evaluate(&f[0], kernelCase, inputs, useGeneric, numPoints, outputSize);
+    } // for
+    err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+
+    *checksum = 0.0;
+    for (size_t i = 0; i < f.size(); ++i) {
+        *checksum += f[i];
+    } // for
+
+    return (tEnd - tStart) / (PetscLogDouble(numIterations) * numPoints);
+} // time
+
+
+// ------------------------------------------------------------------------------------------------
+// Compare kernel output element by element.
+PylithInt
+pylith::benchmarks::_BenchmarkKernels::compare(const char* label,
+                                               const BenchmarkKernels::KernelCase& kernelCase,
+                                               const PylithScalar* values,
+                                               const PylithScalar* valuesE,
+                                               const PylithInt numPoints,
+                                               const PylithInt stride,
+                                               const PylithInt strideE,
+                                               const PylithReal rtol) {
+    assert(values);
+    assert(valuesE);
+
+    const PylithInt outputSize = kernelCase.outputSize;
+    PylithInt numMismatches = 0;
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        // Scale tolerance by the largest magnitude at the point, so values near zero from
+        // cancellation do not require agreement beyond the precision of the other values.
+        PylithReal scale = 0.0;
+        for (PylithInt i = 0; i < outputSize; ++i) {
+            scale = std::max(scale, fabs(valuesE[p*strideE+i]));
+        } // for
+        const PylithReal tolerance = rtol * scale;
+
+        for (PylithInt i = 0; i < outputSize; ++i) {
+            const PylithScalar value = values[p*stride+i];
+            const PylithScalar valueE = valuesE[p*strideE+i];
+            if (!(fabs(value - valueE) <= tolerance)) {
+                if (numMismatches < maxMismatchMessages) {
+                    std::cerr << "ERROR: Mismatch in output of " << label << " of " << kernelCase.name
+                              << " (space dim " << kernelCase.spaceDim << ") at point " << p << ", value " << i
+                              << ": expected " << valueE << ", got " << value << "." << std::endl;
+                } // if
+                ++numMismatches;
+            } // if
+        } // for
+    } // for
+
+    return numMismatches;
+} // compare
+
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[]) {
+    PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+
+    using pylith::benchmarks::BenchmarkKernels;
+
+    int status = 0;
+    try {
+        PetscInt numPoints = 1000000;
+        PetscInt numIterations = 10;
+        PetscInt numVerifyPoints = 1000;
+        PetscReal rtol = 1.0e-10;
+        char kernelFilter[PETSC_MAX_PATH_LEN];
+        PetscBool hasKernelFilter = PETSC_FALSE;
+        char outputFilename[PETSC_MAX_PATH_LEN];
+        PetscBool hasOutputFilename = PETSC_FALSE;
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_num_points", &numPoints, NULL);CHKERRQ(err);
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_num_iterations", &numIterations, NULL);CHKERRQ(err);
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_num_verify_points", &numVerifyPoints, NULL);CHKERRQ(err);
+        err = PetscOptionsGetReal(NULL, NULL, "-bench_rtol", &rtol, NULL);CHKERRQ(err);
+        err = PetscOptionsGetString(NULL, NULL, "-bench_kernel", kernelFilter, sizeof(kernelFilter), &hasKernelFilter);CHKERRQ(err);
+        err = PetscOptionsGetString(NULL, NULL, "-bench_output", outputFilename, sizeof(outputFilename), &hasOutputFilename);CHKERRQ(err);
+
+        const std::vector<BenchmarkKernels::KernelCase>& allCases = BenchmarkKernels::createCases();
+        std::vector<BenchmarkKernels::KernelCase> cases;
+        for (size_t i = 0; i < allCases.size(); ++i) {
+            if (!hasKernelFilter || (allCases[i].name.find(kernelFilter) != std::string::npos)) {
+                cases.push_back(allCases[i]);
+            } // if
+        } // for
+
+        std::cout << std::setw(88) << std::left << "kernel" << std::right
+                  << std::setw(4) << "dim"
+                  << std::setw(12) << "FLOPs/pt"
+                  << std::setw(12) << "ns/point"
+                  << std::setw(10) << "GFLOP/s"
+                  << std::setw(16) << "generic ns/pt" << std::endl;
+        std::vector<BenchmarkKernels::Result> results(cases.size());
+        for (size_t i = 0; i < cases.size(); ++i) {
+            const BenchmarkKernels::KernelCase& kernelCase = cases[i];
+            BenchmarkKernels::Result& result = results[i];
+
+            const BenchmarkKernels::KernelInputs& verifyInputs =
+                BenchmarkKernels::createInputs(kernelCase, std::min(numPoints, numVerifyPoints));
+            BenchmarkKernels::verify(&result, kernelCase, verifyInputs, rtol);
+            if (result.numMismatches > 0) {
+                status = 1;
+            } // if
+
+            const BenchmarkKernels::KernelInputs& inputs = BenchmarkKernels::createInputs(kernelCase, numPoints);
+            BenchmarkKernels::run(&result, kernelCase, inputs, numIterations);
+
+            std::cout << std::setw(88) << std::left << kernelCase.name << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(4) << kernelCase.spaceDim
+                      << std::setw(12) << std::setprecision(1) << result.flopsPerPoint << std::setprecision(2)
+                      << std::setw(12) << 1.0e+9*result.timePerPoint
+                      << std::setw(10) << 1.0e-9*result.flopsPerPoint/result.timePerPoint;
+            if (kernelCase.residualGeneric) {
+                std::cout << std::setw(16) << 1.0e+9*result.timePerPointGeneric;
+            } else {
+                std::cout << std::setw(16) << "-";
+            } // if/else
+            std::cout << std::endl;
+        } // for
+
+        if (hasOutputFilename) {
+            BenchmarkKernels::writeJSON(outputFilename, cases, results, numPoints, numIterations);
+        } // if
+        if (status) {
+            std::cerr << "ERROR: Output of one or more kernels failed verification." << std::endl;
+        } // if
+    } catch (const std::exception& err) {
+        std::cerr << "ERROR: " << err.what() << std::endl;
+        status = 1;
+    } // try/catch
+
+    err = PetscFinalize();CHKERRQ(err);
+
+    return status;
+} // main
+
+
+// End of file
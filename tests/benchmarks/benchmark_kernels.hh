@@ -0,0 +1,192 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file tests/benchmarks/benchmark_kernels.hh
+ *
+ * @brief Micro-benchmark for pointwise kernels.
+ *
+ * The kernels are listed in benchmark_kernels_cases.hh. benchmark_kernels.cc times them and
+ * benchmark_kernels_flops.cc counts their floating point operations. This header does not include
+ * the fekernels headers, because benchmark_kernels_flops.cc includes them with a different scalar
+ * type.
+ */
+
+#if !defined(pylith_benchmarks_benchmarkkernels_hh)
+#define pylith_benchmarks_benchmarkkernels_hh
+
+#include "pylith/utils/types.hh" // USES PylithScalar, PylithReal, PylithInt
+
+#include "petscds.h" // USES PetscPointFunc, PetscPointJac, PetscBdPointFunc, PetscBdPointJac
+#include "petsctime.h" // USES PetscLogDouble
+
+#include <vector> // USES std::vector
+#include <string> // USES std::string
+
+namespace pylith {
+    namespace benchmarks {
+        class BenchmarkKernels;
+    } // benchmarks
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+class pylith::benchmarks::BenchmarkKernels {
+public:
+
+    /// Type of pointwise kernel.
+    enum KernelTypeEnum {
+        RESIDUAL=0, ///< PetscPointFunc
+        JACOBIAN=1, ///< PetscPointJac
+        RESIDUAL_BOUNDARY=2, ///< PetscBdPointFunc (boundary and fault kernels)
+        JACOBIAN_BOUNDARY=3, ///< PetscBdPointJac (boundary and fault kernels)
+    };
+
+    /// Pointwise kernel with the layout of its inputs.
+    struct KernelCase {
+        std::string name;
+        KernelTypeEnum type;
+        size_t index; ///< Index of kernel in benchmark_kernels_cases.hh.
+        PylithInt dim; ///< Dimension passed to kernel.
+        PylithInt spaceDim; ///< Spatial dimension.
+        PetscPointFunc residual;
+        PetscPointJac jacobian;
+        PetscBdPointFunc residualBoundary;
+        PetscBdPointJac jacobianBoundary;
+        PetscPointFunc residualGeneric; ///< Generic implementation for comparison (optional).
+        std::vector<PylithInt> solnSizes; ///< Number of components in each solution subfield.
+        std::vector<PylithInt> auxSizes; ///< Number of components in each auxiliary subfield.
+        std::vector<PylithScalar> constants; ///< Kernel constants.
+        PylithInt outputSize; ///< Number of values written by kernel per point.
+    };
+
+    /// Synthetic quadrature point inputs for a kernel.
+    struct KernelInputs {
+        PylithInt numPoints; ///< Number of points.
+        PylithInt solnSize; ///< Number of solution values per point.
+        PylithInt auxSize; ///< Number of auxiliary values per point.
+        std::vector<PylithInt> sOff; ///< Offsets of solution subfields.
+        std::vector<PylithInt> sOff_x; ///< Offsets of solution subfield gradients.
+        std::vector<PylithInt> aOff; ///< Offsets of auxiliary subfields.
+        std::vector<PylithInt> aOff_x; ///< Offsets of auxiliary subfield gradients.
+        std::vector<PylithScalar> s; ///< Solution values.
+        std::vector<PylithScalar> s_t; ///< Time derivative of solution values.
+        std::vector<PylithScalar> s_x; ///< Gradient of solution values.
+        std::vector<PylithScalar> a; ///< Auxiliary values.
+        std::vector<PylithScalar> a_t; ///< Time derivative of auxiliary values.
+        std::vector<PylithScalar> a_x; ///< Gradient of auxiliary values.
+        std::vector<PylithScalar> x; ///< Coordinates of points.
+        PylithScalar n[3]; ///< Normal direction for boundary kernels.
+        PylithReal t; ///< Time.
+        PylithReal s_tshift; ///< Shift for time derivatives in Jacobian kernels.
+    };
+
+    /// Results for a kernel.
+    struct Result {
+        PetscLogDouble timePerPoint; ///< Time per point (seconds).
+        PetscLogDouble timePerPointGeneric; ///< Time per point for generic implementation (seconds).
+        PylithReal flopsPerPoint; ///< Average number of floating point operations per point.
+        PylithReal checksum; ///< Sum of kernel output.
+        PylithInt numMismatches; ///< Number of output values that failed verification.
+    };
+
+    /// Create kernels for benchmark.
+    static
+    std::vector<KernelCase> createCases(void);
+
+    /** Create synthetic inputs for kernel.
+     *
+     * All kernels use the same pseudo-random sequence, so inputs with the same layout are identical.
+     *
+     * @param[in] kernelCase Kernel with layout of inputs.
+     * @param[in] numPoints Number of points.
+     *
+     * @returns Inputs at points.
+     */
+    static
+    KernelInputs createInputs(const KernelCase& kernelCase,
+                              const PylithInt numPoints);
+
+    /** Verify kernel output and count floating point operations.
+     *
+     * Check that the kernel writes only outputSize values per point, that the generic
+     * implementation (if any) matches the specialized kernel, and that the kernel compiled with
+     * the operation counting scalar type matches the kernel compiled with PylithScalar. Values
+     * agree if they differ by no more than rtol times the largest magnitude of the output at the
+     * point.
+     *
+     * @param[inout] result Results for kernel (flopsPerPoint and numMismatches are set).
+     * @param[in] kernelCase Kernel with layout of inputs.
+     * @param[in] inputs Inputs at points.
+     * @param[in] rtol Relative tolerance for comparing output.
+     */
+    static
+    void verify(Result* result,
+                const KernelCase& kernelCase,
+                const KernelInputs& inputs,
+                const PylithReal rtol);
+
+    /** Time kernel.
+     *
+     * @param[inout] result Results for kernel (times and checksum are set).
+     * @param[in] kernelCase Kernel with layout of inputs.
+     * @param[in] inputs Inputs at points.
+     * @param[in] numIterations Number of sweeps over points.
+     */
+    static
+    void run(Result* result,
+             const KernelCase& kernelCase,
+             const KernelInputs& inputs,
+             const PylithInt numIterations);
+
+    /** Write results in JSON format.
+     *
+     * @param[in] filename Name of output file.
+     * @param[in] cases Kernels.
+     * @param[in] results Results for kernels.
+     * @param[in] numPoints Number of points per sweep.
+     * @param[in] numIterations Number of sweeps.
+     */
+    static
+    void writeJSON(const char* filename,
+                   const std::vector<KernelCase>& cases,
+                   const std::vector<Result>& results,
+                   const PylithInt numPoints,
+                   const PylithInt numIterations);
+
+    /** Evaluate kernel compiled with a scalar type that counts floating point operations.
+     *
+     * Implemented in benchmark_kernels_flops.cc.
+     *
+     * @param[out] values Kernel output at points (numPoints*outputSize).
+     * @param[in] kernelCase Kernel with layout of inputs.
+     * @param[in] inputs Inputs at points.
+     * @param[in] numPoints Number of points to evaluate (no more than inputs.numPoints).
+     *
+     * @returns Average number of floating point operations per point.
+     */
+    static
+    PylithReal countFlops(std::vector<PylithScalar>* values,
+                          const KernelCase& kernelCase,
+                          const KernelInputs& inputs,
+                          const PylithInt numPoints);
+
+}; // BenchmarkKernels
+
+#endif // pylith_benchmarks_benchmarkkernels_hh
+
+
+// End of file
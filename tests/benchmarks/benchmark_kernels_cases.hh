@@ -0,0 +1,499 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/* Pointwise kernels in the micro-benchmark.
+ *
+ * No include guard: benchmark_kernels.cc and benchmark_kernels_flops.cc each include this list
+ * once, after defining the macros below, to build tables of kernels with the same order.
+ * Kernel names are relative to pylith::fekernels.
+ *
+ * BENCHMARK_RESIDUAL(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize)
+ * BENCHMARK_JACOBIAN(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize)
+ * BENCHMARK_RESIDUAL_BOUNDARY(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize)
+ * BENCHMARK_JACOBIAN_BOUNDARY(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize)
+ *   Residual (PetscPointFunc), Jacobian (PetscPointJac), boundary residual (PetscBdPointFunc), and
+ *   boundary Jacobian (PetscBdPointJac) kernels.
+ *
+ * BENCHMARK_RESIDUAL_F1V(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize,
+ *                        Rheology, refState, strainFn, stressFn)
+ *   Elasticity f1 residual kernels that are also compared with a generic implementation that
+ *   calls strainFn and stressFn through function pointers.
+ *
+ * solnSizes, auxSizes, and constants are parenthesized lists with the number of components in
+ * each solution subfield, the number of components in each auxiliary subfield, and the values
+ * of the kernel constants. The outputSize is the number of values the kernel writes per point.
+ */
+
+// ==============================================================================================
+// 2D
+// ==============================================================================================
+
+// Elasticity, common kernels
+// Solution subfields: [displacement, velocity]
+// Auxiliary subfields: [density, body_force, gravity_field] (body force and gravity optional)
+BENCHMARK_RESIDUAL(Elasticity::f0v, 2, 2, (2, 2), (1), (), 2)
+BENCHMARK_JACOBIAN(Elasticity::Jf0vv, 2, 2, (2, 2), (1), (), 4)
+BENCHMARK_RESIDUAL(Elasticity::g0v_grav, 2, 2, (2, 2), (1, 2), (), 2)
+BENCHMARK_RESIDUAL(Elasticity::g0v_bodyforce, 2, 2, (2, 2), (1, 2), (), 2)
+BENCHMARK_RESIDUAL(Elasticity::g0v_gravbodyforce, 2, 2, (2, 2), (1, 2, 2), (), 2)
+BENCHMARK_RESIDUAL(DispVel::f0u, 2, 2, (2, 2), (1), (), 2)
+BENCHMARK_RESIDUAL(DispVel::f0v, 2, 2, (2, 2), (1), (), 2)
+BENCHMARK_RESIDUAL(DispVel::g0u, 2, 2, (2, 2), (1), (), 2)
+BENCHMARK_JACOBIAN(DispVel::Jf0uu_stshift, 2, 2, (2, 2), (1), (), 4)
+BENCHMARK_RESIDUAL(ElasticityPlaneStrain::infinitesimalStrain_asVector, 2, 2, (2, 2), (1), (), 4)
+
+// IsotropicLinearElasticityPlaneStrain
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus]
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain, 2, 2, (2), (1, 1, 1), (), 4,
+                       IsotropicLinearElasticity, false, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearElasticity::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearElasticityPlaneStrain::f1v_infinitesimalStrain_refState, 2, 2, (2), (1, 4, 4, 1, 1), (), 4,
+                       IsotropicLinearElasticity, true, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearElasticity::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearElasticityPlaneStrain::Jf3vu_infinitesimalStrain, 2, 2, (2), (1, 1, 1), (), 16)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticityPlaneStrain::f0l_neg_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticityPlaneStrain::f0l_pos_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticityPlaneStrain::f0l_neg_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticityPlaneStrain::f0l_pos_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearElasticityPlaneStrain::cauchyStress_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1), (), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearElasticityPlaneStrain::cauchyStress_infinitesimalStrain_refState_asVector, 2, 2, (2), (1, 4, 4, 1, 1), (), 4)
+
+// IsotropicLinearMaxwellPlaneStrain
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus,
+//                       maxwell_time, viscous_strain, total_strain]
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearMaxwellPlaneStrain::f1v_infinitesimalStrain, 2, 2, (2), (1, 1, 1, 1, 4, 4), (0.1), 4,
+                       IsotropicLinearMaxwell, false, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearMaxwell::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearMaxwellPlaneStrain::f1v_infinitesimalStrain_refState, 2, 2, (2), (1, 4, 4, 1, 1, 1, 4, 4), (0.1), 4,
+                       IsotropicLinearMaxwell, true, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearMaxwell::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearMaxwellPlaneStrain::Jf3vu_infinitesimalStrain, 2, 2, (2), (1, 1, 1, 1, 4, 4), (0.1), 16)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwellPlaneStrain::f0l_neg_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1, 1, 4, 4), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwellPlaneStrain::f0l_pos_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1, 1, 4, 4), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwellPlaneStrain::f0l_neg_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1, 1, 4, 4), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwellPlaneStrain::f0l_pos_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1, 1, 4, 4), (0.1), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearMaxwellPlaneStrain::cauchyStress_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 1, 4, 4), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearMaxwellPlaneStrain::cauchyStress_infinitesimalStrain_refState_asVector, 2, 2, (2), (1, 4, 4, 1, 1, 1, 4, 4), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearMaxwellPlaneStrain::viscousStrain_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 1, 4, 4), (0.1), 4)
+
+// IsotropicLinearGenMaxwellPlaneStrain
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus,
+//                       maxwell_time(3), shear_modulus_ratio(3), viscous_strain(3), total_strain]
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearGenMaxwellPlaneStrain::f1v_infinitesimalStrain, 2, 2, (2), (1, 1, 1, 3, 3, 12, 4), (0.1), 4,
+                       IsotropicLinearGenMaxwell, false, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearGenMaxwell::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearGenMaxwellPlaneStrain::f1v_infinitesimalStrain_refState, 2, 2, (2), (1, 4, 4, 1, 1, 3, 3, 12, 4), (0.1), 4,
+                       IsotropicLinearGenMaxwell, true, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearGenMaxwell::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearGenMaxwellPlaneStrain::Jf3vu_infinitesimalStrain, 2, 2, (2), (1, 1, 1, 3, 3, 12, 4), (0.1), 16)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwellPlaneStrain::f0l_neg_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1, 3, 3, 12, 4), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwellPlaneStrain::f0l_pos_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1, 3, 3, 12, 4), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwellPlaneStrain::f0l_neg_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1, 3, 3, 12, 4), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwellPlaneStrain::f0l_pos_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1, 3, 3, 12, 4), (0.1), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearGenMaxwellPlaneStrain::cauchyStress_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 3, 3, 12, 4), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearGenMaxwellPlaneStrain::cauchyStress_infinitesimalStrain_refState_asVector, 2, 2, (2), (1, 4, 4, 1, 1, 3, 3, 12, 4), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearGenMaxwellPlaneStrain::viscousStrain_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 3, 3, 12, 4), (0.1), 12)
+
+// IsotropicPowerLawPlaneStrain
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus,
+//                       power_law_reference_strain_rate, power_law_reference_stress, power_law_exponent,
+//                       viscous_strain, deviatoric_stress, effective_stress]
+BENCHMARK_RESIDUAL_F1V(IsotropicPowerLawPlaneStrain::f1v_infinitesimalStrain, 2, 2, (2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4,
+                       IsotropicPowerLaw, false, ElasticityPlaneStrain::infinitesimalStrain, IsotropicPowerLaw::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicPowerLawPlaneStrain::f1v_infinitesimalStrain_refState, 2, 2, (2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4,
+                       IsotropicPowerLaw, true, ElasticityPlaneStrain::infinitesimalStrain, IsotropicPowerLaw::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicPowerLawPlaneStrain::Jf3vu_infinitesimalStrain, 2, 2, (2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 16)
+BENCHMARK_JACOBIAN(IsotropicPowerLawPlaneStrain::Jf3vu_infinitesimalStrain_refState, 2, 2, (2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 16)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLawPlaneStrain::f0l_neg_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLawPlaneStrain::f0l_pos_infinitesimalStrain, 2, 2, (2, 2, 2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLawPlaneStrain::f0l_neg_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLawPlaneStrain::f0l_pos_infinitesimalStrain_refState, 2, 2, (2, 2, 2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 2)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::cauchyStress_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::cauchyStress_infinitesimalStrain_refState_asVector, 2, 2, (2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::viscousStrain_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::viscousStrain_infinitesimalStrain_refState_asVector, 2, 2, (2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::deviatoricStress_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::deviatoricStress_infinitesimalStrain_refState_asVector, 2, 2, (2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 4)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::effectiveStress_infinitesimalStrain_asVector, 2, 2, (2), (1, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 1)
+BENCHMARK_RESIDUAL(IsotropicPowerLawPlaneStrain::effectiveStress_infinitesimalStrain_refState_asVector, 2, 2, (2), (1, 4, 4, 1, 1, 1, 1, 1, 4, 4, 1), (0.1), 1)
+
+// IsotropicLinearIncompElasticityPlaneStrain
+// Solution subfields: [displacement, pressure]
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus]
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticityPlaneStrain::f0p_infinitesimalStrain, 2, 2, (2, 1), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticityPlaneStrain::f0p_infinitesimalStrain_refState, 2, 2, (2, 1), (1, 4, 4, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearIncompElasticityPlaneStrain::f1u_infinitesimalStrain, 2, 2, (2, 1), (1, 1, 1), (), 4,
+                       IsotropicLinearIncompElasticity, false, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearIncompElasticity::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearIncompElasticityPlaneStrain::f1u_infinitesimalStrain_refState, 2, 2, (2, 1), (1, 4, 4, 1, 1), (), 4,
+                       IsotropicLinearIncompElasticity, true, ElasticityPlaneStrain::infinitesimalStrain, IsotropicLinearIncompElasticity::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearIncompElasticityPlaneStrain::Jf3uu_infinitesimalStrain, 2, 2, (2, 1), (1, 1, 1), (), 16)
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticityPlaneStrain::cauchyStress_infinitesimalStrain_asVector, 2, 2, (2, 1), (1, 1, 1), (), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticityPlaneStrain::cauchyStress_infinitesimalStrain_refState_asVector, 2, 2, (2, 1), (1, 4, 4, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(IsotropicLinearIncompElasticity::Jf0pp, 2, 2, (2, 1), (1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearIncompElasticity::Jf0pp_schurPrecond, 2, 2, (2, 1), (1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IncompressibleElasticity::Jf1pu, 2, 2, (2, 1), (1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(IncompressibleElasticity::Jf2up, 2, 2, (2, 1), (1, 1, 1), (), 4)
+
+// IsotropicLinearPoroelasticityPlaneStrain
+// Solution subfields: [displacement, pressure, trace_strain] (quasistatic),
+//                     [displacement, pressure, velocity] (explicit), or
+//                     [displacement, pressure, trace_strain, velocity, pressure_t, trace_strain_t] (implicit-explicit)
+// Auxiliary subfields: [solid_density, fluid_density, fluid_viscosity, porosity, (body_force), (gravity_field),
+//                       (source_density), (reference_stress, reference_strain), shear_modulus,
+//                       drained_bulk_modulus, biot_coefficient, biot_modulus, permeability]
+// f1u_refstate is omitted, because it is flagged as not using the reference state (asserts).
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f0p_explicit, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_body, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f0p_implicit_source_grav_body, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1u, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p_tensor_permeability, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 4), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p_body, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p_body_tensor_permeability, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 1, 1, 1, 1, 4), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p_gravity_tensor_permeability, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 1, 1, 1, 1, 4), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::f1p_body_gravity_tensor_permeability, 2, 2, (2, 1, 1), (1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 4), (), 2)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf3uu, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 16)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf2up, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf2ue, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf3pp, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf3pp_tensor_permeability, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 4), (), 4)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf0pp, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf0pe, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf0ppdot, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticityPlaneStrain::Jf0pedot, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g0p, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g0p_source, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g0p_source_body, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g0p_source_grav, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g0p_source_grav_body, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g1p, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g1p_tensor_permeability, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 4), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g1p_gravity, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g1p_gravity_tensor_permeability, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 1, 1, 1, 1, 4), (), 2)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g1v, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::g1v_refstate, 2, 2, (2, 1, 2), (1, 1, 1, 1, 4, 4, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::cauchyStress, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::cauchyStress_refstate, 2, 2, (2, 1, 1), (1, 1, 1, 1, 4, 4, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::updatePorosityImplicit, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (0.1), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticityPlaneStrain::updatePorosityExplicit, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (0.1), 1)
+
+// Poroelasticity, common kernels (same subfields as IsotropicLinearPoroelasticityPlaneStrain)
+BENCHMARK_RESIDUAL(Poroelasticity::f0v_explicit, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(Poroelasticity::f0v_implicit, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(Poroelasticity::f0e, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(Poroelasticity::f0pdot, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(Poroelasticity::f0edot, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(Poroelasticity::g0u, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(Poroelasticity::g0v_grav, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(Poroelasticity::g0v_bodyforce, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_RESIDUAL(Poroelasticity::g0v_grav_bodyforce, 2, 2, (2, 1, 2), (1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1), (), 2)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0ee, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf1eu, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0vu_implicit, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0vv_implicit, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0vv_explicit, 2, 2, (2, 1, 2), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0pdotp, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0pdotpdot, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0edote, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0edotedot, 2, 2, (2, 1, 1, 2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(PoroelasticityPlaneStrain::cauchyStrain, 2, 2, (2, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 4)
+
+// FaultCohesiveKin (dimension passed to kernels is spaceDim-1)
+// Solution subfields: [displacement (negative and positive sides), velocity (optional), lagrange_multiplier_fault]
+// Auxiliary subfields: [slip] or [slip_acceleration]
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0u_neg, 1, 2, (4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0u_pos, 1, 2, (4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0l_slip, 1, 2, (4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0l_slipAcc, 1, 2, (4, 4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ul_neg, 1, 2, (4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 4)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ul_pos, 1, 2, (4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 4)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0lu, 1, 2, (4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 8)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ll_neg, 1, 2, (4, 4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 4)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ll_pos, 1, 2, (4, 4, 2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 4)
+
+// AbsorbingDampers
+// Solution subfields: [displacement, velocity]
+// Auxiliary subfields: [density, vp, vs]
+BENCHMARK_RESIDUAL_BOUNDARY(AbsorbingDampers::g0, 2, 2, (2, 2), (1, 1, 1), (), 2)
+
+// NeumannTimeDependent and TimeDependentFn boundary values
+// Solution subfields: [displacement]
+// Auxiliary subfields: [initial_amplitude, rate_amplitude, rate_start_time, time_history_amplitude,
+//                       time_history_start_time, time_history_value] (each term optional)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initial_scalar, 2, 2, (2), (1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rate_scalar, 2, 2, (2), (1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_timeHistory_scalar, 2, 2, (2), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRate_scalar, 2, 2, (2), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialTimeHistory_scalar, 2, 2, (2), (1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rateTimeHistory_scalar, 2, 2, (2), (1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRateTimeHistory_scalar, 2, 2, (2), (1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initial_scalar_boundary, 2, 2, (2), (1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rate_scalar_boundary, 2, 2, (2), (1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::timeHistory_scalar_boundary, 2, 2, (2), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRate_scalar_boundary, 2, 2, (2), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialTimeHistory_scalar_boundary, 2, 2, (2), (1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rateTimeHistory_scalar_boundary, 2, 2, (2), (1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRateTimeHistory_scalar_boundary, 2, 2, (2), (1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initial_vector, 2, 2, (2), (2), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rate_vector, 2, 2, (2), (2, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_timeHistory_vector, 2, 2, (2), (2, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRate_vector, 2, 2, (2), (2, 2, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialTimeHistory_vector, 2, 2, (2), (2, 2, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rateTimeHistory_vector, 2, 2, (2), (2, 1, 2, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRateTimeHistory_vector, 2, 2, (2), (2, 2, 1, 2, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initial_vector_boundary, 2, 2, (2), (2), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rate_vector_boundary, 2, 2, (2), (2, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::timeHistory_vector_boundary, 2, 2, (2), (2, 1, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRate_vector_boundary, 2, 2, (2), (2, 2, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialTimeHistory_vector_boundary, 2, 2, (2), (2, 2, 1, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rateTimeHistory_vector_boundary, 2, 2, (2), (2, 1, 2, 1, 1), (), 2)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRateTimeHistory_vector_boundary, 2, 2, (2), (2, 2, 1, 2, 1, 1), (), 2)
+
+// ==============================================================================================
+// 3D
+// ==============================================================================================
+
+// Elasticity, common kernels
+// Solution subfields: [displacement, velocity]
+// Auxiliary subfields: [density, body_force, gravity_field] (body force and gravity optional)
+BENCHMARK_RESIDUAL(Elasticity::f0v, 3, 3, (3, 3), (1), (), 3)
+BENCHMARK_JACOBIAN(Elasticity::Jf0vv, 3, 3, (3, 3), (1), (), 9)
+BENCHMARK_RESIDUAL(Elasticity::g0v_grav, 3, 3, (3, 3), (1, 3), (), 3)
+BENCHMARK_RESIDUAL(Elasticity::g0v_bodyforce, 3, 3, (3, 3), (1, 3), (), 3)
+BENCHMARK_RESIDUAL(Elasticity::g0v_gravbodyforce, 3, 3, (3, 3), (1, 3, 3), (), 3)
+BENCHMARK_RESIDUAL(DispVel::f0u, 3, 3, (3, 3), (1), (), 3)
+BENCHMARK_RESIDUAL(DispVel::f0v, 3, 3, (3, 3), (1), (), 3)
+BENCHMARK_RESIDUAL(DispVel::g0u, 3, 3, (3, 3), (1), (), 3)
+BENCHMARK_JACOBIAN(DispVel::Jf0uu_stshift, 3, 3, (3, 3), (1), (), 9)
+BENCHMARK_RESIDUAL(Elasticity3D::infinitesimalStrain_asVector, 3, 3, (3, 3), (1), (), 6)
+
+// IsotropicLinearElasticity3D
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus]
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearElasticity3D::f1v_infinitesimalStrain, 3, 3, (3), (1, 1, 1), (), 9,
+                       IsotropicLinearElasticity, false, Elasticity3D::infinitesimalStrain, IsotropicLinearElasticity::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearElasticity3D::f1v_infinitesimalStrain_refState, 3, 3, (3), (1, 6, 6, 1, 1), (), 9,
+                       IsotropicLinearElasticity, true, Elasticity3D::infinitesimalStrain, IsotropicLinearElasticity::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearElasticity3D::Jf3vu_infinitesimalStrain, 3, 3, (3), (1, 1, 1), (), 81)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticity3D::f0l_neg_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticity3D::f0l_pos_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticity3D::f0l_neg_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearElasticity3D::f0l_pos_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearElasticity3D::cauchyStress_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1), (), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearElasticity3D::cauchyStress_infinitesimalStrain_refState_asVector, 3, 3, (3), (1, 6, 6, 1, 1), (), 6)
+
+// IsotropicLinearMaxwell3D
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus,
+//                       maxwell_time, viscous_strain, total_strain]
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearMaxwell3D::f1v_infinitesimalStrain, 3, 3, (3), (1, 1, 1, 1, 6, 6), (0.1), 9,
+                       IsotropicLinearMaxwell, false, Elasticity3D::infinitesimalStrain, IsotropicLinearMaxwell::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearMaxwell3D::f1v_infinitesimalStrain_refState, 3, 3, (3), (1, 6, 6, 1, 1, 1, 6, 6), (0.1), 9,
+                       IsotropicLinearMaxwell, true, Elasticity3D::infinitesimalStrain, IsotropicLinearMaxwell::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearMaxwell3D::Jf3vu_infinitesimalStrain, 3, 3, (3), (1, 1, 1, 1, 6, 6), (0.1), 81)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwell3D::f0l_neg_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1, 1, 6, 6), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwell3D::f0l_pos_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1, 1, 6, 6), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwell3D::f0l_neg_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1, 1, 6, 6), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearMaxwell3D::f0l_pos_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1, 1, 6, 6), (0.1), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearMaxwell3D::cauchyStress_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 1, 6, 6), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearMaxwell3D::cauchyStress_infinitesimalStrain_refState_asVector, 3, 3, (3), (1, 6, 6, 1, 1, 1, 6, 6), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearMaxwell3D::viscousStrain_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 1, 6, 6), (0.1), 6)
+
+// IsotropicLinearGenMaxwell3D
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus,
+//                       maxwell_time(3), shear_modulus_ratio(3), viscous_strain(3), total_strain]
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearGenMaxwell3D::f1v_infinitesimalStrain, 3, 3, (3), (1, 1, 1, 3, 3, 18, 6), (0.1), 9,
+                       IsotropicLinearGenMaxwell, false, Elasticity3D::infinitesimalStrain, IsotropicLinearGenMaxwell::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearGenMaxwell3D::f1v_infinitesimalStrain_refState, 3, 3, (3), (1, 6, 6, 1, 1, 3, 3, 18, 6), (0.1), 9,
+                       IsotropicLinearGenMaxwell, true, Elasticity3D::infinitesimalStrain, IsotropicLinearGenMaxwell::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearGenMaxwell3D::Jf3vu_infinitesimalStrain, 3, 3, (3), (1, 1, 1, 3, 3, 18, 6), (0.1), 81)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwell3D::f0l_neg_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1, 3, 3, 18, 6), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwell3D::f0l_pos_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1, 3, 3, 18, 6), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwell3D::f0l_neg_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1, 3, 3, 18, 6), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicLinearGenMaxwell3D::f0l_pos_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1, 3, 3, 18, 6), (0.1), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearGenMaxwell3D::cauchyStress_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 3, 3, 18, 6), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearGenMaxwell3D::cauchyStress_infinitesimalStrain_refState_asVector, 3, 3, (3), (1, 6, 6, 1, 1, 3, 3, 18, 6), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearGenMaxwell3D::viscousStrain_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 3, 3, 18, 6), (0.1), 18)
+
+// IsotropicPowerLaw3D
+// Solution subfields: [displacement, velocity, lagrange_multiplier_fault] (velocity and Lagrange multiplier optional)
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus,
+//                       power_law_reference_strain_rate, power_law_reference_stress, power_law_exponent,
+//                       viscous_strain, deviatoric_stress, effective_stress]
+BENCHMARK_RESIDUAL_F1V(IsotropicPowerLaw3D::f1v_infinitesimalStrain, 3, 3, (3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 9,
+                       IsotropicPowerLaw, false, Elasticity3D::infinitesimalStrain, IsotropicPowerLaw::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicPowerLaw3D::f1v_infinitesimalStrain_refState, 3, 3, (3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 9,
+                       IsotropicPowerLaw, true, Elasticity3D::infinitesimalStrain, IsotropicPowerLaw::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicPowerLaw3D::Jf3vu_infinitesimalStrain, 3, 3, (3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 81)
+BENCHMARK_JACOBIAN(IsotropicPowerLaw3D::Jf3vu_infinitesimalStrain_refState, 3, 3, (3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 81)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLaw3D::f0l_neg_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLaw3D::f0l_pos_infinitesimalStrain, 3, 3, (3, 3, 3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLaw3D::f0l_neg_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(IsotropicPowerLaw3D::f0l_pos_infinitesimalStrain_refState, 3, 3, (3, 3, 3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 3)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::cauchyStress_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::cauchyStress_infinitesimalStrain_refState_asVector, 3, 3, (3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::viscousStrain_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::viscousStrain_infinitesimalStrain_refState_asVector, 3, 3, (3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::deviatoricStress_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::deviatoricStress_infinitesimalStrain_refState_asVector, 3, 3, (3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 6)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::effectiveStress_infinitesimalStrain_asVector, 3, 3, (3), (1, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 1)
+BENCHMARK_RESIDUAL(IsotropicPowerLaw3D::effectiveStress_infinitesimalStrain_refState_asVector, 3, 3, (3), (1, 6, 6, 1, 1, 1, 1, 1, 6, 6, 1), (0.1), 1)
+
+// IsotropicLinearIncompElasticity3D
+// Solution subfields: [displacement, pressure]
+// Auxiliary subfields: [density, (reference_stress, reference_strain), shear_modulus, bulk_modulus]
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticity3D::f0p_infinitesimalStrain, 3, 3, (3, 1), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticity3D::f0p_infinitesimalStrain_refState, 3, 3, (3, 1), (1, 6, 6, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearIncompElasticity3D::f1u_infinitesimalStrain, 3, 3, (3, 1), (1, 1, 1), (), 9,
+                       IsotropicLinearIncompElasticity, false, Elasticity3D::infinitesimalStrain, IsotropicLinearIncompElasticity::cauchyStress)
+BENCHMARK_RESIDUAL_F1V(IsotropicLinearIncompElasticity3D::f1u_infinitesimalStrain_refState, 3, 3, (3, 1), (1, 6, 6, 1, 1), (), 9,
+                       IsotropicLinearIncompElasticity, true, Elasticity3D::infinitesimalStrain, IsotropicLinearIncompElasticity::cauchyStress_refState)
+BENCHMARK_JACOBIAN(IsotropicLinearIncompElasticity3D::Jf3uu_infinitesimalStrain, 3, 3, (3, 1), (1, 1, 1), (), 81)
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticity3D::cauchyStress_infinitesimalStrain_asVector, 3, 3, (3, 1), (1, 1, 1), (), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearIncompElasticity3D::cauchyStress_infinitesimalStrain_refState_asVector, 3, 3, (3, 1), (1, 6, 6, 1, 1), (), 6)
+BENCHMARK_JACOBIAN(IsotropicLinearIncompElasticity::Jf0pp, 3, 3, (3, 1), (1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearIncompElasticity::Jf0pp_schurPrecond, 3, 3, (3, 1), (1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IncompressibleElasticity::Jf1pu, 3, 3, (3, 1), (1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(IncompressibleElasticity::Jf2up, 3, 3, (3, 1), (1, 1, 1), (), 9)
+
+// IsotropicLinearPoroelasticity3D
+// Solution subfields: [displacement, pressure, trace_strain] (quasistatic),
+//                     [displacement, pressure, velocity] (explicit), or
+//                     [displacement, pressure, trace_strain, velocity, pressure_t, trace_strain_t] (implicit-explicit)
+// Auxiliary subfields: [solid_density, fluid_density, fluid_viscosity, porosity, (body_force), (gravity_field),
+//                       (source_density), (reference_stress, reference_strain), shear_modulus,
+//                       drained_bulk_modulus, biot_coefficient, biot_modulus, permeability]
+// f1u_refstate is omitted, because it is flagged as not using the reference state (asserts).
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f0p_explicit, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f0p_implicit, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f0p_implicit_source, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f0p_implicit_source_body, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f0p_implicit_source_grav_body, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1u, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p_tensor_permeability, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 6), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p_body, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p_body_tensor_permeability, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 1, 1, 1, 1, 6), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p_gravity, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p_gravity_tensor_permeability, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 1, 1, 1, 1, 6), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p_body_gravity, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::f1p_body_gravity_tensor_permeability, 3, 3, (3, 1, 1), (1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 6), (), 3)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf3uu, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 81)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf2up, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf2ue, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf3pp, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf3pp_tensor_permeability, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 6), (), 9)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf0pp, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf0pe, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf0ppdot, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(IsotropicLinearPoroelasticity3D::Jf0pedot, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g0p, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g0p_source, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g0p_source_body, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g0p_source_grav, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g0p_source_grav_body, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g1p, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g1p_tensor_permeability, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 6), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g1p_gravity, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g1p_gravity_tensor_permeability, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 1, 1, 1, 1, 6), (), 3)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g1v, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::g1v_refstate, 3, 3, (3, 1, 3), (1, 1, 1, 1, 6, 6, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::cauchyStress, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::cauchyStress_refstate, 3, 3, (3, 1, 1), (1, 1, 1, 1, 6, 6, 1, 1, 1, 1, 1), (), 6)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::updatePorosityImplicit, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (0.1), 1)
+BENCHMARK_RESIDUAL(IsotropicLinearPoroelasticity3D::updatePorosityExplicit, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (0.1), 1)
+
+// Poroelasticity, common kernels (same subfields as IsotropicLinearPoroelasticity3D)
+BENCHMARK_RESIDUAL(Poroelasticity::f0v_explicit, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(Poroelasticity::f0v_implicit, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(Poroelasticity::f0e, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(Poroelasticity::f0pdot, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(Poroelasticity::f0edot, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(Poroelasticity::g0u, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(Poroelasticity::g0v_grav, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(Poroelasticity::g0v_bodyforce, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_RESIDUAL(Poroelasticity::g0v_grav_bodyforce, 3, 3, (3, 1, 3), (1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1), (), 3)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0ee, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf1eu, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0vu_implicit, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0vv_implicit, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0vv_explicit, 3, 3, (3, 1, 3), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 9)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0pdotp, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0pdotpdot, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0edote, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_JACOBIAN(Poroelasticity::Jf0edotedot, 3, 3, (3, 1, 1, 3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL(Poroelasticity3D::cauchyStrain, 3, 3, (3, 1, 1), (1, 1, 1, 1, 1, 1, 1, 1, 1), (), 6)
+
+// FaultCohesiveKin (dimension passed to kernels is spaceDim-1)
+// Solution subfields: [displacement (negative and positive sides), velocity (optional), lagrange_multiplier_fault]
+// Auxiliary subfields: [slip] or [slip_acceleration]
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0u_neg, 2, 3, (6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0u_pos, 2, 3, (6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0l_slip, 2, 3, (6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(FaultCohesiveKin::f0l_slipAcc, 2, 3, (6, 6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ul_neg, 2, 3, (6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 9)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ul_pos, 2, 3, (6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 9)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0lu, 2, 3, (6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 18)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ll_neg, 2, 3, (6, 6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 9)
+BENCHMARK_JACOBIAN_BOUNDARY(FaultCohesiveKin::Jf0ll_pos, 2, 3, (6, 6, 3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 9)
+
+// AbsorbingDampers
+// Solution subfields: [displacement, velocity]
+// Auxiliary subfields: [density, vp, vs]
+BENCHMARK_RESIDUAL_BOUNDARY(AbsorbingDampers::g0, 3, 3, (3, 3), (1, 1, 1), (), 3)
+
+// NeumannTimeDependent and TimeDependentFn boundary values
+// Solution subfields: [displacement]
+// Auxiliary subfields: [initial_amplitude, rate_amplitude, rate_start_time, time_history_amplitude,
+//                       time_history_start_time, time_history_value] (each term optional)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initial_scalar, 3, 3, (3), (1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rate_scalar, 3, 3, (3), (1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_timeHistory_scalar, 3, 3, (3), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRate_scalar, 3, 3, (3), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialTimeHistory_scalar, 3, 3, (3), (1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rateTimeHistory_scalar, 3, 3, (3), (1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRateTimeHistory_scalar, 3, 3, (3), (1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initial_scalar_boundary, 3, 3, (3), (1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rate_scalar_boundary, 3, 3, (3), (1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::timeHistory_scalar_boundary, 3, 3, (3), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRate_scalar_boundary, 3, 3, (3), (1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialTimeHistory_scalar_boundary, 3, 3, (3), (1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rateTimeHistory_scalar_boundary, 3, 3, (3), (1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRateTimeHistory_scalar_boundary, 3, 3, (3), (1, 1, 1, 1, 1, 1), (), 1)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initial_vector, 3, 3, (3), (3), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rate_vector, 3, 3, (3), (3, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_timeHistory_vector, 3, 3, (3), (3, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRate_vector, 3, 3, (3), (3, 3, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialTimeHistory_vector, 3, 3, (3), (3, 3, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_rateTimeHistory_vector, 3, 3, (3), (3, 1, 3, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(NeumannTimeDependent::f0_initialRateTimeHistory_vector, 3, 3, (3), (3, 3, 1, 3, 1, 1), (0.0, 0.0, 1.0,  0.0, 1.0, 0.0), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initial_vector_boundary, 3, 3, (3), (3), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rate_vector_boundary, 3, 3, (3), (3, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::timeHistory_vector_boundary, 3, 3, (3), (3, 1, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRate_vector_boundary, 3, 3, (3), (3, 3, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialTimeHistory_vector_boundary, 3, 3, (3), (3, 3, 1, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::rateTimeHistory_vector_boundary, 3, 3, (3), (3, 1, 3, 1, 1), (), 3)
+BENCHMARK_RESIDUAL_BOUNDARY(TimeDependentFn::initialRateTimeHistory_vector_boundary, 3, 3, (3), (3, 3, 1, 3, 1, 1), (), 3)
+
+
+// End of file
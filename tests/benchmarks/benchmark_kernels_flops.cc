@@ -0,0 +1,467 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/* Count floating point operations in pointwise kernels.
+ *
+ * Hardware performance counters are not available on all platforms (and often not to
+ * unprivileged users), so we count operations by compiling the kernels a second time with a
+ * scalar type that tallies each arithmetic operation and math function call. The kernels are
+ * compiled in namespace pylith::fekernels_flops to keep them separate from the kernels in
+ * libpylith.
+ */
+
+#include <portinfo>
+
+#include "benchmark_kernels.hh" // implementation of class methods
+
+#include <iostream> // USES std::ostream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::logic_error
+#include <cmath> // USES sqrt(), pow(), exp()
+#include <cassert> // USES assert()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace benchmarks {
+        class FlopCounter;
+    } // benchmarks
+} // pylith
+
+/** Scalar type that counts floating point operations.
+ *
+ * Addition, subtraction, multiplication, division, and the math functions sqrt(), pow(), exp(),
+ * log(), sin(), and cos() each count as one operation. Negation, absolute value, and comparisons
+ * do not count. Values constructed from literals are not counted, because the compiler folds
+ * operations on constants; operations with at least one value derived from the kernel inputs are
+ * counted.
+ *
+ * The operators are constexpr so that the constexpr tensor operations in Tensor.hh compile with
+ * this type.
+ */
+class pylith::benchmarks::FlopCounter {
+public:
+
+    double value; ///< Value.
+    bool isInput; ///< True if value is derived from kernel inputs.
+
+    constexpr FlopCounter(const double valueArg=0.0,
+                          const bool isInputArg=false) :
+        value(valueArg),
+        isInput(isInputArg) {}
+
+    /// Number of operations counted since the last reset.
+    static
+    long& count(void) {
+        static long numOperations = 0;
+        return numOperations;
+    } // count
+
+    /// Count one operation.
+    static
+    bool tally(void) {
+        ++count();
+        return true;
+    } // tally
+
+    /** Count one operation if an operand is derived from the kernel inputs.
+     *
+     * @returns True if the result is derived from the kernel inputs.
+     */
+    static constexpr
+    bool tally(const FlopCounter& a) {
+        return a.isInput ? tally() : false;
+    } // tally
+
+    static constexpr
+    bool tally(const FlopCounter& a,
+               const FlopCounter& b) {
+        return (a.isInput || b.isInput) ? tally() : false;
+    } // tally
+
+    /// Kernels assert that some scalars are nonzero.
+    constexpr explicit operator bool(void) const {
+        return value != 0.0;
+    }
+
+    constexpr FlopCounter& operator+=(const FlopCounter& b) {
+        isInput = tally(*this, b);
+        value += b.value;
+        return *this;
+    }
+
+    constexpr FlopCounter& operator-=(const FlopCounter& b) {
+        isInput = tally(*this, b);
+        value -= b.value;
+        return *this;
+    }
+
+    constexpr FlopCounter& operator*=(const FlopCounter& b) {
+        isInput = tally(*this, b);
+        value *= b.value;
+        return *this;
+    }
+
+    constexpr FlopCounter& operator/=(const FlopCounter& b) {
+        isInput = tally(*this, b);
+        value /= b.value;
+        return *this;
+    }
+
+}; // FlopCounter
+
+namespace pylith {
+    namespace benchmarks {
+        constexpr FlopCounter operator+(const FlopCounter& a,
+                                        const FlopCounter& b) {
+            return FlopCounter(a.value + b.value, FlopCounter::tally(a, b));
+        }
+
+        constexpr FlopCounter operator-(const FlopCounter& a,
+                                        const FlopCounter& b) {
+            return FlopCounter(a.value - b.value, FlopCounter::tally(a, b));
+        }
+
+        constexpr FlopCounter operator*(const FlopCounter& a,
+                                        const FlopCounter& b) {
+            return FlopCounter(a.value * b.value, FlopCounter::tally(a, b));
+        }
+
+        constexpr FlopCounter operator/(const FlopCounter& a,
+                                        const FlopCounter& b) {
+            return FlopCounter(a.value / b.value, FlopCounter::tally(a, b));
+        }
+
+        constexpr FlopCounter operator-(const FlopCounter& a) {
+            return FlopCounter(-a.value, a.isInput);
+        }
+
+        constexpr FlopCounter operator+(const FlopCounter& a) {
+            return a;
+        }
+
+        constexpr bool operator<(const FlopCounter& a,
+                                 const FlopCounter& b) {
+            return a.value < b.value;
+        }
+
+        constexpr bool operator>(const FlopCounter& a,
+                                 const FlopCounter& b) {
+            return a.value > b.value;
+        }
+
+        constexpr bool operator<=(const FlopCounter& a,
+                                  const FlopCounter& b) {
+            return a.value <= b.value;
+        }
+
+        constexpr bool operator>=(const FlopCounter& a,
+                                  const FlopCounter& b) {
+            return a.value >= b.value;
+        }
+
+        constexpr bool operator==(const FlopCounter& a,
+                                  const FlopCounter& b) {
+            return a.value == b.value;
+        }
+
+        constexpr bool operator!=(const FlopCounter& a,
+                                  const FlopCounter& b) {
+            return a.value != b.value;
+        }
+
+        inline FlopCounter sqrt(const FlopCounter& a) {
+            return FlopCounter(std::sqrt(a.value), FlopCounter::tally(a));
+        }
+
+        inline FlopCounter pow(const FlopCounter& a,
+                               const FlopCounter& b) {
+            return FlopCounter(std::pow(a.value, b.value), FlopCounter::tally(a, b));
+        }
+
+        inline FlopCounter exp(const FlopCounter& a) {
+            return FlopCounter(std::exp(a.value), FlopCounter::tally(a));
+        }
+
+        inline FlopCounter log(const FlopCounter& a) {
+            return FlopCounter(std::log(a.value), FlopCounter::tally(a));
+        }
+
+        inline FlopCounter sin(const FlopCounter& a) {
+            return FlopCounter(std::sin(a.value), FlopCounter::tally(a));
+        }
+
+        inline FlopCounter cos(const FlopCounter& a) {
+            return FlopCounter(std::cos(a.value), FlopCounter::tally(a));
+        }
+
+        inline FlopCounter fabs(const FlopCounter& a) {
+            return FlopCounter(std::fabs(a.value), a.isInput);
+        }
+
+        inline std::ostream& operator<<(std::ostream& s,
+                                        const FlopCounter& a) {
+            return s << a.value;
+        }
+
+    } // benchmarks
+} // pylith
+
+namespace std {
+    // IsotropicPowerLaw calls std::isfinite() with PylithReal arguments.
+    inline bool isfinite(const pylith::benchmarks::FlopCounter& a) {
+        return std::isfinite(a.value);
+    }
+
+} // std
+
+// ------------------------------------------------------------------------------------------------
+// Compile the kernels with FlopCounter as the scalar type. Unqualified calls to the math functions
+// resolve to the FlopCounter overloads through argument-dependent lookup. The kernel
+// implementations in the .cc files hold the static members and out-of-line kernels.
+#define fekernels fekernels_flops
+#define PylithScalar pylith::benchmarks::FlopCounter
+#define PylithReal pylith::benchmarks::FlopCounter
+#undef PetscSinReal
+#undef PetscCosReal
+#undef PetscSqr
+#define PetscSinReal(a) sin(a)
+#define PetscCosReal(a) cos(a)
+#define PetscSqr(a) ((a)*(a))
+
+#include "pylith/fekernels/Elasticity.hh"
+#include "pylith/fekernels/DispVel.hh"
+#include "pylith/fekernels/IsotropicLinearElasticity.hh"
+#include "pylith/fekernels/IsotropicLinearMaxwell.hh"
+#include "pylith/fekernels/IsotropicLinearGenMaxwell.hh"
+#include "pylith/fekernels/IsotropicPowerLaw.hh"
+#include "pylith/fekernels/IncompressibleElasticity.hh"
+#include "pylith/fekernels/IsotropicLinearIncompElasticity.hh"
+#include "pylith/fekernels/Poroelasticity.hh"
+#include "pylith/fekernels/IsotropicLinearPoroelasticity.hh"
+#include "pylith/fekernels/FaultCohesiveKin.hh"
+#include "pylith/fekernels/AbsorbingDampers.hh"
+#include "pylith/fekernels/NeumannTimeDependent.hh"
+#include "pylith/fekernels/TimeDependentFn.hh"
+
+#include "pylith/fekernels/KernelStatus.cc"
+#include "pylith/fekernels/IsotropicLinearGenMaxwell.cc"
+#include "pylith/fekernels/IsotropicPowerLaw.cc"
+#include "pylith/fekernels/Poroelasticity.cc"
+#include "pylith/fekernels/IsotropicLinearPoroelasticity.cc"
+
+#undef fekernels
+#undef PylithScalar
+#undef PylithReal
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace benchmarks {
+        class _BenchmarkKernelsFlops {
+public:
+
+            typedef pylith::benchmarks::FlopCounter Scalar;
+
+            typedef void (*residualfn_type)(const PylithInt, const PylithInt, const PylithInt,
+                                            const PylithInt[], const PylithInt[],
+                                            const Scalar[], const Scalar[], const Scalar[],
+                                            const PylithInt[], const PylithInt[],
+                                            const Scalar[], const Scalar[], const Scalar[],
+                                            const Scalar, const Scalar[],
+                                            const PylithInt, const Scalar[], Scalar[]);
+            typedef void (*jacobianfn_type)(const PylithInt, const PylithInt, const PylithInt,
+                                            const PylithInt[], const PylithInt[],
+                                            const Scalar[], const Scalar[], const Scalar[],
+                                            const PylithInt[], const PylithInt[],
+                                            const Scalar[], const Scalar[], const Scalar[],
+                                            const Scalar, const Scalar, const Scalar[],
+                                            const PylithInt, const Scalar[], Scalar[]);
+            typedef void (*residualbdfn_type)(const PylithInt, const PylithInt, const PylithInt,
+                                              const PylithInt[], const PylithInt[],
+                                              const Scalar[], const Scalar[], const Scalar[],
+                                              const PylithInt[], const PylithInt[],
+                                              const Scalar[], const Scalar[], const Scalar[],
+                                              const Scalar, const Scalar[], const Scalar[],
+                                              const PylithInt, const Scalar[], Scalar[]);
+            typedef void (*jacobianbdfn_type)(const PylithInt, const PylithInt, const PylithInt,
+                                              const PylithInt[], const PylithInt[],
+                                              const Scalar[], const Scalar[], const Scalar[],
+                                              const PylithInt[], const PylithInt[],
+                                              const Scalar[], const Scalar[], const Scalar[],
+                                              const Scalar, const Scalar, const Scalar[], const Scalar[],
+                                              const PylithInt, const Scalar[], Scalar[]);
+
+            /// Kernels compiled with FlopCounter (one of the kernels is set).
+            struct Kernels {
+                residualfn_type residual;
+                jacobianfn_type jacobian;
+                residualbdfn_type residualBoundary;
+                jacobianbdfn_type jacobianBoundary;
+            };
+
+            /// Kernels in the same order as BenchmarkKernels::createCases().
+            static const Kernels kernels[];
+
+            /// Number of kernels.
+            static const size_t numKernels;
+
+            /** Copy values into counted input values.
+             *
+             * @param[out] counted Counted values.
+             * @param[in] values Values.
+             * @param[in] size Number of values.
+             */
+            static
+            void toCounted(std::vector<Scalar>* counted,
+                           const PylithScalar* values,
+                           const size_t size) {
+                assert(counted);
+                counted->resize(size);
+                for (size_t i = 0; i < size; ++i) {
+                    (*counted)[i] = Scalar(values[i], true);
+                } // for
+            } // toCounted
+
+        }; // _BenchmarkKernelsFlops
+
+    } // benchmarks
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace benchmarks {
+        using namespace pylith::fekernels_flops;
+
+#define BENCHMARK_UNPACK(...) __VA_ARGS__
+#define BENCHMARK_RESIDUAL(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    { kernel, NULL, NULL, NULL },
+#define BENCHMARK_JACOBIAN(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    { NULL, kernel, NULL, NULL },
+#define BENCHMARK_RESIDUAL_BOUNDARY(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    { NULL, NULL, kernel, NULL },
+#define BENCHMARK_JACOBIAN_BOUNDARY(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize) \
+    { NULL, NULL, NULL, kernel },
+#define BENCHMARK_RESIDUAL_F1V(kernel, dim, spaceDim, solnSizes, auxSizes, constants, outputSize, \
+                               Rheology, refState, strainFn, stressFn) \
+    { kernel, NULL, NULL, NULL },
+
+        const _BenchmarkKernelsFlops::Kernels _BenchmarkKernelsFlops::kernels[] = {
+#include "benchmark_kernels_cases.hh"
+        };
+        const size_t _BenchmarkKernelsFlops::numKernels = sizeof(kernels) / sizeof(Kernels);
+
+#undef BENCHMARK_UNPACK
+#undef BENCHMARK_RESIDUAL
+#undef BENCHMARK_JACOBIAN
+#undef BENCHMARK_RESIDUAL_BOUNDARY
+#undef BENCHMARK_JACOBIAN_BOUNDARY
+#undef BENCHMARK_RESIDUAL_F1V
+
+    } // benchmarks
+} // pylith
+
+
+// ------------------------------------------------------------------------------------------------
+// Evaluate kernel compiled with a scalar type that counts floating point operations.
+PylithReal
+pylith::benchmarks::BenchmarkKernels::countFlops(std::vector<PylithScalar>* values,
+                                                 const KernelCase& kernelCase,
+                                                 const KernelInputs& inputs,
+                                                 const PylithInt numPoints) {
+    typedef _BenchmarkKernelsFlops::Scalar Scalar;
+    assert(values);
+    assert(numPoints <= inputs.numPoints);
+
+    if (kernelCase.index >= _BenchmarkKernelsFlops::numKernels) {
+        std::ostringstream msg;
+        msg << "Could not find kernel " << kernelCase.index << " ('" << kernelCase.name << "') compiled with FlopCounter.";
+        throw std::logic_error(msg.str());
+    } // if
+    const _BenchmarkKernelsFlops::Kernels& kernels = _BenchmarkKernelsFlops::kernels[kernelCase.index];
+
+    const PylithInt dim = kernelCase.dim;
+    const PylithInt spaceDim = kernelCase.spaceDim;
+    const PylithInt numS = kernelCase.solnSizes.size();
+    const PylithInt numA = kernelCase.auxSizes.size();
+    const PylithInt solnSize = inputs.solnSize;
+    const PylithInt auxSize = inputs.auxSize;
+    const PylithInt outputSize = kernelCase.outputSize;
+    const PylithInt numConstants = kernelCase.constants.size();
+
+    std::vector<Scalar> s, s_t, s_x, a, a_t, a_x, x, n, constants;
+    _BenchmarkKernelsFlops::toCounted(&n, inputs.n, spaceDim);
+    _BenchmarkKernelsFlops::toCounted(&constants, numConstants > 0 ? &kernelCase.constants[0] : NULL, numConstants);
+    const Scalar t(inputs.t, true);
+    const Scalar s_tshift(inputs.s_tshift, true);
+    std::vector<Scalar> f(outputSize);
+
+    values->resize(numPoints*outputSize);
+    long numOperations = 0;
+    for (PylithInt p = 0; p < numPoints; ++p) {
+        _BenchmarkKernelsFlops::toCounted(&s, &inputs.s[p*solnSize], solnSize);
+        _BenchmarkKernelsFlops::toCounted(&s_t, &inputs.s_t[p*solnSize], solnSize);
+        _BenchmarkKernelsFlops::toCounted(&s_x, &inputs.s_x[p*solnSize*spaceDim], solnSize*spaceDim);
+        _BenchmarkKernelsFlops::toCounted(&a, &inputs.a[p*auxSize], auxSize);
+        _BenchmarkKernelsFlops::toCounted(&a_t, &inputs.a_t[p*auxSize], auxSize);
+        _BenchmarkKernelsFlops::toCounted(&a_x, &inputs.a_x[p*auxSize*spaceDim], auxSize*spaceDim);
+        _BenchmarkKernelsFlops::toCounted(&x, &inputs.x[p*spaceDim], spaceDim);
+        for (PylithInt i = 0; i < outputSize; ++i) {
+            f[i] = 0.0;
+        } // for
+
+        FlopCounter::count() = 0;
+        switch (kernelCase.type) {
+        case RESIDUAL:
+            assert(kernels.residual);
+            kernels.residual(dim, numS, numA, &inputs.sOff[0], &inputs.sOff_x[0], &s[0], &s_t[0], &s_x[0],
+                             &inputs.aOff[0], &inputs.aOff_x[0], &a[0], &a_t[0], &a_x[0],
+                             t, &x[0], numConstants, constants.data(), &f[0]);
+            break;
+        case JACOBIAN:
+            assert(kernels.jacobian);
+            kernels.jacobian(dim, numS, numA, &inputs.sOff[0], &inputs.sOff_x[0], &s[0], &s_t[0], &s_x[0],
+                             &inputs.aOff[0], &inputs.aOff_x[0], &a[0], &a_t[0], &a_x[0],
+                             t, s_tshift, &x[0], numConstants, constants.data(), &f[0]);
+            break;
+        case RESIDUAL_BOUNDARY:
+            assert(kernels.residualBoundary);
+            kernels.residualBoundary(dim, numS, numA, &inputs.sOff[0], &inputs.sOff_x[0], &s[0], &s_t[0], &s_x[0],
+                                     &inputs.aOff[0], &inputs.aOff_x[0], &a[0], &a_t[0], &a_x[0],
+                                     t, &x[0], &n[0], numConstants, constants.data(), &f[0]);
+            break;
+        case JACOBIAN_BOUNDARY:
+            assert(kernels.jacobianBoundary);
+            kernels.jacobianBoundary(dim, numS, numA, &inputs.sOff[0], &inputs.sOff_x[0], &s[0], &s_t[0], &s_x[0],
+                                     &inputs.aOff[0], &inputs.aOff_x[0], &a[0], &a_t[0], &a_x[0],
+                                     t, s_tshift, &x[0], &n[0], numConstants, constants.data(), &f[0]);
+            break;
+        default:
+            assert(0);
+            throw std::logic_error("Unknown kernel type.");
+        } // switch
+        numOperations += FlopCounter::count();
+
+        for (PylithInt i = 0; i < outputSize; ++i) {
+            (*values)[p*outputSize+i] = f[i].value;
+        } // for
+    } // for
+
+    return (numPoints > 0) ? PylithReal(numOperations) / numPoints : 0.0;
+} // countFlops
+
+
+// End of file
@@ -0,0 +1,300 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** Benchmark of mesh reordering.
+ *
+ * Compare the matrix bandwidth and the time for closure-based residual
+ * assembly (DMPlexSNESComputeResidualFEM) for a mesh without reordering,
+ * with reverse Cuthill-McKee reordering, and with Hilbert space-filling
+ * curve reordering.
+ *
+ * Options:
+ *   -bench_mesh FILENAME      PyLith ASCII mesh file (default is generated tet box mesh).
+ *   -bench_cells_per_dim N    Number of cells along each edge of generated box mesh (default 16).
+ *   -bench_num_iterations N   Number of residual evaluations to time (default 20).
+ *
+ * The generated box mesh is shuffled to mimic the poor ordering of
+ * unstructured mesh generators.
+ */
+
+#include <portinfo>
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/ReverseCuthillMcKee.hh" // USES ReverseCuthillMcKee
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::deallocate()
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "petscdmplex.h"
+#include "petscsnes.h"
+#include <Python.h>
+
+#include <algorithm> // USES std::shuffle()
+#include <random> // USES std::mt19937
+#include <numeric> // USES std::iota()
+#include <vector> // USES std::vector
+#include <iostream> // USES std::cout
+#include <iomanip> // USES std::setw()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace benchmarks {
+        class BenchmarkReorder {
+public:
+
+            /// Residual kernel for vector Laplacian (same closure access pattern as elasticity).
+            static
+            void f1(PetscInt dim,
+                    PetscInt Nf,
+                    PetscInt NfAux,
+                    const PetscInt uOff[],
+                    const PetscInt uOff_x[],
+                    const PetscScalar u[],
+                    const PetscScalar u_t[],
+                    const PetscScalar u_x[],
+                    const PetscInt aOff[],
+                    const PetscInt aOff_x[],
+                    const PetscScalar a[],
+                    const PetscScalar a_t[],
+                    const PetscScalar a_x[],
+                    PetscReal t,
+                    const PetscReal x[],
+                    PetscInt numConstants,
+                    const PetscScalar constants[],
+                    PetscScalar f1[]) {
+                for (PetscInt i = 0; i < dim*dim; ++i) {
+                    f1[i] = u_x[i];
+                } // for
+            } // f1
+
+            /// Create box mesh with cells and vertices in random order.
+            static
+            pylith::topology::Mesh* createMesh(const PetscInt cellsPerDim);
+
+            /** Time residual assembly and compute matrix bandwidth for mesh.
+             *
+             * @param[in] mesh Finite-element mesh.
+             * @param[in] numIterations Number of residual evaluations.
+             * @param[out] bandwidth Matrix bandwidth.
+             * @param[out] timePerResidual Average time for one residual evaluation.
+             */
+            static
+            void run(const pylith::topology::Mesh& mesh,
+                     const PetscInt numIterations,
+                     PetscInt* bandwidth,
+                     PetscLogDouble* timePerResidual);
+
+        }; // BenchmarkReorder
+    } // benchmarks
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Create box mesh with cells and vertices in random order.
+pylith::topology::Mesh*
+pylith::benchmarks::BenchmarkReorder::createMesh(const PetscInt cellsPerDim) {
+    PYLITH_METHOD_BEGIN;
+    PetscErrorCode err = 0;
+
+    const PetscInt dim = 3;
+    const PetscInt faces[3] = { cellsPerDim, cellsPerDim, cellsPerDim };
+    const PetscReal lower[3] = { 0.0, 0.0, 0.0 };
+    const PetscReal upper[3] = { 1.0, 1.0, 1.0 };
+    PetscDM dmBox = NULL;
+    err = DMPlexCreateBoxMesh(PETSC_COMM_WORLD, dim, PETSC_TRUE, faces, lower, upper, NULL, PETSC_TRUE, &dmBox);PYLITH_CHECK_ERROR(err);
+
+    // Two materials split at x=0.5.
+    err = DMCreateLabel(dmBox, pylith::topology::Mesh::cells_label_name);PYLITH_CHECK_ERROR(err);
+    pylith::topology::Stratum cellsStratum(dmBox, pylith::topology::Stratum::HEIGHT, 0);
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        PetscReal volume = 0.0;
+        PetscReal centroid[3];
+        err = DMPlexComputeCellGeometryFVM(dmBox, cell, &volume, centroid, NULL);PYLITH_CHECK_ERROR(err);
+        err = DMSetLabelValue(dmBox, pylith::topology::Mesh::cells_label_name, cell, centroid[0] < 0.5 ? 1 : 2);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Shuffle points within each depth stratum.
+    PetscInt pStart = 0, pEnd = 0, depth = 0;
+    err = DMPlexGetChart(dmBox, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepth(dmBox, &depth);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> permutation(pEnd - pStart);
+    std::mt19937 generator(12345);
+    for (PetscInt iDepth = 0; iDepth <= depth; ++iDepth) {
+        PetscInt sStart = 0, sEnd = 0;
+        err = DMPlexGetDepthStratum(dmBox, iDepth, &sStart, &sEnd);PYLITH_CHECK_ERROR(err);
+        std::iota(permutation.begin() + sStart - pStart, permutation.begin() + sEnd - pStart, sStart);
+        std::shuffle(permutation.begin() + sStart - pStart, permutation.begin() + sEnd - pStart, generator);
+    } // for
+    PetscIS permutationIS = NULL;
+    PetscDM dmMesh = NULL;
+    err = ISCreateGeneral(PETSC_COMM_SELF, pEnd - pStart, &permutation[0], PETSC_COPY_VALUES, &permutationIS);PYLITH_CHECK_ERROR(err);
+    err = DMPlexPermute(dmBox, permutationIS, &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&permutationIS);PYLITH_CHECK_ERROR(err);
+    err = DMDestroy(&dmBox);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::Mesh* mesh = new pylith::topology::Mesh(dim);
+    mesh->setDM(dmMesh);
+
+    PYLITH_METHOD_RETURN(mesh);
+} // createMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Time residual assembly and compute matrix bandwidth for mesh.
+void
+pylith::benchmarks::BenchmarkReorder::run(const pylith::topology::Mesh& mesh,
+                                          const PetscInt numIterations,
+                                          PetscInt* bandwidth,
+                                          PetscLogDouble* timePerResidual) {
+    PYLITH_METHOD_BEGIN;
+    assert(bandwidth);
+    assert(timePerResidual);
+    PetscErrorCode err = 0;
+
+    const int spaceDim = mesh.getDimension();
+    pylith::topology::Field field(mesh);
+    field.setLabel("solution");
+    pylith::topology::Field::Description description;
+    description.label = "displacement";
+    description.vectorFieldType = pylith::topology::FieldBase::VECTOR;
+    description.numComponents = spaceDim;
+    description.componentNames.resize(spaceDim);
+    const char* componentNames[3] = { "displacement_x", "displacement_y", "displacement_z" };
+    for (int i = 0; i < spaceDim; ++i) {
+        description.componentNames[i] = componentNames[i];
+    } // for
+    description.scale = 1.0;
+    description.validator = NULL;
+
+    pylith::topology::Field::Discretization discretization;
+    discretization.basisOrder = 1;
+    discretization.quadOrder = 1;
+    discretization.dimension = spaceDim;
+    field.subfieldAdd(description, discretization);
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    PetscDM dmSoln = field.getDM();
+    PetscMat matrix = NULL;
+    err = DMCreateMatrix(dmSoln, &matrix);PYLITH_CHECK_ERROR(err);
+    err = MatComputeBandwidth(matrix, 0.0, bandwidth);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&matrix);PYLITH_CHECK_ERROR(err);
+
+    PetscDS ds = NULL;
+    err = DMGetDS(dmSoln, &ds);PYLITH_CHECK_ERROR(err);
+    err = PetscDSSetResidual(ds, 0, NULL, f1);PYLITH_CHECK_ERROR(err);
+
+    PetscVec solutionVec = field.getLocalVector();
+    PetscVec residualVec = NULL;
+    err = VecDuplicate(solutionVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    PetscRandom random = NULL;
+    err = PetscRandomCreate(PETSC_COMM_SELF, &random);PYLITH_CHECK_ERROR(err);
+    err = VecSetRandom(solutionVec, random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomDestroy(&random);PYLITH_CHECK_ERROR(err);
+
+    // Warm up caches before timing.
+    err = DMPlexSNESComputeResidualFEM(dmSoln, solutionVec, residualVec, NULL);PYLITH_CHECK_ERROR(err);
+
+    PetscLogDouble tStart = 0.0, tEnd = 0.0;
+    err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numIterations; ++i) {
+        err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+        err = DMPlexSNESComputeResidualFEM(dmSoln, solutionVec, residualVec, NULL);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+    *timePerResidual = (tEnd - tStart) / numIterations;
+
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[]) {
+    PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+    Py_Initialize();
+
+    try {
+        char meshFilename[PETSC_MAX_PATH_LEN];
+        PetscBool hasMeshFilename = PETSC_FALSE;
+        PetscInt cellsPerDim = 16;
+        PetscInt numIterations = 20;
+        err = PetscOptionsGetString(NULL, NULL, "-bench_mesh", meshFilename, sizeof(meshFilename), &hasMeshFilename);CHKERRQ(err);
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_cells_per_dim", &cellsPerDim, NULL);CHKERRQ(err);
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_num_iterations", &numIterations, NULL);CHKERRQ(err);
+
+        const char* orderings[3] = { "none", "rcm", "hilbert" };
+        std::cout << std::setw(10) << "ordering"
+                  << std::setw(12) << "bandwidth"
+                  << std::setw(16) << "residual (s)" << std::endl;
+        for (int iOrdering = 0; iOrdering < 3; ++iOrdering) {
+            pylith::topology::Mesh* mesh = NULL;
+            if (hasMeshFilename) {
+                mesh = new pylith::topology::Mesh;
+                pylith::meshio::MeshIOAscii reader;
+                reader.setFilename(meshFilename);
+                reader.read(mesh);
+            } else {
+                mesh = pylith::benchmarks::BenchmarkReorder::createMesh(cellsPerDim);
+            } // if/else
+            spatialdata::geocoords::CSCart cs;
+            cs.setSpaceDim(mesh->getDimension());
+            mesh->setCoordSys(&cs);
+
+            switch (iOrdering) {
+            case 1:
+                pylith::topology::ReverseCuthillMcKee::reorder(mesh);
+                break;
+            case 2:
+                pylith::topology::SpaceFillingCurve::reorder(mesh);
+                break;
+            default:
+                break;
+            } // switch
+
+            PetscInt bandwidth = 0;
+            PetscLogDouble timePerResidual = 0.0;
+            pylith::benchmarks::BenchmarkReorder::run(*mesh, numIterations, &bandwidth, &timePerResidual);
+            std::cout << std::setw(10) << orderings[iOrdering]
+                      << std::setw(12) << bandwidth
+                      << std::setw(16) << std::scientific << std::setprecision(4) << timePerResidual
+                      << std::endl;
+            delete mesh;mesh = NULL;
+        } // for
+    } catch (const std::exception& err) {
+        std::cerr << "ERROR: " << err.what() << std::endl;
+        return 1;
+    } // try/catch
+
+    Py_Finalize();
+    pylith::topology::FieldOps::deallocate();
+    err = PetscFinalize();CHKERRQ(err);
+
+    return 0;
+} // main
+
+
+// End of file
@@ -0,0 +1,240 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** Benchmark of mixed precision smoothers.
+ *
+ * Compare the time for applying PETSc SOR and the single precision SOR
+ * (SinglePrecisionSmoother) as a multigrid smoother (Richardson with a
+ * fixed number of iterations and nonzero initial guess), along with
+ * the memory of the double precision matrix and the single precision
+ * copy. The matrix has the sparsity of trilinear hexahedral cells with
+ * 3 components per vertex.
+ *
+ * Options:
+ *   -bench_vertices_per_dim N   Number of vertices along each edge of the grid (default 32).
+ *   -bench_num_iterations N     Number of smoother applications to time (default 50).
+ *   -bench_num_sweeps N         Number of Richardson iterations per application (default 2).
+ */
+
+#include <portinfo>
+
+#include "pylith/problems/SinglePrecisionSmoother.hh" // USES SinglePrecisionSmoother
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include "petscksp.h"
+#include "petsctime.h"
+
+#include <vector> // USES std::vector
+#include <iostream> // USES std::cout
+#include <iomanip> // USES std::setw()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace benchmarks {
+        class BenchmarkSmoothers {
+public:
+
+            /** Create diagonally dominant matrix with sparsity of hexahedral cells with 3 components.
+             *
+             * @param[in] verticesPerDim Number of vertices along each edge of grid.
+             * @returns PETSc matrix.
+             */
+            static
+            PetscMat createMatrix(const PetscInt verticesPerDim);
+
+            /** Time applications of SOR smoother.
+             *
+             * @param[in] matrix PETSc matrix.
+             * @param[in] mixedPrecision True if using single precision SOR, false for PETSc SOR.
+             * @param[in] numIterations Number of smoother applications.
+             * @param[in] numSweeps Number of Richardson iterations per application.
+             * @returns Average time for one smoother application.
+             */
+            static
+            PetscLogDouble run(PetscMat matrix,
+                               const bool mixedPrecision,
+                               const PetscInt numIterations,
+                               const PetscInt numSweeps);
+
+        }; // BenchmarkSmoothers
+    } // benchmarks
+} // pylith
+
+// ------------------------------------------------------------------------------------------------
+// Create diagonally dominant matrix with sparsity of hexahedral cells with 3 components.
+PetscMat
+pylith::benchmarks::BenchmarkSmoothers::createMatrix(const PetscInt verticesPerDim) {
+    PYLITH_METHOD_BEGIN;
+    PetscErrorCode err = 0;
+
+    const PetscInt numComponents = 3;
+    const PetscInt n = verticesPerDim;
+    const PetscInt numRows = n*n*n*numComponents;
+    PetscMat matrix = NULL;
+    err = MatCreateSeqAIJ(PETSC_COMM_SELF, numRows, numRows, 27*numComponents, NULL, &matrix);PYLITH_CHECK_ERROR(err);
+
+    std::vector<PetscInt> cols;
+    std::vector<PetscScalar> values;
+    for (PetscInt k = 0; k < n; ++k) {
+        for (PetscInt j = 0; j < n; ++j) {
+            for (PetscInt i = 0; i < n; ++i) {
+                const PetscInt vertex = (k*n + j)*n + i;
+                for (PetscInt iComp = 0; iComp < numComponents; ++iComp) {
+                    const PetscInt row = vertex*numComponents + iComp;
+                    cols.clear();
+                    values.clear();
+                    for (PetscInt dk = -1; dk <= 1; ++dk) {
+                        for (PetscInt dj = -1; dj <= 1; ++dj) {
+                            for (PetscInt di = -1; di <= 1; ++di) {
+                                if ((i+di < 0) || (i+di >= n) || (j+dj < 0) || (j+dj >= n) || (k+dk < 0) || (k+dk >= n)) {
+                                    continue;
+                                } // if
+                                const PetscInt vertexAdj = ((k+dk)*n + (j+dj))*n + (i+di);
+                                for (PetscInt jComp = 0; jComp < numComponents; ++jComp) {
+                                    const PetscInt col = vertexAdj*numComponents + jComp;
+                                    cols.push_back(col);
+                                    values.push_back((col == row) ? 100.0 : ((iComp == jComp) ? -1.0 : -0.1));
+                                } // for
+                            } // for
+                        } // for
+                    } // for
+                    err = MatSetValues(matrix, 1, &row, cols.size(), &cols[0], &values[0], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+                } // for
+            } // for
+        } // for
+    } // for
+    err = MatAssemblyBegin(matrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(matrix, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(matrix);
+} // createMatrix
+
+
+// ------------------------------------------------------------------------------------------------
+// Time applications of SOR smoother.
+PetscLogDouble
+pylith::benchmarks::BenchmarkSmoothers::run(PetscMat matrix,
+                                            const bool mixedPrecision,
+                                            const PetscInt numIterations,
+                                            const PetscInt numSweeps) {
+    PYLITH_METHOD_BEGIN;
+    PetscErrorCode err = 0;
+
+    // Same settings as the multigrid level smoothers in the PyLith defaults.
+    PetscKSP ksp = NULL;
+    PetscPC pc = NULL;
+    err = KSPCreate(PETSC_COMM_SELF, &ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(ksp, matrix, matrix);PYLITH_CHECK_ERROR(err);
+    err = KSPSetType(ksp, KSPRICHARDSON);PYLITH_CHECK_ERROR(err);
+    err = KSPSetTolerances(ksp, 0.0, 0.0, PETSC_DEFAULT, numSweeps);PYLITH_CHECK_ERROR(err);
+    err = KSPSetNormType(ksp, KSP_NORM_NONE);PYLITH_CHECK_ERROR(err);
+    err = KSPSetConvergenceTest(ksp, KSPConvergedSkip, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = KSPSetInitialGuessNonzero(ksp, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+    err = PCSetType(pc, PCSOR);PYLITH_CHECK_ERROR(err);
+    err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+    if (mixedPrecision) {
+        pylith::problems::SinglePrecisionSmoother::replace(pc);
+        err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PetscVec rhsVec = NULL;
+    PetscVec solutionVec = NULL;
+    err = MatCreateVecs(matrix, &solutionVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+    PetscRandom random = NULL;
+    err = PetscRandomCreate(PETSC_COMM_SELF, &random);PYLITH_CHECK_ERROR(err);
+    err = VecSetRandom(rhsVec, random);PYLITH_CHECK_ERROR(err);
+    err = PetscRandomDestroy(&random);PYLITH_CHECK_ERROR(err);
+    err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    // Warm up caches before timing.
+    err = KSPSolve(ksp, rhsVec, solutionVec);PYLITH_CHECK_ERROR(err);
+
+    PetscLogDouble tStart = 0.0, tEnd = 0.0;
+    err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numIterations; ++i) {
+        err = KSPSolve(ksp, rhsVec, solutionVec);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+
+    err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    err = KSPDestroy(&ksp);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN((tEnd - tStart) / numIterations);
+} // run
+
+
+// ------------------------------------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[]) {
+    PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+
+    try {
+        PetscInt verticesPerDim = 32;
+        PetscInt numIterations = 50;
+        PetscInt numSweeps = 2;
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_vertices_per_dim", &verticesPerDim, NULL);CHKERRQ(err);
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_num_iterations", &numIterations, NULL);CHKERRQ(err);
+        err = PetscOptionsGetInt(NULL, NULL, "-bench_num_sweeps", &numSweeps, NULL);CHKERRQ(err);
+
+        PetscMat matrix = pylith::benchmarks::BenchmarkSmoothers::createMatrix(verticesPerDim);
+        PetscInt numRows = 0;
+        MatInfo info;
+        err = MatGetSize(matrix, &numRows, NULL);CHKERRQ(err);
+        err = MatGetInfo(matrix, MAT_LOCAL, &info);CHKERRQ(err);
+        const double numNonzeros = info.nz_used;
+
+        // Memory of AIJ matrix (values, column indices, row offsets) and the single precision copy
+        // (off-diagonal values, column indices, row offsets, inverse of diagonal, work array).
+        const double bytesMatrix = numNonzeros*(sizeof(PetscScalar) + sizeof(PetscInt)) + (numRows+1)*sizeof(PetscInt);
+        const double bytesCopy = (numNonzeros - numRows)*(sizeof(float) + sizeof(int)) + (numRows+1)*sizeof(int)
+                                 + 2*numRows*sizeof(float);
+
+        const PetscLogDouble timePETSc = pylith::benchmarks::BenchmarkSmoothers::run(matrix, false, numIterations, numSweeps);
+        const PetscLogDouble timeMixed = pylith::benchmarks::BenchmarkSmoothers::run(matrix, true, numIterations, numSweeps);
+
+        std::cout << "# rows: " << numRows << ", # nonzeros: " << PetscInt(numNonzeros) << std::endl;
+        std::cout << std::setw(12) << "smoother"
+                  << std::setw(16) << "apply (s)"
+                  << std::setw(16) << "memory (MB)" << std::endl;
+        std::cout << std::setw(12) << "petsc"
+                  << std::setw(16) << std::scientific << std::setprecision(4) << timePETSc
+                  << std::setw(16) << std::fixed << std::setprecision(1) << bytesMatrix/1.0e+6
+                  << std::endl;
+        std::cout << std::setw(12) << "mixed"
+                  << std::setw(16) << std::scientific << std::setprecision(4) << timeMixed
+                  << std::setw(16) << std::fixed << std::setprecision(1) << (bytesMatrix + bytesCopy)/1.0e+6
+                  << std::endl;
+        std::cout << "Speedup: " << std::setprecision(2) << timePETSc / timeMixed
+                  << ", additional memory: " << std::setprecision(1) << bytesCopy/1.0e+6 << " MB" << std::endl;
+
+        err = MatDestroy(&matrix);CHKERRQ(err);
+    } catch (const std::exception& err) {
+        std::cerr << "ERROR: " << err.what() << std::endl;
+        return 1;
+    } // try/catch
+
+    err = PetscFinalize();CHKERRQ(err);
+
+    return 0;
+} // main
+
+
+// End of file
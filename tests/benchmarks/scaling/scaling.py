@@ -0,0 +1,219 @@
+#!/usr/bin/env nemesis
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University at Buffalo
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2022 University of California, Davis
+#
+# See LICENSE.md for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file tests/benchmarks/scaling/scaling.py
+#
+# @brief Run strong and weak scaling benchmarks and collect timings,
+# iteration counts, and memory usage into a JSON report.
+
+import argparse
+import csv
+import json
+import os
+import re
+import subprocess
+import time
+
+# Parameter files for each problem (in addition to pylithapp.cfg).
+PROBLEMS = {
+    "elastic": ["elastic.cfg"],
+    "maxwell": ["elastic.cfg", "maxwell.cfg"],
+    "powerlaw": ["elastic.cfg", "powerlaw.cfg"],
+    "poroelastic": ["poroelastic.cfg"],
+    "faultkin": ["elastic.cfg", "faultkin.cfg"],
+    "greensfns": ["elastic.cfg", "faultkin.cfg", "greensfns.cfg"],
+}
+
+# Ratio of number of cells in x, y, and z directions (domain is 100 km x 100 km x 50 km).
+CELLS_RATIO = (2, 2, 1)
+
+REGEX_SOLVE = re.compile(r"(Nonlinear|Linear) solve (converged|did not converge) due to (\w+) iterations (\d+)")
+REGEX_MEMORY = re.compile(
+    r"Maximum \(over computational time\) process memory:\s+total\s+(\S+)\s+max\s+(\S+)\s+min\s+(\S+)")
+
+
+class ScalingApp:
+    """Application to run a ladder of problem sizes and number of processes and collect the
+    performance information into a JSON report.
+    """
+
+    def main(self):
+        """Entry point.
+        """
+        args = self._parse_command_line()
+        report = {
+            "mode": args.mode,
+            "cell_shape": args.cell_shape,
+            "pylith": args.pylith,
+            "date": time.strftime("%Y-%m-%dT%H:%M:%S"),
+            "runs": [],
+        }
+        for problem in args.problems:
+            for nprocs in args.nprocs:
+                for size in args.sizes:
+                    numCells = self._num_cells(size, nprocs, args.mode)
+                    run = self._run(problem, nprocs, numCells, args)
+                    report["runs"].append(run)
+                    self._write_report(report, args.output)
+
+    def _parse_command_line(self):
+        """Parse command line arguments.
+        """
+        parser = argparse.ArgumentParser(description="Run PyLith scaling benchmarks.")
+        parser.add_argument("--problems", action="store", dest="problems", nargs="+",
+                            choices=sorted(PROBLEMS.keys()), default=sorted(PROBLEMS.keys()),
+                            help="Problems to run.")
+        parser.add_argument("--sizes", action="store", dest="sizes", nargs="+", type=int, default=[8, 16, 32],
+                            help="Number of cells in z direction (x and y use twice as many). "
+                            "For weak scaling this is the size for 1 process.")
+        parser.add_argument("--nprocs", action="store", dest="nprocs", nargs="+", type=int, default=[1, 2, 4, 8],
+                            help="Number of processes.")
+        parser.add_argument("--mode", action="store", dest="mode", choices=["strong", "weak"], default="strong",
+                            help="Strong scaling (fixed size) or weak scaling (fixed size per process).")
+        parser.add_argument("--cell-shape", action="store", dest="cell_shape", choices=["tensor", "simplex"],
+                            default="tensor", help="Hexahedral (tensor) or tetrahedral (simplex) cells.")
+        parser.add_argument("--pylith", action="store", dest="pylith", default="pylith",
+                            help="PyLith executable.")
+        parser.add_argument("--output-dir", action="store", dest="output_dir", default="output",
+                            help="Directory for log files.")
+        parser.add_argument("--output", action="store", dest="output", default="scaling.json",
+                            help="Filename for JSON report.")
+        parser.add_argument("--dry-run", action="store_true", dest="dry_run",
+                            help="Print commands without running them.")
+        return parser.parse_args()
+
+    @staticmethod
+    def _num_cells(size, nprocs, mode):
+        """Get number of cells in each direction.
+
+        For weak scaling, the number of cells in each direction grows with the cube root of
+        the number of processes, so the number of cells per process is approximately constant.
+        """
+        scale = nprocs**(1.0/3.0) if mode == "weak" else 1.0
+        nz = max(1, int(round(size * scale)))
+        return [r * nz for r in CELLS_RATIO]
+
+    def _run(self, problem, nprocs, numCells, args):
+        """Run simulation and collect performance information.
+        """
+        name = "{}-{}-np{}-{}x{}x{}".format(problem, args.cell_shape, nprocs, *numCells)
+        if not os.path.isdir(args.output_dir):
+            os.makedirs(args.output_dir)
+        filenameLog = os.path.join(args.output_dir, name + "-log.csv")
+        filenameStdout = os.path.join(args.output_dir, name + "-stdout.txt")
+
+        cmd = [args.pylith, "pylithapp.cfg"] + PROBLEMS[problem] + [
+            "--nodes={:d}".format(nprocs),
+            "--mesh_generator.reader.num_cells=[{:d},{:d},{:d}]".format(*numCells),
+            "--mesh_generator.reader.cell_shape={}".format(args.cell_shape),
+            "--problem.defaults.name={}".format(name),
+            "--petsc.log_view=:{}:ascii_csv".format(filenameLog),
+        ]
+        print(" ".join(cmd))
+        run = {
+            "problem": problem,
+            "nprocs": nprocs,
+            "num_cells": numCells,
+            "command": " ".join(cmd),
+        }
+        if args.dry_run:
+            return run
+
+        t0 = time.time()
+        with open(filenameStdout, "w") as fout:
+            status = subprocess.call(cmd, stdout=fout, stderr=subprocess.STDOUT)
+        run["wall_time"] = time.time() - t0
+        run["status"] = status
+
+        with open(filenameStdout, "r") as fin:
+            stdout = fin.read()
+        run.update(self._parse_stdout(stdout))
+        if os.path.isfile(filenameLog):
+            run["stages"] = self._parse_log(filenameLog)
+        return run
+
+    @staticmethod
+    def _parse_stdout(stdout):
+        """Get iteration counts and memory usage from output of -ksp_converged_reason,
+        -snes_converged_reason, and -memory_view.
+        """
+        info = {
+            "linear_iterations": [],
+            "nonlinear_iterations": [],
+            "diverged": 0,
+        }
+        for match in REGEX_SOLVE.finditer(stdout):
+            solver, result, reason, iterations = match.groups()
+            key = "nonlinear_iterations" if solver == "Nonlinear" else "linear_iterations"
+            info[key].append(int(iterations))
+            if result != "converged":
+                info["diverged"] += 1
+        match = REGEX_MEMORY.search(stdout)
+        if match:
+            total, vmax, vmin = map(float, match.groups())
+            info["memory"] = {
+                "total": total,
+                "max": vmax,
+                "min": vmin,
+            }
+        return info
+
+    @staticmethod
+    def _parse_log(filename):
+        """Get time for each stage and event from PETSc -log_view CSV file with min, max, and
+        average over processes.
+        """
+        times = {}
+        with open(filename, "r") as fin:
+            reader = csv.DictReader(fin)
+            for row in reader:
+                stage = row["Stage Name"].strip()
+                event = row["Event Name"].strip()
+                count = int(float(row["Count"]))
+                if count == 0:
+                    continue
+                key = (stage, event)
+                if not key in times:
+                    times[key] = {"count": count, "time": []}
+                times[key]["time"].append(float(row["Time"]))
+
+        stages = {}
+        for (stage, event), value in times.items():
+            t = value["time"]
+            stats = {
+                "count": value["count"],
+                "time_min": min(t),
+                "time_max": max(t),
+                "time_avg": sum(t) / len(t),
+            }
+            stats["imbalance"] = stats["time_max"] / stats["time_avg"] if stats["time_avg"] > 0.0 else 1.0
+            stages.setdefault(stage, {})[event] = stats
+        return stages
+
+    @staticmethod
+    def _write_report(report, filename):
+        """Write JSON report. We rewrite the report after each run, so partial results are
+        available if a run fails or the job is interrupted.
+        """
+        with open(filename, "w") as fout:
+            json.dump(report, fout, indent=2)
+
+
+if __name__ == "__main__":
+    ScalingApp().main()
+
+
+# End of file
@@ -79,8 +79,8 @@ class TestCase(FullTestCase):
             ),
         ]
 
-    def run_pylith(self, testName, args):
-        FullTestCase.run_pylith(self, testName, args)
+    def run_pylith(self, testName, args, nprocs=1):
+        FullTestCase.run_pylith(self, testName, args, nprocs=nprocs)
 
 
 # -------------------------------------------------------------------------------------------------
@@ -155,6 +155,30 @@ class TestTriGmshIC(TestCase):
         return
 
 
+# -------------------------------------------------------------------------------------------------
+class TestQuadGmshDistrib(TestCase):
+
+    def setUp(self):
+        self.name = "threeblocks_distrib_quad"
+        self.mesh = meshes.QuadGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, ["threeblocks.cfg", "threeblocks_distrib_quad.cfg"], nprocs=2)
+        return
+
+
+# -------------------------------------------------------------------------------------------------
+class TestTriGmshDistrib(TestCase):
+
+    def setUp(self):
+        self.name = "threeblocks_distrib_tri"
+        self.mesh = meshes.TriGmsh()
+        super().setUp()
+
+        TestCase.run_pylith(self, self.name, ["threeblocks.cfg", "threeblocks_distrib_tri.cfg"], nprocs=3)
+        return
+
+
 # -------------------------------------------------------------------------------------------------
 def test_cases():
     return [
@@ -164,6 +188,8 @@ def test_cases():
         TestTriCubit,
         TestQuadGmshIC,
         TestTriGmshIC,
+        TestQuadGmshDistrib,
+        TestTriGmshDistrib,
     ]
 
 
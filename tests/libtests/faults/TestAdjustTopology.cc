@@ -33,6 +33,8 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
+#include <set> // USES std::set, std::multiset
+
 // ------------------------------------------------------------------------------------------------
 // Setup testing _data->
 void
@@ -71,19 +73,7 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
 
     for (size_t i = 0; i < _data->numFaults; ++i) {
         FaultCohesiveStub fault;
-
-        CPPUNIT_ASSERT(_data->interfaceIds);
-        CPPUNIT_ASSERT(_data->faultSurfaceLabels);
-        CPPUNIT_ASSERT(_data->faultEdgeLabels);
-
-        fault.setCohesiveLabelName(pylith::topology::Mesh::cells_label_name);
-        fault.setCohesiveLabelValue(_data->interfaceIds[i]);
-        fault.setSurfaceLabelName(_data->faultSurfaceLabels[i]);
-        fault.setSurfaceLabelValue(1);
-        if (_data->faultEdgeLabels[i]) {
-            fault.setBuriedEdgesLabelName(_data->faultEdgeLabels[i]);
-            fault.setBuriedEdgesLabelValue(1);
-        } // if
+        _setupFault(&fault, i);
         if (!_data->failureExpected) {
             fault.adjustTopology(_mesh);
         } else {
@@ -92,6 +82,57 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
         } // if/else
     } // for
 
+    _checkMesh(true);
+
+    PYLITH_METHOD_END;
+} // testAdjustTopology
+
+
+// ------------------------------------------------------------------------------------------------
+// Test adjustTopologyMultiple().
+void
+pylith::faults::TestAdjustTopology::testAdjustTopologyMultiple(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    const size_t numFaults = _data->numFaults;
+    FaultCohesiveStub* faultStubs = (numFaults > 0) ? new FaultCohesiveStub[numFaults] : NULL;
+    FaultCohesive** faults = (numFaults > 0) ? new FaultCohesive*[numFaults] : NULL;
+    for (size_t i = 0; i < numFaults; ++i) {
+        _setupFault(&faultStubs[i], i);
+        faults[i] = &faultStubs[i];
+    } // for
+    if (!_data->failureExpected) {
+        FaultCohesive::adjustTopologyMultiple(_mesh, faults, numFaults);
+    } else {
+        CPPUNIT_ASSERT_THROW(FaultCohesive::adjustTopologyMultiple(_mesh, faults, numFaults), std::runtime_error);
+    } // if/else
+    delete[] faults;faults = NULL;
+    delete[] faultStubs;faultStubs = NULL;
+    if (_data->failureExpected) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Faults that do not touch may be inserted in a single pass, which changes the order of the
+    // cohesive cells relative to inserting them one at a time.
+    _checkMesh(false);
+
+    PYLITH_METHOD_END;
+} // testAdjustTopologyMultiple
+
+
+// ------------------------------------------------------------------------------------------------
+// Check mesh after adjusting topology.
+void
+pylith::faults::TestAdjustTopology::_checkMesh(const bool checkCellOrder) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
 #if 0 // DEBUGGING
     PetscViewerPushFormat(PETSC_VIEWER_STDOUT_WORLD, PETSC_VIEWER_ASCII_INFO_DETAIL);
     DMView(_mesh->getDM(), PETSC_VIEWER_STDOUT_WORLD);
@@ -134,6 +175,8 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
     err = DMGetLabel(dmMesh, cellsLabelName, &labelMaterials);PYLITH_CHECK_ERROR(err);
     CPPUNIT_ASSERT(labelMaterials);
     const PetscInt idDefault = -999;
+    std::multiset<int> materialIdsE(_data->materialIds, _data->materialIds+_data->numCells);
+    std::multiset<int> materialIdsT;
     for (PetscInt c = cStart, cell = 0; c < cEnd; ++c, ++cell) {
         PetscInt value;
 
@@ -141,10 +184,14 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
         if (value == -1) {
             value = idDefault;
         } // if
-        std::ostringstream msg;
-        msg << "Mismatch in '"<<cellsLabelName<<"' for cell "<<cell<<".";
-        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), _data->materialIds[cell], value);
+        if (checkCellOrder) {
+            std::ostringstream msg;
+            msg << "Mismatch in '"<<cellsLabelName<<"' for cell "<<cell<<".";
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str().c_str(), _data->materialIds[cell], value);
+        } // if
+        materialIdsT.insert(value);
     } // for
+    CPPUNIT_ASSERT_MESSAGE("Mismatch in number of cells with each material id.", materialIdsE == materialIdsT);
 
     // Check groups
     CPPUNIT_ASSERT(_data->groupSizes);
@@ -193,7 +240,34 @@ pylith::faults::TestAdjustTopology::testAdjustTopology(void) {
         CPPUNIT_ASSERT_MESSAGE(msg.str().c_str(), foundGroup);
     } // for
 
-} // testAdjustTopology
+    PYLITH_METHOD_END;
+} // _checkMesh
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup fault.
+void
+pylith::faults::TestAdjustTopology::_setupFault(FaultCohesiveStub* fault,
+                                                const size_t index) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(fault);
+    CPPUNIT_ASSERT(_data);
+    CPPUNIT_ASSERT(_data->interfaceIds);
+    CPPUNIT_ASSERT(_data->faultSurfaceLabels);
+    CPPUNIT_ASSERT(_data->faultEdgeLabels);
+
+    fault->setCohesiveLabelName(pylith::topology::Mesh::cells_label_name);
+    fault->setCohesiveLabelValue(_data->interfaceIds[index]);
+    fault->setSurfaceLabelName(_data->faultSurfaceLabels[index]);
+    fault->setSurfaceLabelValue(1);
+    if (_data->faultEdgeLabels[index]) {
+        fault->setBuriedEdgesLabelName(_data->faultEdgeLabels[index]);
+        fault->setBuriedEdgesLabelValue(1);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setupFault
 
 
 // ------------------------------------------------------------------------------------------------
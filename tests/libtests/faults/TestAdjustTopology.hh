@@ -34,6 +34,8 @@ namespace pylith {
     namespace faults {
         class TestAdjustTopology;
         class TestAdjustTopology_Data;
+
+        class FaultCohesiveStub; // USES FaultCohesiveStub
     } // faults
 } // pylith
 
@@ -43,6 +45,7 @@ class pylith::faults::TestAdjustTopology : public CppUnit::TestFixture {
     CPPUNIT_TEST_SUITE(TestAdjustTopology);
 
     CPPUNIT_TEST(testAdjustTopology);
+    CPPUNIT_TEST(testAdjustTopologyMultiple);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -58,6 +61,9 @@ public:
     /// Test adjustTopology().
     void testAdjustTopology(void);
 
+    /// Test adjustTopologyMultiple().
+    void testAdjustTopologyMultiple(void);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -70,6 +76,21 @@ private:
     /// Setup mesh.
     void _initialize();
 
+    /** Setup fault.
+     *
+     * @param[out] fault Fault to setup.
+     * @param[in] index Index of fault in test data.
+     */
+    void _setupFault(FaultCohesiveStub* fault,
+                     const size_t index);
+
+    /** Check mesh after adjusting topology.
+     *
+     * @param[in] checkCellOrder Check material ids cell by cell (true) or only the number of cells
+     * with each material id (false).
+     */
+    void _checkMesh(const bool checkCellOrder);
+
 }; // class TestAdjustTopology
 
 class pylith::faults::TestAdjustTopology_Data {
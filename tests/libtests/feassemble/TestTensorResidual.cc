@@ -0,0 +1,752 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestTensorResidual.hh" // Implementation of class methods
+
+#include "pylith/feassemble/TensorResidual.hh" // Test subject
+
+#include "pylith/feassemble/DSLabelAccess.hh" // USES DSLabelAccess
+#include "pylith/feassemble/Integrator.hh" // USES Integrator::EquationPart
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::deallocate()
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "petscds.h" // USES PetscDS
+
+#include <algorithm> // USES std::max()
+#include <cmath> // USES sin(), cos(), exp()
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace feassemble {
+        class _TestTensorResidual {
+public:
+
+            /// Residual for displacement subfield with terms from auxiliary field and its gradient.
+            static
+            void f0u(const PylithInt dim,
+                     const PylithInt numS,
+                     const PylithInt numA,
+                     const PylithInt sOff[],
+                     const PylithInt sOff_x[],
+                     const PylithScalar s[],
+                     const PylithScalar s_t[],
+                     const PylithScalar s_x[],
+                     const PylithInt aOff[],
+                     const PylithInt aOff_x[],
+                     const PylithScalar a[],
+                     const PylithScalar a_t[],
+                     const PylithScalar a_x[],
+                     const PylithReal t,
+                     const PylithScalar x[],
+                     const PylithInt numConstants,
+                     const PylithScalar constants[],
+                     PylithScalar f0[]) {
+                const PylithScalar density = a[aOff[0]];
+                const PylithScalar* density_x = &a_x[aOff_x[0]];
+                const PylithScalar pressure = s[sOff[1]];
+                for (PylithInt i = 0; i < dim; ++i) {
+                    f0[i] += density * s_t[sOff[0]+i] + density_x[i] * pressure + x[i] * t;
+                } // for
+            } // f0u
+
+            /// Residual for displacement subfield with stress-like term.
+            static
+            void f1u(const PylithInt dim,
+                     const PylithInt numS,
+                     const PylithInt numA,
+                     const PylithInt sOff[],
+                     const PylithInt sOff_x[],
+                     const PylithScalar s[],
+                     const PylithScalar s_t[],
+                     const PylithScalar s_x[],
+                     const PylithInt aOff[],
+                     const PylithInt aOff_x[],
+                     const PylithScalar a[],
+                     const PylithScalar a_t[],
+                     const PylithScalar a_x[],
+                     const PylithReal t,
+                     const PylithScalar x[],
+                     const PylithInt numConstants,
+                     const PylithScalar constants[],
+                     PylithScalar f1[]) {
+                const PylithScalar shearModulus = a[aOff[1]];
+                const PylithScalar pressure = s[sOff[1]];
+                const PylithScalar* disp_x = &s_x[sOff_x[0]];
+                for (PylithInt i = 0; i < dim; ++i) {
+                    for (PylithInt j = 0; j < dim; ++j) {
+                        f1[i*dim+j] += shearModulus * (disp_x[i*dim+j] + disp_x[j*dim+i]);
+                    } // for
+                    f1[i*dim+i] -= pressure;
+                } // for
+            } // f1u
+
+            /// Residual for pressure subfield.
+            static
+            void f0p(const PylithInt dim,
+                     const PylithInt numS,
+                     const PylithInt numA,
+                     const PylithInt sOff[],
+                     const PylithInt sOff_x[],
+                     const PylithScalar s[],
+                     const PylithScalar s_t[],
+                     const PylithScalar s_x[],
+                     const PylithInt aOff[],
+                     const PylithInt aOff_x[],
+                     const PylithScalar a[],
+                     const PylithScalar a_t[],
+                     const PylithScalar a_x[],
+                     const PylithReal t,
+                     const PylithScalar x[],
+                     const PylithInt numConstants,
+                     const PylithScalar constants[],
+                     PylithScalar f0[]) {
+                const PylithScalar* disp_x = &s_x[sOff_x[0]];
+                PylithScalar divergence = 0.0;
+                for (PylithInt i = 0; i < dim; ++i) {
+                    divergence += disp_x[i*dim+i];
+                } // for
+                f0[0] += divergence + a[aOff[0]] * s[sOff[1]];
+            } // f0p
+
+            /// Residual for pressure subfield with gradient term.
+            static
+            void f1p(const PylithInt dim,
+                     const PylithInt numS,
+                     const PylithInt numA,
+                     const PylithInt sOff[],
+                     const PylithInt sOff_x[],
+                     const PylithScalar s[],
+                     const PylithScalar s_t[],
+                     const PylithScalar s_x[],
+                     const PylithInt aOff[],
+                     const PylithInt aOff_x[],
+                     const PylithScalar a[],
+                     const PylithScalar a_t[],
+                     const PylithScalar a_x[],
+                     const PylithReal t,
+                     const PylithScalar x[],
+                     const PylithInt numConstants,
+                     const PylithScalar constants[],
+                     PylithScalar f1[]) {
+                const PylithScalar* pressure_x = &s_x[sOff_x[1]];
+                const PylithScalar* shearModulus_x = &a_x[aOff_x[1]];
+                for (PylithInt i = 0; i < dim; ++i) {
+                    f1[i] += pressure_x[i] + shearModulus_x[i];
+                } // for
+            } // f1p
+
+            /// Smooth nonpolynomial function for displacement.
+            static
+            PetscErrorCode displacement(PetscInt dim,
+                                        PetscReal t,
+                                        const PetscReal x[],
+                                        PetscInt numComponents,
+                                        PetscScalar* values,
+                                        void* context) {
+                for (PetscInt i = 0; i < numComponents; ++i) {
+                    values[i] = sin(0.7*x[0] + 0.3*i) * cos(0.4*x[1] - 0.2*i) + ((3 == dim) ? 0.2*x[2]*x[2] : 0.0);
+                } // for
+                return 0;
+            } // displacement
+
+            /// Smooth nonpolynomial function for pressure.
+            static
+            PetscErrorCode pressure(PetscInt dim,
+                                    PetscReal t,
+                                    const PetscReal x[],
+                                    PetscInt numComponents,
+                                    PetscScalar* values,
+                                    void* context) {
+                values[0] = exp(0.3*x[0]) - 0.5*x[1]*x[1] + ((3 == dim) ? cos(x[2]) : 0.0);
+                return 0;
+            } // pressure
+
+            /// Time derivative of displacement.
+            static
+            PetscErrorCode displacementDot(PetscInt dim,
+                                           PetscReal t,
+                                           const PetscReal x[],
+                                           PetscInt numComponents,
+                                           PetscScalar* values,
+                                           void* context) {
+                for (PetscInt i = 0; i < numComponents; ++i) {
+                    values[i] = cos(0.5*x[1] + 0.1*i) - 0.3*x[0];
+                } // for
+                return 0;
+            } // displacementDot
+
+            /// Time derivative of pressure.
+            static
+            PetscErrorCode pressureDot(PetscInt dim,
+                                       PetscReal t,
+                                       const PetscReal x[],
+                                       PetscInt numComponents,
+                                       PetscScalar* values,
+                                       void* context) {
+                values[0] = 0.0;
+                return 0;
+            } // pressureDot
+
+            /// Spatially variable density.
+            static
+            PetscErrorCode density(PetscInt dim,
+                                   PetscReal t,
+                                   const PetscReal x[],
+                                   PetscInt numComponents,
+                                   PetscScalar* values,
+                                   void* context) {
+                values[0] = 2.0 + 0.5*x[0] - 0.25*x[1];
+                return 0;
+            } // density
+
+            /// Spatially variable shear modulus.
+            static
+            PetscErrorCode shearModulus(PetscInt dim,
+                                        PetscReal t,
+                                        const PetscReal x[],
+                                        PetscInt numComponents,
+                                        PetscScalar* values,
+                                        void* context) {
+                values[0] = 3.0 + 0.2*x[0]*x[1] + 0.1*x[1]*x[1];
+                return 0;
+            } // shearModulus
+
+            static const int labelValue; ///< Label value for cells.
+
+        }; // _TestTensorResidual
+
+        const int _TestTensorResidual::labelValue = 24;
+
+    } // feassemble
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::feassemble::TestTensorResidual);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::feassemble::TestTensorResidual::setUp(void) {
+    _mesh = NULL;
+    _solution = NULL;
+    _solutionDot = NULL;
+    _auxiliaryField = NULL;
+} // setUp
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::feassemble::TestTensorResidual::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _auxiliaryField;_auxiliaryField = NULL;
+    delete _solutionDot;_solutionDot = NULL;
+    delete _solution;_solution = NULL;
+    delete _mesh;_mesh = NULL;
+    pylith::topology::FieldOps::deallocate();
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test initialize() for simplex and tensor-product cells.
+void
+pylith::feassemble::TestTensorResidual::testInitialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    { // Simplex cells
+        _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+        pylith::meshio::MeshIOAscii iohandler;
+        iohandler.setFilename("data/tri.mesh");
+        iohandler.read(_mesh);
+
+        spatialdata::geocoords::CSCart cs;
+        cs.setSpaceDim(2);
+        _mesh->setCoordSys(&cs);
+
+        _createFields(2, 2, pylith::topology::FieldBase::POLYNOMIAL_SPACE, 2);
+        DSLabelAccess dsLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, _TestTensorResidual::labelValue);
+        TensorResidual tensorResidual;
+        CPPUNIT_ASSERT(!tensorResidual.initialize(dsLabel));
+        CPPUNIT_ASSERT(!tensorResidual.isApplicable());
+        tearDown();
+    } // Simplex cells
+
+    { // Q1: tensor-product structure, but tabulated basis is used without precomputed geometry.
+        _createMesh(2);
+        _createFields(1, 1, pylith::topology::FieldBase::POLYNOMIAL_SPACE, 1);
+        DSLabelAccess dsLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, _TestTensorResidual::labelValue);
+        TensorResidual tensorResidual;
+        CPPUNIT_ASSERT(tensorResidual.initialize(dsLabel));
+        CPPUNIT_ASSERT(!tensorResidual.isApplicable());
+        tearDown();
+    } // Q1
+
+    { // Q2
+        _createMesh(2);
+        _createFields(2, 2, pylith::topology::FieldBase::POLYNOMIAL_SPACE, 2);
+        DSLabelAccess dsLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, _TestTensorResidual::labelValue);
+        TensorResidual tensorResidual;
+        CPPUNIT_ASSERT(tensorResidual.initialize(dsLabel));
+        CPPUNIT_ASSERT(tensorResidual.isApplicable());
+    } // Q2
+
+    PYLITH_METHOD_END;
+} // testInitialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeResidual() matches generic integration for Q2 quadrilateral cells.
+void
+pylith::feassemble::TestTensorResidual::testResidualQuadQ2(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int basisOrder = 2;
+    _createMesh(2);
+    _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::POLYNOMIAL_SPACE, basisOrder);
+    _checkResidual(basisOrder);
+
+    PYLITH_METHOD_END;
+} // testResidualQuadQ2
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeResidual() matches generic integration for Q3 quadrilateral cells.
+void
+pylith::feassemble::TestTensorResidual::testResidualQuadQ3(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int basisOrder = 3;
+    _createMesh(2);
+    _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::POLYNOMIAL_SPACE, basisOrder);
+    _checkResidual(basisOrder);
+
+    PYLITH_METHOD_END;
+} // testResidualQuadQ3
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeResidual() matches generic integration for Q2 hexahedral cells.
+void
+pylith::feassemble::TestTensorResidual::testResidualHexQ2(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int basisOrder = 2;
+    _createMesh(3);
+    _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::POLYNOMIAL_SPACE, basisOrder);
+    _checkResidual(basisOrder);
+
+    PYLITH_METHOD_END;
+} // testResidualHexQ2
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeResidual() with precomputed geometry matches computed geometry for Q1 and Q2 cells.
+void
+pylith::feassemble::TestTensorResidual::testResidualPrecomputedGeometry(void) {
+    PYLITH_METHOD_BEGIN;
+
+    { // Q1: Precomputed geometry makes sum factorization applicable.
+        const int basisOrder = 1;
+        _createMesh(2);
+        _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::POLYNOMIAL_SPACE, basisOrder);
+        _checkResidual(basisOrder, true);
+        tearDown();
+    } // Q1
+
+    { // Q2: Residual is the same with and without precomputed geometry.
+        const int basisOrder = 2;
+        _createMesh(2);
+        _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::POLYNOMIAL_SPACE, basisOrder);
+        _checkResidual(basisOrder, false);
+        _checkResidual(basisOrder, true);
+
+        DSLabelAccess dsLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, _TestTensorResidual::labelValue);
+        TensorResidual tensorResidual;
+        CPPUNIT_ASSERT(tensorResidual.initialize(dsLabel));
+
+        const PylithReal t = 0.5;
+        const PetscInt part = pylith::feassemble::Integrator::LHS;
+        PetscErrorCode err = 0;
+        PetscVec residualComputed = NULL;
+        PetscVec residualPrecomputed = NULL;
+        err = DMCreateLocalVector(_solution->getDM(), &residualComputed);CPPUNIT_ASSERT(!err);
+        err = VecDuplicate(residualComputed, &residualPrecomputed);CPPUNIT_ASSERT(!err);
+        err = VecSet(residualComputed, 0.0);CPPUNIT_ASSERT(!err);
+        err = VecSet(residualPrecomputed, 0.0);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT(tensorResidual.computeResidual(part, dsLabel.cellsIS(), t, _solution->getLocalVector(),
+                                                      _solutionDot->getLocalVector(), residualComputed));
+        tensorResidual.precomputeGeometry(dsLabel.cellsIS());
+        CPPUNIT_ASSERT(tensorResidual.computeResidual(part, dsLabel.cellsIS(), t, _solution->getLocalVector(),
+                                                      _solutionDot->getLocalVector(), residualPrecomputed));
+
+        PylithReal norm = 0.0;
+        PylithReal normDiff = 0.0;
+        err = VecNorm(residualComputed, NORM_INFINITY, &norm);CPPUNIT_ASSERT(!err);
+        err = VecAXPY(residualPrecomputed, -1.0, residualComputed);CPPUNIT_ASSERT(!err);
+        err = VecNorm(residualPrecomputed, NORM_INFINITY, &normDiff);CPPUNIT_ASSERT(!err);
+        const PylithReal tolerance = 1.0e-12;
+        CPPUNIT_ASSERT(norm > 0.0);
+        CPPUNIT_ASSERT(normDiff <= tolerance*norm);
+
+        err = VecDestroy(&residualPrecomputed);CPPUNIT_ASSERT(!err);
+        err = VecDestroy(&residualComputed);CPPUNIT_ASSERT(!err);
+    } // Q2
+
+    PYLITH_METHOD_END;
+} // testResidualPrecomputedGeometry
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeResidual() matches generic integration for batch sizes with full and partial batches.
+void
+pylith::feassemble::TestTensorResidual::testResidualBatches(void) {
+    PYLITH_METHOD_BEGIN;
+
+    { // Quadrilateral mesh with 4 cells: batches of 1, 3+1, and a single partial batch.
+        const int basisOrder = 2;
+        _createMesh(2);
+        _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::POLYNOMIAL_SPACE, basisOrder);
+        _checkResidual(basisOrder, false, 1);
+        _checkResidual(basisOrder, false, 3);
+        _checkResidual(basisOrder, true, 3);
+        _checkResidual(basisOrder, false, 8);
+        tearDown();
+    } // quad
+
+    { // Hexahedral mesh with 2 cells: full batch of 2.
+        const int basisOrder = 2;
+        _createMesh(3);
+        _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::POLYNOMIAL_SPACE, basisOrder);
+        _checkResidual(basisOrder, false, 2);
+    } // hex
+
+    PYLITH_METHOD_END;
+} // testResidualBatches
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeResidual() falls back when auxiliary quadrature points differ.
+void
+pylith::feassemble::TestTensorResidual::testAuxiliaryQuadratureMismatch(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Gauss quadrature for the solution and Gauss-Lobatto-Legendre quadrature for the auxiliary
+    // field with the same number of points.
+    const int basisOrder = 2;
+    _createMesh(2);
+    _createFields(basisOrder, basisOrder, pylith::topology::FieldBase::SPECTRAL_SPACE, basisOrder);
+
+    PetscErrorCode err = 0;
+    PetscDS dsSoln = NULL, dsAux = NULL;
+    PetscObject feSoln = NULL, feAux = NULL;
+    PetscQuadrature quadSoln = NULL, quadAux = NULL;
+    PetscInt numQuadPtsSoln = 0, numQuadPtsAux = 0;
+    err = DMGetDS(_solution->getDM(), &dsSoln);CPPUNIT_ASSERT(!err);
+    err = DMGetDS(_auxiliaryField->getDM(), &dsAux);CPPUNIT_ASSERT(!err);
+    err = PetscDSGetDiscretization(dsSoln, 0, &feSoln);CPPUNIT_ASSERT(!err);
+    err = PetscDSGetDiscretization(dsAux, 0, &feAux);CPPUNIT_ASSERT(!err);
+    err = PetscFEGetQuadrature((PetscFE)feSoln, &quadSoln);CPPUNIT_ASSERT(!err);
+    err = PetscFEGetQuadrature((PetscFE)feAux, &quadAux);CPPUNIT_ASSERT(!err);
+    err = PetscQuadratureGetData(quadSoln, NULL, NULL, &numQuadPtsSoln, NULL, NULL);CPPUNIT_ASSERT(!err);
+    err = PetscQuadratureGetData(quadAux, NULL, NULL, &numQuadPtsAux, NULL, NULL);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(numQuadPtsSoln, numQuadPtsAux);
+
+    DSLabelAccess dsLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, _TestTensorResidual::labelValue);
+    TensorResidual tensorResidual;
+    CPPUNIT_ASSERT(tensorResidual.initialize(dsLabel));
+    CPPUNIT_ASSERT(tensorResidual.isApplicable());
+
+    PetscVec residualVec = NULL;
+    err = DMCreateLocalVector(_solution->getDM(), &residualVec);CPPUNIT_ASSERT(!err);
+    err = VecSet(residualVec, 0.0);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(!tensorResidual.computeResidual(pylith::feassemble::Integrator::LHS, dsLabel.cellsIS(), 0.5,
+                                                   _solution->getLocalVector(), _solutionDot->getLocalVector(),
+                                                   residualVec));
+    PylithReal norm = 0.0;
+    err = VecNorm(residualVec, NORM_2, &norm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(0.0, norm);
+    err = VecDestroy(&residualVec);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testAuxiliaryQuadratureMismatch
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create mesh with distorted quadrilateral or hexahedral cells.
+void
+pylith::feassemble::TestTensorResidual::_createMesh(const int dim) {
+    PYLITH_METHOD_BEGIN;
+
+    pylith::scalar_array coordinates;
+    pylith::int_array cells;
+    int numVertices = 0;
+    int numCells = 0;
+    int numCorners = 0;
+    if (2 == dim) {
+        // 2x2 quadrilaterals with the center vertex moved off of the grid.
+        const PylithScalar coordinatesValues[9*2] = {
+            0.0, 0.0,
+            1.0, 0.0,
+            2.0, 0.0,
+            0.0, 1.0,
+            1.1, 0.9,
+            2.0, 1.0,
+            0.0, 2.0,
+            1.0, 2.0,
+            2.0, 2.0,
+        };
+        const PylithInt cellsValues[4*4] = {
+            0, 1, 4, 3,
+            1, 2, 5, 4,
+            3, 4, 7, 6,
+            4, 5, 8, 7,
+        };
+        numVertices = 9;
+        numCells = 4;
+        numCorners = 4;
+        coordinates = pylith::scalar_array(coordinatesValues, numVertices*dim);
+        cells = pylith::int_array(cellsValues, numCells*numCorners);
+    } else {
+        // Two hexahedra with the shared face distorted.
+        const PylithScalar coordinatesValues[12*3] = {
+            0.0, 0.0, 0.0,
+            1.0, 0.0, 0.0,
+            1.0, 1.0, 0.0,
+            0.0, 1.0, 0.0,
+            0.0, 0.0, 1.0,
+            1.2, 0.1, 1.0,
+            0.9, 1.0, 1.1,
+            0.0, 1.0, 1.0,
+            0.0, 0.0, 2.0,
+            1.0, 0.0, 2.0,
+            1.0, 1.0, 2.0,
+            0.0, 1.0, 2.0,
+        };
+        const PylithInt cellsValues[2*8] = {
+            0, 1, 2, 3, 4, 5, 6, 7,
+            4, 5, 6, 7, 8, 9, 10, 11,
+        };
+        numVertices = 12;
+        numCells = 2;
+        numCorners = 8;
+        coordinates = pylith::scalar_array(coordinatesValues, numVertices*dim);
+        cells = pylith::int_array(cellsValues, numCells*numCorners);
+    } // if/else
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, dim, cells, numCells, numCorners, dim);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(dim);
+    _mesh->setCoordSys(&cs);
+
+    PetscErrorCode err = 0;
+    pylith::topology::Stratum cellsStratum(_mesh->getDM(), pylith::topology::Stratum::HEIGHT, 0);
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        err = DMSetLabelValue(_mesh->getDM(), pylith::topology::Mesh::cells_label_name, cell,
+                              _TestTensorResidual::labelValue);CPPUNIT_ASSERT(!err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _createMesh
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create solution and auxiliary fields, set residual kernels, and set field values.
+void
+pylith::feassemble::TestTensorResidual::_createFields(const int basisOrder,
+                                                      const int quadOrder,
+                                                      const pylith::topology::FieldBase::SpaceEnum auxSpace,
+                                                      const int auxQuadOrder) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_mesh);
+
+    const int dim = _mesh->getDimension();
+
+    pylith::topology::Field::Description displacement;
+    displacement.label = "displacement";
+    displacement.vectorFieldType = pylith::topology::Field::VECTOR;
+    displacement.numComponents = dim;
+    displacement.componentNames.resize(dim);
+    for (int i = 0; i < dim; ++i) {
+        const char* names[3] = { "displacement_x", "displacement_y", "displacement_z" };
+        displacement.componentNames[i] = names[i];
+    } // for
+
+    pylith::topology::Field::Description pressure;
+    pressure.label = "pressure";
+    pressure.vectorFieldType = pylith::topology::Field::SCALAR;
+    pressure.numComponents = 1;
+    pressure.componentNames.resize(1);
+    pressure.componentNames[0] = "pressure";
+
+    pylith::topology::Field::Description density;
+    density.label = "density";
+    density.vectorFieldType = pylith::topology::Field::SCALAR;
+    density.numComponents = 1;
+    density.componentNames.resize(1);
+    density.componentNames[0] = "density";
+
+    pylith::topology::Field::Description shearModulus;
+    shearModulus.label = "shear_modulus";
+    shearModulus.vectorFieldType = pylith::topology::Field::SCALAR;
+    shearModulus.numComponents = 1;
+    shearModulus.componentNames.resize(1);
+    shearModulus.componentNames[0] = "shear_modulus";
+
+    // Pressure uses a lower basis order than displacement, like a Taylor-Hood discretization.
+    const int basisOrderPressure = std::max(basisOrder-1, 1);
+    _solution = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(_solution);
+    _solution->setLabel("solution");
+    _solution->subfieldAdd(displacement, pylith::topology::Field::Discretization(basisOrder, quadOrder, dim));
+    _solution->subfieldAdd(pressure, pylith::topology::Field::Discretization(basisOrderPressure, quadOrder, dim));
+    _solution->subfieldsSetup();
+    _solution->createDiscretization();
+    _solution->allocate();
+
+    _auxiliaryField = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(_auxiliaryField);
+    _auxiliaryField->setLabel("auxiliary field");
+    _auxiliaryField->subfieldAdd(density, pylith::topology::Field::Discretization(1, auxQuadOrder, dim, -1, false,
+                                                                                   pylith::topology::Field::DEFAULT_BASIS,
+                                                                                   auxSpace));
+    _auxiliaryField->subfieldAdd(shearModulus, pylith::topology::Field::Discretization(2, auxQuadOrder, dim, -1, false,
+                                                                                        pylith::topology::Field::DEFAULT_BASIS,
+                                                                                        auxSpace));
+    _auxiliaryField->subfieldsSetup();
+    _auxiliaryField->createDiscretization();
+    _auxiliaryField->allocate();
+
+    PetscErrorCode err = 0;
+    PetscErrorCode (*auxiliaryFns[2])(PetscInt, PetscReal, const PetscReal[], PetscInt, PetscScalar*, void*) = {
+        _TestTensorResidual::density,
+        _TestTensorResidual::shearModulus,
+    };
+    err = DMProjectFunctionLocal(_auxiliaryField->getDM(), 0.0, auxiliaryFns, NULL, INSERT_ALL_VALUES,
+                                 _auxiliaryField->getLocalVector());CPPUNIT_ASSERT(!err);
+
+    PetscErrorCode (*solutionFns[2])(PetscInt, PetscReal, const PetscReal[], PetscInt, PetscScalar*, void*) = {
+        _TestTensorResidual::displacement,
+        _TestTensorResidual::pressure,
+    };
+    err = DMProjectFunctionLocal(_solution->getDM(), 0.0, solutionFns, NULL, INSERT_ALL_VALUES,
+                                 _solution->getLocalVector());CPPUNIT_ASSERT(!err);
+
+    _solutionDot = new pylith::topology::Field(*_solution);CPPUNIT_ASSERT(_solutionDot);
+    _solutionDot->setLabel("solution_dot");
+    PetscErrorCode (*solutionDotFns[2])(PetscInt, PetscReal, const PetscReal[], PetscInt, PetscScalar*, void*) = {
+        _TestTensorResidual::displacementDot,
+        _TestTensorResidual::pressureDot,
+    };
+    err = DMProjectFunctionLocal(_solution->getDM(), 0.0, solutionDotFns, NULL, INSERT_ALL_VALUES,
+                                 _solutionDot->getLocalVector());CPPUNIT_ASSERT(!err);
+
+    // Residual kernels and auxiliary field for cells with label value.
+    PetscDMLabel label = NULL;
+    err = DMGetLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, &label);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(label);
+    DSLabelAccess dsLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, _TestTensorResidual::labelValue);
+    const PetscInt iDisp = _solution->getSubfieldInfo("displacement").index;
+    const PetscInt iPres = _solution->getSubfieldInfo("pressure").index;
+    err = PetscWeakFormAddResidual(dsLabel.weakForm(), label, _TestTensorResidual::labelValue, iDisp,
+                                   pylith::feassemble::Integrator::LHS, _TestTensorResidual::f0u,
+                                   _TestTensorResidual::f1u);CPPUNIT_ASSERT(!err);
+    err = PetscWeakFormAddResidual(dsLabel.weakForm(), label, _TestTensorResidual::labelValue, iPres,
+                                   pylith::feassemble::Integrator::LHS, _TestTensorResidual::f0p,
+                                   _TestTensorResidual::f1p);CPPUNIT_ASSERT(!err);
+    err = DMSetAuxiliaryVec(_solution->getDM(), label, _TestTensorResidual::labelValue, pylith::feassemble::Integrator::LHS,
+                            _auxiliaryField->getLocalVector());CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // _createFields
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check residual from sum factorization against generic integration.
+void
+pylith::feassemble::TestTensorResidual::_checkResidual(const int basisOrder,
+                                                       const bool precomputeGeometry,
+                                                       const int batchSize) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_solution);
+    CPPUNIT_ASSERT(_solutionDot);
+
+    DSLabelAccess dsLabel(_solution->getDM(), pylith::topology::Mesh::cells_label_name, _TestTensorResidual::labelValue);
+    TensorResidual tensorResidual;
+    CPPUNIT_ASSERT(tensorResidual.initialize(dsLabel));
+    if (precomputeGeometry) {
+        tensorResidual.precomputeGeometry(dsLabel.cellsIS());
+    } // if
+    if (batchSize > 0) {
+        tensorResidual._batchSize = batchSize;
+    } // if
+    CPPUNIT_ASSERT(tensorResidual.isApplicable());
+
+    const PylithReal t = 0.5;
+    PetscErrorCode err = 0;
+    PetscVec residualGeneric = NULL;
+    PetscVec residualTensor = NULL;
+    err = DMCreateLocalVector(_solution->getDM(), &residualGeneric);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(residualGeneric, &residualTensor);CPPUNIT_ASSERT(!err);
+    err = VecSet(residualGeneric, 0.0);CPPUNIT_ASSERT(!err);
+    err = VecSet(residualTensor, 0.0);CPPUNIT_ASSERT(!err);
+
+    PetscFormKey key;
+    key.label = dsLabel.label();
+    key.value = dsLabel.value();
+    key.field = 0;
+    key.part = pylith::feassemble::Integrator::LHS;
+    err = DMPlexComputeResidual_Internal(dsLabel.dm(), key, dsLabel.cellsIS(), PETSC_MIN_REAL, _solution->getLocalVector(),
+                                         _solutionDot->getLocalVector(), t, residualGeneric, NULL);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(tensorResidual.computeResidual(key.part, dsLabel.cellsIS(), t, _solution->getLocalVector(),
+                                                  _solutionDot->getLocalVector(), residualTensor));
+
+    PylithReal normGeneric = 0.0;
+    PylithReal normDiff = 0.0;
+    err = VecNorm(residualGeneric, NORM_2, &normGeneric);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(normGeneric > 0.0);
+    err = VecAXPY(residualTensor, -1.0, residualGeneric);CPPUNIT_ASSERT(!err);
+    err = VecNorm(residualTensor, NORM_INFINITY, &normDiff);CPPUNIT_ASSERT(!err);
+
+    std::ostringstream msg;
+    msg << "Mismatch in residual for basis order " << basisOrder << (precomputeGeometry ? " with" : " without")
+        << " precomputed geometry and batch size " << tensorResidual._batchSize << ".";
+    const PylithReal tolerance = 1.0e-10;
+    CPPUNIT_ASSERT_MESSAGE(msg.str().c_str(), normDiff <= tolerance*normGeneric);
+
+    err = VecDestroy(&residualTensor);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&residualGeneric);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // _checkResidual
+
+
+// End of file
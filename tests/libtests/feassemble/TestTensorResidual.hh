@@ -0,0 +1,130 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/feassemble/TestTensorResidual.hh
+ *
+ * @brief C++ TestTensorResidual object.
+ *
+ * C++ unit testing for TensorResidual.
+ */
+
+#if !defined(pylith_feassemble_testtensorresidual_hh)
+#define pylith_feassemble_testtensorresidual_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/feassemble/feassemblefwd.hh" // USES TensorResidual
+#include "pylith/topology/FieldBase.hh" // USES FieldBase::SpaceEnum
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh, Field
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace feassemble {
+        class TestTensorResidual;
+    } // feassemble
+} // pylith
+
+class pylith::feassemble::TestTensorResidual : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestTensorResidual);
+
+    CPPUNIT_TEST(testInitialize);
+    CPPUNIT_TEST(testResidualQuadQ2);
+    CPPUNIT_TEST(testResidualQuadQ3);
+    CPPUNIT_TEST(testResidualHexQ2);
+    CPPUNIT_TEST(testResidualPrecomputedGeometry);
+    CPPUNIT_TEST(testResidualBatches);
+    CPPUNIT_TEST(testAuxiliaryQuadratureMismatch);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test initialize() for simplex and tensor-product cells.
+    void testInitialize(void);
+
+    /// Test computeResidual() matches generic integration for Q2 quadrilateral cells.
+    void testResidualQuadQ2(void);
+
+    /// Test computeResidual() matches generic integration for Q3 quadrilateral cells.
+    void testResidualQuadQ3(void);
+
+    /// Test computeResidual() matches generic integration for Q2 hexahedral cells.
+    void testResidualHexQ2(void);
+
+    /// Test computeResidual() with precomputed geometry matches computed geometry for Q1 and Q2 cells.
+    void testResidualPrecomputedGeometry(void);
+
+    /// Test computeResidual() matches generic integration for batch sizes with full and partial batches.
+    void testResidualBatches(void);
+
+    /// Test computeResidual() falls back when auxiliary quadrature points differ.
+    void testAuxiliaryQuadratureMismatch(void);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create mesh with distorted quadrilateral or hexahedral cells.
+     *
+     * @param[in] dim Dimension of mesh.
+     */
+    void _createMesh(const int dim);
+
+    /** Create solution and auxiliary fields, set residual kernels, and set field values.
+     *
+     * @param[in] basisOrder Basis order for displacement subfield.
+     * @param[in] quadOrder Quadrature order for solution subfields.
+     * @param[in] auxSpace Finite-element space for auxiliary subfields.
+     * @param[in] auxQuadOrder Quadrature order for auxiliary subfields.
+     */
+    void _createFields(const int basisOrder,
+                       const int quadOrder,
+                       const pylith::topology::FieldBase::SpaceEnum auxSpace,
+                       const int auxQuadOrder);
+
+    /** Check residual from sum factorization against generic integration.
+     *
+     * @param[in] basisOrder Basis order for displacement subfield.
+     * @param[in] precomputeGeometry Use precomputed cell geometry.
+     * @param[in] batchSize Number of cells in a batch (0 for default).
+     */
+    void _checkResidual(const int basisOrder,
+                        const bool precomputeGeometry=false,
+                        const int batchSize=0);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+    pylith::topology::Field* _solutionDot; ///< Time derivative of solution field.
+    pylith::topology::Field* _auxiliaryField; ///< Auxiliary field.
+
+}; // class TestTensorResidual
+
+#endif // pylith_feassemble_testtensorresidual_hh
+
+// End of file
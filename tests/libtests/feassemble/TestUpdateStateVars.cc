@@ -0,0 +1,240 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestUpdateStateVars.hh" // Implementation of class methods
+
+#include "pylith/feassemble/UpdateStateVars.hh" // Test subject
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::feassemble::TestUpdateStateVars);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::feassemble::TestUpdateStateVars::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(2);
+    _mesh->setCoordSys(&cs);
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::feassemble::TestUpdateStateVars::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test initialize() for state variables with and without values at quadrature points.
+void
+pylith::feassemble::TestUpdateStateVars::testInitialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    { // Values at quadrature points use local index set.
+        pylith::topology::Field* auxiliaryField = _createAuxiliaryField(pylith::topology::FieldBase::POINT_SPACE);
+        UpdateStateVars updater;
+        updater.initialize(*auxiliaryField);
+        CPPUNIT_ASSERT(updater._stateVarsDM);
+        CPPUNIT_ASSERT(updater._stateVarsVecLocal);
+        CPPUNIT_ASSERT(updater._stateVarsISLocal);
+        CPPUNIT_ASSERT(!updater._stateVarsVecGlobal);
+        CPPUNIT_ASSERT(!updater._auxiliaryFieldVecGlobal);
+        delete auxiliaryField;auxiliaryField = NULL;
+    } // Values at quadrature points
+
+    { // Polynomial basis uses global vectors.
+        pylith::topology::Field* auxiliaryField = _createAuxiliaryField(pylith::topology::FieldBase::POLYNOMIAL_SPACE);
+        UpdateStateVars updater;
+        updater.initialize(*auxiliaryField);
+        CPPUNIT_ASSERT(updater._stateVarsDM);
+        CPPUNIT_ASSERT(updater._stateVarsVecLocal);
+        CPPUNIT_ASSERT(!updater._stateVarsISLocal);
+        CPPUNIT_ASSERT(updater._stateVarsVecGlobal);
+        CPPUNIT_ASSERT(updater._auxiliaryFieldVecGlobal);
+        delete auxiliaryField;auxiliaryField = NULL;
+    } // Polynomial basis
+
+    PYLITH_METHOD_END;
+} // testInitialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test prepare() and restore() for state variables with values at quadrature points.
+void
+pylith::feassemble::TestUpdateStateVars::testRestorePointSpace(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const PylithReal densityValue = -1.0;
+    pylith::topology::Field* auxiliaryField = _createAuxiliaryField(pylith::topology::FieldBase::POINT_SPACE);
+    pylith::topology::Field* auxiliaryFieldGlobal = _createAuxiliaryField(pylith::topology::FieldBase::POINT_SPACE);
+
+    PetscErrorCode err = 0;
+    err = VecSet(auxiliaryField->getLocalVector(), densityValue);CPPUNIT_ASSERT(!err);
+    err = VecSet(auxiliaryFieldGlobal->getLocalVector(), densityValue);CPPUNIT_ASSERT(!err);
+
+    // Update using local index set.
+    UpdateStateVars updater;
+    updater.initialize(*auxiliaryField);
+    CPPUNIT_ASSERT(updater._stateVarsISLocal);
+    updater.prepare(auxiliaryField);
+    PetscVec stateVarsVec = updater.stateVarsLocalVector();CPPUNIT_ASSERT(stateVarsVec);
+    PetscInt stateVarsSize = 0;
+    PetscScalar* stateVarsArray = NULL;
+    err = VecGetLocalSize(stateVarsVec, &stateVarsSize);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(stateVarsSize > 0);
+    err = VecGetArray(stateVarsVec, &stateVarsArray);CPPUNIT_ASSERT(!err);
+    for (PetscInt i = 0; i < stateVarsSize; ++i) {
+        stateVarsArray[i] = 1.0 + 0.5*i;
+    } // for
+    err = VecRestoreArray(stateVarsVec, &stateVarsArray);CPPUNIT_ASSERT(!err);
+    updater.restore(auxiliaryField);
+
+    // Update with the same values going through global vectors.
+    UpdateStateVars updaterGlobal;
+    updaterGlobal.initialize(*auxiliaryFieldGlobal);
+    err = ISDestroy(&updaterGlobal._stateVarsISLocal);CPPUNIT_ASSERT(!err);
+    err = DMCreateGlobalVector(updaterGlobal._stateVarsDM, &updaterGlobal._stateVarsVecGlobal);CPPUNIT_ASSERT(!err);
+    err = DMCreateGlobalVector(auxiliaryFieldGlobal->getDM(), &updaterGlobal._auxiliaryFieldVecGlobal);CPPUNIT_ASSERT(!err);
+    updaterGlobal.prepare(auxiliaryFieldGlobal);
+    err = VecCopy(stateVarsVec, updaterGlobal.stateVarsLocalVector());CPPUNIT_ASSERT(!err);
+    updaterGlobal.restore(auxiliaryFieldGlobal);
+
+    // State variables match values in state variables vector, and other subfields are unchanged.
+    PetscSection auxiliarySection = auxiliaryField->getLocalSection();CPPUNIT_ASSERT(auxiliarySection);
+    PetscSection stateVarsSection = NULL;
+    err = DMGetLocalSection(updater.stateVarsDM(), &stateVarsSection);CPPUNIT_ASSERT(!err);
+    const PetscInt iDensity = auxiliaryField->getSubfieldInfo("density").index;
+    const PetscInt iViscousStrain = auxiliaryField->getSubfieldInfo("viscous_strain").index;
+
+    const PetscScalar* auxiliaryArray = NULL;
+    const PetscScalar* auxiliaryGlobalArray = NULL;
+    const PetscScalar* stateVarsArrayRead = NULL;
+    err = VecGetArrayRead(auxiliaryField->getLocalVector(), &auxiliaryArray);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(auxiliaryFieldGlobal->getLocalVector(), &auxiliaryGlobalArray);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(stateVarsVec, &stateVarsArrayRead);CPPUNIT_ASSERT(!err);
+
+    const PylithReal tolerance = 1.0e-12;
+    pylith::topology::Stratum cellsStratum(_mesh->getDM(), pylith::topology::Stratum::HEIGHT, 0);
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        PetscInt numDof = 0, auxiliaryOff = 0, stateVarsOff = 0;
+        err = PetscSectionGetFieldDof(auxiliarySection, cell, iViscousStrain, &numDof);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetFieldOffset(auxiliarySection, cell, iViscousStrain, &auxiliaryOff);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetFieldOffset(stateVarsSection, cell, 0, &stateVarsOff);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT(numDof > 0);
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsArrayRead[stateVarsOff+iDof], auxiliaryArray[auxiliaryOff+iDof], tolerance);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(auxiliaryGlobalArray[auxiliaryOff+iDof], auxiliaryArray[auxiliaryOff+iDof], tolerance);
+        } // for
+    } // for
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = PetscSectionGetChart(auxiliarySection, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt numDof = 0, auxiliaryOff = 0;
+        err = PetscSectionGetFieldDof(auxiliarySection, point, iDensity, &numDof);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetFieldOffset(auxiliarySection, point, iDensity, &auxiliaryOff);CPPUNIT_ASSERT(!err);
+        for (PetscInt iDof = 0; iDof < numDof; ++iDof) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(densityValue, auxiliaryArray[auxiliaryOff+iDof], tolerance);
+        } // for
+    } // for
+
+    err = VecRestoreArrayRead(stateVarsVec, &stateVarsArrayRead);CPPUNIT_ASSERT(!err);
+    err = VecRestoreArrayRead(auxiliaryFieldGlobal->getLocalVector(), &auxiliaryGlobalArray);CPPUNIT_ASSERT(!err);
+    err = VecRestoreArrayRead(auxiliaryField->getLocalVector(), &auxiliaryArray);CPPUNIT_ASSERT(!err);
+
+    updaterGlobal.deallocate();
+    updater.deallocate();
+    delete auxiliaryFieldGlobal;auxiliaryFieldGlobal = NULL;
+    delete auxiliaryField;auxiliaryField = NULL;
+
+    PYLITH_METHOD_END;
+} // testRestorePointSpace
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create auxiliary field with density and viscous strain state variable.
+pylith::topology::Field*
+pylith::feassemble::TestUpdateStateVars::_createAuxiliaryField(const pylith::topology::FieldBase::SpaceEnum stateVarsSpace) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_mesh);
+
+    pylith::topology::Field::Description density;
+    density.label = "density";
+    density.vectorFieldType = pylith::topology::Field::SCALAR;
+    density.numComponents = 1;
+    density.componentNames.resize(1);
+    density.componentNames[0] = "density";
+
+    pylith::topology::Field::Description viscousStrain;
+    viscousStrain.label = "viscous_strain";
+    viscousStrain.vectorFieldType = pylith::topology::Field::OTHER;
+    viscousStrain.numComponents = 4;
+    viscousStrain.componentNames.resize(4);
+    viscousStrain.componentNames[0] = "viscous_strain_xx";
+    viscousStrain.componentNames[1] = "viscous_strain_yy";
+    viscousStrain.componentNames[2] = "viscous_strain_zz";
+    viscousStrain.componentNames[3] = "viscous_strain_xy";
+    viscousStrain.hasHistory = true;
+
+    const int basisOrder = 1;
+    const int quadOrder = 2;
+    const int dimension = 2;
+    pylith::topology::Field::Discretization densityDiscretization(0, quadOrder, dimension);
+    pylith::topology::Field::Discretization viscousStrainDiscretization(basisOrder, quadOrder, dimension, -1, false,
+                                                                        pylith::topology::Field::DEFAULT_BASIS,
+                                                                        stateVarsSpace,
+                                                                        pylith::topology::Field::POINT_SPACE != stateVarsSpace);
+
+    pylith::topology::Field* field = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(field);
+    field->setLabel("auxiliary field");
+    field->subfieldAdd(density, densityDiscretization);
+    field->subfieldAdd(viscousStrain, viscousStrainDiscretization);
+    field->subfieldsSetup();
+    field->createDiscretization();
+    field->allocate();
+
+    PYLITH_METHOD_RETURN(field);
+} // _createAuxiliaryField
+
+
+// End of file
@@ -0,0 +1,86 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/feassemble/TestUpdateStateVars.hh
+ *
+ * @brief C++ TestUpdateStateVars object.
+ *
+ * C++ unit testing for UpdateStateVars.
+ */
+
+#if !defined(pylith_feassemble_testupdatestatevars_hh)
+#define pylith_feassemble_testupdatestatevars_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/feassemble/feassemblefwd.hh" // USES UpdateStateVars
+#include "pylith/topology/FieldBase.hh" // USES FieldBase::SpaceEnum
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh, Field
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace feassemble {
+        class TestUpdateStateVars;
+    } // feassemble
+} // pylith
+
+class pylith::feassemble::TestUpdateStateVars : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestUpdateStateVars);
+
+    CPPUNIT_TEST(testInitialize);
+    CPPUNIT_TEST(testRestorePointSpace);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test initialize() for state variables with and without values at quadrature points.
+    void testInitialize(void);
+
+    /// Test prepare() and restore() for state variables with values at quadrature points.
+    void testRestorePointSpace(void);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Create auxiliary field with density and viscous strain state variable.
+     *
+     * @param[in] stateVarsSpace Finite-element space for viscous strain.
+     * @returns Auxiliary field.
+     */
+    pylith::topology::Field* _createAuxiliaryField(const pylith::topology::FieldBase::SpaceEnum stateVarsSpace);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+
+}; // class TestUpdateStateVars
+
+#endif // pylith_feassemble_testupdatestatevars_hh
+
+// End of file
@@ -0,0 +1,211 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestElasticity.hh" // Implementation of class methods
+
+#include "pylith/materials/Elasticity.hh" // Test subject
+#include "pylith/materials/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity
+#include "pylith/materials/IsotropicLinearMaxwell.hh" // USES IsotropicLinearMaxwell
+#include "pylith/materials/IsotropicLinearGenMaxwell.hh" // USES IsotropicLinearGenMaxwell
+#include "pylith/materials/IsotropicPowerLaw.hh" // USES IsotropicPowerLaw
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <cmath> // USES sqrt()
+#include <vector> // USES std::vector
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::materials::TestElasticity);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::materials::TestElasticity::setUp(void) {
+    _mesh = NULL;
+} // setUp
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::materials::TestElasticity::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeStableTimeStepsExplicit() for a triangle.
+void
+pylith::materials::TestElasticity::testStableTimeStepTri(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Right triangle with legs of length 2 km: minimum altitude is sqrt(2) km.
+    _testStableTimeStep("data/tri_onecell.mesh", sqrt(2.0)*1.0e+3);
+
+    PYLITH_METHOD_END;
+} // testStableTimeStepTri
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeStableTimeStepsExplicit() for a quadrilateral.
+void
+pylith::materials::TestElasticity::testStableTimeStepQuad(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Square with edges of length 8 km.
+    _testStableTimeStep("data/quad_onecell.mesh", 8.0e+3);
+
+    PYLITH_METHOD_END;
+} // testStableTimeStepQuad
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test isJacobianSymmetric() for linear and power-law rheologies.
+void
+pylith::materials::TestElasticity::testJacobianSymmetric(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Elasticity material;
+
+    IsotropicLinearElasticity linearElasticity;
+    material.setBulkRheology(&linearElasticity);
+    CPPUNIT_ASSERT(material.isJacobianSymmetric());
+
+    IsotropicLinearMaxwell maxwell;
+    material.setBulkRheology(&maxwell);
+    CPPUNIT_ASSERT(material.isJacobianSymmetric());
+
+    IsotropicLinearGenMaxwell genMaxwell;
+    material.setBulkRheology(&genMaxwell);
+    CPPUNIT_ASSERT(material.isJacobianSymmetric());
+
+    // Jf3 for power-law viscoelasticity has C1122 != C2211.
+    IsotropicPowerLaw powerLaw;
+    material.setBulkRheology(&powerLaw);
+    CPPUNIT_ASSERT(!material.isJacobianSymmetric());
+
+    material.setBulkRheology(NULL);
+
+    PYLITH_METHOD_END;
+} // testJacobianSymmetric
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check stable time step for basis orders 1 and 2.
+void
+pylith::materials::TestElasticity::_testStableTimeStep(const char* filename,
+                                                       const double cellSize) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename(filename);
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(2);
+    _mesh->setCoordSys(&cs);
+
+    pylith::topology::Field* auxiliaryField = _createAuxiliaryField();CPPUNIT_ASSERT(auxiliaryField);
+
+    // Density 4, shear modulus 3, bulk modulus 4 gives vp = sqrt(2).
+    const PylithReal vp = sqrt(2.0);
+
+    Elasticity material;
+    material.setLabelValue(24);
+
+    const int numOrders = 2;
+    const int basisOrders[numOrders] = { 1, 2 };
+    for (int iOrder = 0; iOrder < numOrders; ++iOrder) {
+        const int basisOrder = basisOrders[iOrder];
+        material._solutionBasisOrder = basisOrder;
+
+        std::vector<PylithInt> cells;
+        std::vector<PylithReal> dtCells;
+        material.computeStableTimeStepsExplicit(&cells, &dtCells, *auxiliaryField);
+        CPPUNIT_ASSERT_EQUAL(size_t(1), cells.size());
+        CPPUNIT_ASSERT_EQUAL(size_t(1), dtCells.size());
+
+        const PylithReal dtE = cellSize / (vp * basisOrder * basisOrder);
+        const PylithReal tolerance = 1.0e-10;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(filename, 1.0, dtCells[0] / dtE, tolerance);
+    } // for
+
+    delete auxiliaryField;auxiliaryField = NULL;
+
+    PYLITH_METHOD_END;
+} // _testStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create auxiliary field with elastic properties.
+pylith::topology::Field*
+pylith::materials::TestElasticity::_createAuxiliaryField(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_mesh);
+
+    const int numSubfields = 3;
+    const char* names[numSubfields] = { "density", "shear_modulus", "bulk_modulus" };
+    const PylithReal values[numSubfields] = { 4.0, 3.0, 4.0 };
+
+    const int basisOrder = 0;
+    const int quadOrder = 1;
+    const int dimension = 2;
+    pylith::topology::Field::Discretization discretization(basisOrder, quadOrder, dimension);
+
+    pylith::topology::Field* field = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(field);
+    field->setLabel("auxiliary field");
+    for (int i = 0; i < numSubfields; ++i) {
+        pylith::topology::Field::Description description;
+        description.label = names[i];
+        description.vectorFieldType = pylith::topology::Field::SCALAR;
+        description.numComponents = 1;
+        description.componentNames.resize(1);
+        description.componentNames[0] = names[i];
+        field->subfieldAdd(description, discretization);
+    } // for
+    field->subfieldsSetup();
+    field->createDiscretization();
+    field->allocate();
+
+    pylith::topology::Stratum cellsStratum(_mesh->getDM(), pylith::topology::Stratum::HEIGHT, 0);
+    for (int i = 0; i < numSubfields; ++i) {
+        pylith::topology::VecVisitorMesh visitor(*field, names[i]);
+        for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+            visitor.localArray()[visitor.sectionOffset(cell)] = values[i];
+        } // for
+    } // for
+
+    PYLITH_METHOD_RETURN(field);
+} // _createAuxiliaryField
+
+
+// End of file
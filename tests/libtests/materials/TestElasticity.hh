@@ -0,0 +1,95 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/materials/TestElasticity.hh
+ *
+ * @brief C++ TestElasticity object.
+ *
+ * C++ unit testing for Elasticity.
+ */
+
+#if !defined(pylith_materials_testelasticity_hh)
+#define pylith_materials_testelasticity_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace materials {
+        class TestElasticity;
+    } // materials
+} // pylith
+
+class pylith::materials::TestElasticity : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestElasticity);
+
+    CPPUNIT_TEST(testStableTimeStepTri);
+    CPPUNIT_TEST(testStableTimeStepQuad);
+    CPPUNIT_TEST(testJacobianSymmetric);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test computeStableTimeStepsExplicit() for a triangle.
+    void testStableTimeStepTri(void);
+
+    /// Test computeStableTimeStepsExplicit() for a quadrilateral.
+    void testStableTimeStepQuad(void);
+
+    /// Test isJacobianSymmetric() for linear and power-law rheologies.
+    void testJacobianSymmetric(void);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Check stable time step for basis orders 1 and 2.
+     *
+     * @param[in] filename Name of file with ASCII mesh with one cell.
+     * @param[in] cellSize Expected size of cell.
+     */
+    void _testStableTimeStep(const char* filename,
+                             const double cellSize);
+
+    /** Create auxiliary field with elastic properties.
+     *
+     * @returns Auxiliary field (caller is responsible for deleting it).
+     */
+    pylith::topology::Field* _createAuxiliaryField(void);
+
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+
+}; // class TestElasticity
+
+#endif // pylith_materials_testelasticity_hh
+
+// End of file
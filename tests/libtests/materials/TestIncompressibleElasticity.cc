@@ -0,0 +1,87 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestIncompressibleElasticity.hh" // Implementation of class methods
+
+#include "pylith/materials/IncompressibleElasticity.hh" // Test subject
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petscsys.h" // USES PetscOptionsSetValue()
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::materials::TestIncompressibleElasticity);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::materials::TestIncompressibleElasticity::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PetscOptionsClearValue(NULL, "-pc_fieldsplit_schur_precondition");CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _isSchurPreconditionA11() with default solver options.
+void
+pylith::materials::TestIncompressibleElasticity::testSchurPreconditionDefaults(void) {
+    PYLITH_METHOD_BEGIN;
+
+    IncompressibleElasticity material;
+
+    material.setFormulation(pylith::problems::Physics::QUASISTATIC);
+    CPPUNIT_ASSERT_MESSAGE("Parallel without fault should use a11.", material._isSchurPreconditionA11(true, false));
+    CPPUNIT_ASSERT_MESSAGE("Serial should use full Schur complement.", !material._isSchurPreconditionA11(false, false));
+    CPPUNIT_ASSERT_MESSAGE("Fault should not use fieldsplit.", !material._isSchurPreconditionA11(true, true));
+
+    material.setFormulation(pylith::problems::Physics::DYNAMIC);
+    CPPUNIT_ASSERT_MESSAGE("Dynamic should not use fieldsplit.", !material._isSchurPreconditionA11(true, false));
+
+    PYLITH_METHOD_END;
+} // testSchurPreconditionDefaults
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _isSchurPreconditionA11() with user solver options.
+void
+pylith::materials::TestIncompressibleElasticity::testSchurPreconditionUser(void) {
+    PYLITH_METHOD_BEGIN;
+
+    IncompressibleElasticity material;
+    material.setFormulation(pylith::problems::Physics::QUASISTATIC);
+
+    PetscErrorCode err = 0;
+    err = PetscOptionsSetValue(NULL, "-pc_fieldsplit_schur_precondition", "a11");CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_MESSAGE("User a11 in serial should use a11.", material._isSchurPreconditionA11(false, false));
+
+    err = PetscOptionsSetValue(NULL, "-pc_fieldsplit_schur_precondition", "full");CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_MESSAGE("User full in parallel should not use a11.", !material._isSchurPreconditionA11(true, false));
+
+    err = PetscOptionsSetValue(NULL, "-pc_fieldsplit_schur_precondition", "selfp");CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_MESSAGE("User selfp in parallel should not use a11.", !material._isSchurPreconditionA11(true, false));
+
+    PYLITH_METHOD_END;
+} // testSchurPreconditionUser
+
+
+// End of file
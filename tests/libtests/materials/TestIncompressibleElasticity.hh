@@ -0,0 +1,64 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/materials/TestIncompressibleElasticity.hh
+ *
+ * @brief C++ TestIncompressibleElasticity object.
+ *
+ * C++ unit testing for IncompressibleElasticity.
+ */
+
+#if !defined(pylith_materials_testincompressibleelasticity_hh)
+#define pylith_materials_testincompressibleelasticity_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace materials {
+        class TestIncompressibleElasticity;
+    } // materials
+} // pylith
+
+class pylith::materials::TestIncompressibleElasticity : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestIncompressibleElasticity);
+
+    CPPUNIT_TEST(testSchurPreconditionDefaults);
+    CPPUNIT_TEST(testSchurPreconditionUser);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test _isSchurPreconditionA11() with default solver options.
+    void testSchurPreconditionDefaults(void);
+
+    /// Test _isSchurPreconditionA11() with user solver options.
+    void testSchurPreconditionUser(void);
+
+}; // class TestIncompressibleElasticity
+
+#endif // pylith_materials_testincompressibleelasticity_hh
+
+// End of file
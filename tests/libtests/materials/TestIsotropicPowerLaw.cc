@@ -0,0 +1,178 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestIsotropicPowerLaw.hh" // Implementation of class methods
+
+#include "pylith/materials/IsotropicPowerLaw.hh" // Test subject
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::materials::TestIsotropicPowerLaw);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::materials::TestIsotropicPowerLaw::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.setFilename("data/tri.mesh");
+    iohandler.read(_mesh);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(2);
+    _mesh->setCoordSys(&cs);
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::materials::TestIsotropicPowerLaw::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test computeStableTimeStep().
+void
+pylith::materials::TestIsotropicPowerLaw::testComputeStableTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const PylithReal shearModulus = 2.0;
+    const PylithReal refStrainRate = 1.0e-3;
+    const PylithReal refStress = 4.0;
+    const PylithReal exponent = 3.0;
+
+    pylith::topology::Field* auxiliaryField = _createAuxiliaryField();CPPUNIT_ASSERT(auxiliaryField);
+    IsotropicPowerLaw rheology;
+
+    { // Zero deviatoric stress: infinite Maxwell time.
+        const PylithReal dtStable = rheology.computeStableTimeStep(*auxiliaryField);
+        CPPUNIT_ASSERT(dtStable >= PYLITH_MAXSCALAR);
+    } // Zero deviatoric stress
+
+    // Deviatoric stress in cell i is i*(1, -1, 0, 0.5), so the smallest Maxwell time is in the last cell.
+    pylith::topology::Stratum cellsStratum(_mesh->getDM(), pylith::topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    {
+        pylith::topology::VecVisitorMesh shearModulusVisitor(*auxiliaryField, "shear_modulus");
+        pylith::topology::VecVisitorMesh refStrainRateVisitor(*auxiliaryField, "power_law_reference_strain_rate");
+        pylith::topology::VecVisitorMesh refStressVisitor(*auxiliaryField, "power_law_reference_stress");
+        pylith::topology::VecVisitorMesh exponentVisitor(*auxiliaryField, "power_law_exponent");
+        pylith::topology::VecVisitorMesh devStressVisitor(*auxiliaryField, "deviatoric_stress");
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            shearModulusVisitor.localArray()[shearModulusVisitor.sectionOffset(cell)] = shearModulus;
+            refStrainRateVisitor.localArray()[refStrainRateVisitor.sectionOffset(cell)] = refStrainRate;
+            refStressVisitor.localArray()[refStressVisitor.sectionOffset(cell)] = refStress;
+            exponentVisitor.localArray()[exponentVisitor.sectionOffset(cell)] = exponent;
+
+            PetscScalar* devStress = &devStressVisitor.localArray()[devStressVisitor.sectionOffset(cell)];
+            const PylithReal scale = cell - cStart;
+            devStress[0] = +1.0*scale;
+            devStress[1] = -1.0*scale;
+            devStress[2] = 0.0;
+            devStress[3] = +0.5*scale;
+        } // for
+    } // Set values
+
+    { // Nonzero deviatoric stress.
+        // Maxwell time is refStress^n / (2*shearModulus*refStrainRate*j2^(n-1)).
+        const PylithReal dtStableE = 75.73964497041419;
+        const PylithReal dtStable = rheology.computeStableTimeStep(*auxiliaryField);
+        const PylithReal tolerance = 1.0e-10;
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtStable/dtStableE, tolerance);
+    } // Nonzero deviatoric stress
+
+    delete auxiliaryField;auxiliaryField = NULL;
+
+    PYLITH_METHOD_END;
+} // testComputeStableTimeStep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create auxiliary field with power-law subfields.
+pylith::topology::Field*
+pylith::materials::TestIsotropicPowerLaw::_createAuxiliaryField(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_mesh);
+
+    const char* scalarNames[4] = {
+        "shear_modulus",
+        "power_law_reference_strain_rate",
+        "power_law_reference_stress",
+        "power_law_exponent",
+    };
+
+    const int basisOrder = 0;
+    const int quadOrder = 1;
+    const int dimension = 2;
+    pylith::topology::Field::Discretization discretization(basisOrder, quadOrder, dimension);
+
+    pylith::topology::Field* field = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(field);
+    field->setLabel("auxiliary field");
+    for (int i = 0; i < 4; ++i) {
+        pylith::topology::Field::Description description;
+        description.label = scalarNames[i];
+        description.vectorFieldType = pylith::topology::Field::SCALAR;
+        description.numComponents = 1;
+        description.componentNames.resize(1);
+        description.componentNames[0] = scalarNames[i];
+        field->subfieldAdd(description, discretization);
+    } // for
+
+    pylith::topology::Field::Description devStress;
+    devStress.label = "deviatoric_stress";
+    devStress.vectorFieldType = pylith::topology::Field::OTHER;
+    devStress.numComponents = 4;
+    devStress.componentNames.resize(4);
+    devStress.componentNames[0] = "deviatoric_stress_xx";
+    devStress.componentNames[1] = "deviatoric_stress_yy";
+    devStress.componentNames[2] = "deviatoric_stress_zz";
+    devStress.componentNames[3] = "deviatoric_stress_xy";
+    field->subfieldAdd(devStress, discretization);
+
+    field->subfieldsSetup();
+    field->createDiscretization();
+    field->allocate();
+    field->zeroLocal();
+
+    PYLITH_METHOD_RETURN(field);
+} // _createAuxiliaryField
+
+
+// End of file
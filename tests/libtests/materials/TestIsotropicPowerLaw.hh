@@ -0,0 +1,79 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/materials/TestIsotropicPowerLaw.hh
+ *
+ * @brief C++ TestIsotropicPowerLaw object.
+ *
+ * C++ unit testing for IsotropicPowerLaw.
+ */
+
+#if !defined(pylith_materials_testisotropicpowerlaw_hh)
+#define pylith_materials_testisotropicpowerlaw_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace materials {
+        class TestIsotropicPowerLaw;
+    } // materials
+} // pylith
+
+class pylith::materials::TestIsotropicPowerLaw : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestIsotropicPowerLaw);
+
+    CPPUNIT_TEST(testComputeStableTimeStep);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test computeStableTimeStep().
+    void testComputeStableTimeStep(void);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Create auxiliary field with power-law subfields.
+     *
+     * @returns Auxiliary field (caller is responsible for deleting it).
+     */
+    pylith::topology::Field* _createAuxiliaryField(void);
+
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+
+}; // class TestIsotropicPowerLaw
+
+#endif // pylith_materials_testisotropicpowerlaw_hh
+
+// End of file
@@ -0,0 +1,276 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestIsotropicPowerLawKernels.hh" // Implementation of class methods
+
+#include "pylith/fekernels/IsotropicPowerLaw.hh" // Test subject
+#include "pylith/fekernels/KernelStatus.hh" // USES KernelStatus
+#include "pylith/fekernels/Tensor.hh" // USES Tensor, TensorOps
+
+#include <cmath> // USES fabs()
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::fekernels::TestIsotropicPowerLawKernels);
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace fekernels {
+        class _TestIsotropicPowerLawKernels {
+public:
+
+            /// Parameters for root finding (nondimensional).
+            struct Params {
+                PylithReal ae;
+                PylithReal b;
+                PylithReal c;
+                PylithReal d;
+                PylithReal dt;
+                PylithReal j2T;
+                PylithReal powerLawExponent;
+                PylithReal powerLawRefStrainRate;
+                PylithReal powerLawRefStress;
+            }; // Params
+
+            /** Compute root-finding parameters for a deviatoric strain and stress like deviatoricStress().
+             *
+             * @param[in] strainScale Magnitude of deviatoric strain (minus viscous strain).
+             * @param[in] stressScale Magnitude of deviatoric stress at time t.
+             * @param[in] dt Time step.
+             * @param[in] powerLawExponent Power-law exponent.
+             * @returns Parameters for root finding.
+             */
+            static
+            Params createParams(const PylithReal strainScale,
+                                const PylithReal stressScale,
+                                const PylithReal dt,
+                                const PylithReal powerLawExponent) {
+                const PylithReal shearModulus = 1.0;
+                const PylithReal alpha = pylith::fekernels::IsotropicPowerLaw::powerLawAlpha;
+                const PylithReal timeFac = dt * (1.0 - alpha);
+
+                pylith::fekernels::Tensor strainPP;
+                strainPP.xx = 0.6 * strainScale;
+                strainPP.yy = -0.4 * strainScale;
+                strainPP.zz = -0.2 * strainScale;
+                strainPP.xy = 0.8 * strainScale;
+                strainPP.yz = 0.0;
+                strainPP.xz = 0.0;
+
+                pylith::fekernels::Tensor devStress;
+                devStress.xx = 0.5 * stressScale;
+                devStress.yy = -0.3 * stressScale;
+                devStress.zz = -0.2 * stressScale;
+                devStress.xy = 0.9 * stressScale;
+                devStress.yz = 0.0;
+                devStress.xz = 0.0;
+
+                const PylithReal j2T = sqrt(0.5 * pylith::fekernels::TensorOps::scalarProduct(devStress, devStress));
+                const PylithReal strainPPInvar2 = 0.5 * pylith::fekernels::TensorOps::scalarProduct(strainPP, strainPP);
+                const PylithReal strainStressInvar2T = pylith::fekernels::TensorOps::scalarProduct(strainPP, devStress);
+
+                Params params;
+                params.ae = 1.0 / (2.0 * shearModulus);
+                params.b = strainPPInvar2;
+                params.c = strainStressInvar2T * timeFac;
+                params.d = timeFac * j2T;
+                params.dt = dt;
+                params.j2T = j2T;
+                params.powerLawExponent = powerLawExponent;
+                params.powerLawRefStrainRate = 1.0;
+                params.powerLawRefStress = 1.0e-3;
+                return params;
+            } // createParams
+
+        }; // _TestIsotropicPowerLawKernels
+    } // fekernels
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _effectiveStress() against bracketing followed by _search().
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testEffectiveStress(void) {
+    const PylithReal strainScales[3] = { 1.0e-4, 1.0e-3, 1.0e-2 };
+    const PylithReal stressScales[4] = { 0.0, 1.0e-4, 1.0e-3, 1.0e-2 };
+    const PylithReal timeSteps[5] = { 1.0e-4, 1.0e-2, 1.0, 1.0e+2, 1.0e+4 };
+    const PylithReal exponents[4] = { 1.0, 2.0, 3.5, 5.0 };
+
+    const PylithReal shearModulus = 1.0;
+    // Both solvers stop when the effective stress function is below an absolute accuracy, so the
+    // roots agree to within a relative tolerance that depends on the magnitude of the stress.
+    const PylithReal tolerance = 1.0e-6;
+    for (size_t iStrain = 0; iStrain < 3; ++iStrain) {
+        for (size_t iStress = 0; iStress < 4; ++iStress) {
+            for (size_t iDt = 0; iDt < 5; ++iDt) {
+                for (size_t iExp = 0; iExp < 4; ++iExp) {
+                    const _TestIsotropicPowerLawKernels::Params p =
+                        _TestIsotropicPowerLawKernels::createParams(strainScales[iStrain], stressScales[iStress],
+                                                                    timeSteps[iDt], exponents[iExp]);
+                    std::ostringstream msg;
+                    msg << "strain=" << strainScales[iStrain] << ", stress=" << stressScales[iStress]
+                        << ", dt=" << timeSteps[iDt] << ", n=" << exponents[iExp];
+
+                    // Reference solution by bracketing followed by Newton's method with bisection.
+                    const PylithReal xMin = 1.0e-10;
+                    const PylithReal xGuess = (p.j2T > xMin) ? p.j2T : shearModulus;
+                    PylithReal xL = 0.5 * xGuess;
+                    PylithReal xR = 1.5 * xGuess;
+                    KernelStatus::reset();
+                    const bool bracketed = IsotropicPowerLaw::_bracket(&xL, &xR, p.ae, p.b, p.c, p.d, p.dt, p.j2T,
+                                                                       p.powerLawExponent, p.powerLawRefStrainRate,
+                                                                       p.powerLawRefStress);
+                    CPPUNIT_ASSERT_MESSAGE(msg.str(), bracketed);
+                    const PylithReal effStressE = IsotropicPowerLaw::_search(xL, xR, p.ae, p.b, p.c, p.d, p.dt, p.j2T,
+                                                                             p.powerLawExponent, p.powerLawRefStrainRate,
+                                                                             p.powerLawRefStress);
+                    CPPUNIT_ASSERT_MESSAGE(msg.str(), !KernelStatus::hasFailed());
+
+                    const PylithReal effStress = IsotropicPowerLaw::_effectiveStress(p.j2T, shearModulus, p.ae, p.b, p.c, p.d,
+                                                                                     p.dt, p.j2T, p.powerLawExponent,
+                                                                                     p.powerLawRefStrainRate,
+                                                                                     p.powerLawRefStress);
+                    CPPUNIT_ASSERT_MESSAGE(msg.str(), !KernelStatus::hasFailed());
+                    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), 1.0, effStress / effStressE, tolerance);
+
+                    PylithReal effStressNewton = IsotropicPowerLaw::_effectiveStressPredictor(xGuess, p.ae, p.b, p.c, p.d, p.dt,
+                                                                                              p.j2T, p.powerLawExponent,
+                                                                                              p.powerLawRefStrainRate,
+                                                                                              p.powerLawRefStress);
+                    const bool converged = IsotropicPowerLaw::_newton(&effStressNewton, p.ae, p.b, p.c, p.d, p.dt, p.j2T,
+                                                                      p.powerLawExponent, p.powerLawRefStrainRate,
+                                                                      p.powerLawRefStress);
+                    CPPUNIT_ASSERT_MESSAGE(msg.str(), converged);
+                    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), 1.0, effStressNewton / effStressE, tolerance);
+                } // for
+            } // for
+        } // for
+    } // for
+} // testEffectiveStress
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _newton() with initial guesses far from the root.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testNewtonPoorGuess(void) {
+    const PylithReal timeSteps[3] = { 1.0e-2, 1.0, 1.0e+2 };
+    const PylithReal guessFactors[4] = { 1.0e-6, 1.0e-2, 1.0e+2, 1.0e+6 };
+    const PylithReal exponents[2] = { 3.0, 5.0 };
+
+    const PylithReal tolerance = 1.0e-6;
+    for (size_t iDt = 0; iDt < 3; ++iDt) {
+        for (size_t iExp = 0; iExp < 2; ++iExp) {
+            const _TestIsotropicPowerLawKernels::Params p =
+                _TestIsotropicPowerLawKernels::createParams(1.0e-3, 1.0e-3, timeSteps[iDt], exponents[iExp]);
+
+            PylithReal xL = 0.5 * p.j2T;
+            PylithReal xR = 1.5 * p.j2T;
+            KernelStatus::reset();
+            CPPUNIT_ASSERT(IsotropicPowerLaw::_bracket(&xL, &xR, p.ae, p.b, p.c, p.d, p.dt, p.j2T, p.powerLawExponent,
+                                                       p.powerLawRefStrainRate, p.powerLawRefStress));
+            const PylithReal effStressE = IsotropicPowerLaw::_search(xL, xR, p.ae, p.b, p.c, p.d, p.dt, p.j2T,
+                                                                     p.powerLawExponent, p.powerLawRefStrainRate,
+                                                                     p.powerLawRefStress);
+            CPPUNIT_ASSERT(!KernelStatus::hasFailed());
+
+            for (size_t iGuess = 0; iGuess < 4; ++iGuess) {
+                std::ostringstream msg;
+                msg << "dt=" << timeSteps[iDt] << ", n=" << exponents[iExp] << ", guess=" << guessFactors[iGuess] << "*root";
+
+                // Iterates must stay positive and converge to the same root.
+                PylithReal effStress = guessFactors[iGuess] * effStressE;
+                const bool converged = IsotropicPowerLaw::_newton(&effStress, p.ae, p.b, p.c, p.d, p.dt, p.j2T,
+                                                                  p.powerLawExponent, p.powerLawRefStrainRate,
+                                                                  p.powerLawRefStress);
+                CPPUNIT_ASSERT_MESSAGE(msg.str(), converged);
+                CPPUNIT_ASSERT_MESSAGE(msg.str(), effStress > 0.0);
+                CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), 1.0, effStress / effStressE, tolerance);
+            } // for
+        } // for
+    } // for
+} // testNewtonPoorGuess
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test deviatoricStress() with the effective stress state variable as the initial guess.
+void
+pylith::fekernels::TestIsotropicPowerLawKernels::testEffectiveStressWarmStart(void) {
+    const PylithReal timeSteps[3] = { 1.0e-2, 1.0, 1.0e+2 };
+    const PylithReal exponents[3] = { 1.0, 3.0, 5.0 };
+    const PylithReal guessFactors[4] = { 1.0, 0.5, 2.0, 1.0e+3 };
+
+    pylith::fekernels::Tensor strain;
+    strain.xx = 1.2e-3;
+    strain.yy = -0.4e-3;
+    strain.zz = 0.0;
+    strain.xy = 0.8e-3;
+    strain.yz = 0.0;
+    strain.xz = 0.0;
+
+    const PylithReal tolerance = 1.0e-6;
+    for (size_t iDt = 0; iDt < 3; ++iDt) {
+        for (size_t iExp = 0; iExp < 3; ++iExp) {
+            IsotropicPowerLaw::Context context;
+            context.shearModulus = 1.0;
+            context.bulkModulus = 2.0;
+            context.powerLawRefStrainRate = 1.0;
+            context.powerLawRefStress = 1.0e-3;
+            context.powerLawExponent = exponents[iExp];
+            context.dt = timeSteps[iDt];
+            context.viscousStrain.xx = 0.1e-3;
+            context.viscousStrain.yy = -0.1e-3;
+            context.viscousStrain.xy = 0.2e-3;
+            context.devStress.xx = 0.5e-3;
+            context.devStress.yy = -0.3e-3;
+            context.devStress.zz = -0.2e-3;
+            context.devStress.xy = 0.9e-3;
+            context.effectiveStress = 0.0;
+
+            // Cold start: initial guess from deviatoric stress at time t.
+            KernelStatus::reset();
+            pylith::fekernels::Tensor stressE;
+            PylithReal effStressE = 0.0;
+            IsotropicPowerLaw::deviatoricStress(context, strain, &stressE, &effStressE);
+            CPPUNIT_ASSERT(!KernelStatus::hasFailed());
+            CPPUNIT_ASSERT(effStressE > 0.0);
+
+            for (size_t iGuess = 0; iGuess < 4; ++iGuess) {
+                std::ostringstream msg;
+                msg << "dt=" << timeSteps[iDt] << ", n=" << exponents[iExp] << ", guess=" << guessFactors[iGuess] << "*root";
+
+                // Warm start from stored effective stress must converge to the same root.
+                context.effectiveStress = guessFactors[iGuess] * effStressE;
+                pylith::fekernels::Tensor stress;
+                PylithReal effStress = 0.0;
+                IsotropicPowerLaw::deviatoricStress(context, strain, &stress, &effStress);
+                CPPUNIT_ASSERT_MESSAGE(msg.str(), !KernelStatus::hasFailed());
+                CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), 1.0, effStress / effStressE, tolerance);
+
+                const PylithReal stressScale = sqrt(pylith::fekernels::TensorOps::scalarProduct(stressE, stressE));
+                CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), stressE.xx, stress.xx, tolerance*stressScale);
+                CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), stressE.yy, stress.yy, tolerance*stressScale);
+                CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), stressE.zz, stress.zz, tolerance*stressScale);
+                CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), stressE.xy, stress.xy, tolerance*stressScale);
+            } // for
+        } // for
+    } // for
+} // testEffectiveStressWarmStart
+
+
+// End of file
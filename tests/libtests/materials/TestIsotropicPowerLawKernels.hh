@@ -0,0 +1,67 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/materials/TestIsotropicPowerLawKernels.hh
+ *
+ * @brief C++ TestIsotropicPowerLawKernels object.
+ *
+ * C++ unit testing for root finding in IsotropicPowerLaw pointwise kernels.
+ */
+
+#if !defined(pylith_fekernels_testisotropicpowerlawkernels_hh)
+#define pylith_fekernels_testisotropicpowerlawkernels_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/fekernels/fekernelsfwd.hh" // USES IsotropicPowerLaw
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicPowerLawKernels;
+    } // fekernels
+} // pylith
+
+class pylith::fekernels::TestIsotropicPowerLawKernels : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestIsotropicPowerLawKernels);
+
+    CPPUNIT_TEST(testEffectiveStress);
+    CPPUNIT_TEST(testNewtonPoorGuess);
+    CPPUNIT_TEST(testEffectiveStressWarmStart);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test _effectiveStress() against bracketing followed by _search().
+    void testEffectiveStress(void);
+
+    /// Test _newton() with initial guesses far from the root.
+    void testNewtonPoorGuess(void);
+
+    /// Test deviatoricStress() with the effective stress state variable as the initial guess.
+    void testEffectiveStressWarmStart(void);
+
+}; // class TestIsotropicPowerLawKernels
+
+#endif // pylith_fekernels_testisotropicpowerlawkernels_hh
+
+// End of file
@@ -0,0 +1,184 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshIOBinary.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOBinary.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES JournalingComponent
+
+#include <strings.h> // USES strcasecmp()
+#include <fstream> // USES std::ifstream, std::ofstream
+#include <iterator> // USES std::istreambuf_iterator
+#include <cstring> // USES memcpy()
+#include <cstdint> // USES int64_t
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestMeshIOBinary::setUp(void) {
+    TestMeshIO::setUp();
+    _io = new MeshIOBinary();CPPUNIT_ASSERT(_io);
+    _data = NULL;
+
+    _io->PyreComponent::setIdentifier("TestMeshIOBinary");
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Deallocate testing data.
+void
+pylith::meshio::TestMeshIOBinary::tearDown(void) {
+    const char* journalName = _io->PyreComponent::getName();
+    pythia::journal::debug_t debug(journalName);
+    debug.deactivate(); // DEBUGGING
+
+    TestMeshIO::tearDown();
+
+    delete _io;_io = NULL;
+    delete _data;_data = NULL;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestMeshIOBinary::testConstructor(void) {
+    PYLITH_METHOD_BEGIN;
+
+    MeshIOBinary iohandler;
+
+    PYLITH_METHOD_END;
+} // testConstructor
+
+
+// ----------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestMeshIOBinary::testFilename(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+
+    const std::string& filename = "hi.bin";
+    _io->setFilename(filename.c_str());
+    CPPUNIT_ASSERT_EQUAL(filename, std::string(_io->getFilename()));
+
+    PYLITH_METHOD_END;
+} // testFilename
+
+
+// ----------------------------------------------------------------------
+// Test write() and read().
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+    CPPUNIT_ASSERT(_data);
+
+    TestMeshIO::_createMesh();CPPUNIT_ASSERT(_mesh);
+
+    // Write mesh
+    CPPUNIT_ASSERT(_data->filename);
+    _io->setFilename(_data->filename);
+    _io->write(_mesh);
+
+    // Read mesh
+    delete _mesh;_mesh = new pylith::topology::Mesh;
+    _io->read(_mesh);
+
+    // Make sure meshIn matches data
+    TestMeshIO::_checkVals();
+
+    PYLITH_METHOD_END;
+} // testWriteRead1D
+
+
+// ----------------------------------------------------------------------
+// Test read() with invalid counts in header and truncated file.
+void
+pylith::meshio::TestMeshIOBinary::testReadCorrupt(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+    CPPUNIT_ASSERT(_data);
+
+    TestMeshIO::_createMesh();CPPUNIT_ASSERT(_mesh);
+
+    CPPUNIT_ASSERT(_data->filename);
+    _io->setFilename(_data->filename);
+    _io->write(_mesh);
+
+    std::ifstream fin(_data->filename, std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+    fin.close();
+
+    // Offsets of counts in 64-byte header.
+    const size_t offsetNumVertices = 40;
+    const size_t offsetNumCells = 48;
+    const size_t numCases = 4;
+    const size_t offsets[numCases] = { offsetNumVertices, offsetNumCells, offsetNumCells, 0 };
+    const int64_t values[numCases] = { -1, -3, int64_t(1) << 61, 0 };
+    const char* filename = "mesh_corrupt.bin";
+    for (size_t iCase = 0; iCase < numCases; ++iCase) {
+        std::string corrupt(contents);
+        if (offsets[iCase] > 0) {
+            memcpy(&corrupt[offsets[iCase]], &values[iCase], sizeof(int64_t));
+        } else {
+            corrupt.resize(contents.size() / 2); // truncated file
+        } // if/else
+        std::ofstream fout(filename, std::ios::binary);
+        fout.write(corrupt.data(), corrupt.size());
+        fout.close();
+
+        delete _mesh;_mesh = new pylith::topology::Mesh;
+        _io->setFilename(filename);
+        CPPUNIT_ASSERT_THROW(_io->read(_mesh), std::runtime_error);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testReadCorrupt
+
+
+// ----------------------------------------------------------------------
+// Get test data.
+pylith::meshio::TestMeshIO_Data*
+pylith::meshio::TestMeshIOBinary::_getData(void) {
+    return _data;
+} // _data
+
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::TestMeshIOBinary_Data::TestMeshIOBinary_Data(void) :
+    filename(NULL) {} // constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::TestMeshIOBinary_Data::~TestMeshIOBinary_Data(void) {}
+
+
+// End of file
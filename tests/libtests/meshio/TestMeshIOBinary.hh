@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/meshio/TestMeshIOBinary.hh
+ *
+ * @brief C++ TestMeshIOBinary object
+ *
+ * C++ unit testing for MeshIOBinary.
+ */
+
+#if !defined(pylith_meshio_testmeshiobinary_hh)
+#define pylith_meshio_testmeshiobinary_hh
+
+// Include directives ---------------------------------------------------
+#include "TestMeshIO.hh"
+
+// Forward declarations -------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestMeshIOBinary;
+
+        class TestMeshIOBinary_Data; // test data
+    } // meshio
+} // pylith
+
+// ======================================================================
+class pylith::meshio::TestMeshIOBinary : public TestMeshIO {
+
+    // CPPUNIT TEST SUITE ///////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestMeshIOBinary);
+
+    CPPUNIT_TEST(testConstructor);
+    CPPUNIT_TEST(testFilename);
+    CPPUNIT_TEST(testWriteRead);
+    CPPUNIT_TEST(testReadCorrupt);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Deallocate testing data.
+    void tearDown(void);
+
+    /// Test constructor
+    void testConstructor(void);
+
+    /// Test filename()
+    void testFilename(void);
+
+    /// Test write() and read().
+    void testWriteRead(void);
+
+    /// Test read() with invalid counts in header and truncated file.
+    void testReadCorrupt(void);
+
+    /** Get test data.
+     *
+     * @returns Test data.
+     */
+    TestMeshIO_Data* _getData(void);
+
+    // PROTECTED METHODS ////////////////////////////////////////////////
+protected:
+
+    MeshIOBinary* _io; ///< Test subject.
+    TestMeshIOBinary_Data* _data; ///< Data for tests.
+
+}; // class TestMeshIOBinary
+
+// ======================================================================
+class pylith::meshio::TestMeshIOBinary_Data : public TestMeshIO_Data {
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestMeshIOBinary_Data(void);
+
+    /// Destructor
+    ~TestMeshIOBinary_Data(void);
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////
+public:
+
+    const char* filename;
+
+}; // class TestMeshIOBinary_Data
+
+
+#endif // pylith_meshio_testmeshiobinary_hh
+
+// End of file
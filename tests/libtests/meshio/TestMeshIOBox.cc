@@ -0,0 +1,166 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshIOBox.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOBox.hh"
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+#include "pylith/utils/journals.hh" // USES JournalingComponent
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestMeshIOBox::setUp(void) {
+    TestMeshIO::setUp();
+    _io = new MeshIOBox();CPPUNIT_ASSERT(_io);
+    _data = NULL;
+
+    _io->PyreComponent::setIdentifier("TestMeshIOBox");
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Deallocate testing data.
+void
+pylith::meshio::TestMeshIOBox::tearDown(void) {
+    const char* journalName = _io->PyreComponent::getName();
+    pythia::journal::debug_t debug(journalName);
+    debug.deactivate(); // DEBUGGING
+
+    TestMeshIO::tearDown();
+
+    delete _io;_io = NULL;
+    delete _data;_data = NULL;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestMeshIOBox::testConstructor(void) {
+    PYLITH_METHOD_BEGIN;
+
+    MeshIOBox iohandler;
+
+    PYLITH_METHOD_END;
+} // testConstructor
+
+
+// ----------------------------------------------------------------------
+// Test setLower(), setUpper(), setNumCells(), setCellShape(), setFaults().
+void
+pylith::meshio::TestMeshIOBox::testAccessors(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+
+    const PylithReal lower[3] = { -1.0, -2.0, -3.0 };
+    _io->setLower(lower, 3);
+    CPPUNIT_ASSERT_EQUAL(size_t(3), _io->_lower.size());
+    for (int i = 0; i < 3; ++i) {
+        CPPUNIT_ASSERT_EQUAL(lower[i], _io->_lower[i]);
+    } // for
+
+    const PylithReal upper[2] = { 4.0, 5.0 };
+    _io->setUpper(upper, 2);
+    CPPUNIT_ASSERT_EQUAL(size_t(2), _io->_upper.size());
+    for (int i = 0; i < 2; ++i) {
+        CPPUNIT_ASSERT_EQUAL(upper[i], _io->_upper[i]);
+    } // for
+
+    const int numCells[3] = { 4, 5, 6 };
+    _io->setNumCells(numCells, 3);
+    CPPUNIT_ASSERT_EQUAL(size_t(3), _io->_numCells.size());
+    for (int i = 0; i < 3; ++i) {
+        CPPUNIT_ASSERT_EQUAL(numCells[i], _io->_numCells[i]);
+    } // for
+
+    const int numCellsBad[2] = { 4, 0 };
+    CPPUNIT_ASSERT_THROW(_io->setNumCells(numCellsBad, 2), std::runtime_error);
+
+    CPPUNIT_ASSERT_EQUAL(MeshIOBox::TENSOR, _io->_cellShape); // default
+    _io->setCellShape(MeshIOBox::SIMPLEX);
+    CPPUNIT_ASSERT_EQUAL(MeshIOBox::SIMPLEX, _io->_cellShape);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(0), _io->_xFaults.size()); // default
+    const PylithReal xFaults[2] = { 0.5, 1.5 };
+    _io->setFaults(xFaults, 2);
+    CPPUNIT_ASSERT_EQUAL(size_t(2), _io->_xFaults.size());
+    for (int i = 0; i < 2; ++i) {
+        CPPUNIT_ASSERT_EQUAL(xFaults[i], _io->_xFaults[i]);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testAccessors
+
+
+// ----------------------------------------------------------------------
+// Test read().
+void
+pylith::meshio::TestMeshIOBox::testRead(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+    CPPUNIT_ASSERT(_data);
+
+    _io->setLower(_data->lower, _data->spaceDim);
+    _io->setUpper(_data->upper, _data->spaceDim);
+    _io->setNumCells(_data->numCellsDir, _data->spaceDim);
+    _io->setCellShape(_data->cellShape);
+    _io->setFaults(_data->xFaults, _data->numFaults);
+
+    delete _mesh;_mesh = new pylith::topology::Mesh;CPPUNIT_ASSERT(_mesh);
+    _io->read(_mesh);
+
+    // Make sure mesh matches data
+    TestMeshIO::_checkVals();
+
+    PYLITH_METHOD_END;
+} // testRead
+
+
+// ----------------------------------------------------------------------
+// Get test data.
+pylith::meshio::TestMeshIO_Data*
+pylith::meshio::TestMeshIOBox::_getData(void) {
+    return _data;
+} // _data
+
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::TestMeshIOBox_Data::TestMeshIOBox_Data(void) :
+    lower(NULL),
+    upper(NULL),
+    numCellsDir(NULL),
+    cellShape(MeshIOBox::TENSOR),
+    xFaults(NULL),
+    numFaults(0) {} // constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::TestMeshIOBox_Data::~TestMeshIOBox_Data(void) {}
+
+
+// End of file
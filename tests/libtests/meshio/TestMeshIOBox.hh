@@ -0,0 +1,115 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/meshio/TestMeshIOBox.hh
+ *
+ * @brief C++ TestMeshIOBox object
+ *
+ * C++ unit testing for MeshIOBox.
+ */
+
+#if !defined(pylith_meshio_testmeshiobox_hh)
+#define pylith_meshio_testmeshiobox_hh
+
+// Include directives ---------------------------------------------------
+#include "TestMeshIO.hh"
+
+#include "pylith/meshio/MeshIOBox.hh" // USES MeshIOBox::CellShapeEnum
+
+// Forward declarations -------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class TestMeshIOBox;
+
+        class TestMeshIOBox_Data; // test data
+    } // meshio
+} // pylith
+
+// ======================================================================
+class pylith::meshio::TestMeshIOBox : public TestMeshIO {
+
+    // CPPUNIT TEST SUITE ///////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestMeshIOBox);
+
+    CPPUNIT_TEST(testConstructor);
+    CPPUNIT_TEST(testAccessors);
+    CPPUNIT_TEST(testRead);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Deallocate testing data.
+    void tearDown(void);
+
+    /// Test constructor
+    void testConstructor(void);
+
+    /// Test setLower(), setUpper(), setNumCells(), setCellShape(), setFaults().
+    void testAccessors(void);
+
+    /// Test read().
+    void testRead(void);
+
+    /** Get test data.
+     *
+     * @returns Test data.
+     */
+    TestMeshIO_Data* _getData(void);
+
+    // PROTECTED METHODS ////////////////////////////////////////////////
+protected:
+
+    MeshIOBox* _io; ///< Test subject.
+    TestMeshIOBox_Data* _data; ///< Data for tests.
+
+}; // class TestMeshIOBox
+
+// ======================================================================
+class pylith::meshio::TestMeshIOBox_Data : public TestMeshIO_Data {
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestMeshIOBox_Data(void);
+
+    /// Destructor
+    ~TestMeshIOBox_Data(void);
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////
+public:
+
+    PylithReal* lower; ///< Coordinates of corner with minimum coordinates.
+    PylithReal* upper; ///< Coordinates of corner with maximum coordinates.
+    int* numCellsDir; ///< Number of cells in each direction.
+    MeshIOBox::CellShapeEnum cellShape; ///< Shape of cells.
+    PylithReal* xFaults; ///< x coordinates of faults.
+    int numFaults; ///< Number of faults.
+
+}; // class TestMeshIOBox_Data
+
+
+#endif // pylith_meshio_testmeshiobox_hh
+
+// End of file
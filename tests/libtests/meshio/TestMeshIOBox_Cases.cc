@@ -0,0 +1,336 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshIOBox.hh" // Implementation of class methods
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        // --------------------------------------------------------------
+        class TestMeshIOBox_Quad2D : public TestMeshIOBox {
+            CPPUNIT_TEST_SUB_SUITE(TestMeshIOBox_Quad2D, TestMeshIOBox);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshIOBox::setUp();
+                _data = new TestMeshIOBox_Data();CPPUNIT_ASSERT(_data);
+                static PylithReal lower[2] = { -1.0, 0.0 };
+                static PylithReal upper[2] = { +1.0, 1.0 };
+                static int numCellsDir[2] = { 2, 1 };
+                static PylithReal xFaults[1] = { 0.1 }; // Moved to x=0.
+                _data->lower = lower;
+                _data->upper = upper;
+                _data->numCellsDir = numCellsDir;
+                _data->cellShape = MeshIOBox::TENSOR;
+                _data->xFaults = xFaults;
+                _data->numFaults = 1;
+
+                _data->numVertices = 6;
+                _data->spaceDim = 2;
+                _data->numCells = 2;
+                _data->cellDim = 2;
+                _data->numCorners = 4;
+
+                static const PylithScalar vertices[6*2] = {
+                    -1.0, 0.0,
+                    +0.0, 0.0,
+                    +1.0, 0.0,
+                    -1.0, 1.0,
+                    +0.0, 1.0,
+                    +1.0, 1.0,
+                };
+                _data->vertices = const_cast<PylithScalar*>(vertices);
+
+                static const PylithInt cells[2*4] = {
+                    0, 1, 4, 3,
+                    1, 2, 5, 4,
+                };
+                _data->cells = const_cast<PylithInt*>(cells);
+                static const PylithInt materialIds[2] = {
+                    1, 1,
+                };
+                _data->materialIds = const_cast<PylithInt*>(materialIds);
+
+                _data->numGroups = 5;
+                static const PylithInt groupSizes[5] = { 2, 2, 3, 3, 2, };
+                _data->groupSizes = const_cast<PylithInt*>(groupSizes);
+                static const PylithInt groups[2+2+3+3+2] = {
+                    0, 3,
+                    2, 5,
+                    0, 1, 2,
+                    3, 4, 5,
+                    1, 4,
+                };
+                _data->groups = const_cast<PylithInt*>(groups);
+                static const char* groupNames[5] = {
+                    "boundary_xneg",
+                    "boundary_xpos",
+                    "boundary_yneg",
+                    "boundary_ypos",
+                    "fault_0",
+                };
+                _data->groupNames = const_cast<char**>(groupNames);
+                static const char* groupTypes[5] = {
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                };
+                _data->groupTypes = const_cast<char**>(groupTypes);
+            } // setUp
+
+        }; // class TestMeshIOBox_Quad2D
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestMeshIOBox_Quad2D);
+
+        // --------------------------------------------------------------
+        class TestMeshIOBox_Tri2D : public TestMeshIOBox {
+            CPPUNIT_TEST_SUB_SUITE(TestMeshIOBox_Tri2D, TestMeshIOBox);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshIOBox::setUp();
+                _data = new TestMeshIOBox_Data();CPPUNIT_ASSERT(_data);
+                static PylithReal lower[2] = { 0.0, 0.0 };
+                static PylithReal upper[2] = { 2.0, 1.0 };
+                static int numCellsDir[2] = { 1, 1 };
+                _data->lower = lower;
+                _data->upper = upper;
+                _data->numCellsDir = numCellsDir;
+                _data->cellShape = MeshIOBox::SIMPLEX;
+
+                _data->numVertices = 4;
+                _data->spaceDim = 2;
+                _data->numCells = 2;
+                _data->cellDim = 2;
+                _data->numCorners = 3;
+
+                static const PylithScalar vertices[4*2] = {
+                    0.0, 0.0,
+                    2.0, 0.0,
+                    0.0, 1.0,
+                    2.0, 1.0,
+                };
+                _data->vertices = const_cast<PylithScalar*>(vertices);
+
+                static const PylithInt cells[2*3] = {
+                    0, 1, 3,
+                    0, 3, 2,
+                };
+                _data->cells = const_cast<PylithInt*>(cells);
+                static const PylithInt materialIds[2] = {
+                    1, 1,
+                };
+                _data->materialIds = const_cast<PylithInt*>(materialIds);
+
+                _data->numGroups = 4;
+                static const PylithInt groupSizes[4] = { 2, 2, 2, 2, };
+                _data->groupSizes = const_cast<PylithInt*>(groupSizes);
+                static const PylithInt groups[2+2+2+2] = {
+                    0, 2,
+                    1, 3,
+                    0, 1,
+                    2, 3,
+                };
+                _data->groups = const_cast<PylithInt*>(groups);
+                static const char* groupNames[4] = {
+                    "boundary_xneg",
+                    "boundary_xpos",
+                    "boundary_yneg",
+                    "boundary_ypos",
+                };
+                _data->groupNames = const_cast<char**>(groupNames);
+                static const char* groupTypes[4] = {
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                };
+                _data->groupTypes = const_cast<char**>(groupTypes);
+            } // setUp
+
+        }; // class TestMeshIOBox_Tri2D
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestMeshIOBox_Tri2D);
+
+        // --------------------------------------------------------------
+        class TestMeshIOBox_Hex3D : public TestMeshIOBox {
+            CPPUNIT_TEST_SUB_SUITE(TestMeshIOBox_Hex3D, TestMeshIOBox);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshIOBox::setUp();
+                _data = new TestMeshIOBox_Data();CPPUNIT_ASSERT(_data);
+                static PylithReal lower[3] = { 0.0, 0.0, 0.0 };
+                static PylithReal upper[3] = { 1.0, 2.0, 3.0 };
+                static int numCellsDir[3] = { 1, 1, 1 };
+                _data->lower = lower;
+                _data->upper = upper;
+                _data->numCellsDir = numCellsDir;
+                _data->cellShape = MeshIOBox::TENSOR;
+
+                _data->numVertices = 8;
+                _data->spaceDim = 3;
+                _data->numCells = 1;
+                _data->cellDim = 3;
+                _data->numCorners = 8;
+
+                static const PylithScalar vertices[8*3] = {
+                    0.0, 0.0, 0.0,
+                    1.0, 0.0, 0.0,
+                    0.0, 2.0, 0.0,
+                    1.0, 2.0, 0.0,
+                    0.0, 0.0, 3.0,
+                    1.0, 0.0, 3.0,
+                    0.0, 2.0, 3.0,
+                    1.0, 2.0, 3.0,
+                };
+                _data->vertices = const_cast<PylithScalar*>(vertices);
+
+                static const PylithInt cells[1*8] = {
+                    0, 1, 3, 2, 4, 5, 7, 6,
+                };
+                _data->cells = const_cast<PylithInt*>(cells);
+                static const PylithInt materialIds[1] = {
+                    1,
+                };
+                _data->materialIds = const_cast<PylithInt*>(materialIds);
+
+                _data->numGroups = 6;
+                static const PylithInt groupSizes[6] = { 4, 4, 4, 4, 4, 4, };
+                _data->groupSizes = const_cast<PylithInt*>(groupSizes);
+                static const PylithInt groups[6*4] = {
+                    0, 2, 4, 6,
+                    1, 3, 5, 7,
+                    0, 1, 4, 5,
+                    2, 3, 6, 7,
+                    0, 1, 2, 3,
+                    4, 5, 6, 7,
+                };
+                _data->groups = const_cast<PylithInt*>(groups);
+                static const char* groupNames[6] = {
+                    "boundary_xneg",
+                    "boundary_xpos",
+                    "boundary_yneg",
+                    "boundary_ypos",
+                    "boundary_zneg",
+                    "boundary_zpos",
+                };
+                _data->groupNames = const_cast<char**>(groupNames);
+                static const char* groupTypes[6] = {
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                };
+                _data->groupTypes = const_cast<char**>(groupTypes);
+            } // setUp
+
+        }; // class TestMeshIOBox_Hex3D
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestMeshIOBox_Hex3D);
+
+        // --------------------------------------------------------------
+        class TestMeshIOBox_Tet3D : public TestMeshIOBox {
+            CPPUNIT_TEST_SUB_SUITE(TestMeshIOBox_Tet3D, TestMeshIOBox);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestMeshIOBox::setUp();
+                _data = new TestMeshIOBox_Data();CPPUNIT_ASSERT(_data);
+                static PylithReal lower[3] = { 0.0, 0.0, 0.0 };
+                static PylithReal upper[3] = { 1.0, 1.0, 1.0 };
+                static int numCellsDir[3] = { 1, 1, 1 };
+                _data->lower = lower;
+                _data->upper = upper;
+                _data->numCellsDir = numCellsDir;
+                _data->cellShape = MeshIOBox::SIMPLEX;
+
+                _data->numVertices = 8;
+                _data->spaceDim = 3;
+                _data->numCells = 6;
+                _data->cellDim = 3;
+                _data->numCorners = 4;
+
+                static const PylithScalar vertices[8*3] = {
+                    0.0, 0.0, 0.0,
+                    1.0, 0.0, 0.0,
+                    0.0, 1.0, 0.0,
+                    1.0, 1.0, 0.0,
+                    0.0, 0.0, 1.0,
+                    1.0, 0.0, 1.0,
+                    0.0, 1.0, 1.0,
+                    1.0, 1.0, 1.0,
+                };
+                _data->vertices = const_cast<PylithScalar*>(vertices);
+
+                static const PylithInt cells[6*4] = {
+                    0, 1, 3, 7,
+                    0, 2, 6, 7,
+                    0, 4, 5, 7,
+                    0, 5, 1, 7,
+                    0, 3, 2, 7,
+                    0, 6, 4, 7,
+                };
+                _data->cells = const_cast<PylithInt*>(cells);
+                static const PylithInt materialIds[6] = {
+                    1, 1, 1, 1, 1, 1,
+                };
+                _data->materialIds = const_cast<PylithInt*>(materialIds);
+
+                _data->numGroups = 6;
+                static const PylithInt groupSizes[6] = { 4, 4, 4, 4, 4, 4, };
+                _data->groupSizes = const_cast<PylithInt*>(groupSizes);
+                static const PylithInt groups[6*4] = {
+                    0, 2, 4, 6,
+                    1, 3, 5, 7,
+                    0, 1, 4, 5,
+                    2, 3, 6, 7,
+                    0, 1, 2, 3,
+                    4, 5, 6, 7,
+                };
+                _data->groups = const_cast<PylithInt*>(groups);
+                static const char* groupNames[6] = {
+                    "boundary_xneg",
+                    "boundary_xpos",
+                    "boundary_yneg",
+                    "boundary_ypos",
+                    "boundary_zneg",
+                    "boundary_zpos",
+                };
+                _data->groupNames = const_cast<char**>(groupNames);
+                static const char* groupTypes[6] = {
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                    "vertex",
+                };
+                _data->groupTypes = const_cast<char**>(groupTypes);
+            } // setUp
+
+        }; // class TestMeshIOBox_Tet3D
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestMeshIOBox_Tet3D);
+
+    } // meshio
+} // pylith
+
+// End of file
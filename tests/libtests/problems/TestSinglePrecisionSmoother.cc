@@ -0,0 +1,374 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSinglePrecisionSmoother.hh" // Implementation of class methods
+
+#include "pylith/problems/SinglePrecisionSmoother.hh" // Test subject
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+#include "pylith/utils/types.hh" // USES PylithReal
+
+#include "petscksp.h" // USES PetscPC
+
+#include <algorithm> // USES std::max()
+#include <cmath> // USES fabs()
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _TestSinglePrecisionSmoother {
+public:
+
+            /** Create small nonsymmetric, diagonally dominant matrix.
+             *
+             * @param[in] matType PETSc matrix type.
+             * @param[in] blockSize Block size of matrix.
+             * @returns PETSc matrix.
+             */
+            static
+            PetscMat createMatrix(MatType matType,
+                                  const PetscInt blockSize) {
+                const PetscInt numRows = 12;
+                PetscErrorCode err = 0;
+                PetscMat mat = NULL;
+                err = MatCreate(PETSC_COMM_SELF, &mat);CPPUNIT_ASSERT(!err);
+                err = MatSetSizes(mat, numRows, numRows, numRows, numRows);CPPUNIT_ASSERT(!err);
+                err = MatSetType(mat, matType);CPPUNIT_ASSERT(!err);
+                err = MatSetBlockSize(mat, blockSize);CPPUNIT_ASSERT(!err);
+                err = MatSetUp(mat);CPPUNIT_ASSERT(!err);
+                err = MatSetOption(mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);CPPUNIT_ASSERT(!err);
+                for (PetscInt iRow = 0; iRow < numRows; ++iRow) {
+                    err = MatSetValue(mat, iRow, iRow, 4.0 + 0.1*iRow, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+                    if (iRow > 0) {
+                        err = MatSetValue(mat, iRow, iRow-1, -1.2, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+                    } // if
+                    if (iRow+1 < numRows) {
+                        err = MatSetValue(mat, iRow, iRow+1, -0.8, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+                    } // if
+                    if (iRow+3 < numRows) {
+                        err = MatSetValue(mat, iRow, iRow+3, 0.3, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+                    } // if
+                } // for
+                err = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+                err = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+                return mat;
+            } // createMatrix
+
+            /** Create preconditioner with operator.
+             *
+             * @param[in] pcType PETSc preconditioner type.
+             * @param[in] mat PETSc matrix.
+             * @returns PETSc preconditioner.
+             */
+            static
+            PetscPC createPC(PCType pcType,
+                             PetscMat mat) {
+                PetscErrorCode err = 0;
+                PetscPC pc = NULL;
+                err = PCCreate(PETSC_COMM_SELF, &pc);CPPUNIT_ASSERT(!err);
+                err = PCSetType(pc, pcType);CPPUNIT_ASSERT(!err);
+                err = PCSetOperators(pc, mat, mat);CPPUNIT_ASSERT(!err);
+
+                return pc;
+            } // createPC
+
+            /** Check single precision preconditioner matches PETSc preconditioner.
+             *
+             * @param[in] pcE PETSc preconditioner.
+             * @param[in] pc Single precision preconditioner.
+             * @param[in] mat PETSc matrix.
+             */
+            static
+            void checkApply(PetscPC pcE,
+                            PetscPC pc,
+                            PetscMat mat) {
+                PetscErrorCode err = 0;
+                PetscBool isShell = PETSC_FALSE;
+                err = PetscObjectTypeCompare((PetscObject)pc, PCSHELL, &isShell);CPPUNIT_ASSERT(!err);
+                CPPUNIT_ASSERT(isShell);
+
+                PetscVec rhsVec = NULL;
+                PetscVec solutionVecE = NULL;
+                PetscVec solutionVec = NULL;
+                err = MatCreateVecs(mat, &rhsVec, &solutionVec);CPPUNIT_ASSERT(!err);
+                err = VecDuplicate(solutionVec, &solutionVecE);CPPUNIT_ASSERT(!err);
+                PetscInt numRows = 0;
+                err = VecGetSize(rhsVec, &numRows);CPPUNIT_ASSERT(!err);
+                for (PetscInt i = 0; i < numRows; ++i) {
+                    err = VecSetValue(rhsVec, i, 1.0 + 0.25*i - 0.05*i*i, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+                } // for
+                err = VecAssemblyBegin(rhsVec);CPPUNIT_ASSERT(!err);
+                err = VecAssemblyEnd(rhsVec);CPPUNIT_ASSERT(!err);
+
+                err = PCSetUp(pcE);CPPUNIT_ASSERT(!err);
+                err = PCApply(pcE, rhsVec, solutionVecE);CPPUNIT_ASSERT(!err);
+                err = PCSetUp(pc);CPPUNIT_ASSERT(!err);
+                err = PCApply(pc, rhsVec, solutionVec);CPPUNIT_ASSERT(!err);
+
+                // Single precision roundoff.
+                const PylithReal tolerance = 1.0e-5;
+                const PetscScalar* valuesE = NULL;
+                const PetscScalar* values = NULL;
+                err = VecGetArrayRead(solutionVecE, &valuesE);CPPUNIT_ASSERT(!err);
+                err = VecGetArrayRead(solutionVec, &values);CPPUNIT_ASSERT(!err);
+                PylithReal maxValue = 0.0;
+                for (PetscInt i = 0; i < numRows; ++i) {
+                    maxValue = std::max(maxValue, fabs(PetscRealPart(valuesE[i])));
+                } // for
+                CPPUNIT_ASSERT(maxValue > 0.0);
+                for (PetscInt i = 0; i < numRows; ++i) {
+                    CPPUNIT_ASSERT_DOUBLES_EQUAL(PetscRealPart(valuesE[i]), PetscRealPart(values[i]), tolerance*maxValue);
+                } // for
+                err = VecRestoreArrayRead(solutionVecE, &valuesE);CPPUNIT_ASSERT(!err);
+                err = VecRestoreArrayRead(solutionVec, &values);CPPUNIT_ASSERT(!err);
+
+                err = VecDestroy(&rhsVec);CPPUNIT_ASSERT(!err);
+                err = VecDestroy(&solutionVecE);CPPUNIT_ASSERT(!err);
+                err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+            } // checkApply
+
+            /** Check Richardson iterations of single precision preconditioner match PETSc preconditioner.
+             *
+             * @param[in] pcE PETSc preconditioner.
+             * @param[in] pc Single precision preconditioner.
+             * @param[in] mat PETSc matrix.
+             * @param[in] numIterations Number of Richardson iterations.
+             */
+            static
+            void checkApplyRichardson(PetscPC pcE,
+                                      PetscPC pc,
+                                      PetscMat mat,
+                                      const PetscInt numIterations) {
+                PetscErrorCode err = 0;
+                PetscVec rhsVec = NULL;
+                PetscVec solutionVecE = NULL;
+                PetscVec solutionVec = NULL;
+                PetscVec workVec = NULL;
+                err = MatCreateVecs(mat, &rhsVec, &solutionVec);CPPUNIT_ASSERT(!err);
+                err = VecDuplicate(solutionVec, &solutionVecE);CPPUNIT_ASSERT(!err);
+                err = VecDuplicate(solutionVec, &workVec);CPPUNIT_ASSERT(!err);
+                PetscInt numRows = 0;
+                err = VecGetSize(rhsVec, &numRows);CPPUNIT_ASSERT(!err);
+                for (PetscInt i = 0; i < numRows; ++i) {
+                    err = VecSetValue(rhsVec, i, 1.0 + 0.25*i - 0.05*i*i, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+                    err = VecSetValue(solutionVecE, i, 0.5 - 0.1*i, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+                } // for
+                err = VecAssemblyBegin(rhsVec);CPPUNIT_ASSERT(!err);
+                err = VecAssemblyEnd(rhsVec);CPPUNIT_ASSERT(!err);
+                err = VecAssemblyBegin(solutionVecE);CPPUNIT_ASSERT(!err);
+                err = VecAssemblyEnd(solutionVecE);CPPUNIT_ASSERT(!err);
+                err = VecCopy(solutionVecE, solutionVec);CPPUNIT_ASSERT(!err);
+
+                PetscInt numIterationsE = 0;
+                PetscInt numIterationsPC = 0;
+                PCRichardsonConvergedReason reason = PCRICHARDSON_CONVERGED_RTOL;
+                err = PCSetUp(pcE);CPPUNIT_ASSERT(!err);
+                err = PCApplyRichardson(pcE, rhsVec, solutionVecE, workVec, 0.0, 0.0, 1.0e+5, numIterations, PETSC_FALSE,
+                                        &numIterationsE, &reason);CPPUNIT_ASSERT(!err);
+                err = PCSetUp(pc);CPPUNIT_ASSERT(!err);
+                err = PCApplyRichardson(pc, rhsVec, solutionVec, workVec, 0.0, 0.0, 1.0e+5, numIterations, PETSC_FALSE,
+                                        &numIterationsPC, &reason);CPPUNIT_ASSERT(!err);
+                CPPUNIT_ASSERT_EQUAL(numIterations, numIterationsPC);
+                CPPUNIT_ASSERT_EQUAL(PCRICHARDSON_CONVERGED_ITS, reason);
+
+                // Single precision roundoff.
+                const PylithReal tolerance = 1.0e-5;
+                const PetscScalar* valuesE = NULL;
+                const PetscScalar* values = NULL;
+                err = VecGetArrayRead(solutionVecE, &valuesE);CPPUNIT_ASSERT(!err);
+                err = VecGetArrayRead(solutionVec, &values);CPPUNIT_ASSERT(!err);
+                PylithReal maxValue = 0.0;
+                for (PetscInt i = 0; i < numRows; ++i) {
+                    maxValue = std::max(maxValue, fabs(PetscRealPart(valuesE[i])));
+                } // for
+                CPPUNIT_ASSERT(maxValue > 0.0);
+                for (PetscInt i = 0; i < numRows; ++i) {
+                    CPPUNIT_ASSERT_DOUBLES_EQUAL(PetscRealPart(valuesE[i]), PetscRealPart(values[i]), tolerance*maxValue);
+                } // for
+                err = VecRestoreArrayRead(solutionVecE, &valuesE);CPPUNIT_ASSERT(!err);
+                err = VecRestoreArrayRead(solutionVec, &values);CPPUNIT_ASSERT(!err);
+
+                err = VecDestroy(&rhsVec);CPPUNIT_ASSERT(!err);
+                err = VecDestroy(&solutionVecE);CPPUNIT_ASSERT(!err);
+                err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+                err = VecDestroy(&workVec);CPPUNIT_ASSERT(!err);
+            } // checkApplyRichardson
+
+        }; // _TestSinglePrecisionSmoother
+    } // problems
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::problems::TestSinglePrecisionSmoother);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test single precision Jacobi matches PETSc Jacobi.
+void
+pylith::problems::TestSinglePrecisionSmoother::testJacobi(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscMat mat = _TestSinglePrecisionSmoother::createMatrix(MATSEQAIJ, 1);
+    PetscPC pcE = _TestSinglePrecisionSmoother::createPC(PCJACOBI, mat);
+    PetscPC pc = _TestSinglePrecisionSmoother::createPC(PCJACOBI, mat);
+    SinglePrecisionSmoother::_replaceSmoother(pc);
+    _TestSinglePrecisionSmoother::checkApply(pcE, pc, mat);
+
+    // Jacobi only keeps the inverse of the diagonal.
+    void* context = NULL;
+    err = PCShellGetContext(pc, &context);CPPUNIT_ASSERT(!err);
+    const SinglePrecisionSmoother* smoother = (SinglePrecisionSmoother*)context;CPPUNIT_ASSERT(smoother);
+    CPPUNIT_ASSERT_EQUAL(size_t(12), smoother->_diagonalInv.size());
+    CPPUNIT_ASSERT(smoother->_rowOffsets.empty());
+    CPPUNIT_ASSERT(smoother->_columns.empty());
+    CPPUNIT_ASSERT(smoother->_values.empty());
+
+    err = PCDestroy(&pcE);CPPUNIT_ASSERT(!err);
+    err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+    err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testJacobi
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test single precision SOR matches PETSc SOR for several relaxation factors.
+void
+pylith::problems::TestSinglePrecisionSmoother::testSOR(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscMat mat = _TestSinglePrecisionSmoother::createMatrix(MATSEQAIJ, 1);
+
+    const size_t numOmegas = 3;
+    const PylithReal omegas[numOmegas] = { 1.0, 0.7, 1.4 };
+    for (size_t iOmega = 0; iOmega < numOmegas; ++iOmega) {
+        PetscPC pcE = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+        PetscPC pc = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+        err = PCSORSetOmega(pcE, omegas[iOmega]);CPPUNIT_ASSERT(!err);
+        err = PCSORSetOmega(pc, omegas[iOmega]);CPPUNIT_ASSERT(!err);
+        SinglePrecisionSmoother::_replaceSmoother(pc);
+        _TestSinglePrecisionSmoother::checkApply(pcE, pc, mat);
+        err = PCDestroy(&pcE);CPPUNIT_ASSERT(!err);
+        err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+    } // for
+
+    err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testSOR
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test single precision SOR Richardson iterations with nonzero initial guess match PETSc SOR.
+void
+pylith::problems::TestSinglePrecisionSmoother::testSORRichardson(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscMat mat = _TestSinglePrecisionSmoother::createMatrix(MATSEQAIJ, 1);
+
+    const size_t numOmegas = 2;
+    const PylithReal omegas[numOmegas] = { 1.0, 1.4 };
+    for (size_t iOmega = 0; iOmega < numOmegas; ++iOmega) {
+        PetscPC pcE = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+        PetscPC pc = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+        err = PCSORSetOmega(pcE, omegas[iOmega]);CPPUNIT_ASSERT(!err);
+        err = PCSORSetOmega(pc, omegas[iOmega]);CPPUNIT_ASSERT(!err);
+        SinglePrecisionSmoother::_replaceSmoother(pc);
+        _TestSinglePrecisionSmoother::checkApplyRichardson(pcE, pc, mat, 3);
+        err = PCDestroy(&pcE);CPPUNIT_ASSERT(!err);
+        err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+    } // for
+
+    err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testSORRichardson
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test SOR with point blocks is not replaced.
+void
+pylith::problems::TestSinglePrecisionSmoother::testSORPointBlock(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscMat mat = _TestSinglePrecisionSmoother::createMatrix(MATSEQBAIJ, 2);
+    PetscPC pc = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+    SinglePrecisionSmoother::_replaceSmoother(pc);
+    PetscBool isSOR = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)pc, PCSOR, &isSOR);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(isSOR);
+    err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+
+    // Jacobi is pointwise for any matrix type.
+    PetscPC pcE = _TestSinglePrecisionSmoother::createPC(PCJACOBI, mat);
+    pc = _TestSinglePrecisionSmoother::createPC(PCJACOBI, mat);
+    SinglePrecisionSmoother::_replaceSmoother(pc);
+    _TestSinglePrecisionSmoother::checkApply(pcE, pc, mat);
+    err = PCDestroy(&pcE);CPPUNIT_ASSERT(!err);
+    err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+
+    err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testSORPointBlock
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test unsupported Jacobi and SOR settings are rejected.
+void
+pylith::problems::TestSinglePrecisionSmoother::testUnsupported(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscMat mat = _TestSinglePrecisionSmoother::createMatrix(MATSEQAIJ, 1);
+    PetscPC pc = NULL;
+
+    pc = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+    err = PCSORSetIterations(pc, 2, 1);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_THROW(SinglePrecisionSmoother::_replaceSmoother(pc), std::runtime_error);
+    err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+
+    pc = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+    err = PCSORSetIterations(pc, 1, 2);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_THROW(SinglePrecisionSmoother::_replaceSmoother(pc), std::runtime_error);
+    err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+
+    pc = _TestSinglePrecisionSmoother::createPC(PCSOR, mat);
+    err = PCSORSetSymmetric(pc, SOR_LOCAL_FORWARD_SWEEP);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_THROW(SinglePrecisionSmoother::_replaceSmoother(pc), std::runtime_error);
+    err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+
+    pc = _TestSinglePrecisionSmoother::createPC(PCJACOBI, mat);
+    err = PCJacobiSetType(pc, PC_JACOBI_ROWMAX);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_THROW(SinglePrecisionSmoother::_replaceSmoother(pc), std::runtime_error);
+    err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+
+    err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testUnsupported
+
+
+// End of file
@@ -0,0 +1,73 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/problems/TestSinglePrecisionSmoother.hh
+ *
+ * @brief C++ TestSinglePrecisionSmoother object.
+ *
+ * C++ unit testing for SinglePrecisionSmoother.
+ */
+
+#if !defined(pylith_problems_testsingleprecisionsmoother_hh)
+#define pylith_problems_testsingleprecisionsmoother_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestSinglePrecisionSmoother;
+    } // problems
+} // pylith
+
+class pylith::problems::TestSinglePrecisionSmoother : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestSinglePrecisionSmoother);
+
+    CPPUNIT_TEST(testJacobi);
+    CPPUNIT_TEST(testSOR);
+    CPPUNIT_TEST(testSORRichardson);
+    CPPUNIT_TEST(testSORPointBlock);
+    CPPUNIT_TEST(testUnsupported);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test single precision Jacobi matches PETSc Jacobi.
+    void testJacobi(void);
+
+    /// Test single precision SOR matches PETSc SOR for several relaxation factors.
+    void testSOR(void);
+
+    /// Test single precision SOR Richardson iterations with nonzero initial guess match PETSc SOR.
+    void testSORRichardson(void);
+
+    /// Test SOR with point blocks is not replaced.
+    void testSORPointBlock(void);
+
+    /// Test unsupported Jacobi and SOR settings are rejected.
+    void testUnsupported(void);
+
+}; // class TestSinglePrecisionSmoother
+
+#endif // pylith_problems_testsingleprecisionsmoother_hh
+
+// End of file
@@ -0,0 +1,140 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestTimeDependent.hh" // Implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // Test subject
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_*
+
+#include <vector> // USES std::vector
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::problems::TestTimeDependent);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _getPredictorHistorySize().
+void
+pylith::problems::TestTimeDependent::testPredictorHistorySize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT_EQUAL(size_t(0), TimeDependent::_getPredictorHistorySize(TimeDependent::PREDICTOR_NONE));
+    CPPUNIT_ASSERT_EQUAL(size_t(2), TimeDependent::_getPredictorHistorySize(TimeDependent::PREDICTOR_LINEAR));
+    CPPUNIT_ASSERT_EQUAL(size_t(3), TimeDependent::_getPredictorHistorySize(TimeDependent::PREDICTOR_QUADRATIC));
+
+    PYLITH_METHOD_END;
+} // testPredictorHistorySize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _computePredictorWeights().
+void
+pylith::problems::TestTimeDependent::testPredictorWeights(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const PylithReal tolerance = 1.0e-12;
+
+    // Previous solutions at nonuniform times (most recent first), extrapolated to the next time step.
+    const PylithReal t0 = 2.5;
+    const PylithReal t1 = 1.5;
+    const PylithReal t2 = 1.25;
+    const PylithReal tPredict = 3.25;
+
+    { // Linear: exact for polynomials through degree 1.
+        std::vector<PylithReal> times(2);
+        times[0] = t0;
+        times[1] = t1;
+        std::vector<PylithReal> weights;
+        TimeDependent::_computePredictorWeights(&weights, times, tPredict);
+        CPPUNIT_ASSERT_EQUAL(size_t(2), weights.size());
+
+        const PylithReal weightsE[2] = { 1.75, -0.75 };
+        for (size_t i = 0; i < 2; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(weightsE[i], weights[i], tolerance);
+        } // for
+
+        const PylithReal a = 0.3, b = -1.2;
+        PylithReal value = 0.0;
+        for (size_t i = 0; i < 2; ++i) {
+            value += weights[i] * (a + b*times[i]);
+        } // for
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(a + b*tPredict, value, tolerance);
+    } // Linear
+
+    { // Quadratic: exact for polynomials through degree 2.
+        std::vector<PylithReal> times(3);
+        times[0] = t0;
+        times[1] = t1;
+        times[2] = t2;
+        std::vector<PylithReal> weights;
+        TimeDependent::_computePredictorWeights(&weights, times, tPredict);
+        CPPUNIT_ASSERT_EQUAL(size_t(3), weights.size());
+
+        const PylithReal weightsE[3] = { 2.8, -6.0, 4.2 };
+        for (size_t i = 0; i < 3; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(weightsE[i], weights[i], tolerance);
+        } // for
+
+        const PylithReal a = 0.3, b = -1.2, c = 0.7;
+        PylithReal value = 0.0;
+        PylithReal sumWeights = 0.0;
+        for (size_t i = 0; i < 3; ++i) {
+            value += weights[i] * (a + b*times[i] + c*times[i]*times[i]);
+            sumWeights += weights[i];
+        } // for
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(a + b*tPredict + c*tPredict*tPredict, value, tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, sumWeights, tolerance);
+    } // Quadratic
+
+    PYLITH_METHOD_END;
+} // testPredictorWeights
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _computeTimeStep().
+void
+pylith::problems::TestTimeDependent::testComputeTimeStep(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const PylithReal tolerance = 1.0e-12;
+    const PylithReal dtUser = 1.0;
+    const bool isInitial = true;
+    const bool isExplicit = true;
+
+    // Implicit, initial time step: limited by stable time step, never larger than user time step.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.25, TimeDependent::_computeTimeStep(dtUser, 0.25, dtUser, isInitial, !isExplicit), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, TimeDependent::_computeTimeStep(dtUser, 10.0, dtUser, isInitial, !isExplicit), tolerance);
+
+    // Implicit, after time step: grows by at most a factor of 2 up to the user time step.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, TimeDependent::_computeTimeStep(0.25, 10.0, dtUser, !isInitial, !isExplicit), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, TimeDependent::_computeTimeStep(0.75, 10.0, dtUser, !isInitial, !isExplicit), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, TimeDependent::_computeTimeStep(1.0, 10.0, dtUser, !isInitial, !isExplicit), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.3, TimeDependent::_computeTimeStep(0.25, 0.3, dtUser, !isInitial, !isExplicit), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.1, TimeDependent::_computeTimeStep(1.0, 0.1, dtUser, !isInitial, !isExplicit), tolerance);
+
+    // Explicit: always the stable time step.
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.01, TimeDependent::_computeTimeStep(dtUser, 0.01, dtUser, isInitial, isExplicit), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.01, TimeDependent::_computeTimeStep(0.001, 0.01, dtUser, !isInitial, isExplicit), tolerance);
+
+    PYLITH_METHOD_END;
+} // testComputeTimeStep
+
+
+// End of file
@@ -0,0 +1,65 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/problems/TestTimeDependent.hh
+ *
+ * @brief C++ TestTimeDependent object.
+ *
+ * C++ unit testing for TimeDependent.
+ */
+
+#if !defined(pylith_problems_testtimedependent_hh)
+#define pylith_problems_testtimedependent_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestTimeDependent;
+    } // problems
+} // pylith
+
+class pylith::problems::TestTimeDependent : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestTimeDependent);
+
+    CPPUNIT_TEST(testPredictorHistorySize);
+    CPPUNIT_TEST(testPredictorWeights);
+    CPPUNIT_TEST(testComputeTimeStep);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test _getPredictorHistorySize().
+    void testPredictorHistorySize(void);
+
+    /// Test _computePredictorWeights().
+    void testPredictorWeights(void);
+
+    /// Test _computeTimeStep().
+    void testComputeTimeStep(void);
+
+}; // class TestTimeDependent
+
+#endif // pylith_problems_testtimedependent_hh
+
+// End of file
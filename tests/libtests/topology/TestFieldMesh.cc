@@ -31,6 +31,44 @@
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _TestFieldMesh {
+public:
+
+            /** Linear function with different coefficients for each component.
+             *
+             * Signature matches PETSc function for projecting functions into a field.
+             */
+            static
+            PetscErrorCode linearFn(PetscInt dim,
+                                    PetscReal t,
+                                    const PetscReal x[],
+                                    PetscInt numComponents,
+                                    PetscScalar* values,
+                                    void* context) {
+                for (PetscInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                    values[iComponent] = linearValue(dim, x, iComponent);
+                } // for
+                return PETSC_SUCCESS;
+            } // linearFn
+
+            static
+            PylithReal linearValue(const PetscInt dim,
+                                   const PetscReal x[],
+                                   const PetscInt iComponent) {
+                PylithReal value = 1.0 + iComponent;
+                for (PetscInt i = 0; i < dim; ++i) {
+                    value += (2.0 + i + iComponent) * x[i];
+                } // for
+                return value;
+            } // linearValue
+
+        }; // _TestFieldMesh
+    } // topology
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Setup testing data.
 void
@@ -349,6 +387,132 @@ pylith::topology::TestFieldMesh::testView(void) {
 } // testView
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Test layout of subfield with values at quadrature points.
+void
+pylith::topology::TestFieldMesh::testPointSpace(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    FieldBase::Discretization discretization(_data->discretizationA);
+    discretization.feSpace = FieldBase::POINT_SPACE;
+    discretization.isBasisContinuous = false;
+
+    Field field(*_mesh);
+    field.setLabel("state");
+    field.subfieldAdd(_data->descriptionA, discretization);
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    PetscErrorCode err = 0;
+    PetscDS ds = NULL;
+    PetscObject fe = NULL;
+    PetscQuadrature quadrature = NULL;
+    PetscInt numQuadPts = 0;
+    err = DMGetDS(field.getDM(), &ds);CPPUNIT_ASSERT(!err);
+    err = PetscDSGetDiscretization(ds, 0, &fe);CPPUNIT_ASSERT(!err);
+    err = PetscFEGetQuadrature((PetscFE)fe, &quadrature);CPPUNIT_ASSERT(!err);
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, NULL);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(numQuadPts > 0);
+
+    // All degrees of freedom are associated with the cells.
+    PetscSection section = field.getLocalSection();CPPUNIT_ASSERT(section);
+    PetscDM dmMesh = _mesh->getDM();CPPUNIT_ASSERT(dmMesh);
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    const PylithInt numDofCell = numQuadPts * _data->descriptionA.numComponents;
+    for (PylithInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        PylithInt dof = 0;
+        err = PetscSectionGetDof(section, cell, &dof);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(numDofCell, dof);
+    } // for
+    Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+    for (PylithInt vertex = verticesStratum.begin(); vertex < verticesStratum.end(); ++vertex) {
+        PylithInt dof = 0;
+        err = PetscSectionGetDof(section, vertex, &dof);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(PylithInt(0), dof);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testPointSpace
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test values of subfield with values at quadrature points.
+void
+pylith::topology::TestFieldMesh::testPointSpaceValues(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    FieldBase::Discretization discretization(_data->discretizationA);
+    discretization.feSpace = FieldBase::POINT_SPACE;
+    discretization.isBasisContinuous = false;
+    discretization.quadOrder = 2;
+
+    Field field(*_mesh);
+    field.setLabel("state");
+    field.subfieldAdd(_data->descriptionA, discretization);
+    field.subfieldsSetup();
+    field.createDiscretization();
+    field.allocate();
+
+    // Project function; point evaluation functionals at quadrature points reproduce the values exactly.
+    PetscErrorCode err = 0;
+    PetscErrorCode (*fns[1])(PetscInt, PetscReal, const PetscReal[], PetscInt, PetscScalar*, void*) = {
+        _TestFieldMesh::linearFn,
+    };
+    err = DMProjectFunctionLocal(field.getDM(), 0.0, fns, NULL, INSERT_ALL_VALUES, field.getLocalVector());CPPUNIT_ASSERT(!err);
+
+    PetscDS ds = NULL;
+    PetscObject fe = NULL;
+    PetscQuadrature quadrature = NULL;
+    PetscInt numQuadPts = 0;
+    err = DMGetDS(field.getDM(), &ds);CPPUNIT_ASSERT(!err);
+    err = PetscDSGetDiscretization(ds, 0, &fe);CPPUNIT_ASSERT(!err);
+    err = PetscFEGetQuadrature((PetscFE)fe, &quadrature);CPPUNIT_ASSERT(!err);
+    err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, NULL);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(numQuadPts > 1);
+
+    // Dof for a cell are ordered by quadrature point and then component.
+    const PylithInt spaceDim = _data->cellDim;
+    const PylithInt numComponents = _data->descriptionA.numComponents;
+    scalar_array quadPtsCoords(numQuadPts*spaceDim);
+    scalar_array jacobian(numQuadPts*spaceDim*spaceDim);
+    scalar_array jacobianInv(numQuadPts*spaceDim*spaceDim);
+    scalar_array jacobianDet(numQuadPts);
+
+    PetscSection section = field.getLocalSection();CPPUNIT_ASSERT(section);
+    const PetscScalar* fieldArray = NULL;
+    err = VecGetArrayRead(field.getLocalVector(), &fieldArray);CPPUNIT_ASSERT(!err);
+
+    const PylithReal tolerance = 1.0e-10;
+    PetscDM dmMesh = _mesh->getDM();CPPUNIT_ASSERT(dmMesh);
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    for (PylithInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        err = DMPlexComputeCellGeometryFEM(dmMesh, cell, quadrature, &quadPtsCoords[0], &jacobian[0], &jacobianInv[0],
+                                           &jacobianDet[0]);CPPUNIT_ASSERT(!err);
+        PylithInt offset = 0;
+        err = PetscSectionGetOffset(section, cell, &offset);CPPUNIT_ASSERT(!err);
+        for (PylithInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+            for (PylithInt iComponent = 0; iComponent < numComponents; ++iComponent) {
+                const PylithReal valueE = _TestFieldMesh::linearValue(spaceDim, &quadPtsCoords[iQuad*spaceDim], iComponent);
+                const PylithReal value = fieldArray[offset + iQuad*numComponents + iComponent];
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
+            } // for
+        } // for
+    } // for
+    err = VecRestoreArrayRead(field.getLocalVector(), &fieldArray);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testPointSpaceValues
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 void
 pylith::topology::TestFieldMesh::_initialize(void) {
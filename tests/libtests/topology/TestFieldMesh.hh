@@ -58,6 +58,8 @@ class pylith::topology::TestFieldMesh : public CppUnit::TestFixture {
     CPPUNIT_TEST(testAllocate);
     CPPUNIT_TEST(testZeroLocal);
     CPPUNIT_TEST(testView);
+    CPPUNIT_TEST(testPointSpace);
+    CPPUNIT_TEST(testPointSpaceValues);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -100,6 +102,12 @@ public:
     /// Test view().
     void testView(void);
 
+    /// Test layout of subfield with values at quadrature points.
+    void testPointSpace(void);
+
+    /// Test values of subfield with values at quadrature points.
+    void testPointSpaceValues(void);
+
     // PRIVATE METHODS /////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,245 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestFieldOps.hh" // Implementation of class methods
+
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/meshio/MeshBuilder.hh" // Uses MeshBuilder
+#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <algorithm> // USES std::max()
+#include <cmath> // USES fabs()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _TestFieldOps {
+public:
+
+            /** Compute maximum ratio of off-diagonal to diagonal entries of reference cell mass matrix.
+             *
+             * @param[in] fe Finite-element for scalar field.
+             * @returns Maximum of |M_ij| / sqrt(M_ii M_jj) for i != j.
+             */
+            static
+            PylithReal offDiagonalRatio(PetscFE fe) {
+                PetscErrorCode err = 0;
+                PetscTabulation tabulation = NULL;
+                err = PetscFEGetCellTabulation(fe, 0, &tabulation);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(tabulation);
+                CPPUNIT_ASSERT_EQUAL(PetscInt(1), tabulation->Nc);
+
+                PetscQuadrature quadrature = NULL;
+                PetscInt numQuadPts = 0;
+                const PetscReal* weights = NULL;
+                err = PetscFEGetQuadrature(fe, &quadrature);CPPUNIT_ASSERT(!err);
+                err = PetscQuadratureGetData(quadrature, NULL, NULL, &numQuadPts, NULL, &weights);CPPUNIT_ASSERT(!err);
+                CPPUNIT_ASSERT_EQUAL(numQuadPts, tabulation->Np);
+
+                const PetscInt numBasis = tabulation->Nb;
+                const PetscReal* basis = tabulation->T[0];
+                scalar_array mass(numBasis*numBasis);
+                mass = 0.0;
+                for (PetscInt iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+                    for (PetscInt i = 0; i < numBasis; ++i) {
+                        for (PetscInt j = 0; j < numBasis; ++j) {
+                            mass[i*numBasis+j] += weights[iQuad] * basis[iQuad*numBasis+i] * basis[iQuad*numBasis+j];
+                        } // for
+                    } // for
+                } // for
+
+                PylithReal maxRatio = 0.0;
+                for (PetscInt i = 0; i < numBasis; ++i) {
+                    CPPUNIT_ASSERT(mass[i*numBasis+i] > 0.0);
+                    for (PetscInt j = 0; j < numBasis; ++j) {
+                        if (i != j) {
+                            const PylithReal ratio = fabs(mass[i*numBasis+j]) / sqrt(mass[i*numBasis+i]*mass[j*numBasis+j]);
+                            maxRatio = std::max(maxRatio, ratio);
+                        } // if
+                    } // for
+                } // for
+
+                return maxRatio;
+            } // offDiagonalRatio
+
+        }; // _TestFieldOps
+    } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::topology::TestFieldOps);
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::topology::TestFieldOps::setUp(void) {
+    _mesh = NULL;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::topology::TestFieldOps::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    FieldOps::deallocate();
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test createFE() with spectral space yields a diagonal mass matrix.
+void
+pylith::topology::TestFieldOps::testSpectralMassDiagonal(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+
+    const PylithReal tolerance = 1.0e-12;
+    const int numComponents = 1;
+    const int basisOrders[2] = { 2, 3 };
+    for (int iOrder = 0; iOrder < 2; ++iOrder) {
+        const int basisOrder = basisOrders[iOrder];
+        PetscErrorCode err = 0;
+
+        // Spectral: nodes and quadrature points coincide, so the mass matrix is diagonal.
+        FieldBase::Discretization spectral(basisOrder, basisOrder, -1, -1, false, FieldBase::TENSOR_BASIS,
+                                           FieldBase::SPECTRAL_SPACE, true);
+        PetscFE fe = FieldOps::createFE(spectral, _mesh->getDM(), numComponents);CPPUNIT_ASSERT(fe);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, _TestFieldOps::offDiagonalRatio(fe), tolerance);
+        err = PetscFEDestroy(&fe);CPPUNIT_ASSERT(!err);
+
+        // Polynomial with Gauss quadrature: consistent mass matrix is not diagonal.
+        FieldBase::Discretization polynomial(basisOrder, basisOrder, -1, -1, false, FieldBase::TENSOR_BASIS,
+                                             FieldBase::POLYNOMIAL_SPACE, true);
+        fe = FieldOps::createFE(polynomial, _mesh->getDM(), numComponents);CPPUNIT_ASSERT(fe);
+        CPPUNIT_ASSERT(_TestFieldOps::offDiagonalRatio(fe) > 1.0e-3);
+        err = PetscFEDestroy(&fe);CPPUNIT_ASSERT(!err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // testSpectralMassDiagonal
+
+
+// ----------------------------------------------------------------------
+// Test checkDiscretization() with spectral and nonspectral subfields.
+void
+pylith::topology::TestFieldOps::testCheckDiscretizationSpectral(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+
+    const int basisOrder = 2;
+    const int quadOrder = 2;
+    FieldBase::Discretization spectral(basisOrder, quadOrder, -1, -1, false, FieldBase::TENSOR_BASIS,
+                                       FieldBase::SPECTRAL_SPACE, true);
+    FieldBase::Discretization polynomial(basisOrder, quadOrder, -1, -1, false, FieldBase::TENSOR_BASIS,
+                                         FieldBase::POLYNOMIAL_SPACE, true);
+
+    pylith::string_vector componentNames(2);
+    componentNames[0] = "displacement_x";
+    componentNames[1] = "displacement_y";
+    FieldBase::Description displacement("displacement", "displacement", componentNames, 2, FieldBase::VECTOR);
+    FieldBase::Description density("density", "density", pylith::string_vector(1, "density"), 1, FieldBase::SCALAR);
+    FieldBase::Description shearModulus("shear_modulus", "shear_modulus", pylith::string_vector(1, "shear_modulus"), 1,
+                                        FieldBase::SCALAR);
+
+    Field solution(*_mesh);
+    solution.setLabel("solution");
+    solution.subfieldAdd(displacement, spectral);
+    solution.subfieldsSetup();
+
+    { // Auxiliary subfields mix spectral and polynomial spaces.
+        Field auxiliary(*_mesh);
+        auxiliary.setLabel("auxiliary");
+        auxiliary.subfieldAdd(density, spectral);
+        auxiliary.subfieldAdd(shearModulus, polynomial);
+        auxiliary.subfieldsSetup();
+        CPPUNIT_ASSERT_THROW(FieldOps::checkDiscretization(solution, auxiliary), std::runtime_error);
+    } // mixed
+
+    { // All auxiliary subfields polynomial with spectral solution.
+        Field auxiliary(*_mesh);
+        auxiliary.setLabel("auxiliary");
+        auxiliary.subfieldAdd(density, polynomial);
+        auxiliary.subfieldAdd(shearModulus, polynomial);
+        auxiliary.subfieldsSetup();
+        CPPUNIT_ASSERT_THROW(FieldOps::checkDiscretization(solution, auxiliary), std::runtime_error);
+    } // polynomial
+
+    { // All subfields spectral.
+        Field auxiliary(*_mesh);
+        auxiliary.setLabel("auxiliary");
+        auxiliary.subfieldAdd(density, spectral);
+        auxiliary.subfieldAdd(shearModulus, spectral);
+        auxiliary.subfieldsSetup();
+        FieldOps::checkDiscretization(solution, auxiliary);
+    } // spectral
+
+    PYLITH_METHOD_END;
+} // testCheckDiscretizationSpectral
+
+
+// ----------------------------------------------------------------------
+// Create mesh with a single quadrilateral cell.
+void
+pylith::topology::TestFieldOps::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int cellDim = 2;
+    const int spaceDim = 2;
+    const int numVertices = 4;
+    const int numCells = 1;
+    const int numCorners = 4;
+    const PylithScalar coordinatesValues[numVertices*spaceDim] = {
+        0.0, 0.0,
+        2.0, 0.0,
+        2.0, 1.0,
+        0.0, 1.0,
+    };
+    const PylithInt cellsValues[numCells*numCorners] = { 0, 1, 2, 3 };
+
+    scalar_array coordinates(coordinatesValues, numVertices*spaceDim);
+    int_array cells(cellsValues, numCells*numCorners);
+
+    delete _mesh;_mesh = new Mesh;CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners,
+                                           cellDim);
+
+    spatialdata::geocoords::CSCart cs;
+    cs.setSpaceDim(spaceDim);
+    _mesh->setCoordSys(&cs);
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// End of file
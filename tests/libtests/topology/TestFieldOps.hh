@@ -0,0 +1,82 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/topology/TestFieldOps.hh
+ *
+ * @brief C++ unit testing for FieldOps.
+ */
+
+#if !defined(pylith_topology_testfieldops_hh)
+#define pylith_topology_testfieldops_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace topology {
+        class TestFieldOps;
+    } // topology
+} // pylith
+
+// TestFieldOps -------------------------------------------------------------
+/// C++ unit testing for FieldOps.
+class pylith::topology::TestFieldOps : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestFieldOps);
+
+    CPPUNIT_TEST(testSpectralMassDiagonal);
+    CPPUNIT_TEST(testCheckDiscretizationSpectral);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test createFE() with spectral space yields a diagonal mass matrix.
+    void testSpectralMassDiagonal(void);
+
+    /// Test checkDiscretization() with spectral and nonspectral subfields.
+    void testCheckDiscretizationSpectral(void);
+
+    // PROTECTED METHODS //////////////////////////////////////////////////
+protected:
+
+    /// Create mesh with a single quadrilateral cell.
+    void _initialize(void);
+
+    // PROTECTED MEMBERS //////////////////////////////////////////////////
+protected:
+
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+
+}; // class TestFieldOps
+
+#endif // pylith_topology_testfieldops_hh
+
+// End of file
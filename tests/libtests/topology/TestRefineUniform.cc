@@ -24,12 +24,19 @@
 #include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 
 #include "pylith/utils/array.hh" // USES int_array
 
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <vector> // USES std::vector
+
 #include <strings.h> // USES strcasecmp()
 #include <stdexcept> // USES std::logic_error
 
@@ -45,7 +52,12 @@ pylith::topology::TestRefineUniform::setUp(void) {
 // Deallocate testing data.
 void
 pylith::topology::TestRefineUniform::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    FieldOps::deallocate();
     delete _data;_data = NULL;
+
+    PYLITH_METHOD_END;
 } // tearDown
 
 
@@ -192,6 +204,193 @@ pylith::topology::TestRefineUniform::testRefine(void) {
 } // testRefine
 
 
+// ----------------------------------------------------------------------
+// Test coarse levels from refine() with nondimensionalize() and FieldOps::createCoarseHierarchy().
+void
+pylith::topology::TestRefineUniform::testCoarseHierarchy(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
+
+    Mesh mesh(_data->cellDim);
+    _initializeMesh(&mesh);
+
+    const int numLevels = 2;
+    RefineUniform refiner;
+    Mesh newMesh(_data->cellDim);
+    refiner.refine(&newMesh, mesh, numLevels);
+
+    PetscErrorCode err = 0;
+    const char* const cellsLabelName = pylith::topology::Mesh::cells_label_name;
+
+    // Check labels and save dimensioned coordinates on coarse levels.
+    std::vector<PetscVec> coordinatesOrig;
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(newMesh.getDM(), &dmCoarse);CPPUNIT_ASSERT(!err);
+    while (dmCoarse) {
+        PetscInt cStart = 0, cEnd = 0;
+        err = DMPlexGetHeightStratum(dmCoarse, 0, &cStart, &cEnd);CPPUNIT_ASSERT(!err);
+
+        // Cells label contains only cells, including cohesive cells.
+        PetscDMLabel cellsLabel = NULL;
+        err = DMGetLabel(dmCoarse, cellsLabelName, &cellsLabel);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(cellsLabel);
+        PetscInt numPoints = 0;
+        for (PetscInt p = cStart; p < cEnd; ++p) {
+            PetscInt value = -1;
+            err = DMLabelGetValue(cellsLabel, p, &value);CPPUNIT_ASSERT(!err);
+            CPPUNIT_ASSERT(value >= 0);
+            ++numPoints;
+        } // for
+        PetscIS valuesIS = NULL;
+        const PetscInt* values = NULL;
+        PetscInt numValues = 0;
+        PetscInt numLabeled = 0;
+        err = DMLabelGetNumValues(cellsLabel, &numValues);CPPUNIT_ASSERT(!err);
+        err = DMLabelGetValueIS(cellsLabel, &valuesIS);CPPUNIT_ASSERT(!err);
+        err = ISGetIndices(valuesIS, &values);CPPUNIT_ASSERT(!err);
+        for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+            PetscInt stratumSize = 0;
+            err = DMLabelGetStratumSize(cellsLabel, values[iValue], &stratumSize);CPPUNIT_ASSERT(!err);
+            numLabeled += stratumSize;
+        } // for
+        err = ISRestoreIndices(valuesIS, &values);CPPUNIT_ASSERT(!err);
+        err = ISDestroy(&valuesIS);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(numPoints, numLabeled);
+
+        if (_data->faultA) {
+            PetscInt numCohesive = 0;
+            err = DMGetStratumSize(dmCoarse, cellsLabelName, 100, &numCohesive);CPPUNIT_ASSERT(!err);
+            CPPUNIT_ASSERT(numCohesive > 0);
+        } // if
+
+        // Groups, including fault surfaces.
+        for (PetscInt iGroup = 0; iGroup < _data->numGroups; ++iGroup) {
+            PetscBool hasLabel = PETSC_FALSE;
+            err = DMHasLabel(dmCoarse, _data->groupNames[iGroup], &hasLabel);CPPUNIT_ASSERT(!err);
+            CPPUNIT_ASSERT_MESSAGE(std::string("Missing label '") + _data->groupNames[iGroup] + "' on coarse level.",
+                                   hasLabel);
+        } // for
+
+        PetscVec coordVec = NULL;
+        PetscVec coordVecOrig = NULL;
+        err = DMGetCoordinatesLocal(dmCoarse, &coordVec);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(coordVec);
+        err = VecDuplicate(coordVec, &coordVecOrig);CPPUNIT_ASSERT(!err);
+        err = VecCopy(coordVec, coordVecOrig);CPPUNIT_ASSERT(!err);
+        coordinatesOrig.push_back(coordVecOrig);
+
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);CPPUNIT_ASSERT(!err);
+    } // while
+    CPPUNIT_ASSERT_EQUAL(size_t(numLevels), coordinatesOrig.size());
+
+    // Check nondimensionalized coordinates on coarse levels.
+    const PylithReal lengthScale = 10.0;
+    spatialdata::units::Nondimensional normalizer;
+    normalizer.setLengthScale(lengthScale);
+    MeshOps::nondimensionalize(&newMesh, normalizer);
+
+    const PylithReal tolerance = 1.0e-12;
+    err = DMGetCoarseDM(newMesh.getDM(), &dmCoarse);CPPUNIT_ASSERT(!err);
+    for (size_t iLevel = 0; iLevel < coordinatesOrig.size(); ++iLevel) {
+        CPPUNIT_ASSERT(dmCoarse);
+        PylithReal scale = 0.0;
+        err = DMPlexGetScale(dmCoarse, PETSC_UNIT_LENGTH, &scale);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(lengthScale, scale, tolerance*lengthScale);
+
+        PetscVec coordVec = NULL;
+        PetscInt size = 0, sizeOrig = 0;
+        const PetscScalar* coordArray = NULL;
+        const PetscScalar* coordArrayOrig = NULL;
+        err = DMGetCoordinatesLocal(dmCoarse, &coordVec);CPPUNIT_ASSERT(!err);
+        err = VecGetLocalSize(coordVec, &size);CPPUNIT_ASSERT(!err);
+        err = VecGetLocalSize(coordinatesOrig[iLevel], &sizeOrig);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(sizeOrig, size);
+        err = VecGetArrayRead(coordVec, &coordArray);CPPUNIT_ASSERT(!err);
+        err = VecGetArrayRead(coordinatesOrig[iLevel], &coordArrayOrig);CPPUNIT_ASSERT(!err);
+        for (PetscInt i = 0; i < size; ++i) {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(coordArrayOrig[i] / lengthScale, coordArray[i], tolerance);
+        } // for
+        err = VecRestoreArrayRead(coordVec, &coordArray);CPPUNIT_ASSERT(!err);
+        err = VecRestoreArrayRead(coordinatesOrig[iLevel], &coordArrayOrig);CPPUNIT_ASSERT(!err);
+        err = VecDestroy(&coordinatesOrig[iLevel]);CPPUNIT_ASSERT(!err);
+
+        err = DMGetCoarseDM(dmCoarse, &dmCoarse);CPPUNIT_ASSERT(!err);
+    } // for
+    CPPUNIT_ASSERT(!dmCoarse);
+
+    // Check discretization on coarse levels of solution field.
+    const int spaceDim = _data->spaceDim;
+    const FieldBase::CellBasis cellBasis = _data->isSimplexMesh ? FieldBase::SIMPLEX_BASIS : FieldBase::TENSOR_BASIS;
+    pylith::string_vector componentNames(spaceDim);
+    const char* componentSuffixes[3] = { "_x", "_y", "_z" };
+    for (int i = 0; i < spaceDim; ++i) {
+        componentNames[i] = std::string("displacement") + componentSuffixes[i];
+    } // for
+    Field solution(newMesh);
+    solution.setLabel("solution");
+    solution.subfieldAdd(FieldBase::Description("displacement", "displacement", componentNames, spaceDim,
+                                                FieldBase::VECTOR),
+                         FieldBase::Discretization(1, 1, -1, -1, false, cellBasis));
+    if (_data->faultA) {
+        for (int i = 0; i < spaceDim; ++i) {
+            componentNames[i] = std::string("lagrange_multiplier_fault") + componentSuffixes[i];
+        } // for
+        solution.subfieldAdd(FieldBase::Description("lagrange_multiplier_fault", "lagrange_multiplier_fault",
+                                                    componentNames, spaceDim, FieldBase::VECTOR),
+                             FieldBase::Discretization(1, 1, _data->cellDim-1, -1, true, cellBasis));
+    } // if
+    solution.subfieldsSetup();
+    solution.createDiscretization();
+    solution.allocate();
+    FieldOps::createCoarseHierarchy(solution);
+
+    PetscDM dmSoln = solution.getDM();
+    PetscInt numFields = 0, numDS = 0;
+    err = DMGetNumFields(dmSoln, &numFields);CPPUNIT_ASSERT(!err);
+    err = DMGetNumDS(dmSoln, &numDS);CPPUNIT_ASSERT(!err);
+    PetscDM dmSolnCoarse = NULL;
+    PetscDM dmMeshCoarse = NULL;
+    err = DMGetCoarseDM(dmSoln, &dmSolnCoarse);CPPUNIT_ASSERT(!err);
+    err = DMGetCoarseDM(newMesh.getDM(), &dmMeshCoarse);CPPUNIT_ASSERT(!err);
+    for (int iLevel = 0; iLevel < numLevels; ++iLevel) {
+        CPPUNIT_ASSERT(dmSolnCoarse);
+        CPPUNIT_ASSERT(dmMeshCoarse);
+        CPPUNIT_ASSERT(dmSolnCoarse != dmMeshCoarse);
+
+        PetscInt numFieldsCoarse = 0, numDSCoarse = 0;
+        err = DMGetNumFields(dmSolnCoarse, &numFieldsCoarse);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(numFields, numFieldsCoarse);
+        err = DMGetNumDS(dmSolnCoarse, &numDSCoarse);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(numDS, numDSCoarse);
+
+        PetscDS ds = NULL;
+        err = DMGetDS(dmSolnCoarse, &ds);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(ds);
+        for (PetscInt iDS = 0; iDS < numDSCoarse; ++iDS) {
+            PetscDMLabel label = NULL;
+            err = DMGetRegionNumDS(dmSolnCoarse, iDS, &label, NULL, &ds, NULL);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(ds);
+            if (label) {
+                // Region label must belong to the coarse level, not the fine level.
+                const char* labelName = NULL;
+                PetscDMLabel labelCoarse = NULL;
+                err = PetscObjectGetName((PetscObject)label, &labelName);CPPUNIT_ASSERT(!err);
+                err = DMGetLabel(dmSolnCoarse, labelName, &labelCoarse);CPPUNIT_ASSERT(!err);
+                CPPUNIT_ASSERT(label == labelCoarse);
+            } // if
+        } // for
+
+        PetscSection section = NULL;
+        PetscInt storageSize = 0;
+        err = DMGetLocalSection(dmSolnCoarse, &section);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(section);
+        err = PetscSectionGetStorageSize(section, &storageSize);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT(storageSize > 0);
+
+        err = DMGetCoarseDM(dmSolnCoarse, &dmSolnCoarse);CPPUNIT_ASSERT(!err);
+        err = DMGetCoarseDM(dmMeshCoarse, &dmMeshCoarse);CPPUNIT_ASSERT(!err);
+    } // for
+    CPPUNIT_ASSERT(!dmSolnCoarse);
+
+    PYLITH_METHOD_END;
+} // testCoarseHierarchy
+
+
 // ----------------------------------------------------------------------
 void
 pylith::topology::TestRefineUniform::_initializeMesh(Mesh* const mesh) {
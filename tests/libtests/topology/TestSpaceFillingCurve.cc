@@ -0,0 +1,244 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "tests/src/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include <algorithm> // USES std::sort()
+#include <vector> // USES std::vector
+#include <cstdlib> // USES abs()
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::topology::TestSpaceFillingCurve::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _data = new TestSpaceFillingCurve_Data;CPPUNIT_ASSERT(_data);
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::topology::TestSpaceFillingCurve::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _data;_data = NULL;
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test _hilbertIndex().
+void
+pylith::topology::TestSpaceFillingCurve::testHilbertIndex(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Consecutive points along the Hilbert curve through a regular grid
+    // must be nearest neighbors.
+    const int numPerDim = 8;
+    for (int dim = 2; dim <= 3; ++dim) {
+        const int numPoints = (2 == dim) ? numPerDim*numPerDim : numPerDim*numPerDim*numPerDim;
+        std::vector<std::pair<uint64_t, int> > indices(numPoints);
+        for (int iPoint = 0; iPoint < numPoints; ++iPoint) {
+            const PylithReal xyz[3] = {
+                (0.5 + iPoint % numPerDim) / numPerDim,
+                (0.5 + (iPoint / numPerDim) % numPerDim) / numPerDim,
+                (0.5 + iPoint / (numPerDim*numPerDim)) / numPerDim,
+            };
+            indices[iPoint] = std::make_pair(SpaceFillingCurve::_hilbertIndex(xyz, dim), iPoint);
+        } // for
+        std::sort(indices.begin(), indices.end());
+
+        for (int i = 1; i < numPoints; ++i) {
+            const int pointA = indices[i-1].second;
+            const int pointB = indices[i].second;
+            const int distance =
+                abs(pointA % numPerDim - pointB % numPerDim) +
+                abs((pointA / numPerDim) % numPerDim - (pointB / numPerDim) % numPerDim) +
+                abs(pointA / (numPerDim*numPerDim) - pointB / (numPerDim*numPerDim));
+            CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in distance between consecutive points.", 1, distance);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testHilbertIndex
+
+
+// ----------------------------------------------------------------------
+// Test reorder().
+void
+pylith::topology::TestSpaceFillingCurve::testReorder(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+
+    // Get original DM and create Mesh for it
+    const PetscDM dmOrig = _mesh->getDM();
+    PetscObjectReference((PetscObject) dmOrig);
+    Mesh meshOrig;
+    meshOrig.setDM(dmOrig);
+
+    SpaceFillingCurve::reorder(_mesh);
+
+    const PetscDM& dmMesh = _mesh->getDM();CPPUNIT_ASSERT(dmMesh);
+
+    // Check vertices (size only)
+    topology::Stratum verticesStratumE(dmOrig, topology::Stratum::DEPTH, 0);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    CPPUNIT_ASSERT_EQUAL(verticesStratumE.size(), verticesStratum.size());
+
+    // Check cells (size only)
+    topology::Stratum cellsStratumE(dmOrig, topology::Stratum::HEIGHT, 0);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    CPPUNIT_ASSERT_EQUAL(cellsStratumE.size(), cellsStratum.size());
+
+    // Check groups
+    PetscInt numGroupsE, numGroups;
+    PetscErrorCode err;
+    err = DMGetNumLabels(dmOrig, &numGroupsE);CPPUNIT_ASSERT(!err);
+    err = DMGetNumLabels(dmMesh, &numGroups);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(numGroupsE, numGroups);
+
+    for (PetscInt iGroup = 0; iGroup < numGroups; ++iGroup) {
+        const char *name = NULL;
+        err = DMGetLabelName(dmMesh, iGroup, &name);CPPUNIT_ASSERT(!err);
+
+        PetscInt numPointsE, numPoints;
+        err = DMGetStratumSize(dmOrig, name, 1, &numPointsE);CPPUNIT_ASSERT(!err);
+        err = DMGetStratumSize(dmMesh, name, 1, &numPoints);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(numPointsE, numPoints);
+    } // for
+
+    // Check element centroids
+    PylithScalar coordsCheckOrig = 0.0;
+    PylithScalar coordsCheckReorder = 0.0;
+    const PetscDM dms[2] = { dmOrig, dmMesh };
+    PylithScalar* coordsCheck[2] = { &coordsCheckOrig, &coordsCheckReorder };
+    for (int iDM = 0; iDM < 2; ++iDM) {
+        Stratum cellsStratum(dms[iDM], Stratum::HEIGHT, 0);
+        const PetscInt cStart = cellsStratum.begin();
+        const PetscInt cEnd = cellsStratum.end();
+        pylith::topology::CoordsVisitor coordsVisitor(dms[iDM]);
+        for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+            PetscScalar* coordsCell = NULL;
+            PetscInt coordsSize = 0;
+            PylithScalar value = 0.0;
+            coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+            for (int i = 0; i < coordsSize; ++i) {
+                value += coordsCell[i];
+            } // for
+            *coordsCheck[iDM] += value*value;
+            coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+        } // for
+    } // for
+    const PylithScalar tolerance = 1.0e-6;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(coordsCheckOrig, coordsCheckReorder, tolerance*coordsCheckOrig);
+
+    // Verify cells for each material are consecutive and cohesive cells follow all other cells.
+    PetscDMLabel dmLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::cells_label_name, &dmLabel);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(dmLabel);
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMLabelGetValueIS(dmLabel, &valuesIS);CPPUNIT_ASSERT(!err);
+    err = ISGetLocalSize(valuesIS, &numValues);CPPUNIT_ASSERT(!err);
+    err = ISGetIndices(valuesIS, &values);CPPUNIT_ASSERT(!err);
+    for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(dmLabel, values[iValue], &pointsIS);CPPUNIT_ASSERT(!err);
+        err = ISGetLocalSize(pointsIS, &numPoints);CPPUNIT_ASSERT(!err);
+        err = ISGetIndices(pointsIS, &points);CPPUNIT_ASSERT(!err);
+        for (PetscInt iPoint = 1; iPoint < numPoints; ++iPoint) {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE("Cells for material are not consecutive.", PetscInt(1), points[iPoint] - points[iPoint-1]);
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);CPPUNIT_ASSERT(!err);
+        err = ISDestroy(&pointsIS);CPPUNIT_ASSERT(!err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);CPPUNIT_ASSERT(!err);
+    err = ISDestroy(&valuesIS);CPPUNIT_ASSERT(!err);
+
+    bool foundCohesive = false;
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        const bool isCohesive = MeshOps::isCohesiveCell(dmMesh, cell);
+        CPPUNIT_ASSERT_MESSAGE("Found non-cohesive cell after cohesive cell.", !foundCohesive || isCohesive);
+        foundCohesive = isCohesive;
+    } // for
+
+    PYLITH_METHOD_END;
+} // testReorder
+
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestSpaceFillingCurve::_initialize() {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
+
+    delete _mesh;_mesh = new Mesh;CPPUNIT_ASSERT(_mesh);
+
+    meshio::MeshIOAscii iohandler;
+    iohandler.setFilename(_data->filename);
+    iohandler.read(_mesh);
+    CPPUNIT_ASSERT(pylith::topology::MeshOps::getNumCells(*_mesh) > 0);
+    CPPUNIT_ASSERT(pylith::topology::MeshOps::getNumVertices(*_mesh) > 0);
+
+    // Adjust topology if necessary.
+    if (_data->faultLabel) {
+        pylith::faults::FaultCohesiveStub fault;
+        fault.setCohesiveLabelValue(100);
+        fault.setSurfaceLabelName(_data->faultLabel);
+        fault.adjustTopology(_mesh);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::topology::TestSpaceFillingCurve_Data::TestSpaceFillingCurve_Data(void) :
+    filename(NULL),
+    faultLabel(NULL) {}
+
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::topology::TestSpaceFillingCurve_Data::~TestSpaceFillingCurve_Data(void) {}
+
+
+// End of file
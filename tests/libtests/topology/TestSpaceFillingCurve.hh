@@ -0,0 +1,110 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/topology/TestSpaceFillingCurve.hh
+ *
+ * @brief C++ TestSpaceFillingCurve object
+ *
+ * C++ unit testing for SpaceFillingCurve.
+ */
+
+#if !defined(pylith_topology_testspacefillingcurve_hh)
+#define pylith_topology_testspacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace topology {
+        class TestSpaceFillingCurve;
+        class TestSpaceFillingCurve_Data;
+    } // topology
+} // pylith
+
+// TestSpaceFillingCurve ---------------------------------------------------------
+class pylith::topology::TestSpaceFillingCurve : public CppUnit::TestFixture
+{ // class TestSpaceFillingCurve
+
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE( TestSpaceFillingCurve );
+
+    CPPUNIT_TEST( testHilbertIndex );
+    CPPUNIT_TEST( testReorder );
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Deallocate testing data.
+    void tearDown(void);
+
+    /// Test _hilbertIndex().
+    void testHilbertIndex(void);
+
+    /// Test reorder().
+    void testReorder(void);
+
+    // PROTECTED MEMBERS ///////////////////////////////////////////////////////
+protected:
+
+    TestSpaceFillingCurve_Data* _data; ///< Data for testing.
+    Mesh* _mesh; ///< Finite-element mesh.
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /// Setup mesh.
+    void _initialize();
+
+}; // class TestSpaceFillingCurve
+
+
+// TestSpaceFillingCurve_Data-----------------------------------------------------------
+class pylith::topology::TestSpaceFillingCurve_Data {
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestSpaceFillingCurve_Data(void);
+
+    /// Destructor
+    ~TestSpaceFillingCurve_Data(void);
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////
+public:
+
+    const char* filename; ///< Name of mesh file.
+    const char* faultLabel; ///< Label for fault (use NULL for no fault).
+
+};  // TestSpaceFillingCurve_Data
+
+
+#endif // pylith_topology_testspacefillingcurve_hh
+
+
+// End of file
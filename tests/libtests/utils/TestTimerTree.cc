@@ -0,0 +1,160 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestTimerTree.hh" // Implementation of class methods
+
+#include "pylith/utils/TimerTree.hh" // USES TimerTree
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::utils::TestTimerTree);
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::utils::TestTimerTree::tearDown(void) {
+    TimerTree::reset();
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test setEnabled() and isEnabled().
+void
+pylith::utils::TestTimerTree::testEnabled(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(!TimerTree::isEnabled());
+    TimerTree::setEnabled(true);
+    CPPUNIT_ASSERT(TimerTree::isEnabled());
+    TimerTree::setEnabled(false);
+    CPPUNIT_ASSERT(!TimerTree::isEnabled());
+
+    PYLITH_METHOD_END;
+} // testEnabled
+
+
+// ----------------------------------------------------------------------
+// Test begin(), end(), and write().
+void
+pylith::utils::TestTimerTree::testTimers(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TimerTree::setEnabled(true);
+    for (int i = 0; i < 3; ++i) {
+        TimerTree::begin("computeLHSResidual");
+        TimerTree::begin("elastic");
+        TimerTree::end();
+        TimerTree::begin("fault");
+        TimerTree::end();
+        TimerTree::end();
+    } // for
+    TimerTree::end(); // Extra end() at top level is ignored.
+    TimerTree::snapshotMemory("after residual");
+
+    const std::string& json = _writeAndRead();
+    CPPUNIT_ASSERT(json.find("\"num_processes\": 1") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("{\"name\": \"computeLHSResidual\", \"count\": {\"min\": 3, \"max\": 3, \"avg\": 3}") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("{\"name\": \"elastic\", \"count\": {\"min\": 3") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("{\"name\": \"fault\", \"count\": {\"min\": 3") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("{\"label\": \"after residual\"") != std::string::npos);
+
+    // Children are nested within parent.
+    CPPUNIT_ASSERT(json.find("computeLHSResidual") < json.find("elastic"));
+    CPPUNIT_ASSERT(json.find("\"children\": [") < json.find("elastic"));
+
+    PYLITH_METHOD_END;
+} // testTimers
+
+
+// ----------------------------------------------------------------------
+// Test timers for events and stages from EventLogger.
+void
+pylith::utils::TestTimerTree::testEventLogger(void) {
+    PYLITH_METHOD_BEGIN;
+
+    EventLogger logger;
+    logger.setClassName("TimerTree test");
+    logger.initialize();
+    const int eventA = logger.registerEvent("event A");
+    const int eventB = logger.registerEvent("event B");
+    const int stage = logger.registerStage("timer stage");
+
+    TimerTree::setEnabled(true);
+    logger.stagePush(stage);
+    logger.eventBegin(eventA);
+    logger.eventBegin(eventB);
+    logger.eventEnd(eventA); // Also stops event B.
+    logger.stagePop();
+
+    const std::string& json = _writeAndRead();
+    CPPUNIT_ASSERT(json.find("{\"name\": \"timer stage\", \"count\": {\"min\": 1") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("{\"name\": \"event A\", \"count\": {\"min\": 1") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("{\"name\": \"event B\", \"count\": {\"min\": 1") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("timer stage") < json.find("event A"));
+    CPPUNIT_ASSERT(json.find("event A") < json.find("event B"));
+    CPPUNIT_ASSERT(json.find("{\"label\": \"timer stage begin\"") != std::string::npos);
+    CPPUNIT_ASSERT(json.find("{\"label\": \"timer stage end\"") != std::string::npos);
+
+    PYLITH_METHOD_END;
+} // testEventLogger
+
+
+// ----------------------------------------------------------------------
+// Test that no timers are recorded when timers are off.
+void
+pylith::utils::TestTimerTree::testDisabled(void) {
+    PYLITH_METHOD_BEGIN;
+
+    TimerTree::setEnabled(true);
+    TimerTree::setEnabled(false);
+    TimerTree::begin("ignored");
+    TimerTree::end();
+    TimerTree::snapshotMemory("ignored");
+
+    const std::string& json = _writeAndRead();
+    CPPUNIT_ASSERT(json.find("ignored") == std::string::npos);
+
+    PYLITH_METHOD_END;
+} // testDisabled
+
+
+// ----------------------------------------------------------------------
+// Write timers to file and read file into string.
+std::string
+pylith::utils::TestTimerTree::_writeAndRead(void) {
+    const char* filename = "timertree.json";
+    TimerTree::write(filename);
+
+    std::ifstream fin(filename);
+    CPPUNIT_ASSERT(fin.is_open() && fin.good());
+    std::ostringstream contents;
+    contents << fin.rdbuf();
+    fin.close();
+
+    return contents.str();
+} // _writeAndRead
+
+
+// End of file
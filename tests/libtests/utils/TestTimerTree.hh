@@ -0,0 +1,85 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University at Buffalo
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2022 University of California, Davis
+//
+// See LICENSE.md for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/utils/TestTimerTree.hh
+ *
+ * @brief C++ TestTimerTree object
+ *
+ * C++ unit testing for TimerTree.
+ */
+
+#if !defined(pylith_utils_testtimertree_hh)
+#define pylith_utils_testtimertree_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string> // USES std::string
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace utils {
+        class TestTimerTree;
+    } // utils
+} // pylith
+
+/// C++ unit testing for TimerTree
+class pylith::utils::TestTimerTree : public CppUnit::TestFixture { // class TestTimerTree
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestTimerTree);
+
+    CPPUNIT_TEST(testEnabled);
+    CPPUNIT_TEST(testTimers);
+    CPPUNIT_TEST(testEventLogger);
+    CPPUNIT_TEST(testDisabled);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS ///////////////////////////////////////////////////////
+public:
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test setEnabled() and isEnabled().
+    void testEnabled(void);
+
+    /// Test begin(), end(), and write().
+    void testTimers(void);
+
+    /// Test timers for events and stages from EventLogger.
+    void testEventLogger(void);
+
+    /// Test that no timers are recorded when timers are off.
+    void testDisabled(void);
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Write timers to file and read file into string.
+     *
+     * @returns Contents of file.
+     */
+    static
+    std::string _writeAndRead(void);
+
+}; // class TestTimerTree
+
+#endif // pylith_utils_testtimertree_hh
+
+// End of file
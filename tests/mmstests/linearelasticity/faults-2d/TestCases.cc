@@ -38,6 +38,15 @@ TEST_CASE("TwoBlocksStatic::TriP1::testJacobianTaylorSeries", "[TwoBlocksStatic]
 TEST_CASE("TwoBlocksStatic::TriP1::testJacobianFiniteDiff", "[TwoBlocksStatic][TriP1][Jacobian finite difference]") {
     pylith::TestFaultKin(pylith::TwoBlocksStatic::TriP1()).testJacobianFiniteDiff();
 }
+TEST_CASE("TwoBlocksStatic::TriP1::testMultigridReuse", "[TwoBlocksStatic][TriP1][multigrid reuse]") {
+    pylith::TestFaultKin(pylith::TwoBlocksStatic::TriP1()).testMultigridReuse();
+}
+TEST_CASE("TwoBlocksStatic::TriP1::testFaultSchurPreconditioner", "[TwoBlocksStatic][TriP1][fault Schur preconditioner]") {
+    pylith::TestFaultKin(pylith::TwoBlocksStatic::TriP1()).testFaultSchurPreconditioner();
+}
+TEST_CASE("TwoBlocksStatic::TriP1::testJacobianPreallocation", "[TwoBlocksStatic][TriP1][Jacobian preallocation]") {
+    pylith::TestFaultKin(pylith::TwoBlocksStatic::TriP1()).testJacobianPreallocation();
+}
 
 // TriP2
 TEST_CASE("TwoBlocksStatic::TriP2::testDiscretization", "[TwoBlocksStatic][TriP2][discretization]") {
@@ -80,6 +89,12 @@ TEST_CASE("TwoBlocksStatic::QuadQ1::testJacobianTaylorSeries", "[TwoBlocksStatic
 TEST_CASE("TwoBlocksStatic::QuadQ1::testJacobianFiniteDiff", "[TwoBlocksStatic][QuadQ1][Jacobian finite difference]") {
     pylith::TestFaultKin(pylith::TwoBlocksStatic::QuadQ1()).testJacobianFiniteDiff();
 }
+TEST_CASE("TwoBlocksStatic::QuadQ1::testMultigridReuse", "[TwoBlocksStatic][QuadQ1][multigrid reuse]") {
+    pylith::TestFaultKin(pylith::TwoBlocksStatic::QuadQ1()).testMultigridReuse();
+}
+TEST_CASE("TwoBlocksStatic::QuadQ1::testFaultSchurPreconditioner", "[TwoBlocksStatic][QuadQ1][fault Schur preconditioner]") {
+    pylith::TestFaultKin(pylith::TwoBlocksStatic::QuadQ1()).testFaultSchurPreconditioner();
+}
 
 // QuadQ2
 TEST_CASE("TwoBlocksStatic::QuadQ2::testDiscretization", "[TwoBlocksStatic][QuadQ2][discretization]") {
@@ -94,6 +109,9 @@ TEST_CASE("TwoBlocksStatic::QuadQ2::testJacobianTaylorSeries", "[TwoBlocksStatic
 TEST_CASE("TwoBlocksStatic::QuadQ2::testJacobianFiniteDiff", "[TwoBlocksStatic][QuadQ2][Jacobian finite difference]") {
     pylith::TestFaultKin(pylith::TwoBlocksStatic::QuadQ2()).testJacobianFiniteDiff();
 }
+TEST_CASE("TwoBlocksStatic::QuadQ2::testJacobianPreallocation", "[TwoBlocksStatic][QuadQ2][Jacobian preallocation]") {
+    pylith::TestFaultKin(pylith::TwoBlocksStatic::QuadQ2()).testJacobianPreallocation();
+}
 
 // QuadQ3
 TEST_CASE("TwoBlocksStatic::QuadQ3::testDiscretization", "[TwoBlocksStatic][QuadQ3][discretization]") {
@@ -124,6 +142,9 @@ TEST_CASE("ThreeBlocksStatic::TriP1::testJacobianTaylorSeries", "[ThreeBlocksSta
 TEST_CASE("ThreeBlocksStatic::TriP1::testJacobianFiniteDiff", "[ThreeBlocksStatic][TriP1][Jacobian finite difference]") {
     pylith::TestFaultKin(pylith::ThreeBlocksStatic::TriP1()).testJacobianFiniteDiff();
 }
+TEST_CASE("ThreeBlocksStatic::TriP1::testJacobianCache", "[ThreeBlocksStatic][TriP1][Jacobian cache]") {
+    pylith::TestFaultKin(pylith::ThreeBlocksStatic::TriP1()).testJacobianCache();
+}
 
 // TriP2
 TEST_CASE("ThreeBlocksStatic::TriP2::testDiscretization", "[ThreeBlocksStatic][TriP2][discretization]") {
@@ -180,6 +201,9 @@ TEST_CASE("ThreeBlocksStatic::QuadQ2::testJacobianTaylorSeries", "[ThreeBlocksSt
 TEST_CASE("ThreeBlocksStatic::QuadQ2::testJacobianFiniteDiff", "[ThreeBlocksStatic][QuadQ2][Jacobian finite difference]") {
     pylith::TestFaultKin(pylith::ThreeBlocksStatic::QuadQ2()).testJacobianFiniteDiff();
 }
+TEST_CASE("ThreeBlocksStatic::QuadQ2::testJacobianCache", "[ThreeBlocksStatic][QuadQ2][Jacobian cache]") {
+    pylith::TestFaultKin(pylith::ThreeBlocksStatic::QuadQ2()).testJacobianCache();
+}
 
 // QuadQ3
 TEST_CASE("ThreeBlocksStatic::QuadQ3::testDiscretization", "[ThreeBlocksStatic][QuadQ3][discretization]") {
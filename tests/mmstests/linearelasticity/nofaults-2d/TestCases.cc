@@ -38,6 +38,9 @@ TEST_CASE("UniformStrain2D::TriP1::testJacobianTaylorSeries", "[UniformStrain2D]
 TEST_CASE("UniformStrain2D::TriP1::testJacobianFiniteDiff", "[UniformStrain2D][TriP1][Jacobian finite difference]") {
     pylith::TestLinearElasticity(pylith::UniformStrain2D::TriP1()).testJacobianFiniteDiff();
 }
+TEST_CASE("UniformStrain2D::TriP1::testNonlinearFailureRetry", "[UniformStrain2D][TriP1][nonlinear failure retry]") {
+    pylith::TestLinearElasticity(pylith::UniformStrain2D::TriP1()).testNonlinearFailureRetry();
+}
 
 // TriP2
 TEST_CASE("UniformStrain2D::TriP2::testDiscretization", "[UniformStrain2D][TriP2][discretization]") {
@@ -361,6 +364,9 @@ TEST_CASE("PlanePWave2D::TriP2::testDiscretization", "[PlanePWave2D][TriP2][disc
 TEST_CASE("PlanePWave2D::TriP2::testResidual", "[PlanePWave2D][TriP2][residual]") {
     pylith::TestLinearElasticity(pylith::PlanePWave2D::TriP2()).testResidual();
 }
+TEST_CASE("PlanePWave2D::TriP2::testLocalTimeStepping", "[PlanePWave2D][TriP2][local time stepping]") {
+    pylith::TestLinearElasticity(pylith::PlanePWave2D::TriP2()).testLocalTimeStepping();
+}
 
 // TriP3
 TEST_CASE("PlanePWave2D::TriP3::testDiscretization", "[PlanePWave2D][TriP3][discretization]") {
@@ -393,6 +399,9 @@ TEST_CASE("PlanePWave2D::QuadQ2::testDiscretization", "[PlanePWave2D][QuadQ2][di
 TEST_CASE("PlanePWave2D::QuadQ2::testResidual", "[PlanePWave2D][QuadQ2][residual]") {
     pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ2()).testResidual();
 }
+TEST_CASE("PlanePWave2D::QuadQ2::testLocalTimeStepping", "[PlanePWave2D][QuadQ2][local time stepping]") {
+    pylith::TestLinearElasticity(pylith::PlanePWave2D::QuadQ2()).testLocalTimeStepping();
+}
 
 // QuadQ3
 TEST_CASE("PlanePWave2D::QuadQ3::testDiscretization", "[PlanePWave2D][QuadQ3][discretization]") {
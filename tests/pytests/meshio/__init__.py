@@ -1,6 +1,8 @@
 from .TestDataWriter import TestDataWriter
 from .TestDataWriterVTK import TestDataWriterVTK
 from .TestMeshIOAscii import TestMeshIOAscii
+from .TestMeshIOBinary import TestMeshIOBinary
+from .TestMeshIOBox import TestMeshIOBox
 from .TestMeshIOLagrit import TestMeshIOLagrit
 from .TestOutputObserver import TestOutputObserver
 from .TestOutputPhysics import TestOutputPhysics
@@ -36,6 +38,8 @@ def test_classes():
     classes = [
         TestDataWriter,
         TestDataWriterVTK,
+        TestMeshIOBinary,
+        TestMeshIOBox,
         TestOutputObserver,
         TestOutputPhysics,
         TestOutputSoln,
@@ -6,6 +6,7 @@ from .TestMeshImporter import TestMeshImporter
 from .TestMeshRefiner import TestMeshRefiner
 from .TestRefineUniform import TestRefineUniform
 from .TestReverseCuthillMcKee import TestReverseCuthillMcKee
+from .TestSpaceFillingCurve import TestSpaceFillingCurve
 from .TestSubfield import TestSubfield
 
 
@@ -19,6 +20,7 @@ def test_classes():
         TestMeshRefiner,
         TestRefineUniform,
         TestReverseCuthillMcKee,
+        TestSpaceFillingCurve,
         TestSubfield,
     ]
     return classes
@@ -20,7 +20,9 @@
 
 #include "tests/src/MMSTest.hh" // implementation of class methods
 #include "pylith/problems/TimeDependent.hh" // USES TimeDependent
+#include "pylith/problems/FaultSchurPreconditioner.hh" // USES FaultSchurPreconditioner
 #include "pylith/feassemble/IntegrationData.hh" // USES IntegrationData
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/utils/PetscOptions.hh" // USES PetscOptions
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
@@ -35,6 +37,45 @@
 #include "catch2/catch_test_macros.hpp"
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <algorithm> // USES std::min(), std::max()
+
+// ------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace testing {
+        class _MMSTest {
+public:
+
+            /** SNES convergence test that fails the first nonlinear solve.
+             *
+             * @param[in] snes PETSc SNES.
+             * @param[in] it Iteration number.
+             * @param[in] xnorm 2-norm of current iterate.
+             * @param[in] gnorm 2-norm of current step.
+             * @param[in] f 2-norm of function.
+             * @param[out] reason Reason for convergence or divergence.
+             * @param[inout] context Number of times convergence test has been called.
+             * @returns PETSc error code.
+             */
+            static
+            PetscErrorCode failFirstSolve(PetscSNES snes,
+                                          PetscInt it,
+                                          PetscReal xnorm,
+                                          PetscReal gnorm,
+                                          PetscReal f,
+                                          SNESConvergedReason* reason,
+                                          void* context) {
+                PetscInt* numCalls = (PetscInt*)context;
+                if (0 == (*numCalls)++) {
+                    *reason = SNES_DIVERGED_FUNCTION_DOMAIN;
+                    return PETSC_SUCCESS;
+                } // if
+                return SNESConvergedDefault(snes, it, xnorm, gnorm, f, reason, NULL);
+            } // failFirstSolve
+
+        }; // _MMSTest
+    } // testing
+} // pylith
+
 // ------------------------------------------------------------------------------------------------
 // Constructor.
 pylith::testing::MMSTest::MMSTest(void) :
@@ -209,6 +250,444 @@ pylith::testing::MMSTest::testJacobianFiniteDiff(void) {
 } // testJacobianFiniteDiff
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify LHS Jacobian assembled using cached contributions matches full reassembly.
+void
+pylith::testing::MMSTest::testJacobianCache(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+    _initialize();
+
+    // Reassemble the first integrator for every Jacobian so that we have a mix of cached and reassembled
+    // contributions; the others are invalidated when the time step changes like viscoelastic materials.
+    std::vector<pylith::feassemble::Integrator*>& integrators = _problem->_integrators;
+    const size_t numIntegrators = integrators.size();
+    REQUIRE(numIntegrators > 1);
+    integrators[0]->setLHSJacobianTriggers(pylith::feassemble::Integrator::NEW_JACOBIAN_ALWAYS);
+    for (size_t i = 1; i < numIntegrators; ++i) {
+        integrators[i]->setLHSJacobianTriggers(pylith::feassemble::Integrator::NEW_JACOBIAN_TIME_STEP_CHANGE);
+    } // for
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMat jacobianMat = NULL;
+    err = TSGetIJacobian(_problem->getPetscTS(), NULL, &jacobianMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    if (jacobianMat) {
+        err = PetscObjectReference((PetscObject)jacobianMat);PYLITH_CHECK_ERROR(err);
+    } else {
+        err = DMCreateMatrix(_problem->getPetscDM(), &jacobianMat);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    const PylithReal t = _problem->getStartTime();
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+
+    // Build cache, reuse cache, and rebuild cache after the time step changes.
+    const size_t numSteps = 3;
+    const PylithReal dt = _problem->getInitialTimeStep();
+    const PylithReal dtSteps[numSteps] = { dt, dt, 2.0*dt };
+    const bool rebuildCache[numSteps] = { true, false, true };
+    PetscMat jacobianCached = NULL;
+    for (size_t iStep = 0; iStep < numSteps; ++iStep) {
+        const std::vector<size_t> numAssembled = _problem->_numLHSJacobianAssembled;
+
+        _problem->setCacheLHSJacobian(true);
+        _problem->_needNewLHSJacobian = true;
+        _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dtSteps[iStep], 1.0/dtSteps[iStep], _solutionExactVec,
+                                     _solutionDotExactVec);
+        if (!jacobianCached) {
+            err = MatDuplicate(jacobianMat, MAT_COPY_VALUES, &jacobianCached);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = MatCopy(jacobianMat, jacobianCached, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+        } // if/else
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            const size_t numAssembledStep = _problem->_numLHSJacobianAssembled[i] - (numAssembled.size() ? numAssembled[i] : 0);
+            INFO("Step " << iStep << ", integrator " << i);
+            CHECK(numAssembledStep == size_t((0 == i || rebuildCache[iStep]) ? 1 : 0));
+        } // for
+
+        _problem->setCacheLHSJacobian(false);
+        _problem->_needNewLHSJacobian = true;
+        _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dtSteps[iStep], 1.0/dtSteps[iStep], _solutionExactVec,
+                                     _solutionDotExactVec);
+
+        PylithReal normJacobian = 0.0;
+        PylithReal normDiff = 0.0;
+        err = MatNorm(jacobianMat, NORM_FROBENIUS, &normJacobian);PYLITH_CHECK_ERROR(err);
+        err = MatAXPY(jacobianCached, -1.0, jacobianMat, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+        err = MatNorm(jacobianCached, NORM_FROBENIUS, &normDiff);PYLITH_CHECK_ERROR(err);
+        INFO("Step " << iStep << ": |J_cached - J| == " << normDiff << ", |J| == " << normJacobian);
+        REQUIRE(normJacobian > 0.0);
+        REQUIRE_THAT(normDiff / normJacobian, Catch::Matchers::WithinAbs(0.0, _tolerance));
+    } // for
+    err = MatDestroy(&jacobianCached);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testJacobianCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify LHS Jacobian with exact nonzero pattern for interfaces matches Jacobian preallocated by the DM.
+void
+pylith::testing::MMSTest::testJacobianPreallocation(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+    _initialize();
+    assert(_solution);
+    REQUIRE(_solution->hasSubfield("lagrange_multiplier_fault"));
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    PetscMat jacobianDMMat = NULL;
+    err = TSGetIJacobian(_problem->getPetscTS(), &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    REQUIRE(jacobianMat);
+
+    // Separate preconditioning matrix if and only if a DS (bulk or cohesive cells) has preconditioner kernels.
+    bool hasPreconditioner = false;
+    pylith::problems::Problem::_hasJacobianKernels(_problem->getPetscDM(), NULL, &hasPreconditioner);
+    CHECK(hasPreconditioner == (precondMat != jacobianMat));
+    err = DMCreateMatrix(_problem->getPetscDM(), &jacobianDMMat);PYLITH_CHECK_ERROR(err);
+
+    const PylithReal t = _problem->getStartTime();
+    const PylithReal dt = _problem->getInitialTimeStep();
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+    _problem->_needNewLHSJacobian = true;
+    _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dt, 1.0/dt, _solutionExactVec, _solutionDotExactVec);
+    _problem->_needNewLHSJacobian = true;
+    _problem->computeLHSJacobian(jacobianDMMat, jacobianDMMat, t, dt, 1.0/dt, _solutionExactVec, _solutionDotExactVec);
+
+    MatInfo infoExact;
+    MatInfo infoDM;
+    err = MatGetInfo(jacobianMat, MAT_GLOBAL_SUM, &infoExact);PYLITH_CHECK_ERROR(err);
+    err = MatGetInfo(jacobianDMMat, MAT_GLOBAL_SUM, &infoDM);PYLITH_CHECK_ERROR(err);
+    INFO("# nonzeros exact pattern: " << infoExact.nz_used << ", # nonzeros DM pattern: " << infoDM.nz_used);
+    CHECK(infoExact.nz_used < infoDM.nz_used);
+
+    PylithReal normJacobian = 0.0;
+    PylithReal normDiff = 0.0;
+    err = MatNorm(jacobianDMMat, NORM_FROBENIUS, &normJacobian);PYLITH_CHECK_ERROR(err);
+    err = MatAXPY(jacobianDMMat, -1.0, jacobianMat, SUBSET_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+    err = MatNorm(jacobianDMMat, NORM_FROBENIUS, &normDiff);PYLITH_CHECK_ERROR(err);
+    INFO("|J_DM - J| == " << normDiff << ", |J_DM| == " << normJacobian);
+    REQUIRE(normJacobian > 0.0);
+    REQUIRE_THAT(normDiff / normJacobian, Catch::Matchers::WithinAbs(0.0, _tolerance));
+    err = MatDestroy(&jacobianDMMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testJacobianPreallocation
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify time step with failed nonlinear solve is retried with a smaller time step.
+void
+pylith::testing::MMSTest::testNonlinearFailureRetry(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    const int maxNonlinearFailures = 2;
+    _problem->setMaxNonlinearFailures(maxNonlinearFailures);
+    _initialize();
+
+    // Fail the first nonlinear solve, so the time step is retried once.
+    PetscInt numConvergenceChecks = 0;
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = SNESSetConvergenceTest(_problem->getPetscSNES(), _MMSTest::failFirstSolve, &numConvergenceChecks,
+                                 NULL);PYLITH_CHECK_ERROR(err);
+    _problem->solve();
+
+    PetscTS ts = _problem->getPetscTS();
+    PetscInt numFailures = 0;
+    err = TSGetSNESFailures(ts, &numFailures);PYLITH_CHECK_ERROR(err);
+    CHECK(1 == numFailures);
+
+    TSConvergedReason reason = TS_CONVERGED_ITERATING;
+    err = TSGetConvergedReason(ts, &reason);PYLITH_CHECK_ERROR(err);
+    CHECK(reason > 0);
+
+    PylithReal dt = 0.0;
+    err = TSGetTimeStep(ts, &dt);PYLITH_CHECK_ERROR(err);
+    assert(_problem->_normalizer);
+    const PylithReal dtE = _problem->getInitialTimeStep() / _problem->_normalizer->getTimeScale();
+    INFO("Time step after retry " << dt << ", initial time step " << dtE);
+    REQUIRE_THAT(dt, Catch::Matchers::WithinRel(dtE, 1.0e-12));
+
+    PYLITH_METHOD_END;
+} // testNonlinearFailureRetry
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify linear solves with algebraic multigrid reusing interpolation across new LHS Jacobians.
+void
+pylith::testing::MMSTest::testMultigridReuse(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    const int rebuildInterval = 2;
+    _problem->setMultigridRebuildInterval(rebuildInterval);
+    PetscErrorCode err = PETSC_SUCCESS;
+    err = PetscOptionsSetValue(NULL, "-fieldsplit_displacement_pc_type", "gamg");PYLITH_CHECK_ERROR(err);
+    _initialize();
+    assert(_solution);
+    REQUIRE(_solution->hasSubfield("lagrange_multiplier_fault"));
+
+    PetscKSP ksp = NULL;
+    PetscMat jacobianMat = NULL;
+    err = SNESGetKSP(_problem->getPetscSNES(), &ksp);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(_problem->getPetscDM(), &jacobianMat);PYLITH_CHECK_ERROR(err);
+    const PylithReal t = _problem->getStartTime();
+    const PylithReal dt = _problem->getInitialTimeStep();
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+
+    PetscVec rhsVec = NULL;
+    PetscVec solutionVec = NULL;
+    err = VecDuplicate(_solutionExactVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solutionExactVec, &solutionVec);PYLITH_CHECK_ERROR(err);
+
+    // Change the Jacobian values for each solve, so the preconditioner is setup each time, alternating
+    // between rebuilding and reusing the interpolation.
+    const int numSolves = 4;
+    for (int iSolve = 0; iSolve < numSolves; ++iSolve) {
+        _problem->_needNewLHSJacobian = true;
+        _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dt, 1.0/dt, _solutionExactVec, _solutionDotExactVec);
+        err = MatScale(jacobianMat, 1.0 + 0.5*iSolve);PYLITH_CHECK_ERROR(err);
+        const bool reuseE = 0 != iSolve % rebuildInterval;
+        INFO("Solve " << iSolve);
+        CHECK(reuseE == _problem->_reuseMultigridInterpolation);
+
+        err = MatMult(jacobianMat, _solutionExactVec, rhsVec);PYLITH_CHECK_ERROR(err);
+        err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+        err = KSPSetOperators(ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+        err = KSPSolve(ksp, rhsVec, solutionVec);PYLITH_CHECK_ERROR(err);
+
+        KSPConvergedReason reason = KSP_CONVERGED_ITERATING;
+        err = KSPGetConvergedReason(ksp, &reason);PYLITH_CHECK_ERROR(err);
+        CHECK(reason > 0);
+
+        PetscPC pc = NULL;
+        PetscBool isFieldSplit = PETSC_FALSE;
+        err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectTypeCompare((PetscObject)pc, PCFIELDSPLIT, &isFieldSplit);PYLITH_CHECK_ERROR(err);
+        REQUIRE(isFieldSplit);
+        PetscKSP* subksp = NULL;
+        PetscInt numSplits = 0;
+        err = PCFieldSplitGetSubKSP(pc, &numSplits, &subksp);PYLITH_CHECK_ERROR(err);
+        REQUIRE(numSplits > 0);
+        PetscPC subpc = NULL;
+        PetscBool isGAMG = PETSC_FALSE;
+        err = KSPGetPC(subksp[0], &subpc);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectTypeCompare((PetscObject)subpc, PCGAMG, &isGAMG);PYLITH_CHECK_ERROR(err);
+        err = PetscFree(subksp);PYLITH_CHECK_ERROR(err);
+        CHECK(isGAMG);
+
+        PylithReal normSolution = 0.0;
+        PylithReal normDiff = 0.0;
+        err = VecNorm(_solutionExactVec, NORM_2, &normSolution);PYLITH_CHECK_ERROR(err);
+        err = VecAXPY(solutionVec, -1.0, _solutionExactVec);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(solutionVec, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+        INFO("|x - x_E| == " << normDiff << ", |x_E| == " << normSolution);
+        CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, 1.0e-6*std::max(normSolution, 1.0)));
+    } // for
+
+    err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = PetscOptionsClearValue(NULL, "-fieldsplit_displacement_pc_type");PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testMultigridReuse
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify approximate Schur complement for the fault Lagrange multipliers.
+void
+pylith::testing::MMSTest::testFaultSchurPreconditioner(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _initialize();
+    assert(_solution);
+    REQUIRE(_solution->hasSubfield("lagrange_multiplier_fault"));
+    REQUIRE(_problem->_faultSchurPrecond);
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscMat jacobianMat = NULL;
+    err = DMCreateMatrix(_problem->getPetscDM(), &jacobianMat);PYLITH_CHECK_ERROR(err);
+    const PylithReal t = _problem->getStartTime();
+    const PylithReal dt = _problem->getInitialTimeStep();
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+    _problem->_needNewLHSJacobian = true;
+    _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dt, 1.0/dt, _solutionExactVec, _solutionDotExactVec);
+    _problem->_faultSchurPrecond->update(jacobianMat);
+
+    PetscVec rhsVec = NULL;
+    PetscVec solutionVec = NULL;
+    err = VecDuplicate(_solutionExactVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solutionExactVec, &solutionVec);PYLITH_CHECK_ERROR(err);
+    err = MatMult(jacobianMat, _solutionExactVec, rhsVec);PYLITH_CHECK_ERROR(err);
+
+    // Exact solves for the displacement block and the preconditioner of the Schur complement, so
+    // the iterations for the Schur complement reflect the quality of its approximation.
+    const char* options[] = {
+        "-faultschur_ksp_type", "fgmres",
+        "-faultschur_ksp_rtol", "1.0e-12",
+        "-faultschur_pc_type", "fieldsplit",
+        "-faultschur_pc_fieldsplit_type", "schur",
+        "-faultschur_pc_fieldsplit_schur_factorization_type", "full",
+        "-faultschur_fieldsplit_lagrange_multiplier_fault_mat_schur_complement_ainv_type", "blockdiag",
+        "-faultschur_fieldsplit_displacement_ksp_type", "preonly",
+        "-faultschur_fieldsplit_displacement_pc_type", "lu",
+        "-faultschur_fieldsplit_lagrange_multiplier_fault_ksp_type", "gmres",
+        "-faultschur_fieldsplit_lagrange_multiplier_fault_ksp_rtol", "1.0e-10",
+        "-faultschur_fieldsplit_lagrange_multiplier_fault_pc_type", "lu",
+    };
+    const size_t numOptions = sizeof(options) / sizeof(const char*) / 2;
+    for (size_t i = 0; i < numOptions; ++i) {
+        err = PetscOptionsSetValue(NULL, options[2*i], options[2*i+1]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    const int numCases = 2;
+    const PCFieldSplitSchurPreType preTypes[numCases] = { PC_FIELDSPLIT_SCHUR_PRE_USER, PC_FIELDSPLIT_SCHUR_PRE_SELFP };
+    PetscInt numIterations[numCases] = { 0, 0 };
+    for (int iCase = 0; iCase < numCases; ++iCase) {
+        PetscKSP ksp = NULL;
+        err = KSPCreate(PetscObjectComm((PetscObject)jacobianMat), &ksp);PYLITH_CHECK_ERROR(err);
+        err = KSPSetOptionsPrefix(ksp, "faultschur_");PYLITH_CHECK_ERROR(err);
+        err = KSPSetDM(ksp, _problem->getPetscDM());PYLITH_CHECK_ERROR(err);
+        err = KSPSetDMActive(ksp, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+        err = KSPSetOperators(ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+        err = KSPSetFromOptions(ksp);PYLITH_CHECK_ERROR(err);
+
+        PetscPC pc = NULL;
+        err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+        const PetscMat preMat = (PC_FIELDSPLIT_SCHUR_PRE_USER == preTypes[iCase]) ? _problem->_faultSchurPrecond->getMatrix() : NULL;
+        err = PCFieldSplitSetSchurPre(pc, preTypes[iCase], preMat);PYLITH_CHECK_ERROR(err);
+
+        err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+        err = KSPSolve(ksp, rhsVec, solutionVec);PYLITH_CHECK_ERROR(err);
+        KSPConvergedReason reason = KSP_CONVERGED_ITERATING;
+        err = KSPGetConvergedReason(ksp, &reason);PYLITH_CHECK_ERROR(err);
+        INFO("Schur complement preconditioner " << PCFieldSplitSchurPreTypes[preTypes[iCase]]);
+        CHECK(reason > 0);
+
+        PetscKSP* subksp = NULL;
+        PetscInt numSplits = 0;
+        err = PCFieldSplitSchurGetSubKSP(pc, &numSplits, &subksp);PYLITH_CHECK_ERROR(err);
+        REQUIRE(2 == numSplits);
+        err = KSPGetTotalIterations(subksp[1], &numIterations[iCase]);PYLITH_CHECK_ERROR(err);
+        err = PetscFree(subksp);PYLITH_CHECK_ERROR(err);
+
+        PylithReal normSolution = 0.0;
+        PylithReal normDiff = 0.0;
+        err = VecNorm(_solutionExactVec, NORM_2, &normSolution);PYLITH_CHECK_ERROR(err);
+        err = VecAXPY(solutionVec, -1.0, _solutionExactVec);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(solutionVec, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+        INFO("|x - x_E| == " << normDiff << ", |x_E| == " << normSolution);
+        CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, 1.0e-6*std::max(normSolution, 1.0)));
+
+        err = KSPDestroy(&ksp);PYLITH_CHECK_ERROR(err);
+    } // for
+    INFO("Fault Schur complement iterations: user=" << numIterations[0] << ", selfp=" << numIterations[1]);
+    CHECK(numIterations[0] < numIterations[1]);
+
+    for (size_t i = 0; i < numOptions; ++i) {
+        err = PetscOptionsClearValue(NULL, options[2*i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // testFaultSchurPreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify multirate local time stepping.
+void
+pylith::testing::MMSTest::testLocalTimeStepping(void) {
+    PYLITH_METHOD_BEGIN;
+    assert(_problem);
+
+    _problem->setLocalTimeStepping(true);
+    _initialize();
+    REQUIRE(size_t(pylith::problems::TimeDependent::NUM_SPLITS) == _problem->_splitDofs.size());
+
+    PetscErrorCode err = PETSC_SUCCESS;
+    PetscTS ts = _problem->getPetscTS();
+    const PylithReal t = _problem->getStartTime();
+    err = DMComputeExactSolution(_problem->getPetscDM(), t, _solutionExactVec, _solutionDotExactVec);PYLITH_CHECK_ERROR(err);
+    PylithReal dt = 0.0;
+    err = TSGetTimeStep(ts, &dt);PYLITH_CHECK_ERROR(err);
+    dt = std::min(dt, 0.25*_problem->_dtStableLocalTimeStepping);
+    err = TSSetTimeStep(ts, dt);PYLITH_CHECK_ERROR(err);
+
+    // Residual for each split matches residual without splits.
+    PetscVec residualVec = NULL;
+    err = VecDuplicate(_solutionExactVec, &residualVec);PYLITH_CHECK_ERROR(err);
+    _problem->computeRHSResidual(residualVec, t, dt, _solutionExactVec);
+    PetscInt numDofs = 0;
+    err = VecGetLocalSize(residualVec, &numDofs);PYLITH_CHECK_ERROR(err);
+    PetscInt numSplitDofs = 0;
+    for (int iSplit = 0; iSplit < pylith::problems::TimeDependent::NUM_SPLITS; ++iSplit) {
+        PetscIS splitIS = _problem->_splitDofs[iSplit];
+        PetscInt splitSize = 0;
+        err = ISGetLocalSize(splitIS, &splitSize);PYLITH_CHECK_ERROR(err);
+        numSplitDofs += splitSize;
+
+        PetscVec residualSplitE = NULL, residualSplit = NULL;
+        err = VecGetSubVector(residualVec, splitIS, &residualSplitE);PYLITH_CHECK_ERROR(err);
+        err = VecDuplicate(residualSplitE, &residualSplit);PYLITH_CHECK_ERROR(err);
+        _problem->_computeRHSResidualSplit(pylith::problems::TimeDependent::RHSSplitEnum(iSplit), t, _solutionExactVec,
+                                           residualSplit);
+
+        PylithReal normResidual = 0.0, normDiff = 0.0;
+        err = VecNorm(residualSplitE, NORM_2, &normResidual);PYLITH_CHECK_ERROR(err);
+        err = VecAXPY(residualSplit, -1.0, residualSplitE);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(residualSplit, NORM_2, &normDiff);PYLITH_CHECK_ERROR(err);
+        err = VecRestoreSubVector(residualVec, splitIS, &residualSplitE);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&residualSplit);PYLITH_CHECK_ERROR(err);
+
+        INFO("Split " << iSplit << ": |G_split - G| == " << normDiff << ", |G| == " << normResidual);
+        CHECK_THAT(normDiff, Catch::Matchers::WithinAbs(0.0, _tolerance*std::max(normResidual, 1.0)));
+    } // for
+    CHECK(numDofs == numSplitDofs);
+    err = VecDestroy(&residualVec);PYLITH_CHECK_ERROR(err);
+
+    // Advance from exact solution over the same time interval with 1, 2, and 4 time steps. For a
+    // second order time stepper, the difference between successive solutions decreases by a factor of 4.
+    const int numRefinements = 3;
+    PetscVec solutionVecs[numRefinements];
+    for (int iRefine = 0, numSteps = 1; iRefine < numRefinements; ++iRefine, numSteps *= 2) {
+        err = VecDuplicate(_solutionExactVec, &solutionVecs[iRefine]);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(_solutionExactVec, solutionVecs[iRefine]);PYLITH_CHECK_ERROR(err);
+        err = TSSetSolution(ts, solutionVecs[iRefine]);PYLITH_CHECK_ERROR(err);
+        err = TSSetTime(ts, t);PYLITH_CHECK_ERROR(err);
+        err = TSSetStepNumber(ts, 0);PYLITH_CHECK_ERROR(err);
+        err = TSSetMaxSteps(ts, numSteps);PYLITH_CHECK_ERROR(err);
+        err = TSSetTimeStep(ts, dt / numSteps);PYLITH_CHECK_ERROR(err);
+        for (int iStep = 0; iStep < numSteps; ++iStep) {
+            err = TSStep(ts);PYLITH_CHECK_ERROR(err);
+        } // for
+        TSConvergedReason reason = TS_CONVERGED_ITERATING;
+        err = TSGetConvergedReason(ts, &reason);PYLITH_CHECK_ERROR(err);
+        INFO("Number of time steps " << numSteps);
+        REQUIRE(reason >= 0);
+    } // for
+
+    PylithReal normDiff[numRefinements-1];
+    for (int iRefine = 0; iRefine < numRefinements-1; ++iRefine) {
+        err = VecAXPY(solutionVecs[iRefine], -1.0, solutionVecs[iRefine+1]);PYLITH_CHECK_ERROR(err);
+        err = VecNorm(solutionVecs[iRefine], NORM_2, &normDiff[iRefine]);PYLITH_CHECK_ERROR(err);
+    } // for
+    for (int iRefine = 0; iRefine < numRefinements; ++iRefine) {
+        err = VecDestroy(&solutionVecs[iRefine]);PYLITH_CHECK_ERROR(err);
+    } // for
+    INFO("Differences in solution: " << normDiff[0] << ", " << normDiff[1]);
+    REQUIRE(normDiff[1] > 0.0);
+    CHECK(normDiff[0] / normDiff[1] > 3.0);
+
+    PYLITH_METHOD_END;
+} // testLocalTimeStepping
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize objects for test.
 void
@@ -225,8 +704,9 @@ pylith::testing::MMSTest::_initialize(void) {
     TSSetUp(_problem->getPetscTS());
     _setExactSolution();
 
+    // The multirate time stepper only uses the RHS function, so we do not add the LHS residual.
     PetscErrorCode err = PETSC_SUCCESS;
-    if (_problem->getFormulation() == pylith::problems::Physics::DYNAMIC) {
+    if ((_problem->getFormulation() == pylith::problems::Physics::DYNAMIC) && !_problem->_useLocalTimeStepping) {
         err = TSSetIFunction(_problem->getPetscTS(), NULL, pylith::problems::TimeDependent::computeLHSResidual,
                              (void*)_problem);PYLITH_CHECK_ERROR(err);
     } // if
@@ -72,6 +72,47 @@ public:
      */
     void testJacobianFiniteDiff(void);
 
+    /** Verify LHS Jacobian assembled using cached contributions matches full reassembly.
+     *
+     * One integrator is reassembled for every Jacobian, and the others are cached and invalidated
+     * when the time step changes, like viscoelastic materials.
+     */
+    void testJacobianCache(void);
+
+    /** Verify LHS Jacobian with exact nonzero pattern for interfaces matches Jacobian preallocated by the DM.
+     *
+     * The exact nonzero pattern omits the zero blocks between the two sides of an interface, so it has
+     * fewer nonzeros than the DMPlex preallocation.
+     */
+    void testJacobianPreallocation(void);
+
+    /** Verify time step with failed nonlinear solve is retried with a smaller time step.
+     *
+     * The time step is restored after the retried time step succeeds.
+     */
+    void testNonlinearFailureRetry(void);
+
+    /** Verify multirate local time stepping.
+     *
+     * The residual for each split matches the corresponding degrees of freedom of the residual
+     * without splits, and the multirate time stepper converges at second order in time.
+     */
+    void testLocalTimeStepping(void);
+
+    /** Verify linear solves with algebraic multigrid reusing interpolation across new LHS Jacobians.
+     *
+     * Uses algebraic multigrid for the displacement block of the field split for problems with a
+     * fault, so the reuse flag must reach the preconditioner of a split.
+     */
+    void testMultigridReuse(void);
+
+    /** Verify approximate Schur complement for the fault Lagrange multipliers.
+     *
+     * Solves the Schur complement with GMRES preconditioned by the patch approximation and by
+     * `selfp`, and checks that the patch approximation requires fewer iterations.
+     */
+    void testFaultSchurPreconditioner(void);
+
     // PROTECTED METHODS //////////////////////////////////////////////////////////////////////////
 protected:
 